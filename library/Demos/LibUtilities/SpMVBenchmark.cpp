@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File SpMVBenchmark.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Benchmark of the sparse matrix-vector multiply kernels
+//
+///////////////////////////////////////////////////////////////////////////////
+
+//--------------------------------------------------
+// Measures the throughput of the sparse matrix-vector product for the
+// available sparse storage formats on a matrix read from a Matrix Market
+// file. Matrices of real global operators can be written by running a
+// solver with the solver info GlobalMatrixExport = True.
+//
+// Usage: SpMVBenchmark matrix.mtx [threads] [multiplies]
+//
+// For each storage format and number of threads up to the given maximum
+// the average rate is reported in GFLOP/s, counting two floating point
+// operations per nonzero entry, together with the largest deviation from
+// the result of the CSR format.
+//--------------------------------------------------
+
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cmath>
+
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrix.hpp>
+#include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSellCS.hpp>
+
+using namespace std;
+using namespace Nektar;
+
+typedef NekSparseMatrix<StorageSmvBsr<NekDouble> > BsrMat;
+typedef NekSparseMatrix<StorageSellCS<NekDouble> > SellMat;
+
+// Read a real Matrix Market coordinate file
+void ReadMatrixMarket(const string &filename,
+                      IndexType &rows, IndexType &cols, COOMatType &coo)
+{
+    ifstream mtx(filename.c_str());
+    if (!mtx.good())
+    {
+        cerr << "Unable to open file: " << filename << endl;
+        exit(1);
+    }
+
+    string line;
+    getline(mtx, line);
+    bool symmetric = line.find("symmetric") != string::npos;
+
+    while (getline(mtx, line) && line[0] == '%');
+
+    IndexType nnz, i, j;
+    NekDouble v;
+    istringstream header(line);
+    header >> rows >> cols >> nnz;
+
+    for (IndexType n = 0; n < nnz; ++n)
+    {
+        mtx >> i >> j >> v;
+        coo[make_pair(i-1, j-1)] = v;
+        if (symmetric && i != j)
+        {
+            coo[make_pair(j-1, i-1)] = v;
+        }
+    }
+}
+
+// Average time in seconds of one multiply
+template<typename MatType>
+NekDouble TimeMultiply(MatType &mat, const Array<OneD, NekDouble> &in,
+                       Array<OneD, NekDouble> &out, const int nMult)
+{
+    Timer timer;
+
+    mat.Multiply(in, out);
+
+    timer.Start();
+    for (int n = 0; n < nMult; ++n)
+    {
+        mat.Multiply(in, out);
+    }
+    timer.Stop();
+
+    return timer.TimePerTest(nMult);
+}
+
+NekDouble MaxDifference(const Array<OneD, NekDouble> &a,
+                        const Array<OneD, NekDouble> &b,
+                        const IndexType n)
+{
+    NekDouble diff = 0.0;
+    for (IndexType i = 0; i < n; ++i)
+    {
+        diff = max(diff, fabs(a[i] - b[i]));
+    }
+    return diff;
+}
+
+template<typename MatType>
+void Report(const string &name, MatType &mat,
+            const Array<OneD, NekDouble> &in,
+            const Array<OneD, NekDouble> &ref,
+            const IndexType rows, const IndexType nnz,
+            const int maxThreads, const int nMult)
+{
+    Array<OneD, NekDouble> out(ref.num_elements(), 0.0);
+
+    for (int t = 1; t <= maxThreads; t *= 2)
+    {
+        LibUtilities::ThreadPoolSharedPtr pool(
+            new LibUtilities::ThreadPool(t));
+        mat.SetThreadPool(pool);
+
+        NekDouble time = TimeMultiply(mat, in, out, nMult);
+
+        cout << "  " << name << ", threads = " << t
+             << ": " << 2.0*nnz/time*1.0e-9 << " GFLOP/s"
+             << " (max difference = " << MaxDifference(out, ref, rows) << ")"
+             << endl;
+    }
+    mat.SetThreadPool(LibUtilities::ThreadPoolSharedPtr());
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        cerr << "Usage: SpMVBenchmark matrix.mtx [threads] [multiplies]"
+             << endl;
+        return 1;
+    }
+
+    int maxThreads = argc > 2 ? atoi(argv[2]) : 1;
+    int nMult      = argc > 3 ? atoi(argv[3]) : 100;
+
+    IndexType  rows, cols;
+    COOMatType coo;
+    ReadMatrixMarket(argv[1], rows, cols, coo);
+
+    cout << "Matrix " << argv[1] << ": " << rows << " x " << cols
+         << ", " << coo.size() << " entries" << endl;
+
+    // Vectors are padded so that any block size divides their length
+    const IndexType maxBlk = 4;
+    const IndexType len    = (max(rows, cols)/12 + 1)*12;
+    Array<OneD, NekDouble> in (len, 0.0);
+    Array<OneD, NekDouble> ref(len, 0.0);
+    for (IndexType i = 0; i < cols; ++i)
+    {
+        in[i] = sin(0.1*i) + 1.0;
+    }
+
+    // reference result from the CSR format
+    IndexType nnz;
+    {
+        BCOMatType bco;
+        convertCooToBco(rows, cols, 1, coo, bco);
+        BsrMat csr(MemoryManager<StorageSmvBsr<NekDouble> >::
+                   AllocateSharedPtr(rows, cols, 1, bco));
+        csr.Multiply(in, ref);
+        nnz = csr.GetNumNonZeroEntries();
+    }
+
+    for (IndexType blk = 1; blk <= maxBlk; ++blk)
+    {
+        const IndexType brows = rows/blk + (rows % blk > 0);
+        const IndexType bcols = cols/blk + (cols % blk > 0);
+
+        BCOMatType bco;
+        convertCooToBco(brows, bcols, blk, coo, bco);
+        BsrMat bsr(MemoryManager<StorageSmvBsr<NekDouble> >::
+                   AllocateSharedPtr(brows, bcols, blk, bco));
+
+        stringstream name;
+        name << "SmvBSR " << blk << "x" << blk << " (fill-in "
+             << bsr.GetFillInRatio() << ")";
+        Report(name.str(), bsr, in, ref, rows, nnz, maxThreads, nMult);
+    }
+
+    const int chunks[] = {4, 8, 16, 32};
+    const int scopes[] = {1, 32, 256, 4096};
+    for (int c = 0; c < 4; ++c)
+    {
+        for (int s = 0; s < 4; ++s)
+        {
+            SellMat sell(MemoryManager<StorageSellCS<NekDouble> >::
+                AllocateSharedPtr(rows, cols, chunks[c], scopes[s], coo));
+
+            stringstream name;
+            name << "SELL-" << chunks[c] << "-" << scopes[s]
+                 << " (fill-in " << sell.GetFillInRatio() << ")";
+            Report(name.str(), sell, in, ref, rows, nnz, maxThreads, nMult);
+        }
+    }
+
+    return 0;
+}
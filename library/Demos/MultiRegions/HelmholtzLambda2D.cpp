@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/Communication/Comm.h>
+#include <MultiRegions/ContField2D.h>
+#include <MultiRegions/GlobalLinSys.h>
+#include <SpatialDomains/MeshGraph2D.h>
+
+using namespace Nektar;
+
+// Solves the Helmholtz problem of the session with the constant Lambda, then
+// with twice that constant, Lambda, three times that constant and Lambda
+// again on the same field, as is done when the time step of a solver
+// changes. The solution for twice the constant is compared with that of a
+// newly built system, and the error of the final solution against the exact
+// solution is reported. With the solver info ParametricHelmholtz set to True,
+// at most ParametricHelmholtzSystems systems are kept and a system for a new
+// constant is obtained by changing the least recently used one.
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    MultiRegions::ContField2DSharedPtr Exp, Ref;
+    int     nq, coordim;
+    Array<OneD,NekDouble>  fce;
+    Array<OneD,NekDouble>  xc0,xc1,xc2;
+    StdRegions::ConstFactorMap factors, factors2, factors3;
+
+    if(argc < 2)
+    {
+        fprintf(stderr,"Usage: HelmholtzLambda2D meshfile\n");
+        exit(1);
+    }
+
+    try
+    {
+        //----------------------------------------------
+        // Read in mesh from input file
+        SpatialDomains::MeshGraphSharedPtr graph2D =
+            SpatialDomains::MeshGraph::Read(vSession);
+        //----------------------------------------------
+
+        factors [StdRegions::eFactorLambda] = vSession->GetParameter("Lambda");
+        factors2[StdRegions::eFactorLambda] =
+            2.0 * factors[StdRegions::eFactorLambda];
+        factors3[StdRegions::eFactorLambda] =
+            3.0 * factors[StdRegions::eFactorLambda];
+
+        cout << "Solving 2D Helmholtz for three values of lambda: " << endl;
+        cout << "         Communication: "
+             << vSession->GetComm()->GetType() << endl;
+        cout << "         Solver type  : "
+             << vSession->GetSolverInfo("GlobalSysSoln") << endl;
+        cout << "         Lambda       : "
+             << factors [StdRegions::eFactorLambda] << ", "
+             << factors2[StdRegions::eFactorLambda] << ", "
+             << factors3[StdRegions::eFactorLambda] << endl;
+        cout << endl;
+
+        //----------------------------------------------
+        // Define Expansion
+        Exp = MemoryManager<MultiRegions::ContField2D>::
+            AllocateSharedPtr(vSession,graph2D,vSession->GetVariable(0));
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Set up coordinates of mesh for Forcing function evaluation
+        coordim = Exp->GetCoordim(0);
+        nq      = Exp->GetTotPoints();
+
+        xc0 = Array<OneD,NekDouble>(nq,0.0);
+        xc1 = Array<OneD,NekDouble>(nq,0.0);
+        xc2 = Array<OneD,NekDouble>(nq,0.0);
+
+        switch(coordim)
+        {
+        case 2:
+            Exp->GetCoords(xc0,xc1);
+            break;
+        case 3:
+            Exp->GetCoords(xc0,xc1,xc2);
+            break;
+        default:
+            ASSERTL0(false,"Coordim not valid");
+            break;
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Define forcing function
+        fce = Array<OneD,NekDouble>(nq);
+        LibUtilities::EquationSharedPtr ffunc
+                                    = vSession->GetFunction("Forcing", 0);
+        ffunc->Evaluate(xc0, xc1, xc2, fce);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve for Lambda, twice Lambda, Lambda, three times Lambda and
+        // Lambda again
+        Array<OneD, NekDouble> coeffs (Exp->GetNcoeffs(), 0.0);
+        Array<OneD, NekDouble> coeffs2(Exp->GetNcoeffs(), 0.0);
+        Array<OneD, NekDouble> coeffs3(Exp->GetNcoeffs(), 0.0);
+
+        Exp->HelmSolve(fce, coeffs,  NullFlagList, factors);
+        Exp->HelmSolve(fce, coeffs2, NullFlagList, factors2);
+
+        Vmath::Zero(Exp->GetNcoeffs(), coeffs, 1);
+        Exp->HelmSolve(fce, coeffs,  NullFlagList, factors);
+        Exp->HelmSolve(fce, coeffs3, NullFlagList, factors3);
+
+        Vmath::Zero(Exp->GetNcoeffs(), coeffs, 1);
+        Exp->HelmSolve(fce, coeffs,  NullFlagList, factors);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve for twice Lambda with a new system on a new field. The
+        // systems held by the manager are removed first, since the manager
+        // is shared by all fields.
+        LibUtilities::NekManager<MultiRegions::GlobalLinSysKey,
+                                 MultiRegions::GlobalLinSys>::
+            ClearManager("GlobalLinSys");
+
+        Ref = MemoryManager<MultiRegions::ContField2D>::
+            AllocateSharedPtr(vSession,graph2D,vSession->GetVariable(0));
+
+        Array<OneD, NekDouble> refCoeffs(Ref->GetNcoeffs(), 0.0);
+        Ref->HelmSolve(fce, refCoeffs, NullFlagList, factors2);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Compare the two solutions for twice Lambda
+        Array<OneD, NekDouble> phys2(nq), refPhys(nq);
+        Exp->BwdTrans(coeffs2,   phys2);
+        Ref->BwdTrans(refCoeffs, refPhys);
+        NekDouble vDiff = Exp->Linf(phys2, refPhys);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Error of the final solution against the exact solution
+        LibUtilities::EquationSharedPtr ex_sol
+                                = vSession->GetFunction("ExactSolution",0);
+        Exp->BwdTrans(coeffs, Exp->UpdatePhys());
+
+        ex_sol->Evaluate(xc0, xc1, xc2, fce);
+
+        NekDouble vLinfError = Exp->Linf(Exp->GetPhys(), fce);
+        NekDouble vL2Error   = Exp->L2  (Exp->GetPhys(), fce);
+
+        if (vSession->GetComm()->GetRank() == 0)
+        {
+            cout << "L infinity error (variable u): " << vLinfError << endl;
+            cout << "L 2 error (variable u):        " << vL2Error << endl;
+            cout << "L infinity error (variable diff): " << vDiff << endl;
+        }
+        //----------------------------------------------
+    }
+    catch (const std::runtime_error&)
+    {
+        cout << "Caught an error" << endl;
+        return 1;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <boost/lexical_cast.hpp>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/Communication/Comm.h>
+#include <MultiRegions/ContField2D.h>
+#include <SpatialDomains/MeshGraph2D.h>
+
+using namespace Nektar;
+
+// Solves the Helmholtz problem of the session for several right-hand sides,
+// once field by field and once through a single MultiHelmSolve call, and
+// reports the largest difference between the two sets of solutions.
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    MultiRegions::ContField2DSharedPtr Exp, Fce;
+    int     i, nq, coordim;
+    const int nRhs = 3;
+    Array<OneD,NekDouble>  fce;
+    Array<OneD,NekDouble>  xc0,xc1,xc2;
+    StdRegions::ConstFactorMap factors;
+
+    if(argc < 2)
+    {
+        fprintf(stderr,"Usage: HelmholtzMultiRHS2D meshfile\n");
+        exit(1);
+    }
+
+    try
+    {
+        //----------------------------------------------
+        // Read in mesh from input file
+        SpatialDomains::MeshGraphSharedPtr graph2D =
+            SpatialDomains::MeshGraph::Read(vSession);
+        //----------------------------------------------
+
+        factors[StdRegions::eFactorLambda] = vSession->GetParameter("Lambda");
+
+        cout << "Solving 2D Helmholtz for " << nRhs << " right-hand sides: "
+             << endl;
+        cout << "         Communication: "
+             << vSession->GetComm()->GetType() << endl;
+        cout << "         Solver type  : "
+             << vSession->GetSolverInfo("GlobalSysSoln") << endl;
+        cout << "         Lambda       : "
+             << factors[StdRegions::eFactorLambda] << endl;
+        cout << endl;
+
+        //----------------------------------------------
+        // Define Expansion. The copies share the local to global map of
+        // the first field, so that MultiHelmSolve can use a single system.
+        Exp = MemoryManager<MultiRegions::ContField2D>::
+            AllocateSharedPtr(vSession,graph2D,vSession->GetVariable(0));
+
+        Array<OneD, MultiRegions::ExpListSharedPtr> fields(nRhs);
+        for (i = 0; i < nRhs; ++i)
+        {
+            fields[i] = MemoryManager<MultiRegions::ContField2D>::
+                AllocateSharedPtr(*Exp);
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Set up coordinates of mesh for Forcing function evaluation
+        coordim = Exp->GetCoordim(0);
+        nq      = Exp->GetTotPoints();
+
+        xc0 = Array<OneD,NekDouble>(nq,0.0);
+        xc1 = Array<OneD,NekDouble>(nq,0.0);
+        xc2 = Array<OneD,NekDouble>(nq,0.0);
+
+        switch(coordim)
+        {
+        case 2:
+            Exp->GetCoords(xc0,xc1);
+            break;
+        case 3:
+            Exp->GetCoords(xc0,xc1,xc2);
+            break;
+        default:
+            ASSERTL0(false,"Coordim not valid");
+            break;
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Define the forcing functions. The first is that of the session;
+        // the others are read from the functions Forcing1, Forcing2, ...
+        // The session gives them different spectral content, so that the
+        // right-hand sides converge after different numbers of iterations
+        // and leave the active set of the multiple solve one by one.
+        Array<OneD, Array<OneD, NekDouble> > rhs(nRhs);
+        for (i = 0; i < nRhs; ++i)
+        {
+            std::string fname = "Forcing";
+            if (i > 0)
+            {
+                fname += boost::lexical_cast<std::string>(i);
+            }
+            ASSERTL0(vSession->DefinesFunction(fname),
+                     "Session does not define function " + fname);
+
+            rhs[i] = Array<OneD, NekDouble>(nq);
+            LibUtilities::EquationSharedPtr ffunc
+                                        = vSession->GetFunction(fname, 0);
+            ffunc->Evaluate(xc0, xc1, xc2, rhs[i]);
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve each right-hand side in turn
+        Array<OneD, Array<OneD, NekDouble> > seqCoeffs(nRhs);
+        for (i = 0; i < nRhs; ++i)
+        {
+            seqCoeffs[i] = Array<OneD, NekDouble>(Exp->GetNcoeffs(), 0.0);
+            fields[i]->HelmSolve(rhs[i], seqCoeffs[i], NullFlagList, factors);
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve all right-hand sides together
+        Array<OneD, Array<OneD, NekDouble> > mulCoeffs(nRhs);
+        for (i = 0; i < nRhs; ++i)
+        {
+            mulCoeffs[i] = Array<OneD, NekDouble>(Exp->GetNcoeffs(), 0.0);
+        }
+        Exp->MultiHelmSolve(fields, rhs, mulCoeffs, NullFlagList, factors);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Compare the two sets of solutions at the quadrature points
+        Array<OneD, NekDouble> seqPhys(nq), mulPhys(nq);
+        NekDouble vDiff = 0.0;
+        for (i = 0; i < nRhs; ++i)
+        {
+            Exp->BwdTrans(seqCoeffs[i], seqPhys);
+            Exp->BwdTrans(mulCoeffs[i], mulPhys);
+            vDiff = max(vDiff, Exp->Linf(seqPhys, mulPhys));
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Error of the first right-hand side against the exact solution
+        LibUtilities::EquationSharedPtr ex_sol
+                                = vSession->GetFunction("ExactSolution",0);
+        Exp->BwdTrans(mulCoeffs[0], Exp->UpdatePhys());
+
+        fce = Array<OneD,NekDouble>(nq);
+        ex_sol->Evaluate(xc0, xc1, xc2, fce);
+
+        NekDouble vLinfError = Exp->Linf(Exp->GetPhys(), fce);
+        NekDouble vL2Error   = Exp->L2  (Exp->GetPhys(), fce);
+
+        if (vSession->GetComm()->GetRank() == 0)
+        {
+            cout << "L infinity error (variable u): " << vLinfError << endl;
+            cout << "L 2 error (variable u):        " << vL2Error << endl;
+            cout << "L infinity error (variable diff): " << vDiff << endl;
+        }
+        //----------------------------------------------
+    }
+    catch (const std::runtime_error&)
+    {
+        cout << "Caught an error" << endl;
+        return 1;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 2D CG with P=7, all BCs, iterative sc, p-multigrid, par(3), single system changed to each new lambda, against a new system</description>
+    <executable>HelmholtzLambda2D</executable>
+    <parameters>-v -I GlobalSysSoln=IterativeStaticCond -I Preconditioner=PMultigrid -I ParametricHelmholtz=True -P ParametricHelmholtzSystems=1 Helmholtz2D_P7_AllBCs.xml</parameters>
+    <processes>3</processes>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_AllBCs.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-7">0.00888037</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-6">0.0101781</value>
+            <value variable="diff" tolerance="1e-8">0</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^Updated static condensation system for lambda = (\S+)</regex>
+            <matches>
+                <match>
+                    <field tolerance="1e-12">2</field>
+                </match>
+                <match>
+                    <field tolerance="1e-12">1</field>
+                </match>
+                <match>
+                    <field tolerance="1e-12">3</field>
+                </match>
+                <match>
+                    <field tolerance="1e-12">1</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
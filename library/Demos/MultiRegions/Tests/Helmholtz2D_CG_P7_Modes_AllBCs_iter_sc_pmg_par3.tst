@@ -0,0 +1,29 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 2D CG with P=7, all BCs, iterative sc, p-multigrid, par(3)</description>
+    <executable>Helmholtz2D</executable>
+    <parameters>-v -I GlobalSysSoln=IterativeStaticCond -I Preconditioner=PMultigrid Helmholtz2D_P7_AllBCs.xml</parameters>
+    <processes>3</processes>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_AllBCs.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-7">0.00888037</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-6">0.0101781</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^CG iterations made = (\d+) using tolerance.*</regex>
+            <matches>
+                <match>
+                    <field tolerance="7">8</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
+
+
@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 2D CG with P=7, iterative sc, multiple independent RHS against sequential solves, par(3)</description>
+    <executable>HelmholtzMultiRHS2D</executable>
+    <parameters>-I GlobalSysSoln=IterativeStaticCond Helmholtz2D_P7.xml</parameters>
+    <processes>3</processes>
+    <files>
+        <file description="Session File">Helmholtz2D_P7.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-7">0.00888036</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-6">0.0101781</value>
+            <value variable="diff" tolerance="1e-8">0</value>
+        </metric>
+    </metrics>
+</test>
+
@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 3D CG for deformed Prism, compressed mesh sections with curved edges and face, par(2)</description>
+    <executable>Helmholtz3D</executable>
+    <parameters>-I GlobalSysSoln=IterativeStaticCond Helmholtz3D_Prism_Deformed_compressed.xml</parameters>
+    <processes>2</processes>
+    <files>
+        <file description="Session File">Helmholtz3D_Prism_Deformed_compressed.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-8">1.61137e-06</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-8">8.98093e-06</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File CompressData.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Routines for compressing and encoding data
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/CompressData.h>
+
+#include <boost/archive/iterators/base64_from_binary.hpp>
+#include <boost/archive/iterators/binary_from_base64.hpp>
+#include <boost/archive/iterators/dataflow_exception.hpp>
+#include <boost/archive/iterators/transform_width.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+#include <tinyxml/tinyxml.h>
+
+#include "zlib.h"
+
+// Buffer size for zlib compression/decompression
+#define CHUNK 16384
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        namespace CompressData
+        {
+            std::string GetCompressString()
+            {
+                const int one = 1;
+                return *reinterpret_cast<const char*>(&one) == 1 ?
+                    "B64Z-LittleEndian" : "B64Z-BigEndian";
+            }
+
+
+            /**
+             * The compressed stream is padded with zeros to a multiple of
+             * three bytes so that the base64 text needs no padding
+             * characters; the padding is ignored by zlib when decoding.
+             */
+            void ZlibEncodeToBase64Str(const char  *in,
+                                       size_t       nbytes,
+                                       std::string &out)
+            {
+                int ret;
+                z_stream strm;
+                std::string buffer(CHUNK, '\0');
+                std::string compressed;
+
+                strm.zalloc = Z_NULL;
+                strm.zfree  = Z_NULL;
+                strm.opaque = Z_NULL;
+                ret = deflateInit(&strm, Z_DEFAULT_COMPRESSION);
+                ASSERTL0(ret == Z_OK, "Error initializing zlib.");
+
+                strm.avail_in = nbytes;
+                strm.next_in  = (unsigned char*)(in);
+
+                do {
+                    strm.avail_out = CHUNK;
+                    strm.next_out  = (unsigned char*)(&buffer[0]);
+
+                    ret = deflate(&strm, Z_FINISH);
+                    ASSERTL0(ret != Z_STREAM_ERROR, "Zlib stream error");
+
+                    compressed.append(buffer, 0, CHUNK - strm.avail_out);
+                } while (strm.avail_out == 0);
+
+                ASSERTL0(strm.avail_in == 0, "Not all input was used.");
+                ASSERTL0(ret == Z_STREAM_END, "Stream not finished");
+                (void)deflateEnd(&strm);
+
+                compressed.append((3 - compressed.size() % 3) % 3, '\0');
+
+                typedef boost::archive::iterators::base64_from_binary<
+                    boost::archive::iterators::transform_width<
+                        std::string::const_iterator, 6, 8> > base64_t;
+                out.assign(base64_t(compressed.begin()),
+                           base64_t(compressed.end()));
+            }
+
+
+            void ZlibDecodeFromBase64Str(const std::string &in,
+                                         std::string       &out)
+            {
+                std::string text(in);
+                text.erase(std::remove_if(text.begin(), text.end(),
+                                          ::isspace), text.end());
+
+                typedef boost::archive::iterators::transform_width<
+                    boost::archive::iterators::binary_from_base64<
+                        std::string::const_iterator>, 8, 6> binary_t;
+                std::string compressed;
+                try
+                {
+                    compressed.assign(binary_t(text.begin()),
+                                      binary_t(text.end()));
+                }
+                catch (boost::archive::iterators::dataflow_exception &e)
+                {
+                    NEKERROR(ErrorUtil::efatal,
+                             (std::string("Failed to decode base64 data: ")
+                              + e.what()).c_str());
+                }
+
+                int ret;
+                z_stream strm;
+                std::string buffer(CHUNK, '\0');
+
+                strm.zalloc   = Z_NULL;
+                strm.zfree    = Z_NULL;
+                strm.opaque   = Z_NULL;
+                strm.avail_in = 0;
+                strm.next_in  = Z_NULL;
+                ret = inflateInit(&strm);
+                ASSERTL0(ret == Z_OK, "Error initializing zlib decompression.");
+
+                strm.avail_in = compressed.size();
+                strm.next_in  = (unsigned char*)(&compressed[0]);
+
+                out.clear();
+                do {
+                    strm.avail_out = CHUNK;
+                    strm.next_out  = (unsigned char*)(&buffer[0]);
+
+                    ret = inflate(&strm, Z_NO_FLUSH);
+                    if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR ||
+                        ret == Z_MEM_ERROR || ret == Z_STREAM_ERROR)
+                    {
+                        break;
+                    }
+
+                    out.append(buffer, 0, CHUNK - strm.avail_out);
+                } while (ret != Z_STREAM_END && strm.avail_out == 0);
+
+                (void)inflateEnd(&strm);
+
+                // A checksum mismatch is reported as Z_DATA_ERROR.
+                ASSERTL0(ret == Z_STREAM_END,
+                         "Failed to decompress data: corrupt or truncated.");
+            }
+
+
+            /**
+             * Mesh sections written in compressed form carry the attribute
+             * COMPRESSED, whose value identifies the encoding and the byte
+             * order of the writing machine. Only data matching the byte
+             * order of this machine can be read.
+             */
+            bool IsCompressed(TiXmlElement *section)
+            {
+                const char *compressed = section->Attribute("COMPRESSED");
+                if (!compressed)
+                {
+                    return false;
+                }
+
+                ASSERTL0(std::string(compressed) == GetCompressString(),
+                         (std::string("Compressed data uses unsupported "
+                                      "encoding: ") + compressed).c_str());
+                return true;
+            }
+
+
+            bool GetCompressedText(TiXmlElement      *section,
+                                   const std::string &tag,
+                                   std::string       &encoded)
+            {
+                encoded.clear();
+
+                TiXmlElement *child = section->FirstChildElement(tag.c_str());
+                if (!child)
+                {
+                    return false;
+                }
+
+                for (TiXmlNode *node = child->FirstChild(); node;
+                     node = node->NextSibling())
+                {
+                    if (node->Type() == TiXmlNode::TEXT)
+                    {
+                        encoded += node->ToText()->ValueStr();
+                    }
+                }
+                return true;
+            }
+        }
+    }
+}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File CompressData.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Routines for compressing and encoding data
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_COMPRESSDATA_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_COMPRESSDATA_H
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+
+#include <string>
+#include <vector>
+
+class TiXmlElement;
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        /**
+         * Helpers to store arrays of plain data in XML files as base64 text
+         * of their zlib-compressed binary representation. The zlib stream
+         * carries an Adler-32 checksum of the data, which is verified when
+         * decoding.
+         */
+        namespace CompressData
+        {
+            /// Value of the COMPRESSED attribute identifying data written
+            /// by this machine, e.g. "B64Z-LittleEndian".
+            LIB_UTILITIES_EXPORT std::string GetCompressString();
+
+            /// Compress @a nbytes bytes at @a in and encode them in base64.
+            LIB_UTILITIES_EXPORT void ZlibEncodeToBase64Str(
+                const char  *in,
+                size_t       nbytes,
+                std::string &out);
+
+            /// Decode and decompress a string produced by
+            /// ZlibEncodeToBase64Str. Whitespace in @a in is ignored.
+            LIB_UTILITIES_EXPORT void ZlibDecodeFromBase64Str(
+                const std::string &in,
+                std::string       &out);
+
+            template<typename T>
+            void ZlibEncodeToBase64Str(const std::vector<T> &in,
+                                       std::string          &out)
+            {
+                ZlibEncodeToBase64Str(
+                    in.empty() ? NULL : reinterpret_cast<const char*>(&in[0]),
+                    in.size() * sizeof(T), out);
+            }
+
+            template<typename T>
+            void ZlibDecodeFromBase64Str(const std::string &in,
+                                         std::vector<T>    &out)
+            {
+                std::string bytes;
+                ZlibDecodeFromBase64Str(in, bytes);
+
+                ASSERTL0(bytes.size() % sizeof(T) == 0,
+                         "Decoded data is not a whole number of values.");
+
+                out.resize(bytes.size() / sizeof(T));
+                if (!out.empty())
+                {
+                    std::copy(bytes.begin(), bytes.end(),
+                              reinterpret_cast<char*>(&out[0]));
+                }
+            }
+
+            /// Check whether an XML section holds compressed data written
+            /// with the byte order of this machine.
+            LIB_UTILITIES_EXPORT bool IsCompressed(TiXmlElement *section);
+
+            /// Collect the encoded text of the child @a tag of @a section.
+            /// Returns false if the section has no such child.
+            LIB_UTILITIES_EXPORT bool GetCompressedText(
+                TiXmlElement      *section,
+                const std::string &tag,
+                std::string       &encoded);
+
+            /// Decode the compressed records stored in the child @a tag of
+            /// @a section, each of @a recordSize values. A missing tag
+            /// yields no records.
+            template<typename T>
+            void ReadCompressedData(TiXmlElement      *section,
+                                    const std::string &tag,
+                                    const int          recordSize,
+                                    std::vector<T>    &data)
+            {
+                data.clear();
+
+                std::string encoded;
+                if (!GetCompressedText(section, tag, encoded))
+                {
+                    return;
+                }
+
+                ZlibDecodeFromBase64Str(encoded, data);
+                ASSERTL0(data.size() % recordSize == 0,
+                         ("Compressed data in " + tag +
+                          " is not a whole number of records.").c_str());
+            }
+        }
+    }
+}
+
+#endif
@@ -47,11 +47,13 @@
 
 #include <tinyxml/tinyxml.h>
 
+#include <LibUtilities/BasicUtils/CompressData.h>
 #include <LibUtilities/BasicUtils/Metis.hpp>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
 #include <LibUtilities/BasicUtils/SessionReader.h>
 #include <LibUtilities/BasicUtils/ShapeType.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/Foundations/Foundations.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/graph/adjacency_list.hpp>
@@ -274,6 +276,95 @@ namespace Nektar
 
 
 
+        /**
+         * Reads the entities stored in compressed form as records of an ID
+         * followed by @a pNumItems items, one tag per entity type.
+         */
+        void MeshPartition::ReadCompressedEntities(
+            TiXmlElement                    *pSection,
+            const std::string               &pTypes,
+            const int                       *pNumItems,
+            std::map<int, MeshEntity>       &pEntities)
+        {
+            std::vector<int> vData;
+            for (int t = 0; t < pTypes.size(); ++t)
+            {
+                const int vRecordSize = pNumItems[t] + 1;
+                CompressData::ReadCompressedData(
+                    pSection, pTypes.substr(t, 1), vRecordSize, vData);
+
+                for (int i = 0; i < vData.size(); i += vRecordSize)
+                {
+                    MeshEntity e;
+                    e.id   = vData[i];
+                    e.type = pTypes[t];
+                    e.list.assign(vData.begin() + i + 1,
+                                  vData.begin() + i + vRecordSize);
+                    pEntities[e.id] = e;
+                }
+            }
+
+            std::map<int, MeshEntity>::const_iterator it;
+            int i = 0;
+            for (it = pEntities.begin(); it != pEntities.end(); ++it)
+            {
+                ASSERTL0(it->first == i++, "Entity IDs not sequential.");
+            }
+        }
+
+
+        /**
+         * Reads the curves stored in compressed form as records of (ID,
+         * EDGEID or FACEID, NUMPOINTS, points type, number of coordinate
+         * triples) in the E and F tags, with the coordinates of all curves
+         * of each kind in the EPOINTS and FPOINTS tags. The coordinates are
+         * kept as text, which is how the partitions are written.
+         */
+        void MeshPartition::ReadCompressedCurves(TiXmlElement *pSection)
+        {
+            const std::string vCurveTypes[2] = {"E", "F"};
+            for (int t = 0; t < 2; ++t)
+            {
+                std::vector<int>       vInfo;
+                std::vector<NekDouble> vPoints;
+                CompressData::ReadCompressedData(
+                    pSection, vCurveTypes[t], 5, vInfo);
+                CompressData::ReadCompressedData(
+                    pSection, vCurveTypes[t] + "POINTS", 3, vPoints);
+
+                int vOffset = 0;
+                for (int i = 0; i < vInfo.size(); i += 5)
+                {
+                    ASSERTL0(vInfo[i+3] >= 0 && vInfo[i+3] < SIZE_PointsType,
+                             "Invalid points type.");
+                    ASSERTL0(vOffset + 3*vInfo[i+4] <= vPoints.size(),
+                             "Compressed CURVED data is inconsistent.");
+
+                    MeshCurved c;
+                    c.id         = vInfo[i];
+                    c.entitytype = vCurveTypes[t];
+                    c.entityid   = vInfo[i+1];
+                    c.npoints    = vInfo[i+2];
+                    c.type       = kPointsTypeStr[vInfo[i+3]];
+
+                    std::stringstream vData;
+                    vData.precision(12);
+                    for (int j = 0; j < 3*vInfo[i+4]; ++j, ++vOffset)
+                    {
+                        vData << std::setw(15) << vPoints[vOffset];
+                    }
+                    vData << " ";
+                    c.data = vData.str();
+
+                    m_meshCurved[std::make_pair(c.entitytype, c.id)] = c;
+                }
+
+                ASSERTL0(vOffset == vPoints.size(),
+                         "Compressed CURVED data is inconsistent.");
+            }
+        }
+
+
         void MeshPartition::ReadGeometry(const LibUtilities::SessionReaderSharedPtr& pSession)
         {
             TiXmlElement* x;
@@ -298,7 +389,29 @@ namespace Nektar
                 }
             }
 
-            x = vSubElement->FirstChildElement();
+            if (CompressData::IsCompressed(vSubElement))
+            {
+                std::vector<int>       vId;
+                std::vector<NekDouble> vCoords;
+                CompressData::ReadCompressedData(vSubElement, "ID", 1, vId);
+                CompressData::ReadCompressedData(vSubElement, "X",  3, vCoords);
+                ASSERTL0(vCoords.size() == 3*vId.size(),
+                         "Compressed VERTEX data is inconsistent.");
+
+                for (i = 0; i < vId.size(); ++i)
+                {
+                    MeshVertex v;
+                    v.id = vId[i];
+                    ASSERTL0(v.id == i, "Vertex IDs not sequential.");
+                    v.x = vCoords[3*i];
+                    v.y = vCoords[3*i+1];
+                    v.z = vCoords[3*i+2];
+                    m_meshVertices[v.id] = v;
+                }
+            }
+
+            x = CompressData::IsCompressed(vSubElement) ?
+                0 : vSubElement->FirstChildElement();
             i = 0;
             while(x)
             {
@@ -322,7 +435,14 @@ namespace Nektar
             {
                 vSubElement = pSession->GetElement("Nektar/Geometry/Edge");
                 ASSERTL0(vSubElement, "Cannot read edges");
-                x = vSubElement->FirstChildElement();
+                if (CompressData::IsCompressed(vSubElement))
+                {
+                    const int vNumItems[] = {2};
+                    ReadCompressedEntities(vSubElement, "E", vNumItems,
+                                           m_meshEdges);
+                }
+                x = CompressData::IsCompressed(vSubElement) ?
+                    0 : vSubElement->FirstChildElement();
                 i = 0;
                 while(x)
                 {
@@ -347,7 +467,14 @@ namespace Nektar
             {
                 vSubElement = pSession->GetElement("Nektar/Geometry/Face");
                 ASSERTL0(vSubElement, "Cannot read faces.");
-                x = vSubElement->FirstChildElement();
+                if (CompressData::IsCompressed(vSubElement))
+                {
+                    const int vNumItems[] = {3, 4};
+                    ReadCompressedEntities(vSubElement, "TQ", vNumItems,
+                                           m_meshFaces);
+                }
+                x = CompressData::IsCompressed(vSubElement) ?
+                    0 : vSubElement->FirstChildElement();
                 i = 0;
                 while(x)
                 {
@@ -372,7 +499,16 @@ namespace Nektar
             // Read mesh elements
             vSubElement = pSession->GetElement("Nektar/Geometry/Element");
             ASSERTL0(vSubElement, "Cannot read elements.");
-            x = vSubElement->FirstChildElement();
+            if (CompressData::IsCompressed(vSubElement))
+            {
+                // Items are vertices in 1D, edges in 2D and faces in 3D.
+                const int vNumItems[3][4] = {{2}, {3, 4}, {4, 5, 5, 6}};
+                const std::string vTypes[3] = {"S", "TQ", "APRH"};
+                ReadCompressedEntities(vSubElement, vTypes[m_dim-1],
+                                       vNumItems[m_dim-1], m_meshElements);
+            }
+            x = CompressData::IsCompressed(vSubElement) ?
+                0 : vSubElement->FirstChildElement();
             i = 0;
             while(x)
             {
@@ -397,7 +533,12 @@ namespace Nektar
             if (pSession->DefinesElement("Nektar/Geometry/Curved"))
             {
                 vSubElement = pSession->GetElement("Nektar/Geometry/Curved");
-                x = vSubElement->FirstChildElement();
+                if (CompressData::IsCompressed(vSubElement))
+                {
+                    ReadCompressedCurves(vSubElement);
+                }
+                x = CompressData::IsCompressed(vSubElement) ?
+                    0 : vSubElement->FirstChildElement();
                 i = 0;
                 while(x)
                 {
@@ -208,6 +208,12 @@ namespace Nektar
 
             void ReadExpansions(const SessionReaderSharedPtr& pSession);
             void ReadGeometry(const SessionReaderSharedPtr& pSession);
+            void ReadCompressedEntities(
+                    TiXmlElement                *pSection,
+                    const std::string           &pTypes,
+                    const int                   *pNumItems,
+                    std::map<int, MeshEntity>   &pEntities);
+            void ReadCompressedCurves(TiXmlElement *pSection);
             void ReadConditions(const SessionReaderSharedPtr& pSession);
             void WeightElements();
             void CreateGraph(BoostSubGraph& pGraph);
@@ -43,6 +43,7 @@
 #include <boost/concept_check.hpp>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 
 using namespace std;
@@ -74,6 +75,8 @@ namespace Nektar
                 typedef std::map<std::string, boost::shared_ptr<ValueContainer> > ValueContainerPool;
                 typedef boost::shared_ptr<bool> BoolSharedPtr;
                 typedef std::map<std::string, BoolSharedPtr> FlagContainerPool;
+                typedef boost::shared_ptr<boost::mutex> MutexSharedPtr;
+                typedef std::map<std::string, MutexSharedPtr> MutexContainerPool;
 
                 NekManager(std::string whichPool="") :
                     m_values(), 
@@ -82,11 +85,13 @@ namespace Nektar
                 {
                     if (!whichPool.empty())
                     {
+                        boost::mutex::scoped_lock poolLock(m_poolMutex);
                         typename ValueContainerPool::iterator iter = m_ValueContainerPool.find(whichPool);
                         if (iter != m_ValueContainerPool.end())
                         {
                             m_values = iter->second;
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            m_mutex = m_mutexContainerPool[whichPool];
                         }
                         else
                         {
@@ -97,12 +102,15 @@ namespace Nektar
                                 m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
                             }
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            m_mutex = MutexSharedPtr(new boost::mutex);
+                            m_mutexContainerPool[whichPool] = m_mutex;
                         }
                     }
                     else
                     {
                         m_values = ValueContainerShPtr(new ValueContainer);
                         m_managementEnabled = BoolSharedPtr(new bool(true));
+                        m_mutex = MutexSharedPtr(new boost::mutex);
                     }
                 };
 
@@ -114,11 +122,13 @@ namespace Nektar
                 {
                     if (!whichPool.empty())
                     {
+                        boost::mutex::scoped_lock poolLock(m_poolMutex);
                         typename ValueContainerPool::iterator iter = m_ValueContainerPool.find(whichPool);
                         if (iter != m_ValueContainerPool.end())
                         {
                             m_values = iter->second;
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            m_mutex = m_mutexContainerPool[whichPool];
                         }
                         else
                         {
@@ -129,6 +139,8 @@ namespace Nektar
                                 m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
                             }
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            m_mutex = MutexSharedPtr(new boost::mutex);
+                            m_mutexContainerPool[whichPool] = m_mutex;
                         }
 
                     }
@@ -136,6 +148,7 @@ namespace Nektar
                     {
                         m_values = ValueContainerShPtr(new ValueContainer);
                         m_managementEnabled = BoolSharedPtr(new bool(true));
+                        m_mutex = MutexSharedPtr(new boost::mutex);
                     }
                 }
                 
@@ -164,6 +177,7 @@ namespace Nektar
 
                 bool AlreadyCreated(typename boost::call_traits<KeyType>::const_reference key)
                 {
+                    boost::mutex::scoped_lock lock(*m_mutex);
                     bool value = false;
                     typename ValueContainer::iterator found = m_values->find(key);
                     if( found != m_values->end() )
@@ -174,15 +188,24 @@ namespace Nektar
                     return value;
                 }
 
+                /// Return the object associated with @a key, creating it if
+                /// it does not exist. This may be called from several threads
+                /// at once. Objects are created without holding the lock, so
+                /// that creators may themselves use the manager; if two
+                /// threads create the same object, the first one stored is
+                /// returned to both.
                 ValueType operator[](typename boost::call_traits<KeyType>::const_reference key)
                 {
-                    typename ValueContainer::iterator found = m_values->find(key);
-
-                    if( found != m_values->end() )
                     {
-                        return (*found).second;
+                        boost::mutex::scoped_lock lock(*m_mutex);
+                        typename ValueContainer::iterator found = m_values->find(key);
+
+                        if( found != m_values->end() )
+                        {
+                            return (*found).second;
+                        }
                     }
-                    else
+
                     {
                         // No object, create a new one.
                         CreateFuncType f = m_globalCreateFunc;
@@ -197,7 +220,9 @@ namespace Nektar
                             ValueType v = f(key);
                             if (*m_managementEnabled)
                             {
-                                (*m_values)[key] = v;
+                                boost::mutex::scoped_lock lock(*m_mutex);
+                                return m_values->insert(
+                                    std::make_pair(key, v)).first->second;
                             }
                             return v;
                         }
@@ -214,6 +239,7 @@ namespace Nektar
 
                 void DeleteObject(typename boost::call_traits<KeyType>::const_reference key)
                 {
+                    boost::mutex::scoped_lock lock(*m_mutex);
                     typename ValueContainer::iterator found = m_values->find(key);
 
                     if( found != m_values->end() )
@@ -224,18 +250,21 @@ namespace Nektar
 
                 static void ClearManager(std::string whichPool = "")
                 {
+                    boost::mutex::scoped_lock poolLock(m_poolMutex);
                     typename ValueContainerPool::iterator x;
                     if (!whichPool.empty())
                     {
                         x = m_ValueContainerPool.find(whichPool);
                         ASSERTL1(x != m_ValueContainerPool.end(),
                                 "Could not find pool " + whichPool);
+                        boost::mutex::scoped_lock lock(*m_mutexContainerPool[whichPool]);
                         x->second->clear();
                     }
                     else
                     {
                         for (x = m_ValueContainerPool.begin(); x != m_ValueContainerPool.end(); ++x)
                         {
+                            boost::mutex::scoped_lock lock(*m_mutexContainerPool[x->first]);
                             x->second->clear();
                         }
                     }
@@ -243,6 +272,7 @@ namespace Nektar
 
                 static void EnableManagement(std::string whichPool = "")
                 {
+                    boost::mutex::scoped_lock poolLock(m_poolMutex);
                     typename FlagContainerPool::iterator x;
                     if (!whichPool.empty())
                     {
@@ -260,6 +290,7 @@ namespace Nektar
 
                 static void DisableManagement(std::string whichPool = "")
                 {
+                    boost::mutex::scoped_lock poolLock(m_poolMutex);
                     typename FlagContainerPool::iterator x;
                     if (!whichPool.empty())
                     {
@@ -281,13 +312,20 @@ namespace Nektar
 
                 ValueContainerShPtr m_values;
                 BoolSharedPtr m_managementEnabled;
+                /// Guards #m_values, shared by all managers of the same pool.
+                MutexSharedPtr m_mutex;
                 static ValueContainerPool m_ValueContainerPool;
                 static FlagContainerPool m_managementEnabledContainerPool;
+                static MutexContainerPool m_mutexContainerPool;
+                /// Guards the static pools.
+                static boost::mutex m_poolMutex;
                 CreateFuncType m_globalCreateFunc;
                 CreateFuncContainer m_keySpecificCreateFuncs;
         };
         template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::ValueContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_ValueContainerPool;
         template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::FlagContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_managementEnabledContainerPool;
+        template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::MutexContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_mutexContainerPool;
+        template <typename KeyType, typename ValueT, typename opLessCreator> boost::mutex NekManager<KeyType, ValueT, opLessCreator>::m_poolMutex;
     }
 }
 
@@ -289,6 +289,8 @@ namespace Nektar
                                  "number of procs in Y-dir")
                 ("npz",          po::value<int>(),
                                  "number of procs in Z-dir")
+                ("npt",          po::value<int>(),
+                                 "number of time slices for parallel-in-time drivers")
 
             ;
             
@@ -502,6 +504,18 @@ namespace Nektar
         }
 
 
+        /**
+         * Returns the communicator linking processes that hold the same
+         * spatial partition in different time slices. This is only set when
+         * the --npt command-line option is given, otherwise the pointer is
+         * empty.
+         */
+        CommSharedPtr& SessionReader::GetTimeComm()
+        {
+            return m_commTime;
+        }
+
+
         /**
          * This routine finalises any parallel communication.
          *
@@ -1351,6 +1365,10 @@ namespace Nektar
             // Get row of comm, or the whole comm if not split
             CommSharedPtr vCommMesh = m_comm->GetRowComm();
 
+            // Time slices share the same spatial partitions, so only the
+            // first one writes them out.
+            bool writePartitions = !m_commTime || m_commTime->GetRank() == 0;
+
             // Partition mesh into length of row comms
             if (vCommMesh->GetSize() > 1)
             {
@@ -1364,7 +1382,10 @@ namespace Nektar
                         MeshPartitionSharedPtr vPartitioner = MemoryManager<
                             MeshPartition>::AllocateSharedPtr(vSession);
                         vPartitioner->PartitionMesh(true);
-                        vPartitioner->WriteAllPartitions(vSession);
+                        if (writePartitions)
+                        {
+                            vPartitioner->WriteAllPartitions(vSession);
+                        }
                         vPartitioner->GetCompositeOrdering(m_compOrder);
                         vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
                     }
@@ -1380,11 +1401,18 @@ namespace Nektar
                     MeshPartitionSharedPtr vPartitioner = MemoryManager<
                         MeshPartition>::AllocateSharedPtr(vSession);
                     vPartitioner->PartitionMesh(false);
-                    vPartitioner->WriteLocalPartition(vSession);
+                    if (writePartitions)
+                    {
+                        vPartitioner->WriteLocalPartition(vSession);
+                    }
                     vPartitioner->GetCompositeOrdering(m_compOrder);
                     vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
                 }
                 m_comm->Block();
+                if (m_commTime)
+                {
+                    m_commTime->Block();
+                }
 
                 std::string  dirname = GetSessionName() + "_xml";
                 fs::path    pdirname(dirname);
@@ -1428,6 +1456,24 @@ namespace Nektar
          */
         void SessionReader::PartitionComm()
         {
+            // Split off the time slices first. The session then only sees
+            // the communicator of its own time slice, and the spatial
+            // partitioning below is done within it.
+            if (m_comm->GetSize() > 1 && DefinesCmdLineArgument("npt"))
+            {
+                int nProcT = GetCmdLineArgument<int>("npt");
+
+                ASSERTL0(nProcT > 0 && m_comm->GetSize() % nProcT == 0,
+                         "Cannot exactly partition using npt value.");
+
+                if (nProcT > 1)
+                {
+                    m_comm->SplitComm(nProcT, m_comm->GetSize() / nProcT);
+                    m_commTime = m_comm->GetColumnComm();
+                    m_comm     = m_comm->GetRowComm();
+                }
+            }
+
             if (m_comm->GetSize() > 1)
             {
                 int nProcZ = 1;
@@ -1633,6 +1679,7 @@ namespace Nektar
             {
                 ASSERTL0(
                     m_solverInfo["GLOBALSYSSOLN"] == "IterativeFull"       ||
+                    m_solverInfo["GLOBALSYSSOLN"] == "IterativeMatrixFree" ||
                     m_solverInfo["GLOBALSYSSOLN"] == "IterativeStaticCond" ||
                     m_solverInfo["GLOBALSYSSOLN"] == 
                         "IterativeMultiLevelStaticCond"                    ||
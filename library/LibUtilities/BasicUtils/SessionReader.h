@@ -182,6 +182,8 @@ namespace Nektar
             LIB_UTILITIES_EXPORT const std::string  GetSessionNameRank() const;
             /// Returns the communication object.
             LIB_UTILITIES_EXPORT CommSharedPtr &GetComm();
+            /// Returns the communicator across time slices, if any.
+            LIB_UTILITIES_EXPORT CommSharedPtr &GetTimeComm();
             /// Finalises the session.
             LIB_UTILITIES_EXPORT void Finalise();
 
@@ -396,6 +398,8 @@ namespace Nektar
 
             /// Communication object.
             CommSharedPtr                             m_comm;
+            /// Communicator across time slices, empty unless --npt is given.
+            CommSharedPtr                             m_commTime;
             /// Filenames
             std::vector<std::string>                  m_filenames;
             /// Filename of the loaded XML document.
@@ -46,10 +46,40 @@
 #include <boost/multi_array.hpp>
 #include <boost/shared_ptr.hpp>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace Nektar
 {
     class LinearSystem;
 
+    namespace detail
+    {
+        /// Reference counts of arrays are updated atomically, since arrays
+        /// sharing storage may be copied and released concurrently by the
+        /// threads of the matrix setup.
+        inline void IncrementArrayCount(unsigned int* count)
+        {
+#if defined(_MSC_VER)
+            _InterlockedIncrement(reinterpret_cast<volatile long*>(count));
+#else
+            __sync_fetch_and_add(count, 1u);
+#endif
+        }
+
+        /// Returns the count remaining after the decrement.
+        inline unsigned int DecrementArrayCount(unsigned int* count)
+        {
+#if defined(_MSC_VER)
+            return static_cast<unsigned int>(
+                _InterlockedDecrement(reinterpret_cast<volatile long*>(count)));
+#else
+            return __sync_sub_and_fetch(count, 1u);
+#endif
+        }
+    }
+
     // Forward declaration for a ConstArray constructor.
     template<typename Dim, typename DataType>
     class Array;
@@ -152,7 +182,7 @@ namespace Nektar
                 m_count(rhs.m_count),
                 m_offset(rhs.m_offset)
             {
-                *m_count += 1;
+                detail::IncrementArrayCount(m_count);
                 ASSERTL0(m_size <= rhs.num_elements(), "Requested size is larger than input array size.");
             }
 
@@ -164,7 +194,7 @@ namespace Nektar
                 m_count(rhs.m_count),
                 m_offset(rhs.m_offset)
             {
-                *m_count += 1;
+                detail::IncrementArrayCount(m_count);
             }
 
             ~Array()
@@ -174,8 +204,7 @@ namespace Nektar
                     return;
                 }
 
-                *m_count -= 1;
-                if( *m_count == 0 )
+                if( detail::DecrementArrayCount(m_count) == 0 )
                 {
                     ArrayDestructionPolicy<DataType>::Destroy(m_data+1, m_capacity);
                     MemoryManager<DataType>::RawDeallocate(m_data, m_capacity+1);
@@ -185,8 +214,10 @@ namespace Nektar
             /// \brief Creates a reference to rhs.
             Array<OneD, const DataType>& operator=(const Array<OneD, const DataType>& rhs)
             {
-                *m_count -= 1;
-                if( *m_count == 0 )
+                // Take the new reference first, so that assigning an array
+                // to itself cannot release its storage.
+                detail::IncrementArrayCount(rhs.m_count);
+                if( detail::DecrementArrayCount(m_count) == 0 )
                 {
                     ArrayDestructionPolicy<DataType>::Destroy(m_data+1, m_capacity);
                     MemoryManager<DataType>::RawDeallocate(m_data, m_capacity+1);
@@ -195,7 +226,6 @@ namespace Nektar
                 m_data = rhs.m_data;
                 m_capacity = rhs.m_capacity;
                 m_count = rhs.m_count;
-                *m_count += 1;
                 m_offset = rhs.m_offset;
                 m_size = rhs.m_size;
                 return *this;
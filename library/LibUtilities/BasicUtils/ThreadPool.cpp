@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: ThreadPool.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Persistent pool of worker threads
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/ThreadPool.h>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+
+#include <boost/bind.hpp>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        /// Guards the creation of the shared pool.
+        static boost::mutex sharedPoolMutex;
+
+        /**
+         * Returns the pool shared by all parts of the code which run their
+         * work on threads, e.g. the global matrices of every field and
+         * multi-level solver, so that the process holds a single set of
+         * worker threads rather than one per object. The pool is created
+         * on first use. If a different number of threads is requested
+         * later, a new pool replaces it, while holders of the previous pool
+         * keep it alive until they release it.
+         *
+         * Since calls to ThreadPool::Run are serialised, users of the
+         * shared pool must not call it from within one of its jobs.
+         */
+        ThreadPoolSharedPtr GetThreadPool(const unsigned int nThreads)
+        {
+            static ThreadPoolSharedPtr pool;
+
+            boost::unique_lock<boost::mutex> lock(sharedPoolMutex);
+            const unsigned int n = nThreads > 0 ? nThreads : 1;
+            if (!pool || pool->GetNumThreads() != n)
+            {
+                pool = ThreadPoolSharedPtr(new ThreadPool(n));
+            }
+            return pool;
+        }
+
+        ThreadPool::ThreadPool(const unsigned int nThreads) :
+            m_nThreads  (nThreads > 0 ? nThreads : 1),
+            m_job       (0),
+            m_generation(0),
+            m_nBusy     (0),
+            m_shutdown  (false)
+        {
+            for (unsigned int t = 1; t < m_nThreads; ++t)
+            {
+                m_threads.create_thread(
+                    boost::bind(&ThreadPool::Worker, this, t));
+            }
+        }
+
+        ThreadPool::~ThreadPool()
+        {
+            {
+                boost::unique_lock<boost::mutex> lock(m_mutex);
+                m_shutdown = true;
+            }
+            m_start.notify_all();
+            m_threads.join_all();
+        }
+
+        void ThreadPool::Run(const JobType &job)
+        {
+            if (m_nThreads == 1)
+            {
+                job(0);
+                return;
+            }
+
+            boost::unique_lock<boost::mutex> runLock(m_runMutex);
+
+            {
+                boost::unique_lock<boost::mutex> lock(m_mutex);
+                m_job   = &job;
+                m_nBusy = m_nThreads - 1;
+                m_error.clear();
+                ++m_generation;
+            }
+            m_start.notify_all();
+
+            // The workers hold a pointer to the job, so wait for all of
+            // them before leaving, even if this thread's share fails.
+            std::string error;
+            try
+            {
+                job(0);
+            }
+            catch (std::exception &e)
+            {
+                error = e.what();
+            }
+
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+            while (m_nBusy > 0)
+            {
+                m_done.wait(lock);
+            }
+            m_job = 0;
+
+            if (error.empty())
+            {
+                error = m_error;
+            }
+            lock.unlock();
+
+            ASSERTL0(error.empty(), "Thread pool job failed: " + error);
+        }
+
+        void ThreadPool::ParallelFor(
+            const unsigned int  n,
+            const JobType      &job)
+        {
+            unsigned int next = 0;
+            Run(boost::bind(&ThreadPool::ParallelForWorker, this,
+                            n, boost::cref(job), boost::ref(next)));
+        }
+
+        void ThreadPool::ParallelForWorker(
+            const unsigned int  n,
+            const JobType      &job,
+                  unsigned int &next)
+        {
+            boost::unique_lock<boost::mutex> lock(m_mutex, boost::defer_lock);
+
+            while (true)
+            {
+                lock.lock();
+                unsigned int i = next++;
+                lock.unlock();
+
+                if (i >= n)
+                {
+                    break;
+                }
+
+                job(i);
+            }
+        }
+
+        void ThreadPool::Worker(const unsigned int id)
+        {
+            unsigned long seen = 0;
+
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+            while (true)
+            {
+                while (m_generation == seen && !m_shutdown)
+                {
+                    m_start.wait(lock);
+                }
+
+                if (m_shutdown)
+                {
+                    break;
+                }
+
+                seen = m_generation;
+                const JobType *job = m_job;
+
+                lock.unlock();
+                std::string error;
+                try
+                {
+                    (*job)(id);
+                }
+                catch (std::exception &e)
+                {
+                    error = e.what();
+                }
+                lock.lock();
+
+                if (!error.empty() && m_error.empty())
+                {
+                    m_error = error;
+                }
+
+                if (--m_nBusy == 0)
+                {
+                    m_done.notify_one();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: ThreadPool.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Persistent pool of worker threads
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_THREADPOOL_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_THREADPOOL_H
+
+#include <string>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        /**
+         * A fixed set of worker threads which are created once and then
+         * repeatedly given a job to execute. This avoids the cost of
+         * creating threads in operations which are called many times, such
+         * as a sparse matrix-vector product inside an iterative solver.
+         *
+         * A job is a function of the thread index. The calling thread
+         * takes part in each job as thread zero, so a pool of one thread
+         * does not create any additional threads. Jobs must not themselves
+         * submit work to the same pool.
+         */
+        class ThreadPool
+        {
+        public:
+            typedef boost::function<void (unsigned int)> JobType;
+
+            /// Start a pool of @a nThreads threads (including the caller).
+            LIB_UTILITIES_EXPORT ThreadPool(const unsigned int nThreads);
+
+            LIB_UTILITIES_EXPORT ~ThreadPool();
+
+            /// Number of threads, including the calling thread.
+            unsigned int GetNumThreads() const
+            {
+                return m_nThreads;
+            }
+
+            /// Execute @a job(t) for t = 0, ..., GetNumThreads()-1 and
+            /// wait for all of them to finish.
+            LIB_UTILITIES_EXPORT void Run(const JobType &job);
+
+            /// Execute @a job(i) for i = 0, ..., n-1, distributing the
+            /// indices dynamically over the threads.
+            LIB_UTILITIES_EXPORT void ParallelFor(
+                const unsigned int n,
+                const JobType     &job);
+
+        private:
+            ThreadPool(const ThreadPool &rhs);
+            ThreadPool& operator=(const ThreadPool &rhs);
+
+            void Worker(const unsigned int id);
+
+            void ParallelForWorker(
+                const unsigned int  n,
+                const JobType      &job,
+                      unsigned int &next);
+
+            unsigned int                m_nThreads;
+            boost::thread_group         m_threads;
+            /// Serialises concurrent calls to #Run.
+            boost::mutex                m_runMutex;
+            boost::mutex                m_mutex;
+            boost::condition_variable   m_start;
+            boost::condition_variable   m_done;
+            /// Job currently being executed.
+            const JobType              *m_job;
+            /// Incremented each time a new job is submitted.
+            unsigned long               m_generation;
+            /// Number of worker threads still executing the current job.
+            unsigned int                m_nBusy;
+            bool                        m_shutdown;
+            /// First error raised by a worker during the current job.
+            std::string                 m_error;
+        };
+
+        typedef boost::shared_ptr<ThreadPool> ThreadPoolSharedPtr;
+
+        /// Process-wide pool of @a nThreads threads shared by all callers.
+        LIB_UTILITIES_EXPORT ThreadPoolSharedPtr GetThreadPool(
+            const unsigned int nThreads);
+    }
+}
+
+#endif //NEKTAR_LIB_UTILITIES_BASIC_UTILS_THREADPOOL_H
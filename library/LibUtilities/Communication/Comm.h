@@ -69,6 +69,15 @@ namespace Nektar
             ReduceMin
         };
 
+        /// Handle to one or more outstanding non-blocking communications.
+        class CommRequest
+        {
+            public:
+                LIB_UTILITIES_EXPORT virtual ~CommRequest() {}
+        };
+
+        typedef boost::shared_ptr<CommRequest> CommRequestSharedPtr;
+
         /// Base communications class
         class Comm: public boost::enable_shared_from_this<Comm>
         {
@@ -130,6 +139,21 @@ namespace Nektar
 													      Array<OneD, int>& pRecvDataSizeMap,
 													      Array<OneD, int>& pRecvDataOffsetMap);
 
+                LIB_UTILITIES_EXPORT inline CommRequestSharedPtr CreateRequest(
+                                                                    int pNum);
+                LIB_UTILITIES_EXPORT inline void Isend(int pProc,
+                                            Array<OneD, NekDouble>& pData,
+                                            int pCount,
+                                            const CommRequestSharedPtr& pRequest,
+                                            int pLoc);
+                LIB_UTILITIES_EXPORT inline void Irecv(int pProc,
+                                            Array<OneD, NekDouble>& pData,
+                                            int pCount,
+                                            const CommRequestSharedPtr& pRequest,
+                                            int pLoc);
+                LIB_UTILITIES_EXPORT inline void WaitAll(
+                                            const CommRequestSharedPtr& pRequest);
+
                 LIB_UTILITIES_EXPORT inline void SplitComm(int pRows, int pColumns);
                 LIB_UTILITIES_EXPORT inline CommSharedPtr GetRowComm();
                 LIB_UTILITIES_EXPORT inline CommSharedPtr GetColumnComm();
@@ -191,6 +215,18 @@ namespace Nektar
 										Array<OneD, int>& pRecvData,
 										Array<OneD, int>& pRecvDataSizeMap,
 										Array<OneD, int>& pRecvDataOffsetMap) = 0;
+                virtual CommRequestSharedPtr v_CreateRequest(int pNum) = 0;
+                virtual void v_Isend(int pProc,
+                                     Array<OneD, NekDouble>& pData,
+                                     int pCount,
+                                     const CommRequestSharedPtr& pRequest,
+                                     int pLoc) = 0;
+                virtual void v_Irecv(int pProc,
+                                     Array<OneD, NekDouble>& pData,
+                                     int pCount,
+                                     const CommRequestSharedPtr& pRequest,
+                                     int pLoc) = 0;
+                virtual void v_WaitAll(const CommRequestSharedPtr& pRequest) = 0;
                 virtual void v_SplitComm(int pRows, int pColumns) = 0;
         };
 
@@ -430,6 +466,56 @@ namespace Nektar
         }
 
 
+        /**
+         * @brief Create a handle able to hold @a pNum outstanding
+         * non-blocking communications.
+         */
+        inline CommRequestSharedPtr Comm::CreateRequest(int pNum)
+        {
+            return v_CreateRequest(pNum);
+        }
+
+
+        /**
+         * @brief Start sending the first @a pCount entries of @a pData to
+         * process @a pProc, storing the communication in slot @a pLoc of
+         * @a pRequest. @a pData must not be modified until #WaitAll returns.
+         */
+        inline void Comm::Isend(int pProc,
+                                Array<OneD, NekDouble>& pData,
+                                int pCount,
+                                const CommRequestSharedPtr& pRequest,
+                                int pLoc)
+        {
+            v_Isend(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Start receiving @a pCount entries into @a pData from process
+         * @a pProc, storing the communication in slot @a pLoc of
+         * @a pRequest. @a pData is only valid once #WaitAll returns.
+         */
+        inline void Comm::Irecv(int pProc,
+                                Array<OneD, NekDouble>& pData,
+                                int pCount,
+                                const CommRequestSharedPtr& pRequest,
+                                int pLoc)
+        {
+            v_Irecv(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Wait for all communications held in @a pRequest to
+         * complete.
+         */
+        inline void Comm::WaitAll(const CommRequestSharedPtr& pRequest)
+        {
+            v_WaitAll(pRequest);
+        }
+
+
         /**
          * @brief Retrieve the row communicator to which this process belongs.
          */
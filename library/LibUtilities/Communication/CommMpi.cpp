@@ -599,6 +599,70 @@ namespace Nektar
 		}
 
 
+        /**
+         *
+         */
+        CommRequestSharedPtr CommMpi::v_CreateRequest(int pNum)
+        {
+            return MemoryManager<CommRequestMpi>::AllocateSharedPtr(pNum);
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Isend(int pProc,
+                              Array<OneD, NekDouble>& pData,
+                              int pCount,
+                              const CommRequestSharedPtr& pRequest,
+                              int pLoc)
+        {
+            CommRequestMpi *req =
+                static_cast<CommRequestMpi*>(pRequest.get());
+            ASSERTL1(pCount <= pData.num_elements(),
+                     "Send data is too short.");
+            MPI_Isend(pData.get(), pCount, MPI_DOUBLE, pProc, 0, m_comm,
+                      &req->m_request[pLoc]);
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Irecv(int pProc,
+                              Array<OneD, NekDouble>& pData,
+                              int pCount,
+                              const CommRequestSharedPtr& pRequest,
+                              int pLoc)
+        {
+            CommRequestMpi *req =
+                static_cast<CommRequestMpi*>(pRequest.get());
+            ASSERTL1(pCount <= pData.num_elements(),
+                     "Receive data is too short.");
+            MPI_Irecv(pData.get(), pCount, MPI_DOUBLE, pProc, 0, m_comm,
+                      &req->m_request[pLoc]);
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_WaitAll(const CommRequestSharedPtr& pRequest)
+        {
+            CommRequestMpi *req =
+                static_cast<CommRequestMpi*>(pRequest.get());
+            if (req->m_request.empty())
+            {
+                return;
+            }
+            int retval = MPI_Waitall((int) req->m_request.size(),
+                                     &req->m_request[0],
+                                     MPI_STATUSES_IGNORE);
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error waiting for non-blocking communications.");
+        }
+
+
         /**
          * Processes are considered as a grid of size pRows*pColumns. Comm
          * objects are created corresponding to the rows and columns of this
@@ -57,6 +57,19 @@ namespace Nektar
         /// Pointer to a Communicator object.
         typedef boost::shared_ptr<CommMpi> CommMpiSharedPtr;
 
+        /// Outstanding non-blocking MPI communications.
+        class CommRequestMpi : public CommRequest
+        {
+        public:
+            CommRequestMpi(int pNum) : m_request(pNum, MPI_REQUEST_NULL)
+            {
+            }
+
+            virtual ~CommRequestMpi() {}
+
+            std::vector<MPI_Request> m_request;
+        };
+
         /// A global linear system.
         class CommMpi : public Comm
         {
@@ -125,6 +138,18 @@ namespace Nektar
 									Array<OneD, int>& pRecvData,
 									Array<OneD, int>& pRecvDataSizeMap,
 									Array<OneD, int>& pRecvDataOffsetMap);
+            virtual CommRequestSharedPtr v_CreateRequest(int pNum);
+            virtual void v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 const CommRequestSharedPtr& pRequest,
+                                 int pLoc);
+            virtual void v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 const CommRequestSharedPtr& pRequest,
+                                 int pLoc);
+            virtual void v_WaitAll(const CommRequestSharedPtr& pRequest);
             virtual void v_SplitComm(int pRows, int pColumns);
 
         private:
@@ -262,6 +262,47 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        CommRequestSharedPtr CommSerial::v_CreateRequest(int pNum)
+        {
+            return MemoryManager<CommRequest>::AllocateSharedPtr();
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 const CommRequestSharedPtr& pRequest,
+                                 int pLoc)
+        {
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 const CommRequestSharedPtr& pRequest,
+                                 int pLoc)
+        {
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_WaitAll(const CommRequestSharedPtr& pRequest)
+        {
+        }
+
+
         /**
          *
          */
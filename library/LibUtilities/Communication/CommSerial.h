@@ -117,6 +117,20 @@ namespace Nektar
 													     Array<OneD, int>& pRecvData,
 													     Array<OneD, int>& pRecvDataSizeMap,
 													     Array<OneD, int>& pRecvDataOffsetMap);
+            LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_CreateRequest(
+                                 int pNum);
+            LIB_UTILITIES_EXPORT virtual void v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 const CommRequestSharedPtr& pRequest,
+                                 int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 const CommRequestSharedPtr& pRequest,
+                                 int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_WaitAll(
+                                 const CommRequestSharedPtr& pRequest);
             LIB_UTILITIES_EXPORT virtual void v_SplitComm(int pRows, int pColumns);
 			
         };
@@ -127,6 +127,8 @@ namespace Gs
     {
         void nektar_gs(void *u, gs_dom dom, gs_op op, unsigned transpose,
                 gs_data *gsh, buffer *buf);
+        void nektar_gs_vec(void *u, unsigned vn, gs_dom dom, gs_op op,
+                unsigned transpose, gs_data *gsh, buffer *buf);
         gs_data *nektar_gs_setup(const long *id, unsigned int n, const struct comm *comm,
                                 int unique, gs_method method, int verbose);
         void nektar_gs_free(gs_data *gsh);
@@ -238,6 +240,40 @@ namespace Gs
 #endif
     }
 
+
+    /**
+     * @brief Performs a gather-scatter operation on @a pVecLen interleaved
+     * vectors at once.
+     *
+     * Entry @c pU[i*pVecLen+k] holds the @c k-th vector's value at the
+     * degree of freedom @c i of the mapping. All vectors are exchanged with
+     * each neighbouring process in a single message.
+     */
+    static inline void GatherVec(Nektar::Array<OneD, NekDouble> pU,
+                       unsigned int pVecLen, gs_op pOp, gs_data *pGsh,
+                       Nektar::Array<OneD, NekDouble> pBuffer
+                                                        = NullNekDouble1DArray)
+    {
+#ifdef NEKTAR_USE_MPI
+        if (!pGsh)
+        {
+            return;
+        }
+        if (pBuffer.num_elements() == 0)
+        {
+            nektar_gs_vec(pU.get(), pVecLen, gs_double, pOp, false, pGsh, 0);
+        }
+        else
+        {
+            array buf;
+            buf.ptr = &pBuffer[0];
+            buf.n = pBuffer.num_elements();
+            nektar_gs_vec(pU.get(), pVecLen, gs_double, pOp, false, pGsh,
+                          &buf);
+        }
+#endif
+    }
+
 }
 
 #endif
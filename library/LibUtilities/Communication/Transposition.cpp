@@ -41,6 +41,9 @@
 #include <LibUtilities/Foundations/Basis.h>  // for BasisKey
 #include <LibUtilities/Foundations/Foundations.hpp>
 
+#include <algorithm>
+#include <vector>
+
 
 namespace Nektar
 {
@@ -53,6 +56,7 @@ namespace Nektar
                                      LibUtilities::CommSharedPtr hcomm)
         {
             m_hcomm = hcomm;
+            m_num_chunks = 4;
             m_num_homogeneous_directions = 1;
 
             m_num_points_per_proc =
@@ -112,6 +116,7 @@ namespace Nektar
                                      LibUtilities::CommSharedPtr hcomm)
         {
             m_hcomm = hcomm;
+            m_num_chunks = 4;
             m_num_homogeneous_directions = 2;
 
             m_num_points_per_proc =
@@ -151,6 +156,7 @@ namespace Nektar
                                      LibUtilities::CommSharedPtr hcomm)
         {
             m_hcomm = hcomm;
+            m_num_chunks = 4;
             m_num_homogeneous_directions = 3;
 
             m_num_points_per_proc =
@@ -333,12 +339,9 @@ namespace Nektar
                 m_hcomm->AlltoAllv(outarray,     m_SizeMap, m_OffsetMap,
                                    tmp_outarray, m_SizeMap, m_OffsetMap);
 
-                for(i = 0; i < packed_len; ++i)
-                {
-                    Vmath::Vcopy(num_pencil_per_proc,
-                            &(tmp_outarray[i * num_pencil_per_proc]), 1,
-                            &(outarray[i]), packed_len);
-                }
+                BlockTranspose(packed_len, num_pencil_per_proc,
+                               &tmp_outarray[0], num_pencil_per_proc,
+                               &outarray[0],     packed_len);
                 // End Transposition
             }
 
@@ -346,7 +349,7 @@ namespace Nektar
             // implemenation)
             else
             {
-                int i, pts_per_plane;
+                int pts_per_plane;
                 int n = inarray.num_elements();
                 int packed_len;
 
@@ -364,12 +367,9 @@ namespace Nektar
                 ASSERTL1(&inarray[0] != &outarray[0],
                          "Inarray and outarray cannot be the same");
 
-                for(i = 0; i < packed_len; ++i)
-                {
-                    Vmath::Vcopy(pts_per_plane,
-                            &(inarray[i * pts_per_plane]), 1,
-                            &(outarray[i]), packed_len);
-                }
+                BlockTranspose(packed_len, pts_per_plane,
+                               &inarray[0],  pts_per_plane,
+                               &outarray[0], packed_len);
             }
         }
 
@@ -424,11 +424,9 @@ namespace Nektar
                 }
 
                 // Start Transposition
-                for(i = 0; i < packed_len; ++i)
-                {
-                    Vmath::Vcopy(num_pencil_per_proc,&(inarray[i]),packed_len,
-                                 &(tmp_inarray[i*num_pencil_per_proc]),1);
-                }
+                BlockTranspose(num_pencil_per_proc, packed_len,
+                               &inarray[0],     packed_len,
+                               &tmp_inarray[0], num_pencil_per_proc);
 
                 m_hcomm->AlltoAllv(tmp_inarray,  m_SizeMap, m_OffsetMap,
                                    tmp_outarray, m_SizeMap, m_OffsetMap);
@@ -458,7 +456,7 @@ namespace Nektar
             // implemenation)
             else
             {
-                int i,pts_per_plane;
+                int pts_per_plane;
                 int n = inarray.num_elements();
                 int packed_len;
 
@@ -478,12 +476,9 @@ namespace Nektar
                 ASSERTL1(&inarray[0] != &outarray[0],
                          "Inarray and outarray cannot be the same");
 
-                for(i = 0; i < packed_len; ++i)
-                {
-                    Vmath::Vcopy(pts_per_plane,
-                                 &(inarray[i]), packed_len,
-                                 &(outarray[i * pts_per_plane]), 1);
-                }
+                BlockTranspose(pts_per_plane, packed_len,
+                               &inarray[0],  packed_len,
+                               &outarray[0], pts_per_plane);
             }
         }
 
@@ -504,7 +499,7 @@ namespace Nektar
             }
             else
             {
-                int i, pts_per_line;
+                int pts_per_line;
                 int n = inarray.num_elements();
                 int packed_len;
 
@@ -525,12 +520,9 @@ namespace Nektar
                 ASSERTL1(&inarray[0] != &outarray[0],
                          "Inarray and outarray cannot be the same");
 
-                for(i = 0; i < packed_len; ++i)
-                {
-                    Vmath::Vcopy(pts_per_line,
-                            &(inarray[i * pts_per_line]), 1,
-                            &(outarray[i]), packed_len);
-                }
+                BlockTranspose(packed_len, pts_per_line,
+                               &inarray[0],  pts_per_line,
+                               &outarray[0], packed_len);
             }
         }
 
@@ -551,7 +543,7 @@ namespace Nektar
             }
             else
             {
-                int i,pts_per_line;
+                int pts_per_line;
                 int n = inarray.num_elements();
                 int packed_len;
 
@@ -572,12 +564,9 @@ namespace Nektar
                 ASSERTL1(&inarray[0] != &outarray[0],
                          "Inarray and outarray cannot be the same");
 
-                for(i = 0; i < packed_len; ++i)
-                {
-                    Vmath::Vcopy(pts_per_line,
-                            &(inarray[i]), packed_len,
-                            &(outarray[i * pts_per_line]), 1);
-                }
+                BlockTranspose(pts_per_line, packed_len,
+                               &inarray[0],  packed_len,
+                               &outarray[0], pts_per_line);
             }
         }
 
@@ -606,12 +595,9 @@ namespace Nektar
 
                 int packed_len = pts_per_line * m_num_homogeneous_points[1];
 
-                for(int i = 0; i < m_num_homogeneous_points[0] ; ++i)
-                {
-                    Vmath::Vcopy(packed_len,
-                            &(inarray[i]), m_num_homogeneous_points[0],
-                            &(outarray[i * packed_len]), 1);
-                }
+                BlockTranspose(packed_len, m_num_homogeneous_points[0],
+                               &inarray[0],  m_num_homogeneous_points[0],
+                               &outarray[0], packed_len);
             }
         }
 
@@ -640,11 +626,229 @@ namespace Nektar
 
                 int packed_len = pts_per_line * m_num_homogeneous_points[1];
 
-                for(int i = 0; i < packed_len ; ++i)
+                BlockTranspose(m_num_homogeneous_points[0], packed_len,
+                               &inarray[0],  packed_len,
+                               &outarray[0], m_num_homogeneous_points[0]);
+            }
+        }
+
+
+        /**
+         * Apply @a func to the pencils of @a inarray, which is given and
+         * returned in SEM (XY) ordering. This is equivalent to an eXYtoZ
+         * transposition, a call of @a func on all local pencils and an eZtoXY
+         * transposition, but in parallel the pencils are split into
+         * #m_num_chunks chunks and the exchanges are posted without blocking
+         * so that @a func runs on one chunk while the others are in flight.
+         *
+         * @a func is called with the number of pencils in a chunk and arrays
+         * holding these pencils contiguously, each of length packed_len.
+         *
+         * As in ExpListHomogeneous1D::Homogeneous1DTrans, the number of
+         * pencils is taken from @a inarray for a forwards transform and from
+         * @a outarray for a backwards one.
+         */
+        void Transposition::TransformPencils(
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray,
+                                const PencilFuncType              &func,
+                                bool IsForwards,
+                                bool UseNumMode)
+        {
+            ASSERTL0(m_num_homogeneous_directions == 1,
+                     "Pencil transforms only implemented for "
+                     "3D-Homo-1D approach.");
+
+            // As in Transpose, the input is packed with the plane size of
+            // inarray and the output unpacked with that of outarray.
+            int nplanes       = m_num_points_per_proc[0];
+            int nprocs        = m_num_processes[0];
+            int pts_plane     = inarray.num_elements()  / nplanes;
+            int pts_plane_out = outarray.num_elements() / nplanes;
+            int pts_sized     = IsForwards ? pts_plane : pts_plane_out;
+            int num_pencils   = pts_sized / nprocs + (pts_sized % nprocs > 0);
+            int packed_len    = UseNumMode ? m_num_homogeneous_coeffs[0]
+                                           : m_num_homogeneous_points[0];
+
+            Array<OneD, NekDouble> pencils_in (num_pencils*packed_len, 0.0);
+            Array<OneD, NekDouble> pencils_out(num_pencils*packed_len, 0.0);
+            Array<OneD, NekDouble> tmp1, tmp2;
+
+            if(nprocs == 1)
+            {
+                Transpose(inarray, pencils_in, UseNumMode, eXYtoZ);
+                func(num_pencils, pencils_in, pencils_out);
+                Transpose(pencils_out, outarray, UseNumMode, eZtoXY);
+                return;
+            }
+
+            ASSERTL1(pts_plane == pts_plane_out,
+                     "Input and output arrays hold a different number of "
+                     "points per plane.");
+
+            int nchunks = std::max(1, std::min(m_num_chunks, num_pencils));
+
+            // First pencil of each chunk.
+            Array<OneD, int> chunk_start(nchunks + 1);
+            for(int c = 0; c <= nchunks; ++c)
+            {
+                chunk_start[c] = c * num_pencils / nchunks;
+            }
+
+            // The data exchanged with process q for chunk c are stored at
+            // q*block + nplanes*chunk_start[c], ordered plane by plane.
+            int block = nplanes * num_pencils;
+            Array<OneD, NekDouble> send(nprocs * block, 0.0);
+            Array<OneD, NekDouble> recv(nprocs * block, 0.0);
+
+            std::vector<CommRequestSharedPtr> fwd_req(nchunks);
+            std::vector<CommRequestSharedPtr> bwd_req(nchunks);
+
+            int c, i, q, c0, len, off, first, valid, nvalid;
+
+            // Pack and post the exchange of every chunk.
+            for(c = 0; c < nchunks; ++c)
+            {
+                c0  = chunk_start[c];
+                len = chunk_start[c+1] - c0;
+
+                fwd_req[c] = m_hcomm->CreateRequest(2 * nprocs);
+
+                for(q = 0; q < nprocs; ++q)
                 {
-                    Vmath::Vcopy(m_num_homogeneous_points[0],
-                            &(inarray[i]), packed_len,
-                            &(outarray[i * m_num_homogeneous_points[0]]), 1);
+                    off   = q * block + nplanes * c0;
+                    first = q * num_pencils + c0;
+                    valid = std::max(0, std::min(len, pts_plane - first));
+
+                    for(i = 0; i < nplanes && valid > 0; ++i)
+                    {
+                        Vmath::Vcopy(valid, &inarray[i * pts_plane + first], 1,
+                                            &send[off + i * len],           1);
+                    }
+
+                    m_hcomm->Irecv(q, tmp1 = recv + off, nplanes * len,
+                                   fwd_req[c], q);
+                    m_hcomm->Isend(q, tmp2 = send + off, nplanes * len,
+                                   fwd_req[c], nprocs + q);
+                }
+            }
+
+            // Transform each chunk as it arrives and send it back.
+            for(c = 0; c < nchunks; ++c)
+            {
+                c0  = chunk_start[c];
+                len = chunk_start[c+1] - c0;
+
+                m_hcomm->WaitAll(fwd_req[c]);
+
+                for(q = 0; q < nprocs; ++q)
+                {
+                    off    = q * block + nplanes * c0;
+                    nvalid = std::max(0, std::min(nplanes,
+                                                  packed_len - q * nplanes));
+
+                    if(nvalid > 0)
+                    {
+                        BlockTranspose(nvalid, len, &recv[off], len,
+                            &pencils_in[c0 * packed_len + q * nplanes],
+                            packed_len);
+                    }
+                }
+
+                func(len, tmp1 = pencils_in  + c0 * packed_len,
+                          tmp2 = pencils_out + c0 * packed_len);
+
+                bwd_req[c] = m_hcomm->CreateRequest(2 * nprocs);
+
+                for(q = 0; q < nprocs; ++q)
+                {
+                    off    = q * block + nplanes * c0;
+                    nvalid = std::max(0, std::min(nplanes,
+                                                  packed_len - q * nplanes));
+
+                    // The send buffer of this chunk has been released by
+                    // the wait above and is reused here.
+                    Vmath::Zero(nplanes * len, &send[off], 1);
+                    if(nvalid > 0)
+                    {
+                        BlockTranspose(len, nvalid,
+                            &pencils_out[c0 * packed_len + q * nplanes],
+                            packed_len, &send[off], len);
+                    }
+
+                    m_hcomm->Irecv(q, tmp1 = recv + off, nplanes * len,
+                                   bwd_req[c], q);
+                    m_hcomm->Isend(q, tmp2 = send + off, nplanes * len,
+                                   bwd_req[c], nprocs + q);
+                }
+            }
+
+            // Unpack the transformed chunks into SEM ordering.
+            for(c = 0; c < nchunks; ++c)
+            {
+                c0  = chunk_start[c];
+                len = chunk_start[c+1] - c0;
+
+                m_hcomm->WaitAll(bwd_req[c]);
+
+                for(q = 0; q < nprocs; ++q)
+                {
+                    off   = q * block + nplanes * c0;
+                    first = q * num_pencils + c0;
+                    valid = std::max(0, std::min(len, pts_plane_out - first));
+
+                    for(i = 0; i < nplanes && valid > 0; ++i)
+                    {
+                        Vmath::Vcopy(valid, &recv[off + i * len], 1,
+                                     &outarray[i * pts_plane_out + first], 1);
+                    }
+                }
+            }
+        }
+
+
+        /**
+         * Set the number of chunks used to pipeline TransformPencils.
+         */
+        void Transposition::SetNumChunks(int pNumChunks)
+        {
+            ASSERTL0(pNumChunks > 0, "Number of chunks must be positive.");
+            m_num_chunks = pNumChunks;
+        }
+
+
+        /**
+         * Cache-blocked out-of-place transpose: the @a rows x @a cols matrix
+         * stored row by row in @a in with leading dimension @a ldin is
+         * written column by column to @a out with leading dimension
+         * @a ldout, i.e. out[j*ldout + i] = in[i*ldin + j].
+         */
+        void Transposition::BlockTranspose(
+                                const int        rows,
+                                const int        cols,
+                                const NekDouble *in,
+                                const int        ldin,
+                                      NekDouble *out,
+                                const int        ldout)
+        {
+            static const int tile = 32;
+
+            for(int ii = 0; ii < rows; ii += tile)
+            {
+                int iend = std::min(ii + tile, rows);
+
+                for(int jj = 0; jj < cols; jj += tile)
+                {
+                    int jend = std::min(jj + tile, cols);
+
+                    for(int i = ii; i < iend; ++i)
+                    {
+                        const NekDouble *src = in + i * ldin;
+                        for(int j = jj; j < jend; ++j)
+                        {
+                            out[j * ldout + i] = src[j];
+                        }
+                    }
                 }
             }
         }
@@ -40,6 +40,8 @@
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 
+#include <boost/function.hpp>
+
 namespace Nektar { namespace LibUtilities { class BasisKey; } }
 
 namespace Nektar
@@ -60,6 +62,13 @@ namespace Nektar
             eNoTrans
         };
 
+        /// Operation applied to @a howmany contiguous pencils, from the first
+        /// array into the second, by Transposition::TransformPencils.
+        typedef boost::function<void (int,
+                                      Array<OneD, NekDouble>&,
+                                      Array<OneD, NekDouble>&)>
+            PencilFuncType;
+
         class Transposition
         {
         public:
@@ -94,6 +103,15 @@ namespace Nektar
                     bool UseNumMode = false,
                     TranspositionDir dir = eNoTrans);
 
+            LIB_UTILITIES_EXPORT void TransformPencils(
+                    const Array<OneD,const NekDouble> &inarray,
+                          Array<OneD,      NekDouble> &outarray,
+                    const PencilFuncType              &func,
+                    bool IsForwards,
+                    bool UseNumMode = false);
+
+            LIB_UTILITIES_EXPORT void SetNumChunks(int pNumChunks);
+
             LIB_UTILITIES_EXPORT void SetSpecVanVisc(Array<OneD, NekDouble> visc);
             
             LIB_UTILITIES_EXPORT NekDouble GetSpecVanVisc(const int k);
@@ -103,6 +121,14 @@ namespace Nektar
 
         private:
 
+            static void BlockTranspose(
+                    const int        rows,
+                    const int        cols,
+                    const NekDouble *in,
+                    const int        ldin,
+                          NekDouble *out,
+                    const int        ldout);
+
             LIB_UTILITIES_EXPORT void TransposeXYtoZ(
                     const Array<OneD,const NekDouble> &inarray,
                           Array<OneD,      NekDouble> &outarray,
@@ -160,6 +186,10 @@ namespace Nektar
 
             /// MPI_Alltoallv offset map of send/recv buffer in global vector.
             Array<OneD,int> m_OffsetMap;
+
+            /// Number of chunks the pencils are split into when pipelining
+            /// the exchange with TransformPencils.
+            int m_num_chunks;
         };
 
         typedef boost::shared_ptr<Transposition>      TranspositionSharedPtr;
@@ -37,6 +37,8 @@
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 
+#include <set>
+
 namespace Nektar
 {
     namespace LibUtilities
@@ -48,35 +50,100 @@ namespace Nektar
         NekFFTW::NekFFTW(int N)
                 : NektarFFT(N)
         {
-            m_wsp = Array<OneD, NekDouble>(m_N);
-            phys = Array<OneD,NekDouble>(m_N);
-            coef = Array<OneD,NekDouble>(m_N);
-
-            plan_forward  = fftw_plan_r2r_1d(m_N, &phys[0], &coef[0],
-                                             FFTW_R2HC, FFTW_ESTIMATE);
-            plan_backward = fftw_plan_r2r_1d(m_N, &coef[0], &phys[0],
-                                             FFTW_HC2R, FFTW_ESTIMATE);
-
-            m_FFTW_w = Array<OneD,NekDouble>(m_N);
-            m_FFTW_w_inv = Array<OneD,NekDouble>(m_N);
+            ASSERTL1(m_N % 2 == 0,
+                     "NekFFTW requires an even number of points");
+        }
 
-            m_FFTW_w[0] = 1.0/(NekDouble)m_N;
-            m_FFTW_w[1] = 0.0;
+        // Distructor
+        NekFFTW::~NekFFTW()
+        {
+            std::map<int, PlanPair>::iterator it;
+            for (it = m_plans.begin(); it != m_plans.end(); ++it)
+            {
+                fftw_destroy_plan(it->second.first);
+                fftw_destroy_plan(it->second.second);
+            }
+        }
 
-            m_FFTW_w_inv[0] = m_N;
-            m_FFTW_w_inv[1] = 0.0;
+        void NekFFTW::ImportWisdom()
+        {
+            static std::set<std::string> imported;
 
-            for(int i=2;i<m_N;i++)
+            if (m_wisdomFile.empty() ||
+                imported.find(m_wisdomFile) != imported.end())
             {
-                m_FFTW_w[i]     = m_FFTW_w[0];
-                m_FFTW_w_inv[i] = m_FFTW_w_inv[0];
+                return;
             }
+
+            imported.insert(m_wisdomFile);
+
+            // A missing file simply means no wisdom has been gathered yet.
+            fftw_import_wisdom_from_filename(m_wisdomFile.c_str());
         }
 
-        // Distructor
-        NekFFTW::~NekFFTW()
+        /**
+         * Plans are created for data laid out as @a howmany contiguous
+         * vectors of length m_N. Since FFTW may overwrite the arrays while
+         * measuring, planning is done on scratch storage and the plans are
+         * executed later on arbitrary arrays through the new-array execute
+         * interface, hence FFTW_UNALIGNED.
+         */
+        const NekFFTW::PlanPair &NekFFTW::GetPlans(int howmany)
         {
+            std::map<int, PlanPair>::iterator it = m_plans.find(howmany);
+            if (it != m_plans.end())
+            {
+                return it->second;
+            }
+
+            unsigned int flags = FFTW_UNALIGNED;
+            switch (m_rigour)
+            {
+                case eFFTEstimate:
+                    flags |= FFTW_ESTIMATE;
+                    break;
+                case eFFTMeasure:
+                    flags |= FFTW_MEASURE;
+                    break;
+                case eFFTPatient:
+                    flags |= FFTW_PATIENT;
+                    break;
+            }
 
+            ImportWisdom();
+
+            int n = m_N;
+            fftw_r2r_kind fwdKind = FFTW_R2HC;
+            fftw_r2r_kind bwdKind = FFTW_HC2R;
+
+            Array<OneD, NekDouble> in (howmany*m_N);
+            Array<OneD, NekDouble> out(howmany*m_N);
+
+            PlanPair plans;
+            plans.first  = fftw_plan_many_r2r(1, &n, howmany,
+                                              &in[0],  NULL, 1, m_N,
+                                              &out[0], NULL, 1, m_N,
+                                              &fwdKind, flags);
+            plans.second = fftw_plan_many_r2r(1, &n, howmany,
+                                              &out[0], NULL, 1, m_N,
+                                              &in[0],  NULL, 1, m_N,
+                                              &bwdKind, flags);
+
+            ASSERTL0(plans.first && plans.second,
+                     "Failed to create FFTW plans");
+
+            if (m_exportWisdom && !m_wisdomFile.empty() &&
+                m_rigour != eFFTEstimate)
+            {
+                fftw_export_wisdom_to_filename(m_wisdomFile.c_str());
+            }
+
+            if (m_wsp.num_elements() < howmany*m_N)
+            {
+                m_wsp = Array<OneD, NekDouble>(howmany*m_N);
+            }
+
+            return m_plans[howmany] = plans;
         }
 
         // Forward transformation
@@ -84,13 +151,7 @@ namespace Nektar
                 Array<OneD,NekDouble> &inarray,
                 Array<OneD,NekDouble> &outarray)
         {
-            Vmath::Vcopy(m_N, inarray, 1, phys, 1);
-
-            fftw_execute(plan_forward);
-
-            Reshuffle_FFTW2Nek(coef);
-
-            Vmath::Vcopy(m_N, coef, 1, outarray, 1);
+            v_FFTFwdTrans(1, inarray, outarray);
         }
 
         // Backward transformation
@@ -98,53 +159,70 @@ namespace Nektar
                 Array<OneD,NekDouble> &inarray,
                 Array<OneD,NekDouble> &outarray)
         {
-            Vmath::Vcopy(m_N, inarray, 1, coef, 1);
-
-            Reshuffle_Nek2FFTW(coef);
-
-            fftw_execute(plan_backward);
-
-            Vmath::Vcopy(m_N, phys, 1, outarray, 1);
+            v_FFTBwdTrans(1, inarray, outarray);
         }
 
-        // Reshuffle FFTW2Nek
-        void NekFFTW::Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef)
+        /**
+         * The half-complex output of FFTW, (r0, r1, ..., r_{N/2}, i_{N/2-1},
+         * ..., i1), is reordered into the Nektar++ layout (r0, 0, r1, i1, ...)
+         * and scaled by 1/N in the same pass.
+         */
+        void NekFFTW::v_FFTFwdTrans(
+                int howmany,
+                Array<OneD,NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
         {
-            int halfN = m_N/2;
+            const PlanPair &plans = GetPlans(howmany);
 
-            m_wsp[1] = coef[halfN];
+            fftw_execute_r2r(plans.first, &inarray[0], &m_wsp[0]);
 
-            Vmath::Vcopy(halfN, coef, 1, m_wsp, 2);
+            int       halfN = m_N/2;
+            NekDouble scale = 1.0/(NekDouble)m_N;
 
-            for(int i = 0; i < (halfN - 1); i++)
+            for (int j = 0; j < howmany; ++j)
             {
-                m_wsp[(m_N-1)-2*i] = coef[halfN+1+i];
+                const NekDouble *w = &m_wsp[0]    + j*m_N;
+                NekDouble       *c = &outarray[0] + j*m_N;
+
+                c[0] = scale*w[0];
+                c[1] = 0.0;
+                for (int k = 1; k < halfN; ++k)
+                {
+                    c[2*k]   = scale*w[k];
+                    c[2*k+1] = scale*w[m_N-k];
+                }
             }
-
-            Vmath::Vmul(m_N, m_wsp, 1, m_FFTW_w, 1, coef, 1);
-
-            return;
         }
 
-        // Reshuffle Nek2FFTW
-        void NekFFTW::Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef)
+        /**
+         * Inverse of the reordering in the forward transformation; the
+         * Nyquist mode is discarded.
+         */
+        void NekFFTW::v_FFTBwdTrans(
+                int howmany,
+                Array<OneD,NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
         {
-            int halfN = m_N/2;
-
-            Vmath::Vmul(m_N, coef, 1, m_FFTW_w_inv, 1, coef, 1);
+            const PlanPair &plans = GetPlans(howmany);
 
-            m_wsp[halfN] = coef[1];
-
-            Vmath::Vcopy(halfN, coef, 2, m_wsp, 1);
+            int halfN = m_N/2;
 
-            for(int i = 0; i < (halfN-1); i++)
+            for (int j = 0; j < howmany; ++j)
             {
-                m_wsp[halfN+1+i] = coef[(m_N-1)-2*i];
+                const NekDouble *c = &inarray[0] + j*m_N;
+                NekDouble       *w = &m_wsp[0]   + j*m_N;
+
+                w[0]     = c[0];
+                w[halfN] = 0.0;
+                for (int k = 1; k < halfN; ++k)
+                {
+                    w[k]     = c[2*k];
+                    w[m_N-k] = c[2*k+1];
+                }
             }
 
-            Vmath::Smul(m_N, 1.0/m_N, m_wsp, 1, coef, 1);
-
-            return;
+            // HC2R destroys its input, which is why m_wsp is used.
+            fftw_execute_r2r(plans.second, &m_wsp[0], &outarray[0]);
         }
     }
 }
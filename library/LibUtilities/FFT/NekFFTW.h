@@ -46,6 +46,8 @@
 
 #include <fftw3.h>
 
+#include <map>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -71,10 +73,10 @@ namespace Nektar
 			/// Name of class
 			static std::string className;
 			            
-			// constructor (initialisation of the FFTW planes and fill up the m_FFTW_w vector)
+			// constructor (plans are created on first use of each batch size)
 			NekFFTW(int N);
 			
-			// Distructor
+			// Distructor (destroys the plans)
 			virtual ~NekFFTW();
 			
 			
@@ -83,31 +85,30 @@ namespace Nektar
 			
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
+			virtual void v_FFTFwdTrans(int howmany, Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
+			
+			virtual void v_FFTBwdTrans(int howmany, Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
+			
 			
 			
 		protected:
 			
-			Array<OneD,NekDouble> m_FFTW_w;  // weights to convert arrays form Nektar++ to FFTW format
-			Array<OneD,NekDouble> m_FFTW_w_inv; // weights to convert arrays from FFTW to Nektar++ format
-
-			Array<OneD,NekDouble> phys;
-			Array<OneD,NekDouble> coef;
+			typedef std::pair<fftw_plan, fftw_plan> PlanPair;
+			
+			// Forward/backward plans for each batch size used so far
+			std::map<int, PlanPair> m_plans;
 
 			Array<OneD,NekDouble> m_wsp;     // Workspace area for transforms
-
-			fftw_plan plan_backward;         // plan to execute a backward FFT in FFTW
-			fftw_plan plan_forward;          // plan to execute a forward FFT in FFTW
+			
 			/**
-			 * Reshuffling routines to put the coefficients in Nektar++/FFTW format.
-			 * The routines take as an input the number of points N, the vector of coeffcients
-			 * and the vector containing the weights of the numerical integration.
-			 * The routines modify directly the coef vector.
+			 * Return the forward and backward plans transforming @a howmany
+			 * contiguous vectors of length m_N, creating them with the
+			 * current planning rigour if they do not exist yet.
 			 */
-			void Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef);
-			
-			void Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef);
-			
+			const PlanPair &GetPlans(int howmany);
 			
+			/// Read the wisdom file, if any, once per process.
+			void ImportWisdom();
 
 		private:
 		};
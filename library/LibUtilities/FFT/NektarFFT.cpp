@@ -35,6 +35,8 @@
 
 #include <LibUtilities/FFT/NektarFFT.h>
 #include <loki/Singleton.h>             // for CreateUsingNew, NoDestroy, etc
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
 
 namespace Nektar
 {
@@ -57,10 +59,24 @@ namespace Nektar
 		 * instantiated directly.
 		 */
 		NektarFFT::NektarFFT(int N)
+			: m_rigour(eFFTEstimate),
+			  m_exportWisdom(false)
 		{
 			m_N = N;
 		}
 		
+		std::string NektarFFT::rigourdef =
+			SessionReader::RegisterDefaultSolverInfo(
+				"FFTWPlanRigour", "Estimate");
+		std::string NektarFFT::rigourlookupIds[3] = {
+			SessionReader::RegisterEnumValue(
+				"FFTWPlanRigour", "Estimate", eFFTEstimate),
+			SessionReader::RegisterEnumValue(
+				"FFTWPlanRigour", "Measure",  eFFTMeasure),
+			SessionReader::RegisterEnumValue(
+				"FFTWPlanRigour", "Patient",  eFFTPatient)
+		};
+		
 		NektarFFT::~NektarFFT()
 		{
 			
@@ -91,6 +107,64 @@ namespace Nektar
 			v_FFTBwdTrans(coef,phys);
 		}
 		
+		void NektarFFT::FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			v_FFTFwdTrans(howmany,phys,coef);
+		}
+		
+		void NektarFFT::FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			v_FFTBwdTrans(howmany,coef,phys);
+		}
+		
+		void NektarFFT::SetPlanRigour(FFTPlanRigour rigour)
+		{
+			m_rigour = rigour;
+		}
+		
+		void NektarFFT::SetWisdomFile(const std::string &file, bool exportWisdom)
+		{
+			m_wisdomFile   = file;
+			m_exportWisdom = exportWisdom;
+		}
+		
+		/**
+		 * Wisdom is only written back by the root process of the session
+		 * communicator.
+		 */
+		void NektarFFT::SetPlanning(const SessionReaderSharedPtr &session)
+		{
+			SetPlanRigour(session->GetSolverInfoAsEnum<FFTPlanRigour>(
+				"FFTWPlanRigour"));
+			
+			if(session->DefinesSolverInfo("FFTWWisdomFile"))
+			{
+				SetWisdomFile(session->GetSolverInfo("FFTWWisdomFile"),
+							  session->GetComm()->GetRank() == 0);
+			}
+		}
+		
+		/**
+		 * By default each vector is transformed in turn.
+		 */
+		void NektarFFT::v_FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			Array<OneD,NekDouble> in, out;
+			for(int i = 0; i < howmany; ++i)
+			{
+				v_FFTFwdTrans(in = phys + i*m_N, out = coef + i*m_N);
+			}
+		}
+		
+		void NektarFFT::v_FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			Array<OneD,NekDouble> in, out;
+			for(int i = 0; i < howmany; ++i)
+			{
+				v_FFTBwdTrans(in = coef + i*m_N, out = phys + i*m_N);
+			}
+		}
+		
 		void NektarFFT::v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
 		{
 			
@@ -54,6 +54,23 @@ namespace Nektar
 		 * library or to a specific FFT implementation.
 		 */
 		class NektarFFT;
+		class SessionReader;
+		
+		/// Effort spent by the FFT library in choosing how to perform a
+		/// transform.
+		enum FFTPlanRigour
+		{
+			eFFTEstimate,
+			eFFTMeasure,
+			eFFTPatient
+		};
+		
+		const char* const FFTPlanRigourMap[] =
+		{
+			"Estimate",
+			"Measure",
+			"Patient"
+		};
 		
 		// A shared pointer to the NektarFFT object
 		typedef boost::shared_ptr<NektarFFT>  NektarFFTSharedPtr;
@@ -103,15 +120,51 @@ namespace Nektar
 			 */
 			LIB_UTILITIES_EXPORT void FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			/**
+			 * Forward transformation of @a howmany vectors of length m_N stored
+			 * one after the other in @a phys, into the same layout in @a coef.
+			 */
+			LIB_UTILITIES_EXPORT void FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
+			
+			/**
+			 * Backward transformation of @a howmany vectors of length m_N stored
+			 * one after the other in @a coef, into the same layout in @a phys.
+			 */
+			LIB_UTILITIES_EXPORT void FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+			
+			/// Set the effort spent in planning transforms not yet performed.
+			LIB_UTILITIES_EXPORT void SetPlanRigour(FFTPlanRigour rigour);
+			
+			/**
+			 * Set a file from which previously accumulated planning information
+			 * is read, and to which it is written after planning if
+			 * @a exportWisdom is set.
+			 */
+			LIB_UTILITIES_EXPORT void SetWisdomFile(const std::string &file, bool exportWisdom);
+			
+			/// Apply the planning rigour and wisdom file requested in
+			/// @a session.
+			LIB_UTILITIES_EXPORT void SetPlanning(const boost::shared_ptr<SessionReader> &session);
+			
 		protected:
 			
+			FFTPlanRigour m_rigour;
+			std::string   m_wisdomFile;
+			bool          m_exportWisdom;
 			
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
 						
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			virtual void v_FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
+			
+			virtual void v_FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+			
 		private:
 			
+			static std::string rigourdef;
+			static std::string rigourlookupIds[];
+			
 		};
 	}//end namespace LibUtilities
 }//end of namespace Nektar
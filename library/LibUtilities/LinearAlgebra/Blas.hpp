@@ -96,6 +96,18 @@ namespace Blas
                  const double* a,     const int& lda,
                  const double* b,     const int& ldb,
                  const double& beta,  double* c, const int& ldc);
+
+        void F77NAME(dtrsm) (const char& side,    const char& uplo,
+                 const char& transa,  const char& diag,
+                 const int& m,        const int& n,
+                 const double& alpha, const double* a,
+                 const int& lda,      double* b, const int& ldb);
+
+        void F77NAME(dsyrk) (const char& uplo,    const char& trans,
+                 const int& n,        const int& k,
+                 const double& alpha, const double* a,
+                 const int& lda,      const double& beta,
+                 double* c,           const int& ldc);
     }
 
 #ifdef NEKTAR_USING_BLAS
@@ -219,6 +231,25 @@ namespace Blas
         F77NAME(dgemm) (transa,transb,m,n,k,alpha,a,lda,b,ldb,beta,c,ldc);
     }
 
+    /// \brief BLAS level 3: Solve op(A) X = alpha B or X op(A) = alpha B
+    /// where A is triangular; B is overwritten by X.
+    static inline void Dtrsm (const char& side,    const char& uplo,
+          const char& transa,  const char& diag,   const int& m,
+          const int& n,        const double& alpha, const double* a,
+          const int& lda,      double* b,           const int& ldb)
+    {
+        F77NAME(dtrsm) (side,uplo,transa,diag,m,n,alpha,a,lda,b,ldb);
+    }
+
+    /// \brief BLAS level 3: Symmetric rank-k update C = alpha A A^T + beta C
+    static inline void Dsyrk (const char& uplo,    const char& trans,
+          const int& n,        const int& k,       const double& alpha,
+          const double* a,     const int& lda,     const double& beta,
+          double* c,           const int& ldc)
+    {
+        F77NAME(dsyrk) (uplo,trans,n,k,alpha,a,lda,beta,c,ldc);
+    }
+
     // \brief Wrapper to mutliply two (row major) matrices together C =
     // a*A*B + b*C
     static inline void Cdgemm(const int M, const int N, const int K, const double a,
@@ -56,6 +56,8 @@ namespace Lapack
                               double* b, const int& ldb, int& info);
         void F77NAME(dpptrf) (const char& uplo, const int& n,
                   double* ap, int& info);
+        void F77NAME(dpotrf) (const char& uplo, const int& n,
+                  double* a, const int& lda, int& info);
         void F77NAME(dpptrs) (const char& uplo, const int& n,
                   const int& nrhs, const double* ap,
                   double* b, const int& ldb, int& info);
@@ -87,6 +89,25 @@ namespace Lapack
                               double* lev,  const int& ldv,
                               double* work, const int& lwork, int& info);
 
+        void F77NAME(dgees)  (const char& jobvs, const char& sort,
+                              int (*select)(const double*, const double*),
+                              const int& n, double* a, const int& lda,
+                              int& sdim, double* wr, double* wi,
+                              double* vs, const int& ldvs,
+                              double* work, const int& lwork,
+                              int* bwork, int& info);
+        void F77NAME(dtrexc) (const char& compq, const int& n,
+                              double* t, const int& ldt,
+                              double* q, const int& ldq,
+                              int& ifst, int& ilst,
+                              double* work, int& info);
+        void F77NAME(dgesvd) (const char& jobu, const char& jobvt,
+                              const int& m, const int& n,
+                              double* a, const int& lda, double* s,
+                              double* u, const int& ldu,
+                              double* vt, const int& ldvt,
+                              double* work, const int& lwork, int& info);
+
         void F77NAME(dspev)  (const char& jobz, const char& uplo, const int& n,
                   double* ap, double* w, double* z, const int& ldz,
                   double* work, int& info);
@@ -118,6 +139,13 @@ namespace Lapack
         F77NAME(dsptrs) (uplo,n,nrhs,ap,ipiv,b,ldb,info);
     }
 
+    /// \brief Cholesky factor a real Positive Definite symmetric matrix.
+    static inline void Dpotrf (const char& uplo, const int& n,
+              double *a, const int& lda, int& info)
+    {
+        F77NAME(dpotrf) (uplo,n,a,lda,info);
+    }
+
     /// \brief Cholesky factor a real Positive Definite packed-symmetric matrix.
     static inline void Dpptrf (const char& uplo, const int& n,
               double *ap, int& info)
@@ -209,6 +237,39 @@ namespace Lapack
             ldr, lev, ldv, work, lwork, info);
     }
 
+    /// \brief Compute the real Schur form of a general real matrix,
+    /// without ordering the eigenvalues.
+    static inline void Dgees (const char& jobvs, const int& n,
+             double* a, const int& lda, double* wr, double* wi,
+             double* vs, const int& ldvs,
+             double* work, const int& lwork, int& info)
+    {
+        int sdim;
+        F77NAME(dgees) (jobvs, 'N', 0, n, a, lda, sdim, wr, wi, vs, ldvs,
+            work, lwork, 0, info);
+    }
+
+    /// \brief Reorder the real Schur form of a matrix, moving the diagonal
+    /// block at row ifst to row ilst.
+    static inline void Dtrexc (const char& compq, const int& n,
+             double* t, const int& ldt, double* q, const int& ldq,
+             int& ifst, int& ilst, double* work, int& info)
+    {
+        F77NAME(dtrexc) (compq, n, t, ldt, q, ldq, ifst, ilst, work, info);
+    }
+
+    /// \brief Compute the singular value decomposition of a general real
+    /// matrix.
+    static inline void Dgesvd (const char& jobu, const char& jobvt,
+             const int& m, const int& n, double* a, const int& lda,
+             double* s, double* u, const int& ldu,
+             double* vt, const int& ldvt,
+             double* work, const int& lwork, int& info)
+    {
+        F77NAME(dgesvd) (jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+            work, lwork, info);
+    }
+
     /// \brief Solve packed-symmetric real matrix eigenproblem.
     static inline void Dspev (const char& jobz, const char& uplo, const int& n,
              double* ap, double* w, double* z, const int& ldz,
@@ -0,0 +1,544 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SparseCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: supernodal sparse Cholesky factorisation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <LibUtilities/LinearAlgebra/SparseCholesky.hpp>
+
+namespace Nektar
+{
+    SparseCholesky::SparseCholesky(
+            const IndexType     nRows,
+            const COOMatType   &cooMat,
+            const unsigned int  nThreads)
+        : m_nRows(nRows)
+    {
+        if (nThreads > 1)
+        {
+            m_threadPool = LibUtilities::GetThreadPool(nThreads);
+        }
+
+        // Lower triangular part of the matrix stored by columns
+        ColumnVector columns(nRows);
+        COOMatTypeConstIt entry;
+        for (entry = cooMat.begin(); entry != cooMat.end(); ++entry)
+        {
+            IndexType row = entry->first.first;
+            IndexType col = entry->first.second;
+            if (row <= col)
+            {
+                columns[row].push_back(std::make_pair((int) col,
+                                                      entry->second));
+            }
+        }
+
+        Analyse(columns);
+        Factorise(columns);
+    }
+
+    SparseCholesky::~SparseCholesky()
+    {
+    }
+
+    IndexType SparseCholesky::GetRows() const
+    {
+        return m_nRows;
+    }
+
+    IndexType SparseCholesky::GetNumSupernodes() const
+    {
+        return m_snodeParent.size();
+    }
+
+    size_t SparseCholesky::GetNumFactorNonZeros() const
+    {
+        size_t nnz = 0;
+        for (int s = 0; s < m_snodeParent.size(); ++s)
+        {
+            int k = m_snodeStart[s+1] - m_snodeStart[s];
+            nnz += m_snodeRows[s].size()*k - k*(k-1)/2;
+        }
+        return nnz;
+    }
+
+    /**
+     * Symbolic factorisation: compute the elimination tree, the sparsity
+     * pattern of each column of \f$ L \f$ and group the columns into
+     * fundamental supernodes.
+     */
+    void SparseCholesky::Analyse(const ColumnVector &columns)
+    {
+        int n = m_nRows;
+        int i, j, k, c, next;
+
+        // Elimination tree, using path compression
+        std::vector<std::vector<int> > upper(n);
+        for (j = 0; j < n; ++j)
+        {
+            for (k = 0; k < columns[j].size(); ++k)
+            {
+                if (columns[j][k].first > j)
+                {
+                    upper[columns[j][k].first].push_back(j);
+                }
+            }
+        }
+
+        std::vector<int> parent  (n, -1);
+        std::vector<int> ancestor(n, -1);
+        for (k = 0; k < n; ++k)
+        {
+            for (c = 0; c < upper[k].size(); ++c)
+            {
+                for (i = upper[k][c]; i != -1 && i < k; i = next)
+                {
+                    next = ancestor[i];
+                    ancestor[i] = k;
+                    if (next == -1)
+                    {
+                        parent[i] = k;
+                    }
+                }
+            }
+        }
+        upper.clear();
+
+        std::vector<std::vector<int> > children(n);
+        for (j = 0; j < n; ++j)
+        {
+            if (parent[j] >= 0)
+            {
+                children[parent[j]].push_back(j);
+            }
+        }
+
+        // Column patterns of L. The pattern of column j is that of column j
+        // of A merged with the patterns of its children in the elimination
+        // tree. The pattern of a column which is not the first of its
+        // supernode is released once its parent has been processed; only
+        // those of the first column of each supernode are retained.
+        std::vector<std::vector<int> > pattern(n);
+        std::vector<int>  marker(n, -1);
+        std::vector<int>  count (n, 0);
+        std::vector<bool> isStart(n, true);
+        for (j = 0; j < n; ++j)
+        {
+            std::vector<int> &pj = pattern[j];
+            pj.push_back(j);
+            marker[j] = j;
+
+            for (k = 0; k < columns[j].size(); ++k)
+            {
+                i = columns[j][k].first;
+                if (marker[i] != j)
+                {
+                    marker[i] = j;
+                    pj.push_back(i);
+                }
+            }
+
+            for (c = 0; c < children[j].size(); ++c)
+            {
+                std::vector<int> &pc = pattern[children[j][c]];
+                for (k = 0; k < pc.size(); ++k)
+                {
+                    i = pc[k];
+                    if (i > j && marker[i] != j)
+                    {
+                        marker[i] = j;
+                        pj.push_back(i);
+                    }
+                }
+
+                if (!isStart[children[j][c]])
+                {
+                    std::vector<int>().swap(pc);
+                }
+            }
+
+            std::sort(pj.begin(), pj.end());
+            count[j] = pj.size();
+
+            if (j > 0 && parent[j-1] == j && children[j].size() == 1 &&
+                count[j-1] == count[j] + 1)
+            {
+                isStart[j] = false;
+            }
+        }
+
+        // Supernodes and supernodal elimination tree
+        std::vector<int> colToSnode(n);
+        for (j = 0; j < n; ++j)
+        {
+            if (isStart[j])
+            {
+                m_snodeStart.push_back(j);
+                m_snodeRows.push_back(std::vector<int>());
+                m_snodeRows.back().swap(pattern[j]);
+            }
+            colToSnode[j] = m_snodeStart.size() - 1;
+        }
+        m_snodeStart.push_back(n);
+
+        int nSnode = m_snodeRows.size();
+        m_snodeParent.resize(nSnode);
+        m_snodeChildren.resize(nSnode);
+        for (int s = 0; s < nSnode; ++s)
+        {
+            int p = parent[m_snodeStart[s+1] - 1];
+            m_snodeParent[s] = (p >= 0) ? colToSnode[p] : -1;
+            if (p >= 0)
+            {
+                m_snodeChildren[m_snodeParent[s]].push_back(s);
+            }
+        }
+    }
+
+    /**
+     * Numerical factorisation, processing each supernode once those of its
+     * children are complete.
+     */
+    void SparseCholesky::Factorise(const ColumnVector &columns)
+    {
+        std::vector<std::vector<NekDouble> > update(m_snodeParent.size());
+
+        // One status per supernode: each is written by the single thread
+        // factorising that supernode and only read after the traversal has
+        // joined, so no flag is shared between threads.
+        std::vector<int> info(m_snodeParent.size(), 0);
+
+        m_factor.resize(m_snodeParent.size());
+
+        TraverseTree(true, boost::bind(
+                         &SparseCholesky::FactoriseSupernode, this, _1, _2,
+                         boost::cref(columns), boost::ref(update),
+                         boost::ref(info)));
+
+        int nFailed = info.size() - std::count(info.begin(), info.end(), 0);
+        ASSERTL0(nFailed == 0, "Sparse Cholesky factorisation failed: "
+                               "matrix is not positive definite");
+    }
+
+    /**
+     * Assemble the frontal matrix of supernode @a s from the matrix entries
+     * of its columns and the update matrices of its children, factorise its
+     * leading columns and compute its own update matrix.
+     */
+    void SparseCholesky::FactoriseSupernode(
+            const int                               s,
+                  std::vector<int>                 &relIdx,
+            const ColumnVector                     &columns,
+                  std::vector<std::vector<NekDouble> > &update,
+                  std::vector<int>                 &info)
+    {
+        const std::vector<int> &rows = m_snodeRows[s];
+        int first = m_snodeStart[s];
+        int k     = m_snodeStart[s+1] - first;
+        int m     = rows.size();
+        int mu    = m - k;
+        int a, b, c, j;
+
+        for (a = 0; a < m; ++a)
+        {
+            relIdx[rows[a]] = a;
+        }
+
+        std::vector<NekDouble> front(m*m, 0.0);
+
+        for (j = 0; j < k; ++j)
+        {
+            const std::vector<std::pair<int, NekDouble> > &col
+                                                    = columns[first + j];
+            for (a = 0; a < col.size(); ++a)
+            {
+                front[relIdx[col[a].first] + m*j] += col[a].second;
+            }
+        }
+
+        // Extend-add the update matrices of the children
+        for (c = 0; c < m_snodeChildren[s].size(); ++c)
+        {
+            int child = m_snodeChildren[s][c];
+            const std::vector<int> &crows = m_snodeRows[child];
+            int kc  = m_snodeStart[child+1] - m_snodeStart[child];
+            int muc = crows.size() - kc;
+            const std::vector<NekDouble> &u = update[child];
+
+            for (b = 0; b < muc; ++b)
+            {
+                int cb = relIdx[crows[kc+b]];
+                for (a = b; a < muc; ++a)
+                {
+                    front[relIdx[crows[kc+a]] + m*cb] += u[a + muc*b];
+                }
+            }
+            std::vector<NekDouble>().swap(update[child]);
+        }
+
+        Lapack::Dpotrf('L', k, &front[0], m, info[s]);
+
+        if (mu > 0)
+        {
+            // L21 = A21 L11^{-T}, U = A22 - L21 L21^T
+            Blas::Dtrsm('R', 'L', 'T', 'N', mu, k, 1.0, &front[0], m,
+                        &front[k], m);
+            Blas::Dsyrk('L', 'N', mu, k, -1.0, &front[k], m, 1.0,
+                        &front[k + m*k], m);
+
+            update[s].resize(mu*mu);
+            for (b = 0; b < mu; ++b)
+            {
+                std::copy(&front[k + m*(k+b)], &front[0] + m*(k+b+1),
+                          &update[s][mu*b]);
+            }
+        }
+
+        m_factor[s].assign(front.begin(), front.begin() + m*k);
+    }
+
+    void SparseCholesky::Solve(
+            const Array<OneD, const NekDouble> &in,
+                  Array<OneD,       NekDouble> &out) const
+    {
+        ASSERTL1(in.num_elements() >= m_nRows && out.num_elements() >= m_nRows,
+                 "Vectors are too short for this matrix");
+
+        std::vector<std::vector<NekDouble> > update(m_snodeParent.size());
+
+        // Forward substitution L y = b, bottom-up
+        TraverseTree(true, boost::bind(
+                         &SparseCholesky::ForwardSupernode, this, _1, _2,
+                         boost::ref(update), in.get(), out.get()));
+
+        // Backward substitution L^T x = y, top-down
+        TraverseTree(false, boost::bind(
+                         &SparseCholesky::BackwardSupernode, this, _1, _2,
+                         out.get()));
+    }
+
+    /**
+     * Forward substitution for the columns of supernode @a s. Contributions
+     * to rows below the supernode are accumulated in an update vector which
+     * is added in by the parent supernode.
+     */
+    void SparseCholesky::ForwardSupernode(
+            const int                               s,
+                  std::vector<int>                 &relIdx,
+                  std::vector<std::vector<NekDouble> > &update,
+            const NekDouble                        *in,
+                  NekDouble                        *out) const
+    {
+        const std::vector<int>       &rows = m_snodeRows[s];
+        const std::vector<NekDouble> &L    = m_factor[s];
+        int first = m_snodeStart[s];
+        int k     = m_snodeStart[s+1] - first;
+        int m     = rows.size();
+        int mu    = m - k;
+        int a, c, info = 0;
+
+        for (a = 0; a < m; ++a)
+        {
+            relIdx[rows[a]] = a;
+        }
+
+        std::vector<NekDouble> f(m, 0.0);
+        std::copy(in + first, in + first + k, f.begin());
+
+        for (c = 0; c < m_snodeChildren[s].size(); ++c)
+        {
+            int child = m_snodeChildren[s][c];
+            const std::vector<int> &crows = m_snodeRows[child];
+            int kc  = m_snodeStart[child+1] - m_snodeStart[child];
+            int muc = crows.size() - kc;
+            const std::vector<NekDouble> &u = update[child];
+
+            for (a = 0; a < muc; ++a)
+            {
+                f[relIdx[crows[kc+a]]] += u[a];
+            }
+            std::vector<NekDouble>().swap(update[child]);
+        }
+
+        Lapack::Dtrtrs('L', 'N', 'N', k, 1, &L[0], m, &f[0], m, info);
+
+        if (mu > 0)
+        {
+            Blas::Dgemv('N', mu, k, -1.0, &L[k], m, &f[0], 1, 1.0, &f[k], 1);
+            update[s].assign(f.begin() + k, f.end());
+        }
+
+        std::copy(f.begin(), f.begin() + k, out + first);
+    }
+
+    /**
+     * Backward substitution for the columns of supernode @a s, once the
+     * solution is known for all of its ancestors.
+     */
+    void SparseCholesky::BackwardSupernode(
+            const int                               s,
+                  std::vector<int>                 &relIdx,
+                  NekDouble                        *out) const
+    {
+        const std::vector<int>       &rows = m_snodeRows[s];
+        const std::vector<NekDouble> &L    = m_factor[s];
+        int first = m_snodeStart[s];
+        int k     = m_snodeStart[s+1] - first;
+        int m     = rows.size();
+        int mu    = m - k;
+        int a, info = 0;
+
+        std::vector<NekDouble> f(out + first, out + first + k);
+
+        if (mu > 0)
+        {
+            std::vector<NekDouble> x(mu);
+            for (a = 0; a < mu; ++a)
+            {
+                x[a] = out[rows[k+a]];
+            }
+            Blas::Dgemv('T', mu, k, -1.0, &L[k], m, &x[0], 1, 1.0, &f[0], 1);
+        }
+
+        Lapack::Dtrtrs('L', 'T', 'N', k, 1, &L[0], m, &f[0], k, info);
+
+        std::copy(f.begin(), f.end(), out + first);
+    }
+
+    /**
+     * Apply @a task to every supernode, either from the leaves to the root
+     * (each supernode after all of its children) or from the root to the
+     * leaves (each supernode after its parent). Independent supernodes are
+     * distributed across the threads of #m_threadPool.
+     */
+    void SparseCholesky::TraverseTree(
+            const bool           bottomUp,
+            const SupernodeTask &task) const
+    {
+        int nSnode = m_snodeParent.size();
+        int s;
+
+        TreeTraversal traversal;
+        traversal.m_nDone    = 0;
+        traversal.m_bottomUp = bottomUp;
+        traversal.m_pending.resize(nSnode, 0);
+
+        for (s = 0; s < nSnode; ++s)
+        {
+            if (bottomUp)
+            {
+                traversal.m_pending[s] = m_snodeChildren[s].size();
+            }
+            else
+            {
+                traversal.m_pending[s] = (m_snodeParent[s] >= 0) ? 1 : 0;
+            }
+
+            if (traversal.m_pending[s] == 0)
+            {
+                traversal.m_ready.push_back(s);
+            }
+        }
+
+        if (!m_threadPool || nSnode <= 1)
+        {
+            TraverseTreeWorker(traversal, task);
+            return;
+        }
+
+        // Threads without a ready supernode wait until the traversal is
+        // complete, so the pool may have more threads than supernodes.
+        m_threadPool->Run(boost::bind(
+                &SparseCholesky::TraverseTreeWorker, this,
+                boost::ref(traversal), boost::cref(task)));
+    }
+
+    void SparseCholesky::TraverseTreeWorker(
+                  TreeTraversal &traversal,
+            const SupernodeTask &task) const
+    {
+        int nSnode = m_snodeParent.size();
+        int s, c;
+        std::vector<int> relIdx(m_nRows);
+
+        boost::unique_lock<boost::mutex> lock(traversal.m_mutex);
+        while (true)
+        {
+            while (traversal.m_ready.empty() && traversal.m_nDone < nSnode)
+            {
+                traversal.m_cond.wait(lock);
+            }
+
+            if (traversal.m_ready.empty())
+            {
+                break;
+            }
+
+            s = traversal.m_ready.front();
+            traversal.m_ready.pop_front();
+
+            lock.unlock();
+            task(s, relIdx);
+            lock.lock();
+
+            ++traversal.m_nDone;
+            if (traversal.m_bottomUp)
+            {
+                int p = m_snodeParent[s];
+                if (p >= 0 && --traversal.m_pending[p] == 0)
+                {
+                    traversal.m_ready.push_back(p);
+                }
+            }
+            else
+            {
+                for (c = 0; c < m_snodeChildren[s].size(); ++c)
+                {
+                    int child = m_snodeChildren[s][c];
+                    if (--traversal.m_pending[child] == 0)
+                    {
+                        traversal.m_ready.push_back(child);
+                    }
+                }
+            }
+            traversal.m_cond.notify_all();
+        }
+    }
+}
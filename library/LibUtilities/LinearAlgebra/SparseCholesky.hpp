@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SparseCholesky.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: supernodal sparse Cholesky factorisation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_HPP
+#define NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_HPP
+
+#include <vector>
+#include <deque>
+#include <boost/function.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <LibUtilities/BasicUtils/ThreadPool.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+
+namespace Nektar
+{
+    /**
+     * Sparse Cholesky factorisation \f$ A = LL^T \f$ of a symmetric positive
+     * definite matrix.
+     *
+     * The factorisation uses the multifrontal method on fundamental
+     * supernodes, i.e. sets of consecutive columns of \f$ L \f$ sharing the
+     * same sparsity pattern, so that the numerical work is done by dense
+     * LAPACK/BLAS kernels. No fill-reducing reordering is applied: the
+     * matrix is expected to be numbered such that fill-in is small, e.g.
+     * by a nested dissection ordering. Independent subtrees of the
+     * supernodal elimination tree are processed concurrently, both in the
+     * numerical factorisation and in the forward and backward substitution.
+     */
+    class SparseCholesky
+    {
+    public:
+        /// Analyse and factorise the matrix given by the upper triangular
+        /// entries of @a cooMat; entries below the diagonal are ignored.
+        LIB_UTILITIES_EXPORT SparseCholesky(
+                const IndexType     nRows,
+                const COOMatType   &cooMat,
+                const unsigned int  nThreads = 1);
+
+        LIB_UTILITIES_EXPORT ~SparseCholesky();
+
+        /// Solve \f$ A x = b \f$.
+        LIB_UTILITIES_EXPORT void Solve(
+                const Array<OneD, const NekDouble> &in,
+                      Array<OneD,       NekDouble> &out) const;
+
+        LIB_UTILITIES_EXPORT IndexType GetRows() const;
+        LIB_UTILITIES_EXPORT IndexType GetNumSupernodes() const;
+        /// Number of non-zero entries of the factor \f$ L \f$.
+        LIB_UTILITIES_EXPORT size_t    GetNumFactorNonZeros() const;
+
+    private:
+        typedef std::vector<std::vector<std::pair<int, NekDouble> > >
+                                                        ColumnVector;
+        typedef boost::function<void (const int, std::vector<int> &)>
+                                                        SupernodeTask;
+
+        /// Shared state of the threads traversing the supernodal tree.
+        struct TreeTraversal
+        {
+            boost::mutex               m_mutex;
+            boost::condition_variable  m_cond;
+            std::deque<int>            m_ready;
+            std::vector<int>           m_pending;
+            int                        m_nDone;
+            bool                       m_bottomUp;
+        };
+
+        IndexType                              m_nRows;
+        /// Shared pool running the tree traversals, if more than one
+        /// thread is used.
+        LibUtilities::ThreadPoolSharedPtr      m_threadPool;
+        /// First column of each supernode, with one past the last column
+        /// appended.
+        std::vector<int>                       m_snodeStart;
+        /// Parent of each supernode in the supernodal elimination tree.
+        std::vector<int>                       m_snodeParent;
+        std::vector<std::vector<int> >         m_snodeChildren;
+        /// Sorted row indices of the columns of each supernode.
+        std::vector<std::vector<int> >         m_snodeRows;
+        /// Columns of \f$ L \f$ for each supernode, stored as a dense
+        /// column-major block of size rows by columns.
+        std::vector<std::vector<NekDouble> >   m_factor;
+
+        void Analyse(const ColumnVector &columns);
+
+        void Factorise(const ColumnVector &columns);
+
+        void FactoriseSupernode(
+                const int                               s,
+                      std::vector<int>                 &relIdx,
+                const ColumnVector                     &columns,
+                      std::vector<std::vector<NekDouble> > &update,
+                      std::vector<int>                 &info);
+
+        void ForwardSupernode(
+                const int                               s,
+                      std::vector<int>                 &relIdx,
+                      std::vector<std::vector<NekDouble> > &update,
+                const NekDouble                        *in,
+                      NekDouble                        *out) const;
+
+        void BackwardSupernode(
+                const int                               s,
+                      std::vector<int>                 &relIdx,
+                      NekDouble                        *out) const;
+
+        void TraverseTree(
+                const bool           bottomUp,
+                const SupernodeTask &task) const;
+
+        void TraverseTreeWorker(
+                      TreeTraversal &traversal,
+                const SupernodeTask &task) const;
+    };
+
+    typedef boost::shared_ptr<SparseCholesky> SparseCholeskySharedPtr;
+}
+
+#endif //NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_HPP
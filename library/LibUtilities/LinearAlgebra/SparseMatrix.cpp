@@ -45,8 +45,11 @@
 #include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
 #include <LibUtilities/LinearAlgebra/SparseMatrix.hpp>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSellCS.hpp>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
 
 #include <boost/lexical_cast.hpp>
+#include <boost/bind.hpp>
 
 using std::min;
 using std::max;
@@ -64,7 +67,9 @@ namespace Nektar
     template<typename SparseStorageType>
     NekSparseMatrix<SparseStorageType>::NekSparseMatrix(const NekSparseMatrix& src):
         m_mulCallsCounter(src.m_mulCallsCounter),
-        m_sparseStorage(src.m_sparseStorage)
+        m_sparseStorage(src.m_sparseStorage),
+        m_threadPool(src.m_threadPool),
+        m_threadBounds(src.m_threadBounds)
     {
     }
 
@@ -124,6 +129,12 @@ namespace Nektar
     void NekSparseMatrix<SparseStorageType>::Multiply(const DataVectorType &in,
                         DataVectorType &out)
     {
+        if (m_threadPool)
+        {
+            Multiply(in.get(), out.get());
+            return;
+        }
+
         m_sparseStorage->Multiply(in,out);
         m_mulCallsCounter++;
     }
@@ -132,10 +143,46 @@ namespace Nektar
     void NekSparseMatrix<SparseStorageType>::Multiply(const DataType* in,
                         DataType* out)
     {
-        m_sparseStorage->Multiply(in,out);
+        if (m_threadPool)
+        {
+            m_threadPool->Run(boost::bind(
+                &NekSparseMatrix<SparseStorageType>::MultiplyThread,
+                this, in, out, _1));
+        }
+        else
+        {
+            m_sparseStorage->Multiply(in,out);
+        }
         m_mulCallsCounter++;
     }
 
+    template<typename SparseStorageType>
+    void NekSparseMatrix<SparseStorageType>::SetThreadPool(
+                const boost::shared_ptr<LibUtilities::ThreadPool> &pool)
+    {
+        if (!pool || pool->GetNumThreads() < 2)
+        {
+            m_threadPool.reset();
+            m_threadBounds.clear();
+            return;
+        }
+
+        m_threadPool = pool;
+        m_sparseStorage->PartitionRowGroups(pool->GetNumThreads(),
+                                            m_threadBounds);
+    }
+
+    template<typename SparseStorageType>
+    void NekSparseMatrix<SparseStorageType>::MultiplyThread(
+                        const DataType* in,
+                              DataType* out,
+                        const unsigned int thread)
+    {
+        m_sparseStorage->MultiplyRowGroups(in, out,
+                                           m_threadBounds[thread],
+                                           m_threadBounds[thread+1]);
+    }
+
     template<typename SparseStorageType>
     const size_t NekSparseMatrix<SparseStorageType>::GetMemoryFootprint() const
     {
@@ -269,6 +316,7 @@ namespace Nektar
 
     // explicit instantiation
     template class NekSparseMatrix<StorageSmvBsr<NekDouble> >;
+    template class NekSparseMatrix<StorageSellCS<NekDouble> >;
 
 
 } // namespace
@@ -51,6 +51,10 @@
 
 namespace Nektar
 {
+    namespace LibUtilities
+    {
+        class ThreadPool;
+    }
 
     /*
      * This is a class-container to a single sparse matrices.
@@ -96,6 +100,11 @@ namespace Nektar
         LIB_UTILITIES_EXPORT void Multiply(const DataType* in,
                             DataType* out);
 
+        /// Perform subsequent multiplies on the threads of @a pool, each
+        /// thread computing a contiguous range of rows of similar work.
+        LIB_UTILITIES_EXPORT void SetThreadPool(
+                const boost::shared_ptr<LibUtilities::ThreadPool> &pool);
+
 
         LIB_UTILITIES_EXPORT void writeSparsityPatternTo(std::ostream& out, IndexType blockSize = 64);
         LIB_UTILITIES_EXPORT void writeBlockSparsityPatternTo(std::ostream& out,
@@ -106,7 +115,13 @@ namespace Nektar
         unsigned long           m_mulCallsCounter;
         SparseStorageSharedPtr  m_sparseStorage;
 
+        boost::shared_ptr<LibUtilities::ThreadPool> m_threadPool;
+        /// Row groups of the storage multiplied by each thread
+        std::vector<IndexType>  m_threadBounds;
+
     private:
+        void MultiplyThread(const DataType* in, DataType* out,
+                            const unsigned int thread);
 
     };
 
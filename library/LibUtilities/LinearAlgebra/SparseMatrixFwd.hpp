@@ -69,6 +69,7 @@ namespace Nektar
 
 
     template<typename DataType> class StorageSmvBsr;
+    template<typename DataType> class StorageSellCS;
 
     template<typename SparseStorageType> class NekSparseMatrix;
     template<typename SparseStorageType> class NekSparseDiagBlkMatrix;
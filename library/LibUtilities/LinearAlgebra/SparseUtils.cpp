@@ -35,12 +35,15 @@
 
 #include <utility>
 #include <map>
+#include <vector>
+#include <algorithm>
 
 #include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
 #include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
 #include <LibUtilities/LinearAlgebra/SparseMatrix.hpp>
 #include <LibUtilities/LinearAlgebra/SparseDiagBlkMatrix.hpp>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSellCS.hpp>
 
 
 namespace Nektar{
@@ -83,6 +86,35 @@ namespace Nektar{
         }
     }
 
+    /**
+     * Splits @a nGroups consecutive row groups into @a nParts contiguous
+     * ranges of roughly equal work, where the work of the groups before
+     * group i is given by @a workOffsets[i] (e.g. the row pointer array of a
+     * CSR-like storage). On output part p covers the groups
+     * [bounds[p], bounds[p+1]).
+     */
+    void partitionByWork(
+                    const IndexType     *workOffsets,
+                    const IndexType      nGroups,
+                    const unsigned int   nParts,
+                          std::vector<IndexType> &bounds)
+    {
+        bounds.resize(nParts+1);
+        bounds[0]      = 0;
+        bounds[nParts] = nGroups;
+
+        const double total = workOffsets[nGroups] - workOffsets[0];
+        for (unsigned int p = 1; p < nParts; ++p)
+        {
+            IndexType target = workOffsets[0] +
+                (IndexType)(total * p / nParts);
+            bounds[p] = std::lower_bound(workOffsets,
+                                         workOffsets + nGroups,
+                                         target) - workOffsets;
+            bounds[p] = std::max(bounds[p], bounds[p-1]);
+        }
+    }
+
     template<typename SparseStorageType>
     std::ostream& operator<<(std::ostream& os, const NekSparseMatrix<SparseStorageType>& rhs)
     {
@@ -141,5 +173,6 @@ namespace Nektar{
 
     template std::ostream& operator<<(std::ostream& os, const NekSparseMatrix<StorageSmvBsr<NekDouble> >& rhs);
     template std::ostream& operator<<(std::ostream& os, const NekSparseDiagBlkMatrix<StorageSmvBsr<NekDouble> >& rhs);
+    template std::ostream& operator<<(std::ostream& os, const NekSparseMatrix<StorageSellCS<NekDouble> >& rhs);
 
 } // namespace
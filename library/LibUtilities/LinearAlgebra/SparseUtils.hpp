@@ -47,6 +47,12 @@ namespace Nektar{
                     const COOMatType&   cooMat,
                           BCOMatType&   bcoMat);
 
+    LIB_UTILITIES_EXPORT void partitionByWork(
+                    const IndexType     *workOffsets,
+                    const IndexType      nGroups,
+                    const unsigned int   nParts,
+                          std::vector<IndexType> &bounds);
+
     template<class SparseStorageType>
     std::ostream& operator<<(std::ostream& os, const NekSparseMatrix<SparseStorageType>& rhs);
 
@@ -0,0 +1,492 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: StorageSellCS.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: 0-based sliced ELLPACK (SELL-C-sigma) sparse storage class.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+
+#include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSellCS.hpp>
+#include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
+
+namespace Nektar
+{
+
+    template<typename DataType>
+    StorageSellCS<DataType>::const_iterator::const_iterator(
+                    const StorageSellCS& storage,
+                    IndexType            sortedRow) :
+        m_storage(storage),
+        m_iter(),
+        m_row(sortedRow),
+        m_pos(0)
+    {
+        m_iter.nnzindex = (sortedRow >= storage.m_rows) ? storage.m_nStored : 0;
+        settle();
+    }
+
+    template<typename DataType>
+    StorageSellCS<DataType>::const_iterator::const_iterator(const const_iterator& src):
+        m_storage(src.m_storage),
+        m_iter(src.m_iter),
+        m_row(src.m_row),
+        m_pos(src.m_pos)
+    {
+    }
+
+    template<typename DataType>
+    StorageSellCS<DataType>::const_iterator::~const_iterator()
+    {
+    }
+
+    // Skips rows without (further) entries and fills in the current entry.
+    template<typename DataType>
+    void StorageSellCS<DataType>::const_iterator::settle()
+    {
+        while (m_row < m_storage.m_rows && m_pos >= m_storage.m_rowLen[m_row])
+        {
+            m_row++;
+            m_pos = 0;
+        }
+
+        if (m_row >= m_storage.m_rows)
+        {
+            return;
+        }
+
+        const IndexType C     = m_storage.m_chunkSize;
+        const IndexType chunk = m_row / C;
+
+        m_iter.storageindex = m_storage.m_chunkPtr[chunk] + m_pos*C + m_row % C;
+        m_iter.first.first  = m_storage.m_perm[m_row];
+        m_iter.first.second = m_storage.m_col[m_iter.storageindex];
+        m_iter.second       = m_storage.m_val[m_iter.storageindex];
+    }
+
+    template<typename DataType>
+    typename StorageSellCS<DataType>::const_iterator StorageSellCS<DataType>::const_iterator::operator++(int)
+    {
+        const_iterator out = *this;
+        ++(*this);
+        return out;
+    }
+
+    template<typename DataType>
+    typename StorageSellCS<DataType>::const_iterator& StorageSellCS<DataType>::const_iterator::operator++()
+    {
+        m_pos++;
+        m_iter.nnzindex++;
+        settle();
+        return *this;
+    }
+
+    template<typename DataType>
+    const typename StorageSellCS<DataType>::const_iterator::IterType& StorageSellCS<DataType>::const_iterator::operator*()
+    {
+        return m_iter;
+    }
+
+    template<typename DataType>
+    const typename StorageSellCS<DataType>::const_iterator::IterType* StorageSellCS<DataType>::const_iterator::operator->()
+    {
+        return &m_iter;
+    }
+
+    template<typename DataType>
+    const bool StorageSellCS<DataType>::const_iterator::operator==(const const_iterator& rhs)
+    {
+        return m_iter.nnzindex == rhs.m_iter.nnzindex;
+    }
+
+    template<typename DataType>
+    const bool StorageSellCS<DataType>::const_iterator::operator!=(const const_iterator& rhs)
+    {
+        return !(m_iter.nnzindex == rhs.m_iter.nnzindex);
+    }
+
+
+
+
+    template<typename DataType>
+    StorageSellCS<DataType>::StorageSellCS(
+                    const IndexType  rows,
+                    const IndexType  columns,
+                    const IndexType  chunkSize,
+                    const IndexType  sortScope,
+                    const COOMatType&   cooMat,
+                    const MatrixStorage matType):
+        m_matType  (matType),
+        m_rows     (rows),
+        m_columns  (columns),
+        m_chunkSize(chunkSize > 0 ? chunkSize : 1),
+        m_sortScope(sortScope > 0 ? sortScope : 1),
+        m_nChunks  ((rows + m_chunkSize - 1) / m_chunkSize),
+        m_nnz      (0),
+        m_nStored  (0)
+    {
+        ASSERTL0(matType == Nektar::eFULL,
+                 "Only full matrices are supported by SELL-C-sigma storage");
+
+        processCooInput(cooMat);
+    }
+
+
+    template<typename DataType>
+    StorageSellCS<DataType>::StorageSellCS(const StorageSellCS& src):
+        m_matType  (src.m_matType),
+        m_rows     (src.m_rows),
+        m_columns  (src.m_columns),
+        m_chunkSize(src.m_chunkSize),
+        m_sortScope(src.m_sortScope),
+        m_nChunks  (src.m_nChunks),
+        m_nnz      (src.m_nnz),
+        m_nStored  (src.m_nStored),
+        m_val      (src.m_val),
+        m_col      (src.m_col),
+        m_chunkPtr (src.m_chunkPtr),
+        m_chunkLen (src.m_chunkLen),
+        m_rowLen   (src.m_rowLen),
+        m_perm     (src.m_perm),
+        m_invPerm  (src.m_invPerm)
+    {
+    }
+
+    template<typename DataType>
+    StorageSellCS<DataType>::~StorageSellCS()
+    {
+    }
+
+
+    template<typename DataType>
+    const IndexType StorageSellCS<DataType>::GetRows() const
+    {
+        return m_rows;
+    }
+
+    template<typename DataType>
+    const IndexType StorageSellCS<DataType>::GetColumns() const
+    {
+        return m_columns;
+    }
+
+    template<typename DataType>
+    const IndexType StorageSellCS<DataType>::GetNumNonZeroEntries() const
+    {
+        return m_nnz;
+    }
+
+    template<typename DataType>
+    const IndexType StorageSellCS<DataType>::GetBlkSize() const
+    {
+        return 1;
+    }
+
+    template<typename DataType>
+    const IndexType StorageSellCS<DataType>::GetChunkSize() const
+    {
+        return m_chunkSize;
+    }
+
+    template<typename DataType>
+    const IndexType StorageSellCS<DataType>::GetNumStoredDoubles() const
+    {
+        return m_val.num_elements();
+    }
+
+    template<typename DataType>
+    const DataType StorageSellCS<DataType>::GetFillInRatio() const
+    {
+        // A partition with no free DOFs stores nothing; report no fill-in.
+        if (m_nnz == 0)
+        {
+            return 1.0;
+        }
+        return (DataType)(m_val.num_elements())/(DataType)m_nnz;
+    }
+
+
+    template<typename DataType>
+    const size_t StorageSellCS<DataType>::GetMemoryUsage(IndexType nnz, IndexType nRows) const
+    {
+        return sizeof(DataType) *m_val.capacity()      +
+               sizeof(IndexType)*m_col.capacity()      +
+               sizeof(IndexType)*m_chunkPtr.capacity() +
+               sizeof(IndexType)*m_chunkLen.capacity() +
+               sizeof(IndexType)*m_rowLen.capacity()   +
+               sizeof(IndexType)*m_perm.capacity()     +
+               sizeof(IndexType)*m_invPerm.capacity()  +
+               sizeof(IndexType)*7   + //< rows + cols + C + sigma + chunks + nnz + stored
+               sizeof(MatrixStorage);
+    }
+
+
+    template<typename DataType>
+    const typename boost::call_traits<DataType>::const_reference StorageSellCS<DataType>::GetValue(IndexType row, IndexType column) const
+    {
+        static DataType defaultReturnValue;
+
+        const IndexType sorted = m_invPerm[row];
+        const IndexType C      = m_chunkSize;
+        IndexType offset = m_chunkPtr[sorted / C] + sorted % C;
+
+        for (IndexType j = 0; j < m_rowLen[sorted]; ++j, offset += C)
+        {
+            if (m_col[offset] == column)
+            {
+                return m_val[offset];
+            }
+        }
+
+        return defaultReturnValue;
+    }
+
+
+    template<typename DataType>
+    typename StorageSellCS<DataType>::const_iterator StorageSellCS<DataType>::begin() const
+    {
+        return const_iterator(*this, 0);
+    }
+
+    template<typename DataType>
+    typename StorageSellCS<DataType>::const_iterator StorageSellCS<DataType>::end() const
+    {
+        return const_iterator(*this, m_rows);
+    }
+
+
+    // C = A*B where A is matrix and B is vector.
+    // No scaling. Previous content of C is discarded.
+    template<typename DataType>
+    void StorageSellCS<DataType>::Multiply(
+            const DataVectorType &in,
+                  DataVectorType &out)
+    {
+        MultiplyRowGroups(&in[0], &out[0], 0, m_nChunks);
+    }
+
+    template<typename DataType>
+    void StorageSellCS<DataType>::Multiply(
+            const DataType*  in,
+                  DataType*  out)
+    {
+        MultiplyRowGroups(in, out, 0, m_nChunks);
+    }
+
+
+    template<typename DataType>
+    void StorageSellCS<DataType>::PartitionRowGroups(
+            const unsigned int      nParts,
+            std::vector<IndexType> &bounds) const
+    {
+        partitionByWork(&m_chunkPtr[0], m_nChunks, nParts, bounds);
+    }
+
+
+    template<typename DataType>
+    void StorageSellCS<DataType>::MultiplyRowGroups(
+            const DataType*  in,
+                  DataType*  out,
+            const IndexType  first,
+            const IndexType  last)
+    {
+        switch (m_chunkSize)
+        {
+        case  4: Multiply_chunk< 4>(first, last, in, out); return;
+        case  8: Multiply_chunk< 8>(first, last, in, out); return;
+        case 16: Multiply_chunk<16>(first, last, in, out); return;
+        case 32: Multiply_chunk<32>(first, last, in, out); return;
+        default: Multiply_generic(first, last, in, out);   return;
+        }
+    }
+
+    /// SELL multiply for a chunk size known at compile time. The
+    /// innermost loop runs over the rows of a chunk with unit stride so
+    /// that it can be vectorised.
+    template<typename DataType>
+    template<int C>
+    void StorageSellCS<DataType>::Multiply_chunk(
+            const IndexType  first,
+            const IndexType  last,
+            const DataType*  in,
+                  DataType*  out)
+    {
+        DataType t[C];
+
+        for (IndexType chunk = first; chunk < last; ++chunk)
+        {
+            const DataType  *pval = m_val.get() + m_chunkPtr[chunk];
+            const IndexType *pcol = m_col.get() + m_chunkPtr[chunk];
+            const IndexType  width = m_chunkLen[chunk];
+
+            for (int r = 0; r < C; ++r)
+            {
+                t[r] = 0.0;
+            }
+
+            for (IndexType j = 0; j < width; ++j)
+            {
+                for (int r = 0; r < C; ++r)
+                {
+                    t[r] += pval[r] * in[pcol[r]];
+                }
+                pval += C;
+                pcol += C;
+            }
+
+            const IndexType row0 = chunk*C;
+            const IndexType nRow = std::min((IndexType)C, m_rows - row0);
+            for (IndexType r = 0; r < nRow; ++r)
+            {
+                out[m_perm[row0+r]] = t[r];
+            }
+        }
+    }
+
+    /// SELL multiply for any other chunk size
+    template<typename DataType>
+    void StorageSellCS<DataType>::Multiply_generic(
+            const IndexType  first,
+            const IndexType  last,
+            const DataType*  in,
+                  DataType*  out)
+    {
+        const IndexType C = m_chunkSize;
+
+        for (IndexType chunk = first; chunk < last; ++chunk)
+        {
+            const IndexType row0 = chunk*C;
+            const IndexType nRow = std::min(C, m_rows - row0);
+
+            for (IndexType r = 0; r < nRow; ++r)
+            {
+                const DataType  *pval = m_val.get() + m_chunkPtr[chunk] + r;
+                const IndexType *pcol = m_col.get() + m_chunkPtr[chunk] + r;
+                const IndexType  len  = m_rowLen[row0+r];
+
+                DataType t = 0.0;
+                for (IndexType j = 0; j < len; ++j)
+                {
+                    t += pval[j*C] * in[pcol[j*C]];
+                }
+                out[m_perm[row0+r]] = t;
+            }
+        }
+    }
+
+
+    // converts input COO matrix to the internal SELL representation
+    template<typename DataType>
+    void StorageSellCS<DataType>::processCooInput(const COOMatType& cooMat)
+    {
+        const IndexType C = m_chunkSize;
+        IndexType i, j, c;
+        COOMatTypeConstIt entry;
+
+        // count the entries on each row
+        std::vector<IndexType> len(m_rows, 0);
+        for (entry = cooMat.begin(); entry != cooMat.end(); ++entry)
+        {
+            len[entry->first.first]++;
+        }
+
+        // sort the rows by decreasing length within each window of
+        // sigma rows; the stable sort keeps rows of equal length in
+        // their original order to retain the locality of the numbering
+        std::vector<std::pair<int, IndexType> > order(m_rows);
+        for (i = 0; i < m_rows; ++i)
+        {
+            order[i] = std::make_pair(m_sortScope > 1 ? -(int)len[i] : 0, i);
+        }
+        for (i = 0; i < m_rows; i += m_sortScope)
+        {
+            IndexType iend = std::min(i + m_sortScope, m_rows);
+            std::stable_sort(order.begin() + i, order.begin() + iend);
+        }
+
+        m_perm    = IndexVectorType(m_rows);
+        m_invPerm = IndexVectorType(m_rows);
+        m_rowLen  = IndexVectorType(m_nChunks*C, (IndexType)0);
+        for (i = 0; i < m_rows; ++i)
+        {
+            m_perm[i]                = order[i].second;
+            m_invPerm[m_perm[i]]     = i;
+            m_rowLen[i]              = len[m_perm[i]];
+        }
+
+        // chunk widths and offsets
+        m_chunkLen = IndexVectorType(m_nChunks,   (IndexType)0);
+        m_chunkPtr = IndexVectorType(m_nChunks+1, (IndexType)0);
+        for (c = 0; c < m_nChunks; ++c)
+        {
+            for (i = c*C; i < (c+1)*C; ++i)
+            {
+                m_chunkLen[c] = std::max(m_chunkLen[c], m_rowLen[i]);
+            }
+            m_chunkPtr[c+1] = m_chunkPtr[c] + m_chunkLen[c]*C;
+        }
+
+        // padding entries are zeros multiplying the first column
+        m_val = DataVectorType (m_chunkPtr[m_nChunks], 0.0);
+        m_col = IndexVectorType(m_chunkPtr[m_nChunks], (IndexType)0);
+
+        // fill in the entries of each row in order of increasing column
+        std::vector<IndexType> fill(m_rows, 0);
+        for (entry = cooMat.begin(); entry != cooMat.end(); ++entry)
+        {
+            i = m_invPerm[entry->first.first];
+            j = fill[i]++;
+            c = i / C;
+
+            const IndexType offset = m_chunkPtr[c] + j*C + i % C;
+            m_val[offset] = entry->second;
+            m_col[offset] = entry->first.second;
+
+            if (std::abs(entry->second) > NekConstants::kNekSparseNonZeroTol)
+            {
+                m_nnz++;
+            }
+            m_nStored++;
+        }
+    }
+
+
+    // explicit instantiation
+    template class StorageSellCS<NekDouble>;
+
+
+} // namespace
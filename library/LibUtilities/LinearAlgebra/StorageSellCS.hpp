@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: StorageSellCS.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: 0-based sliced ELLPACK (SELL-C-sigma) sparse storage class.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STORAGE_SELL_CS_HPP
+#define NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STORAGE_SELL_CS_HPP
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <fstream>
+
+#include <LibUtilities/LinearAlgebra/MatrixStorageType.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+
+#include <boost/call_traits.hpp>
+
+
+namespace Nektar
+{
+    /*
+     *  Zero-based SELL-C-sigma (sliced ELLPACK) storage class.
+     *
+     *  The rows are grouped into chunks of C consecutive rows. Within a
+     *  chunk the entries are stored column by column, i.e. the j-th entry
+     *  of all C rows is contiguous, and every row is padded with zeros to
+     *  the length of the longest row of its chunk. The multiply kernel
+     *  therefore processes C rows at once with unit-stride access to the
+     *  values, which suits SIMD units far better than the row-by-row loop
+     *  of CSR. To limit the padding, rows are sorted by decreasing length
+     *  within windows of sigma rows before they are chunked; the sorting
+     *  only permutes the rows, the columns keep their original numbering.
+     *
+     *  The constructor takes the input matrix in coordinate storage (COO).
+     *
+     */
+
+    template<typename T>
+    class StorageSellCS
+    {
+
+    public:
+        typedef T                             DataType;
+        typedef Array<OneD, DataType>         DataVectorType;
+        typedef Array<OneD, const DataType>   ConstDataVectorType;
+        typedef Array<OneD, IndexType>        IndexVectorType;
+
+        /// \internal
+        /// \brief Forward iterator through the stored (non-padding)
+        ///        elements of the matrix that mimics forward iteration
+        ///        of COOMatType.
+        class const_iterator
+        {
+            struct IterType
+            {
+                CoordType  first;       //< (row, column)
+                DataType   second;      //< value
+                IndexType  nnzindex;    //< index of this entry
+                IndexType  storageindex;//< offset of this entry in the storage
+            };
+
+            public:
+                const_iterator(const StorageSellCS& storage,
+                               IndexType            sortedRow);
+                const_iterator(const const_iterator& src);
+                ~const_iterator();
+
+                const_iterator operator++(int);
+                const_iterator& operator++();
+                const IterType& operator*();
+                const IterType* operator->();
+                const bool operator==(const const_iterator& rhs);
+                const bool operator!=(const const_iterator& rhs);
+
+            private:
+                void settle();
+
+                const StorageSellCS&        m_storage;
+                IterType                    m_iter;
+                IndexType                   m_row;   // sorted row
+                IndexType                   m_pos;   // entry within row
+        };
+
+
+    public:
+        // Constructs zero-based SELL-C-sigma sparse matrix based on input
+        // COO storage
+        LIB_UTILITIES_EXPORT StorageSellCS( const IndexType  rows,
+                             const IndexType  columns,
+                             const IndexType  chunkSize,
+                             const IndexType  sortScope,
+                             const COOMatType&   cooMat,
+                             const MatrixStorage matType = eFULL);
+
+        // Copy constructor
+        LIB_UTILITIES_EXPORT StorageSellCS(const StorageSellCS& src);
+
+        LIB_UTILITIES_EXPORT ~StorageSellCS();
+
+        LIB_UTILITIES_EXPORT const IndexType GetRows() const;
+        LIB_UTILITIES_EXPORT const IndexType GetColumns() const;
+        LIB_UTILITIES_EXPORT const IndexType GetNumNonZeroEntries() const;
+        LIB_UTILITIES_EXPORT const IndexType GetNumStoredDoubles() const;
+        LIB_UTILITIES_EXPORT const IndexType GetBlkSize() const;
+        LIB_UTILITIES_EXPORT const IndexType GetChunkSize() const;
+        LIB_UTILITIES_EXPORT const DataType  GetFillInRatio() const;
+        LIB_UTILITIES_EXPORT const size_t GetMemoryUsage(IndexType nnz, IndexType nRows) const;
+
+        LIB_UTILITIES_EXPORT const_iterator begin() const;
+        LIB_UTILITIES_EXPORT const_iterator end() const;
+
+        LIB_UTILITIES_EXPORT const typename boost::call_traits<DataType>::const_reference
+                GetValue(IndexType row, IndexType column) const;
+
+        LIB_UTILITIES_EXPORT void Multiply(const DataType* in,
+                            DataType* out);
+        LIB_UTILITIES_EXPORT void Multiply(const DataVectorType &in,
+                            DataVectorType &out);
+
+        // Split the chunks into nParts ranges of similar work
+        LIB_UTILITIES_EXPORT void PartitionRowGroups(const unsigned int nParts,
+                            std::vector<IndexType> &bounds) const;
+        // Multiply the chunks [first, last) only
+        LIB_UTILITIES_EXPORT void MultiplyRowGroups(const DataType* in,
+                            DataType* out,
+                            const IndexType first,
+                            const IndexType last);
+
+    protected:
+
+        // converts input COO matrix to the internal SELL representation
+        void processCooInput(const COOMatType& cooMat);
+
+        template<int C>
+        void Multiply_chunk(const IndexType first, const IndexType last,
+                            const DataType* in, DataType* out);
+
+        void Multiply_generic(const IndexType first, const IndexType last,
+                              const DataType* in, DataType* out);
+
+        MatrixStorage    m_matType;
+
+        IndexType        m_rows;     // number of rows
+        IndexType        m_columns;  // number of columns
+        IndexType        m_chunkSize;// number of rows per chunk (C)
+        IndexType        m_sortScope;// rows sorted within windows (sigma)
+        IndexType        m_nChunks;  // number of chunks
+
+        IndexType        m_nnz;      //< number of factual nonzero entries
+        IndexType        m_nStored;  //< number of stored (non-padding) entries
+
+        DataVectorType   m_val;      // values, chunk by chunk, column-major
+        IndexVectorType  m_col;      // column indices of the values
+        IndexVectorType  m_chunkPtr; // offset of first value of each chunk
+        IndexVectorType  m_chunkLen; // width (longest row) of each chunk
+        IndexVectorType  m_rowLen;   // length of each sorted row
+        IndexVectorType  m_perm;     // original row of each sorted row
+        IndexVectorType  m_invPerm;  // sorted row of each original row
+
+    private:
+
+    };
+
+
+
+} // namespace
+
+#endif //NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STORAGE_SELL_CS_HPP
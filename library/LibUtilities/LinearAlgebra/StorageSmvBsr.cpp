@@ -43,6 +43,7 @@
 #include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
 #include <LibUtilities/LinearAlgebra/Blas.hpp>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
 #include <LibUtilities/LinearAlgebra/NistSparseDescriptors.hpp>
 
 #include <LibUtilities/LinearAlgebra/LibSMV.hpp>
@@ -413,13 +414,41 @@ namespace Nektar
             const DataType*  in,
                   DataType*  out)
     {
+        MultiplyRowGroups(in, out, 0, m_blkRows);
+    }
+
+
+    template<typename DataType>
+    void StorageSmvBsr<DataType>::PartitionRowGroups(
+            const unsigned int      nParts,
+            std::vector<IndexType> &bounds) const
+    {
+        partitionByWork(&m_pntr[0], m_blkRows, nParts, bounds);
+    }
+
+
+    // Multiplies the block rows [first, last). Each kernel walks the
+    // values of consecutive block rows sequentially, so the range is
+    // selected by offsetting the value, row pointer and result arrays.
+    template<typename DataType>
+    void StorageSmvBsr<DataType>::MultiplyRowGroups(
+            const DataType*  in,
+                  DataType*  out,
+            const IndexType  first,
+            const IndexType  last)
+    {
+        if (first >= last)
+        {
+            return;
+        }
+
         const double* b = &in[0];
-              double* c = &out[0];
-        const double* val = &m_val[0];
+              double* c = &out[0] + first*m_blkDim;
+        const double* val = &m_val[0] + m_pntr[first]*m_blkDim*m_blkDim;
         const int* bindx  = (int*)&m_indx[0];
-        const int* bpntrb = (int*)&m_pntr[0];
-        const int* bpntre = (int*)&m_pntr[0]+1;
-        const int  mb = m_blkRows;
+        const int* bpntrb = (int*)&m_pntr[0] + first;
+        const int* bpntre = (int*)&m_pntr[0] + first + 1;
+        const int  mb = last - first;
         const int  kb = m_blkCols;
 
         switch(m_blkDim)
@@ -162,6 +162,15 @@ namespace Nektar
         LIB_UTILITIES_EXPORT void MultiplyLight(const DataVectorType &in,
                                  DataVectorType &out);
 
+        // Split the block rows into nParts ranges of similar work
+        LIB_UTILITIES_EXPORT void PartitionRowGroups(const unsigned int nParts,
+                            std::vector<IndexType> &bounds) const;
+        // Multiply the block rows [first, last) only
+        LIB_UTILITIES_EXPORT void MultiplyRowGroups(const DataType* in,
+                            DataType* out,
+                            const IndexType first,
+                            const IndexType last);
+
 
     protected:
 
@@ -1163,6 +1163,57 @@ namespace Nektar
             }
         }
 
+        /**
+         * Given a face and vector of element coefficients:
+         * - maps those elemental coefficients corresponding to the face into
+         *   a face-vector.
+         * - resets the element coefficients
+         * - multiplies the face vector by the face mass matrix
+         * - maps the face coefficients back onto the elemental coefficients
+         */
+        void Expansion3D::v_AddRobinEdgeContribution(
+            const int                           face,
+            const Array<OneD, const NekDouble> &primCoeffs,
+                  Array<OneD,       NekDouble> &coeffs)
+        {
+            ASSERTL1(IsBoundaryInteriorExpansion(),
+                     "Not set up for non boundary-interior expansions");
+            int i;
+            Expansion2DSharedPtr faceExp = m_faceExp[face].lock();
+            int order_f = faceExp->GetNcoeffs();
+
+            Array<OneD, unsigned int> map;
+            Array<OneD,          int> sign;
+
+            StdRegions::VarCoeffMap varcoeffs;
+            varcoeffs[StdRegions::eVarCoeffMass] = primCoeffs;
+
+            LocalRegions::MatrixKey mkey(
+                StdRegions::eMass,
+                faceExp->DetShapeType(),
+                *faceExp,
+                StdRegions::NullConstFactorMap,
+                varcoeffs);
+            DNekScalMat &facemat = *faceExp->GetLocMatrix(mkey);
+
+            NekVector<NekDouble> vFaceCoeffs(order_f);
+
+            GetFaceToElementMap(face, GetFaceOrient(face), map, sign);
+
+            for (i = 0; i < order_f; ++i)
+            {
+                vFaceCoeffs[i] = coeffs[map[i]]*sign[i];
+            }
+            Vmath::Zero(GetNcoeffs(), coeffs, 1);
+
+            vFaceCoeffs = facemat * vFaceCoeffs;
+
+            for (i = 0; i < order_f; ++i)
+            {
+                coeffs[map[i]] = vFaceCoeffs[i]*sign[i];
+            }
+        }
+
         DNekMatSharedPtr Expansion3D::v_BuildVertexMatrix(
             const DNekScalMatSharedPtr &r_bnd)
         {
@@ -120,6 +120,10 @@ namespace Nektar
                 const int                           face, 
                 const Array<OneD, const NekDouble> &primCoeffs, 
                 DNekMatSharedPtr                   &inoutmat);
+            virtual void v_AddRobinEdgeContribution(
+                const int                           face,
+                const Array<OneD, const NekDouble> &primCoeffs,
+                      Array<OneD,       NekDouble> &coeffs);
 
             virtual NekDouble v_Integrate(
                 const Array<OneD, const NekDouble>& inarray);
@@ -49,6 +49,8 @@ namespace Nektar
             StdMatrixKey(matrixType, shapeType, stdExpansion, factorMap, varCoeffMap, nodalType),
             m_metricinfo(stdExpansion.GetMetricInfo())
         {
+            SetKeyMetricInfo();
+            RemoveLambdaFactor();
         }
 
         MatrixKey::MatrixKey(const MatrixKey& mkey,
@@ -56,6 +58,8 @@ namespace Nektar
             StdRegions::StdMatrixKey(mkey, matrixType),
             m_metricinfo(mkey.m_metricinfo)
         {
+            SetKeyMetricInfo();
+            RemoveLambdaFactor();
         }
 
         MatrixKey::MatrixKey(const StdRegions::StdMatrixKey &mkey) :
@@ -63,6 +67,87 @@ namespace Nektar
         {
         }
 
+        /**
+         * Matrices which depend on the element only through its Jacobian and
+         * derivative factors are keyed on the representative of the
+         * congruent elements, so that the pooled matrix managers store them
+         * once per distinct element shape. Other matrices, such as the HDG
+         * matrices which also depend on the trace orientation, are keyed on
+         * the element itself.
+         */
+        void MatrixKey::SetKeyMetricInfo()
+        {
+            m_keyMetricInfo = m_metricinfo;
+
+            if (!m_metricinfo)
+            {
+                return;
+            }
+
+            switch (GetMatrixType())
+            {
+                case StdRegions::eMass:
+                case StdRegions::eInvMass:
+                case StdRegions::eLaplacian:
+                case StdRegions::eLaplacian00:
+                case StdRegions::eLaplacian01:
+                case StdRegions::eLaplacian02:
+                case StdRegions::eLaplacian10:
+                case StdRegions::eLaplacian11:
+                case StdRegions::eLaplacian12:
+                case StdRegions::eLaplacian20:
+                case StdRegions::eLaplacian21:
+                case StdRegions::eLaplacian22:
+                case StdRegions::eWeakDeriv0:
+                case StdRegions::eWeakDeriv1:
+                case StdRegions::eWeakDeriv2:
+                case StdRegions::eBwdTrans:
+                case StdRegions::eFwdTrans:
+                case StdRegions::eIProductWRTBase:
+                case StdRegions::eIProductWRTDerivBase0:
+                case StdRegions::eIProductWRTDerivBase1:
+                case StdRegions::eIProductWRTDerivBase2:
+                case StdRegions::eHelmholtz:
+                    m_keyMetricInfo = SpatialDomains::GeomFactors::
+                        GetCongruent(m_metricinfo);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /**
+         * The Helmholtz matrix is formed from the mass and Laplacian matrices
+         * with keys derived from the Helmholtz key, so these would otherwise
+         * carry the Helmholtz constant and be regenerated, by quadrature, for
+         * every new value of it, e.g. after a change of time step. Since
+         * neither depends on the constant, it is removed from their keys and
+         * a new constant only costs the combination of the stored matrices
+         * and the static condensation.
+         */
+        void MatrixKey::RemoveLambdaFactor()
+        {
+            switch (GetMatrixType())
+            {
+                case StdRegions::eMass:
+                case StdRegions::eInvMass:
+                case StdRegions::eLaplacian:
+                case StdRegions::eLaplacian00:
+                case StdRegions::eLaplacian01:
+                case StdRegions::eLaplacian02:
+                case StdRegions::eLaplacian10:
+                case StdRegions::eLaplacian11:
+                case StdRegions::eLaplacian12:
+                case StdRegions::eLaplacian20:
+                case StdRegions::eLaplacian21:
+                case StdRegions::eLaplacian22:
+                    m_factors.erase(StdRegions::eFactorLambda);
+                    break;
+                default:
+                    break;
+            }
+        }
+
         bool MatrixKey::opLess::operator()(const MatrixKey &lhs, const MatrixKey &rhs) const
         {        
             {
@@ -72,13 +157,13 @@ namespace Nektar
 
         bool operator<(const MatrixKey &lhs, const MatrixKey &rhs)
         {
-            if(lhs.m_metricinfo.get() < rhs.m_metricinfo.get())
+            if(lhs.m_keyMetricInfo.get() < rhs.m_keyMetricInfo.get())
             {
                 return true;
             }
 
 
-            if(lhs.m_metricinfo.get() > rhs.m_metricinfo.get())
+            if(lhs.m_keyMetricInfo.get() > rhs.m_keyMetricInfo.get())
             {
                 return false;
             }    
@@ -85,6 +85,15 @@ namespace Nektar
 
             SpatialDomains::GeomFactorsSharedPtr  m_metricinfo; 
 
+            /// Geometric factors identifying the matrix; this is shared by
+            /// congruent elements for matrices which only depend on the
+            /// metric terms.
+            SpatialDomains::GeomFactorsSharedPtr  m_keyMetricInfo;
+
+            void SetKeyMetricInfo();
+
+            void RemoveLambdaFactor();
+
         private:
         };
 
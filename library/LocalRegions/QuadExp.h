@@ -215,6 +215,9 @@ namespace Nektar
             LOCAL_REGIONS_EXPORT void v_DropLocStaticCondMatrix(
                         const MatrixKey &mkey);
 
+            LOCAL_REGIONS_EXPORT void v_DropLocMatrix(
+                        const MatrixKey &mkey);
+
 
             //---------------------------------------
             // Operators
@@ -227,6 +227,9 @@ namespace Nektar
             LOCAL_REGIONS_EXPORT void v_DropLocStaticCondMatrix(
                         const MatrixKey &mkey);
 
+            LOCAL_REGIONS_EXPORT void v_DropLocMatrix(
+                        const MatrixKey &mkey);
+
         private:
             LibUtilities::NekManager<MatrixKey, DNekScalMat, MatrixKey::opLess>
                     m_matrixManager;
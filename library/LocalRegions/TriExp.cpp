@@ -1327,6 +1327,11 @@ namespace Nektar
             m_staticCondMatrixManager.DeleteObject(mkey);
         }
 
+        void TriExp::v_DropLocMatrix(const MatrixKey &mkey)
+        {
+            m_matrixManager.DeleteObject(mkey);
+        }
+
 
 
         void TriExp::v_MassMatrixOp(const Array<OneD, const NekDouble> &inarray,
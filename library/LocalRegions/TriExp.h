@@ -213,6 +213,9 @@ namespace Nektar
             LOCAL_REGIONS_EXPORT void v_DropLocStaticCondMatrix(
                             const MatrixKey &mkey);
 
+            LOCAL_REGIONS_EXPORT void v_DropLocMatrix(
+                            const MatrixKey &mkey);
+
 
             LOCAL_REGIONS_EXPORT virtual void v_MassMatrixOp(
                             const Array<OneD, const NekDouble> &inarray,
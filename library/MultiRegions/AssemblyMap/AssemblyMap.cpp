@@ -155,6 +155,10 @@ namespace Nektar
                                         m_successiveRHS,0);
             }
 
+            if(pSession->DefinesSolverInfo("SetupCacheDir"))
+            {
+                m_setupCacheDir = pSession->GetSolverInfo("SetupCacheDir");
+            }
         }
         
         /** 
@@ -173,6 +177,7 @@ namespace Nektar
             m_preconType(oldLevelMap->m_preconType),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
+            m_setupCacheDir(oldLevelMap->m_setupCacheDir),
             m_gsh(oldLevelMap->m_gsh),
             m_bndGsh(oldLevelMap->m_bndGsh),
             m_lowestStaticCondLevel(oldLevelMap->m_lowestStaticCondLevel)
@@ -370,6 +370,10 @@ namespace Nektar
             /// sucessive RHS  for iterative solver
             int  m_successiveRHS;
 
+            /// Directory in which graph reorderings are cached between runs,
+            /// empty if caching is disabled.
+            std::string m_setupCacheDir;
+
             Gs::gs_data * m_gsh;
             Gs::gs_data * m_bndGsh;
 
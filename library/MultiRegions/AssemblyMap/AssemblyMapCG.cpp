@@ -35,6 +35,7 @@
 
 #include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
 #include <MultiRegions/ExpList.h>
+#include <MultiRegions/SetupCache.h>
 #include <LocalRegions/Expansion.h>
 #include <LocalRegions/Expansion2D.h>
 #include <LocalRegions/Expansion3D.h>
@@ -348,6 +349,259 @@ namespace Nektar
             }
         }
 
+        /**
+         * The numbering of multi-level static condensation is not cached,
+         * since the next level is built from the substructured graph. Its
+         * graph reordering is cached by MultiLevelBisectionReordering.
+         */
+        bool AssemblyMapCG::UseC0ContMapCache() const
+        {
+            return !m_setupCacheDir.empty()                   &&
+                m_solnType != eDirectMultiLevelStaticCond     &&
+                m_solnType != eIterativeMultiLevelStaticCond  &&
+                m_solnType != eXxtMultiLevelStaticCond        &&
+                m_solnType != eDirectSparseStaticCond;
+        }
+
+        /**
+         * Adds the mesh entities and expansion of @a exp to the key of
+         * @a cache.
+         */
+        static void AddExpansionToCacheKey(
+                  SetupCache                       &cache,
+            const LocalRegions::ExpansionSharedPtr &exp)
+        {
+            int j;
+            SpatialDomains::GeometrySharedPtr geom = exp->GetGeom();
+
+            cache.AddKey((int)exp->DetShapeType());
+            cache.AddKey(geom->GetGlobalID());
+            cache.AddKey(exp->GetNcoeffs());
+            for (j = 0; j < exp->GetNumBases(); ++j)
+            {
+                cache.AddKey((int)exp->GetBasisType(j));
+                cache.AddKey(exp->GetBasisNumModes(j));
+            }
+
+            for (j = 0; j < exp->GetNverts(); ++j)
+            {
+                cache.AddKey(geom->GetVid(j));
+            }
+
+            if (exp->GetShapeDimension() > 1)
+            {
+                for (j = 0; j < exp->GetNedges(); ++j)
+                {
+                    cache.AddKey(geom->GetEid(j));
+                    cache.AddKey((int)geom->GetEorient(j));
+                }
+            }
+
+            if (exp->GetShapeDimension() > 2)
+            {
+                SpatialDomains::Geometry3DSharedPtr geom3D =
+                    boost::dynamic_pointer_cast<
+                        SpatialDomains::Geometry3D>(geom);
+                for (j = 0; j < exp->GetNfaces(); ++j)
+                {
+                    cache.AddKey(geom3D->GetFid(j));
+                    cache.AddKey((int)geom3D->GetFaceOrient(j));
+                }
+            }
+        }
+
+        /**
+         * The key holds everything the numbering of this process depends on:
+         * the partition, the solution type, the mesh entities and expansion
+         * of each element and boundary element, the boundary condition types
+         * and the periodic entities. Since the numbering also depends on the
+         * other processes, the cache is only used if every process finds its
+         * entry.
+         *
+         * On success, the numbering and the extra Dirichlet degrees of
+         * freedom are those stored at the end of the setup, and only the
+         * universal map remains to be set up.
+         */
+        bool AssemblyMapCG::LoadC0ContMapCache(
+            SetupCache &cache,
+            const int numLocalCoeffs,
+            const ExpList &locExp,
+            const Array<OneD, const boost::shared_ptr<ExpList> > &bndCondExp,
+            const Array<OneD, const SpatialDomains::BoundaryConditionShPtr>
+                                                                &bndConditions,
+            const PeriodicMap &perVerts,
+            const PeriodicMap &perEdges,
+            const PeriodicMap &perFaces,
+            const bool checkIfSystemSingular)
+        {
+            int i, j, n;
+            PeriodicMap::const_iterator pIt;
+
+            if (!UseC0ContMapCache())
+            {
+                return false;
+            }
+
+            const LocalRegions::ExpansionVector &locExpVector =
+                *(locExp.GetExp());
+            const PeriodicMap *perMaps[3] = { &perVerts, &perEdges, &perFaces };
+
+            cache.AddKey(m_comm->GetSize());
+            cache.AddKey(m_comm->GetRank());
+            cache.AddKey((int)m_solnType);
+            cache.AddKey((int)checkIfSystemSingular);
+            cache.AddKey(numLocalCoeffs);
+
+            cache.AddKey((int)locExpVector.size());
+            for (n = 0; n < locExpVector.size(); ++n)
+            {
+                cache.AddKey(locExp.GetOffset_Elmt_Id(n));
+                AddExpansionToCacheKey(cache, locExpVector[n]);
+            }
+
+            cache.AddKey((int)bndCondExp.num_elements());
+            for (i = 0; i < bndCondExp.num_elements(); ++i)
+            {
+                cache.AddKey(
+                    (int)bndConditions[i]->GetBoundaryConditionType());
+                cache.AddKey(bndCondExp[i]->GetExpSize());
+                for (n = 0; n < bndCondExp[i]->GetExpSize(); ++n)
+                {
+                    AddExpansionToCacheKey(cache, bndCondExp[i]->GetExp(n));
+                }
+            }
+
+            for (i = 0; i < 3; ++i)
+            {
+                cache.AddKey((int)perMaps[i]->size());
+                for (pIt = perMaps[i]->begin(); pIt != perMaps[i]->end(); ++pIt)
+                {
+                    cache.AddKey(pIt->first);
+                    cache.AddKey((int)pIt->second.size());
+                    for (j = 0; j < pIt->second.size(); ++j)
+                    {
+                        cache.AddKey(pIt->second[j].id);
+                        cache.AddKey((int)pIt->second[j].orient);
+                        cache.AddKey((int)pIt->second[j].isLocal);
+                    }
+                }
+            }
+
+            int    ints[18];
+            size_t hash  = 0;
+            int    found = cache.Load()               &&
+                           cache.Get(ints, 18)        &&
+                           cache.Get(hash)            &&
+                           cache.GetArray(m_localToGlobalMap)                &&
+                           cache.GetArray(m_localToGlobalSign)               &&
+                           cache.GetArray(m_localToGlobalBndMap)             &&
+                           cache.GetArray(m_localToGlobalBndSign)            &&
+                           cache.GetArray(m_bndCondCoeffsToGlobalCoeffsMap)  &&
+                           cache.GetArray(m_bndCondCoeffsToGlobalCoeffsSign) &&
+                           cache.GetArray(m_numLocalBndCoeffsPerPatch)       &&
+                           cache.GetArray(m_numLocalIntCoeffsPerPatch)       &&
+                           cache.GetArray(m_extraDirEdges)                   &&
+                           cache.Get(n);
+
+            m_extraDirDofs.clear();
+            for (i = 0; found && i < n; ++i)
+            {
+                int bndId, nDofs;
+                found = cache.Get(bndId) && cache.Get(nDofs);
+                for (j = 0; found && j < nDofs; ++j)
+                {
+                    int       loc, gid;
+                    NekDouble val;
+                    found = cache.Get(loc) && cache.Get(gid) && cache.Get(val);
+                    m_extraDirDofs[bndId].push_back(ExtraDirDof(loc, gid, val));
+                }
+            }
+
+            found = found && cache.AtEnd() &&
+                ints[0] == numLocalCoeffs  &&
+                m_localToGlobalMap.num_elements() == numLocalCoeffs;
+
+            m_comm->AllReduce(found, LibUtilities::ReduceMin);
+            if (!found)
+            {
+                m_extraDirDofs.clear();
+                return false;
+            }
+
+            m_numLocalCoeffs        = ints[0];
+            m_numGlobalCoeffs       = ints[1];
+            m_numLocalBndCoeffs     = ints[2];
+            m_numGlobalBndCoeffs    = ints[3];
+            m_numLocalDirBndCoeffs  = ints[4];
+            m_numGlobalDirBndCoeffs = ints[5];
+            m_systemSingular        = ints[6] != 0;
+            m_signChange            = ints[7] != 0;
+            m_staticCondLevel       = ints[8];
+            m_lowestStaticCondLevel = ints[9];
+            m_numPatches            = ints[10];
+            m_numNonDirVertexModes  = ints[11];
+            m_numNonDirEdgeModes    = ints[12];
+            m_numNonDirFaceModes    = ints[13];
+            m_numDirEdges           = ints[14];
+            m_numDirFaces           = ints[15];
+            m_numNonDirEdges        = ints[16];
+            m_numNonDirFaces        = ints[17];
+            m_hash                  = hash;
+
+            return true;
+        }
+
+        /**
+         * Called at the end of the setup with the key set by
+         * #LoadC0ContMapCache. Failure to write is not fatal.
+         */
+        void AssemblyMapCG::SaveC0ContMapCache(SetupCache &cache) const
+        {
+            if (!UseC0ContMapCache())
+            {
+                return;
+            }
+
+            int ints[18] = {
+                m_numLocalCoeffs,       m_numGlobalCoeffs,
+                m_numLocalBndCoeffs,    m_numGlobalBndCoeffs,
+                m_numLocalDirBndCoeffs, m_numGlobalDirBndCoeffs,
+                m_systemSingular,       m_signChange,
+                m_staticCondLevel,      m_lowestStaticCondLevel,
+                m_numPatches,           m_numNonDirVertexModes,
+                m_numNonDirEdgeModes,   m_numNonDirFaceModes,
+                m_numDirEdges,          m_numDirFaces,
+                m_numNonDirEdges,       m_numNonDirFaces };
+
+            cache.Put(ints, 18);
+            cache.Put(m_hash);
+            cache.PutArray(m_localToGlobalMap);
+            cache.PutArray(m_localToGlobalSign);
+            cache.PutArray(m_localToGlobalBndMap);
+            cache.PutArray(m_localToGlobalBndSign);
+            cache.PutArray(m_bndCondCoeffsToGlobalCoeffsMap);
+            cache.PutArray(m_bndCondCoeffsToGlobalCoeffsSign);
+            cache.PutArray(m_numLocalBndCoeffsPerPatch);
+            cache.PutArray(m_numLocalIntCoeffsPerPatch);
+            cache.PutArray(m_extraDirEdges);
+
+            map<int, vector<ExtraDirDof> >::const_iterator it;
+            cache.Put((int)m_extraDirDofs.size());
+            for (it = m_extraDirDofs.begin(); it != m_extraDirDofs.end(); ++it)
+            {
+                cache.Put(it->first);
+                cache.Put((int)it->second.size());
+                for (int i = 0; i < it->second.size(); ++i)
+                {
+                    cache.Put(it->second[i].get<0>());
+                    cache.Put(it->second[i].get<1>());
+                    cache.Put(it->second[i].get<2>());
+                }
+            }
+
+            cache.Save();
+        }
+
         /**
          * @brief Construct an AssemblyMapCG object which corresponds to the
          * linear space of the current object.
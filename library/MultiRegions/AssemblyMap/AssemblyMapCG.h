@@ -49,6 +49,7 @@ namespace Nektar
         const static vector<map<int,int> > NullVecIntIntMap;
 
         class ExpList;
+        class SetupCache;
         class AssemblyMapCG;
         typedef boost::shared_ptr<AssemblyMapCG>  AssemblyMapCGSharedPtr;
 
@@ -127,6 +128,24 @@ namespace Nektar
             /// Calculate the bandwith of the full matrix system.
             void CalculateFullSystemBandWidth();
 
+            /// Set up the key of the C0 numbering in @a cache and read the
+            /// numbering from it if a previous run stored it.
+            bool LoadC0ContMapCache(
+                SetupCache &cache,
+                const int numLocalCoeffs,
+                const ExpList &locExp,
+                const Array<OneD, const boost::shared_ptr<ExpList> >
+                                                                &bndCondExp,
+                const Array<OneD, const SpatialDomains::BoundaryConditionShPtr>
+                                                                &bndConditions,
+                const PeriodicMap &perVerts,
+                const PeriodicMap &perEdges,
+                const PeriodicMap &perFaces,
+                const bool checkIfSystemSingular);
+
+            /// Store the C0 numbering in @a cache.
+            void SaveC0ContMapCache(SetupCache &cache) const;
+
             MULTI_REGIONS_EXPORT virtual int v_GetLocalToGlobalMap(const int i) const;
 
             MULTI_REGIONS_EXPORT virtual int v_GetGlobalToUniversalMap(const int i) const;
@@ -196,6 +215,9 @@ namespace Nektar
             MULTI_REGIONS_EXPORT virtual const Array<OneD, const int>& v_GetExtraDirEdges();
 
             MULTI_REGIONS_EXPORT virtual AssemblyMapSharedPtr v_XxtLinearSpaceMap(const ExpList &locexp);
+
+        private:
+            bool UseC0ContMapCache() const;
         };
 
 
@@ -35,6 +35,7 @@
 
 #include <MultiRegions/MultiRegions.hpp>
 #include <MultiRegions/AssemblyMap/AssemblyMapCG2D.h>
+#include <MultiRegions/SetupCache.h>
 #include <MultiRegions/ExpList.h>
 #include <LocalRegions/SegExp.h>
 #include <LocalRegions/Expansion2D.h>
@@ -168,6 +169,19 @@ namespace Nektar
             Array<OneD, unsigned int>           edgeInteriorMap;
             Array<OneD, int>                    edgeInteriorSign;
             const LocalRegions::ExpansionVector &locExpVector = *(locExp.GetExp());
+
+            // Reuse the numbering stored by a previous run with the same
+            // mesh, expansion and boundary conditions, if any.
+            SetupCache cache(m_setupCacheDir, "assemblymap");
+            if (LoadC0ContMapCache(cache, numLocalCoeffs, locExp,
+                                   bndCondExp, bndConditions,
+                                   periodicVertsId, periodicEdgesId, NullPeriodicMap,
+                                   checkIfSystemSingular))
+            {
+                SetUpUniversalC0ContMap(locExp, periodicVertsId, periodicEdgesId);
+                return;
+            }
+
             m_signChange = false;
             m_systemSingular = false;
             Array<OneD, map<int,int> > ReorderedGraphVertId(2);
@@ -540,6 +554,8 @@ namespace Nektar
             m_comm->GetRowComm()->AllReduce(hash, 
                               LibUtilities::ReduceSum);
             m_hash = hash;
+
+            SaveC0ContMapCache(cache);
         }
 
         /**
@@ -1283,6 +1299,7 @@ namespace Nektar
                 {
                 case eDirectFullMatrix:
                 case eIterativeFull:
+                case eIterativeMatrixFree:
                 case eIterativeStaticCond:
                 case eXxtFullMatrix:
                 case eXxtStaticCond:
@@ -1298,8 +1315,9 @@ namespace Nektar
                 case eDirectMultiLevelStaticCond:
                 case eIterativeMultiLevelStaticCond:
                 case eXxtMultiLevelStaticCond:
+                case eDirectSparseStaticCond:
                     {
-                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph,partVerts,mdswitch);
+                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph,partVerts,mdswitch,m_setupCacheDir);
                     }
                     break;
                 default:
@@ -35,6 +35,7 @@
 
 #include <MultiRegions/MultiRegions.hpp>
 #include <MultiRegions/AssemblyMap/AssemblyMapCG3D.h>
+#include <MultiRegions/SetupCache.h>
 #include <LocalRegions/Expansion2D.h>
 #include <LocalRegions/Expansion3D.h>
 
@@ -205,6 +206,18 @@ namespace Nektar
 
             const LocalRegions::ExpansionVector &locExpVector = *(locExp.GetExp());
 
+            // Reuse the numbering stored by a previous run with the same
+            // mesh, expansion and boundary conditions, if any.
+            SetupCache cache(m_setupCacheDir, "assemblymap");
+            if (LoadC0ContMapCache(cache, numLocalCoeffs, locExp,
+                                   bndCondExp, bndConditions,
+                                   periodicVerts, periodicEdges, periodicFaces,
+                                   checkIfSystemSingular))
+            {
+                SetUpUniversalC0ContMap(locExp, periodicVerts, periodicEdges, periodicFaces);
+                return;
+            }
+
             m_signChange = false;
             //m_systemSingular = false;
             
@@ -1224,6 +1237,7 @@ namespace Nektar
                 {
                 case eDirectFullMatrix:
                 case eIterativeFull:
+                case eIterativeMatrixFree:
                 case eIterativeStaticCond:
                 case eXxtFullMatrix:
                 case eXxtStaticCond:
@@ -1239,8 +1253,9 @@ namespace Nektar
                 case eDirectMultiLevelStaticCond:
                 case eIterativeMultiLevelStaticCond:
                 case eXxtMultiLevelStaticCond:
+                case eDirectSparseStaticCond:
                     {
-                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph,partVerts);
+                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph,partVerts,1,m_setupCacheDir);
                     }
                     break;
                 default:
@@ -1687,6 +1702,8 @@ namespace Nektar
             m_comm->GetRowComm()->AllReduce(hash, 
                               LibUtilities::ReduceSum);
             m_hash = hash;
+
+            SaveC0ContMapCache(cache);
         }
     } // namespace
 } // namespace
@@ -58,7 +58,10 @@ namespace Nektar
     namespace MultiRegions
     {
         AssemblyMapDG::AssemblyMapDG():
-            m_numDirichletBndPhys(0)
+            m_traceGsh(0),
+            m_numDirichletBndPhys(0),
+            m_traceSplitExchange(false),
+            m_tracePending(false)
         {
         }
 
@@ -79,7 +82,10 @@ namespace Nektar
             const Array<OneD, const SpatialDomains::BoundaryConditionShPtr> &bndCond,
             const map<int,int> &periodicVertices,
             const std::string variable)
-            : AssemblyMap(pSession,variable)
+            : AssemblyMap(pSession,variable),
+              m_traceGsh(0),
+              m_traceSplitExchange(false),
+              m_tracePending(false)
         {
             int i,j;
             int cnt, vid, gid;
@@ -194,7 +200,10 @@ namespace Nektar
                                                const Array<OneD, SpatialDomains::BoundaryConditionShPtr> &bndCond,
                                                const PeriodicMap &periodicEdges,
                                      const std::string variable) :
-            AssemblyMap(pSession,variable)
+            AssemblyMap(pSession,variable),
+            m_traceGsh(0),
+            m_traceSplitExchange(false),
+            m_tracePending(false)
         {
 
             int i,j,k,cnt,eid, id, id1, order_e,gid;
@@ -439,8 +448,10 @@ namespace Nektar
                         break;
                     }
                     case eDirectMultiLevelStaticCond:
+                    case eDirectSparseStaticCond:
                     {
-                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph);
+                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph,
+                                                      std::set<int>(),1,m_setupCacheDir);
                         break;
                     }
                     default:
@@ -634,7 +645,10 @@ namespace Nektar
             const Array<OneD, SpatialDomains::BoundaryConditionShPtr> &bndCond,
             const PeriodicMap                                         &periodicFaces,
             const std::string variable):
-            AssemblyMap(pSession,variable)
+            AssemblyMap(pSession,variable),
+            m_traceGsh(0),
+            m_traceSplitExchange(false),
+            m_tracePending(false)
         {
             int i,j,k,cnt,eid, id, id1, order_e,gid;
             int ntrace_exp = trace->GetExpSize();
@@ -849,9 +863,12 @@ namespace Nektar
                         break;
                     }
                     case eDirectMultiLevelStaticCond:
+                    case eDirectSparseStaticCond:
                     {
                         MultiLevelBisectionReordering(boostGraphObj,perm,iperm,
-                                                      bottomUpGraph);
+                                                      bottomUpGraph,
+                                                      std::set<int>(), 1,
+                                                      m_setupCacheDir);
                         break;
                     }
                     default:
@@ -1307,6 +1324,107 @@ namespace Nektar
             {
                 m_traceToUniversalMapUnique[i] = tmp2[i];
             }
+
+            SetUpTraceExchange();
+        }
+
+        /**
+         * Sets up the neighbour-wise exchange used by
+         * #UniversalTraceAssembleStart and #UniversalTraceAssembleFinish.
+         *
+         * In DG each trace point is shared by at most two elements, and so by
+         * at most one other process. The gather-scatter map is used to find,
+         * for every trace point, how many processes hold it and which they
+         * are. Shared points are then grouped by neighbouring process and
+         * ordered by universal ID so that both processes agree on the
+         * layout of the message between them. If any point is held more than
+         * twice, or twice on one process (e.g. a periodic trace), the split
+         * exchange is disabled on all processes and the gather-scatter
+         * operation is used instead.
+         */
+        void AssemblyMapDG::SetUpTraceExchange()
+        {
+            m_traceSplitExchange = false;
+
+            if (!m_traceGsh)
+            {
+                return;
+            }
+
+            const int nTracePhys = m_traceToUniversalMap.num_elements();
+            const int rank       = m_comm->GetRank();
+            int i;
+
+            Array<OneD, NekDouble> count  (nTracePhys, 1.0);
+            Array<OneD, NekDouble> procMin(nTracePhys, (NekDouble) rank);
+            Array<OneD, NekDouble> procMax(nTracePhys, (NekDouble) rank);
+
+            Gs::Gather(count,   Gs::gs_add, m_traceGsh);
+            Gs::Gather(procMin, Gs::gs_min, m_traceGsh);
+            Gs::Gather(procMax, Gs::gs_max, m_traceGsh);
+
+            int valid = 1;
+            map<int, vector<pair<int, int> > > shared;
+
+            m_traceSharedPts.resize(nTracePhys);
+            for (i = 0; i < nTracePhys; ++i)
+            {
+                m_traceSharedPts[i] = count[i] > 1.5;
+            }
+
+            for (i = 0; i < nTracePhys; ++i)
+            {
+                int nHolders = (int) (count[i] + 0.5);
+                int pMin     = (int) (procMin[i] + 0.5);
+                int pMax     = (int) (procMax[i] + 0.5);
+
+                if (nHolders == 1)
+                {
+                    continue;
+                }
+
+                if (nHolders > 2 || pMin == pMax)
+                {
+                    valid = 0;
+                    break;
+                }
+
+                shared[pMin + pMax - rank].push_back(
+                    make_pair(m_traceToUniversalMap[i], i));
+            }
+
+            m_comm->AllReduce(valid, LibUtilities::ReduceMin);
+
+            if (!valid)
+            {
+                return;
+            }
+
+            int nShared = 0;
+            map<int, vector<pair<int, int> > >::iterator it;
+            for (it = shared.begin(); it != shared.end(); ++it)
+            {
+                nShared += it->second.size();
+            }
+
+            m_traceExchangeProcs   = Array<OneD, int>(shared.size());
+            m_traceExchangeOffsets = Array<OneD, int>(shared.size()+1, 0);
+            m_traceExchangeMap     = Array<OneD, int>(nShared);
+
+            int cnt = 0;
+            for (i = 0, it = shared.begin(); it != shared.end(); ++it, ++i)
+            {
+                sort(it->second.begin(), it->second.end());
+
+                m_traceExchangeProcs[i] = it->first;
+                for (int j = 0; j < it->second.size(); ++j)
+                {
+                    m_traceExchangeMap[cnt++] = it->second[j].second;
+                }
+                m_traceExchangeOffsets[i+1] = cnt;
+            }
+
+            m_traceSplitExchange = true;
         }
 
         void AssemblyMapDG::RealignTraceElement(
@@ -1395,6 +1513,149 @@ namespace Nektar
             Gs::Gather(pGlobal, Gs::gs_add, m_traceGsh);
         }
 
+        /**
+         * Assembles several trace vectors across processes with a single
+         * gather-scatter exchange. The vectors are interleaved so that the
+         * partition-boundary values of all of them travel in one message per
+         * neighbouring process, rather than one message per vector.
+         */
+        void AssemblyMapDG::UniversalTraceAssemble(
+            Array<OneD, Array<OneD, NekDouble> > &pGlobal) const
+        {
+            const int nVec = pGlobal.num_elements();
+
+            if (!m_traceGsh || nVec == 0)
+            {
+                return;
+            }
+
+            const int nPts = pGlobal[0].num_elements();
+            Array<OneD, NekDouble> tmp(nVec*nPts);
+            int i;
+
+            for (i = 0; i < nVec; ++i)
+            {
+                Vmath::Vcopy(nPts, &pGlobal[i][0], 1, &tmp[i], nVec);
+            }
+
+            Gs::GatherVec(tmp, nVec, Gs::gs_add, m_traceGsh);
+
+            for (i = 0; i < nVec; ++i)
+            {
+                Vmath::Vcopy(nPts, &tmp[i], nVec, &pGlobal[i][0], 1);
+            }
+        }
+
+        /**
+         * Starts assembling the trace vectors @a pGlobal across processes.
+         * The values of the partition-boundary points are sent to the
+         * neighbouring processes without waiting for them to arrive, so that
+         * other work can be done before #UniversalTraceAssembleFinish is
+         * called. The partition-boundary values of @a pGlobal must not be
+         * modified in between.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleStart(
+            Array<OneD, Array<OneD, NekDouble> > &pGlobal)
+        {
+            ASSERTL0(!m_tracePending,
+                     "Trace exchange has already been started.");
+
+            m_tracePending   = true;
+            m_tracePendingIn = pGlobal;
+
+            if (!m_traceGsh || !m_traceSplitExchange)
+            {
+                return;
+            }
+
+            const int nVec   = pGlobal.num_elements();
+            const int nProcs = m_traceExchangeProcs.num_elements();
+            const int nBuf   = nVec*m_traceExchangeMap.num_elements();
+            int i, j, k;
+
+            if (m_traceSendBuf.num_elements() < nBuf)
+            {
+                m_traceSendBuf = Array<OneD, NekDouble>(nBuf);
+                m_traceRecvBuf = Array<OneD, NekDouble>(nBuf);
+            }
+
+            for (j = 0; j < m_traceExchangeMap.num_elements(); ++j)
+            {
+                for (k = 0; k < nVec; ++k)
+                {
+                    m_traceSendBuf[j*nVec+k] =
+                        pGlobal[k][m_traceExchangeMap[j]];
+                }
+            }
+
+            m_traceRequest = m_comm->CreateRequest(2*nProcs);
+
+            Array<OneD, NekDouble> tmp;
+            for (i = 0; i < nProcs; ++i)
+            {
+                int offset = nVec*m_traceExchangeOffsets[i];
+                int size   = nVec*(m_traceExchangeOffsets[i+1] -
+                                   m_traceExchangeOffsets[i]);
+
+                m_comm->Irecv(m_traceExchangeProcs[i],
+                              tmp = m_traceRecvBuf + offset, size,
+                              m_traceRequest, i);
+                m_comm->Isend(m_traceExchangeProcs[i],
+                              tmp = m_traceSendBuf + offset, size,
+                              m_traceRequest, nProcs+i);
+            }
+        }
+
+        /**
+         * Completes the assembly started by #UniversalTraceAssembleStart,
+         * adding the values received from neighbouring processes into the
+         * trace vectors passed to it.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleFinish()
+        {
+            if (!m_tracePending)
+            {
+                return;
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > pGlobal = m_tracePendingIn;
+
+            m_tracePending   = false;
+            m_tracePendingIn = Array<OneD, Array<OneD, NekDouble> >();
+
+            if (!m_traceGsh)
+            {
+                return;
+            }
+
+            if (!m_traceSplitExchange)
+            {
+                UniversalTraceAssemble(pGlobal);
+                return;
+            }
+
+            m_comm->WaitAll(m_traceRequest);
+
+            const int nVec = pGlobal.num_elements();
+            for (int j = 0; j < m_traceExchangeMap.num_elements(); ++j)
+            {
+                for (int k = 0; k < nVec; ++k)
+                {
+                    pGlobal[k][m_traceExchangeMap[j]] +=
+                        m_traceRecvBuf[j*nVec+k];
+                }
+            }
+        }
+
+        /**
+         * Returns whether the trace point @a i is shared with another
+         * process and so is exchanged by #UniversalTraceAssemble.
+         */
+        bool AssemblyMapDG::IsTracePointShared(const int i) const
+        {
+            return m_traceSharedPts.size() > 0 && m_traceSharedPts[i];
+        }
+
         int AssemblyMapDG::v_GetLocalToGlobalMap(const int i) const
         {
             return m_localToGlobalBndMap[i];
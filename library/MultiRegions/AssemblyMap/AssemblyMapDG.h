@@ -116,6 +116,16 @@ namespace Nektar
             MULTI_REGIONS_EXPORT void UniversalTraceAssemble(
                 Array<OneD, NekDouble> &pGlobal) const;
 
+            MULTI_REGIONS_EXPORT void UniversalTraceAssemble(
+                Array<OneD, Array<OneD, NekDouble> > &pGlobal) const;
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleStart(
+                Array<OneD, Array<OneD, NekDouble> > &pGlobal);
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleFinish();
+
+            MULTI_REGIONS_EXPORT bool IsTracePointShared(const int i) const;
+
         protected:
             Gs::gs_data * m_traceGsh;
             
@@ -131,8 +141,33 @@ namespace Nektar
             /// universal space (signed).
             Array<OneD,int> m_traceToUniversalMapUnique;
 
+            /// Whether the trace can be exchanged pairwise with neighbouring
+            /// processes using non-blocking communication.
+            bool                                 m_traceSplitExchange;
+            /// Neighbouring processes sharing trace points.
+            Array<OneD, int>                     m_traceExchangeProcs;
+            /// Offsets into #m_traceExchangeMap of the points shared with
+            /// each neighbouring process.
+            Array<OneD, int>                     m_traceExchangeOffsets;
+            /// Trace points shared with other processes, grouped by process
+            /// and ordered by universal ID.
+            Array<OneD, int>                     m_traceExchangeMap;
+            /// Send and receive buffers of the split exchange.
+            Array<OneD, NekDouble>               m_traceSendBuf;
+            Array<OneD, NekDouble>               m_traceRecvBuf;
+            /// Outstanding communications of the split exchange.
+            LibUtilities::CommRequestSharedPtr   m_traceRequest;
+            /// Whether an exchange has been started and not finished.
+            bool                                 m_tracePending;
+            /// Trace vectors of the exchange in progress.
+            Array<OneD, Array<OneD, NekDouble> > m_tracePendingIn;
+            /// Whether each trace point is shared with another process.
+            std::vector<bool>                    m_traceSharedPts;
+
             void SetUpUniversalDGMap(const ExpList &locExp);
 
+            void SetUpTraceExchange();
+
             void SetUpUniversalTraceMap(
                 const ExpList         &locExp,
                 const ExpListSharedPtr trace,
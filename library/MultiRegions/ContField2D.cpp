@@ -89,7 +89,8 @@ namespace Nektar
             m_globalMat(),
             m_globalLinSysManager(
                     boost::bind(&ContField2D::GenGlobalLinSys, this, _1),
-                    std::string("GlobalLinSys"))
+                    std::string("GlobalLinSys")),
+            m_parametricLinSys(MemoryManager<ParametricLinSysMap>::AllocateSharedPtr())
         {
         }
 
@@ -124,7 +125,8 @@ namespace Nektar
             m_globalMat(MemoryManager<GlobalMatrixMap>::AllocateSharedPtr()),
             m_globalLinSysManager(
                     boost::bind(&ContField2D::GenGlobalLinSys, this, _1),
-                    std::string("GlobalLinSys"))
+                    std::string("GlobalLinSys")),
+            m_parametricLinSys(MemoryManager<ParametricLinSysMap>::AllocateSharedPtr())
         {
             SpatialDomains::BoundaryConditions bcs(m_session, graph2D);
 
@@ -172,7 +174,8 @@ namespace Nektar
             m_globalMat   (MemoryManager<GlobalMatrixMap>::AllocateSharedPtr()),
             m_globalLinSysManager(
                     boost::bind(&ContField2D::GenGlobalLinSys, this, _1),
-                    std::string("GlobalLinSys"))
+                    std::string("GlobalLinSys")),
+            m_parametricLinSys(MemoryManager<ParametricLinSysMap>::AllocateSharedPtr())
         {
             SpatialDomains::BoundaryConditions bcs(m_session, graph2D);
             if(!SameTypeOfBoundaryConditions(In) || CheckIfSingularSystem)
@@ -203,7 +206,8 @@ namespace Nektar
             DisContField2D(In,DeclareCoeffPhysArrays),
             m_locToGloMap(In.m_locToGloMap),
             m_globalMat(In.m_globalMat),
-            m_globalLinSysManager(In.m_globalLinSysManager)
+            m_globalLinSysManager(In.m_globalLinSysManager),
+            m_parametricLinSys(In.m_parametricLinSys)
         {
         }
 
@@ -587,16 +591,28 @@ namespace Nektar
         GlobalLinSysSharedPtr ContField2D::GetGlobalLinSys(
                                 const GlobalLinSysKey &mkey)
         {
-            return m_globalLinSysManager[mkey];
+            GlobalLinSysSharedPtr linSys = m_globalLinSysManager[mkey];
+            UseParametricGlobalLinSys(linSys, *m_parametricLinSys);
+            return linSys;
         }
 
+        /**
+         * Helmholtz systems may be changed to a new Helmholtz constant
+         * rather than built again, see ExpList::GenParametricGlobalLinSys.
+         *
+         * @param   mkey        This key uniquely defines the requested
+         *                      linear system.
+         */
         GlobalLinSysSharedPtr ContField2D::GenGlobalLinSys(
                                 const GlobalLinSysKey &mkey)
         {
             ASSERTL1(mkey.LocToGloMapIsDefined(),
                      "To use method must have a AssemblyMap "
                      "attached to key");
-            return ExpList::GenGlobalLinSys(mkey, m_locToGloMap);
+
+            return GenParametricGlobalLinSys(mkey, m_locToGloMap,
+                                             m_globalLinSysManager,
+                                             *m_parametricLinSys);
         }
 
 
@@ -813,13 +829,121 @@ namespace Nektar
                 const StdRegions::ConstFactorMap &factors,
                 const StdRegions::VarCoeffMap &varcoeff,
                 const Array<OneD, const NekDouble> &dirForcing)
+        {
+            int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+            Array<OneD,NekDouble> wsp(contNcoeffs);
+            AssembleHelmholtzForcing(inarray, wsp);
+
+            GlobalLinSysKey key(StdRegions::eHelmholtz,m_locToGloMap,factors,varcoeff);
+            
+            if(flags.isSet(eUseGlobal))
+            {
+                GlobalSolve(key,wsp,outarray,dirForcing);
+            }
+            else
+            {
+                Array<OneD,NekDouble> tmp(contNcoeffs);
+                LocalToGlobal(outarray,tmp);
+                GlobalSolve(key,wsp,tmp,dirForcing);
+                GlobalToLocal(tmp,outarray);
+            }
+        }
+
+
+        /**
+         * Solves the Helmholtz equation for each of the \a fields in the
+         * manner of #v_HelmSolve. When all fields share the local to global
+         * mapping of this expansion, have no Robin boundary conditions and
+         * successive right-hand-side projection is disabled, the Helmholtz
+         * operators of all fields are identical and the global system is
+         * solved for all right-hand sides at once. Otherwise each field is
+         * solved in turn.
+         */
+        void ContField2D::v_MultiHelmSolve(
+                const Array<OneD, ExpListSharedPtr> &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff)
+        {
+            int i;
+            int nFields     = fields.num_elements();
+            int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+            int NumDirBcs   = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+
+            Array<OneD, ContField2DSharedPtr> cfields(nFields);
+            bool sharedSystem = m_locToGloMap->GetSuccessiveRHS() == 0 &&
+                                GetRobinBCInfo().size() == 0;
+            for(i = 0; i < nFields && sharedSystem; ++i)
+            {
+                cfields[i] = boost::dynamic_pointer_cast<ContField2D>(
+                                                                fields[i]);
+                sharedSystem = cfields[i] &&
+                    cfields[i]->m_locToGloMap == m_locToGloMap &&
+                    cfields[i]->GetRobinBCInfo().size() == 0;
+            }
+
+            if(!sharedSystem)
+            {
+                ExpList::v_MultiHelmSolve(fields, inarray, outarray, flags,
+                                          factors, varcoeff);
+                return;
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > rhs  (nFields);
+            Array<OneD, Array<OneD, NekDouble> > inout(nFields);
+
+            for(i = 0; i < nFields; ++i)
+            {
+                rhs[i] = Array<OneD, NekDouble>(contNcoeffs);
+                cfields[i]->AssembleHelmholtzForcing(inarray[i], rhs[i]);
+
+                if(flags.isSet(eUseGlobal))
+                {
+                    inout[i] = outarray[i];
+                }
+                else
+                {
+                    inout[i] = Array<OneD, NekDouble>(contNcoeffs);
+                    LocalToGlobal(outarray[i], inout[i]);
+                }
+
+                // Set the Dirichlet dofs of each field
+                cfields[i]->v_ImposeDirichletConditions(inout[i]);
+            }
+
+            if(contNcoeffs - NumDirBcs > 0)
+            {
+                GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                                    factors, varcoeff);
+                GetGlobalLinSys(key)->Solve(rhs, inout, m_locToGloMap);
+            }
+
+            if(!flags.isSet(eUseGlobal))
+            {
+                for(i = 0; i < nFields; ++i)
+                {
+                    GlobalToLocal(inout[i], outarray[i]);
+                }
+            }
+        }
+
+
+        /**
+         * Assembles the global right-hand side of the Helmholtz problem,
+         * consisting of the negated inner product of the forcing \a inarray
+         * and the weak (Neumann and Robin) boundary conditions.
+         */
+        void ContField2D::AssembleHelmholtzForcing(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &wsp)
         {
             //----------------------------------
             //  Setup RHS Inner product
             //----------------------------------
             // Inner product of forcing
             int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
-            Array<OneD,NekDouble> wsp(contNcoeffs);
             IProductWRTBase(inarray,wsp,eGlobal);
             // Note -1.0 term necessary to invert forcing function to
             // be consistent with matrix definition
@@ -851,20 +975,6 @@ namespace Nektar
 
             // Add weak boundary conditions to forcing
             Vmath::Vadd(contNcoeffs, wsp, 1, gamma, 1, wsp, 1);
-
-            GlobalLinSysKey key(StdRegions::eHelmholtz,m_locToGloMap,factors,varcoeff);
-            
-            if(flags.isSet(eUseGlobal))
-            {
-                GlobalSolve(key,wsp,outarray,dirForcing);
-            }
-            else
-            {
-                Array<OneD,NekDouble> tmp(contNcoeffs);
-                LocalToGlobal(outarray,tmp);
-                GlobalSolve(key,wsp,tmp,dirForcing);
-                GlobalToLocal(tmp,outarray);
-            }
         }
 
 
@@ -191,6 +191,11 @@ namespace Nektar
             /// constructed only once.
             LibUtilities::NekManager<GlobalLinSysKey, GlobalLinSys> m_globalLinSysManager;
 
+            /// (A shared pointer to) the recently used Helmholtz systems,
+            /// which are changed to a new Helmholtz constant rather than
+            /// built again, stored under their keys without the constant.
+            ParametricLinSysMapShPtr        m_parametricLinSys;
+
             /// Solves the linear system specified by the key \a key.
             MULTI_REGIONS_EXPORT void GlobalSolve(const GlobalLinSysKey &key,
                              const Array<OneD, const  NekDouble> &rhs,
@@ -206,6 +211,11 @@ namespace Nektar
 
             MULTI_REGIONS_EXPORT GlobalLinSysSharedPtr GenGlobalLinSys(const GlobalLinSysKey &mkey);
 
+            /// Assembles the global right-hand side of the Helmholtz problem.
+            MULTI_REGIONS_EXPORT void AssembleHelmholtzForcing(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp);
+
             /// Impose the Dirichlet Boundary Conditions on outarray 
             MULTI_REGIONS_EXPORT virtual void v_ImposeDirichletConditions(Array<OneD,NekDouble>& outarray);
 
@@ -254,6 +264,16 @@ namespace Nektar
                     const StdRegions::VarCoeffMap &varcoeff,
                     const Array<OneD, const NekDouble> &dirForcing);
 
+            /// Solves the Helmholtz equation for several fields sharing this
+            /// expansion's boundary condition layout.
+            MULTI_REGIONS_EXPORT virtual void v_MultiHelmSolve(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff);
+
             /// Calculates the result of the multiplication of a global
             /// matrix of type specified by \a mkey with a vector given by \a
             /// inarray.
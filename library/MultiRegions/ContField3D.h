@@ -119,6 +119,11 @@ namespace Nektar
             /// constructed only once.
             LibUtilities::NekManager<GlobalLinSysKey, GlobalLinSys> m_globalLinSysManager;
 
+            /// (A shared pointer to) the recently used Helmholtz systems,
+            /// which are changed to a new Helmholtz constant rather than
+            /// built again, stored under their keys without the constant.
+            ParametricLinSysMapShPtr        m_parametricLinSys;
+
             /// Performs the backward transformation of the spectral/hp
             /// element expansion.
             virtual void v_BwdTrans(
@@ -179,6 +184,18 @@ namespace Nektar
                     const StdRegions::VarCoeffMap &varcoeff,
                     const Array<OneD, const NekDouble> &dirForcing);
 
+            virtual void v_MultiHelmSolve(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff);
+
+            void AssembleHelmholtzForcing(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp);
+
             virtual void v_GeneralMatrixOp(
                     const GlobalMatrixKey             &gkey,
                     const Array<OneD,const NekDouble> &inarray,
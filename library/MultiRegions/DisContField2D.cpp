@@ -1333,7 +1333,7 @@ namespace Nektar
         {
             // Loop over elements and collect forward expansion
             int nexp = GetExpSize();
-            int cnt, n, e, npts, phys_offset;
+            int cnt, n, e, phys_offset;
             Array<OneD,NekDouble> e_tmp;
             PeriodicMap::iterator it2;
             boost::unordered_map<int,pair<int,int> >::iterator it3;
@@ -1371,8 +1371,24 @@ namespace Nektar
                 }
             }
             
+            FillBwdWithBoundCond(Fwd, Bwd);
+
+            // Do parallel exchange for forwards/backwards spaces.
+            m_traceMap->UniversalTraceAssemble(Fwd);
+            m_traceMap->UniversalTraceAssemble(Bwd);
+        }
+
+        /**
+         * @brief Fill the backwards trace space @a Bwd on the boundary of the
+         * domain from this field's boundary conditions and copy the periodic
+         * values across from @a Fwd.
+         */
+        void DisContField2D::FillBwdWithBoundCond(
+            const Array<OneD, const NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
             // Fill boundary conditions into missing elements.
-            int id1, id2 = 0;
+            int cnt, n, e, npts, id1, id2 = 0;
             
             for(cnt = n = 0; n < m_bndCondExpansions.num_elements(); ++n)
             {				
@@ -1424,10 +1440,198 @@ namespace Nektar
             {
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
+        }
 
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+        /**
+         * @brief Extract the forwards and backwards trace spaces of every
+         * field in @a fields at once.
+         *
+         * This is equivalent to calling #v_GetFwdBwdTracePhys with
+         * @a inarray[i] for each field, but the edges of each element are
+         * visited once for all fields, and the partition-boundary values of
+         * all the traces are exchanged in a single operation.
+         */
+        void DisContField2D::v_MultiGetFwdBwdTracePhys(
+            const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            v_MultiGetFwdBwdTracePhysStart (fields, inarray, Fwd, Bwd);
+            v_MultiGetFwdBwdTracePhysFinish();
+        }
+
+        /**
+         * @brief Extract the forwards and backwards trace spaces of every
+         * field in @a fields and start exchanging their partition-boundary
+         * values.
+         *
+         * The traces of elements with a edge on a partition boundary are
+         * extracted first and their exchange is posted; the traces of the
+         * remaining elements and the boundary conditions are then filled in
+         * while the messages are in flight. The trace spaces are complete
+         * once #v_MultiGetFwdBwdTracePhysFinish has been called, and work
+         * which does not need them can be done in between. Fields which do
+         * not share this field's expansions and trace map are handled one at
+         * a time by ExpList::v_MultiGetFwdBwdTracePhys.
+         */
+        void DisContField2D::v_MultiGetFwdBwdTracePhysStart(
+            const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            const int nFields = fields.num_elements();
+            int i;
+
+            ASSERTL1(inarray.num_elements() == nFields &&
+                     Fwd    .num_elements() == nFields &&
+                     Bwd    .num_elements() == nFields,
+                     "Number of fields and trace arrays differ.");
+
+            std::vector<DisContField2D *> disFields(nFields);
+            for (i = 0; i < nFields; ++i)
+            {
+                disFields[i] = dynamic_cast<DisContField2D *>(fields[i].get());
+
+                if (!disFields[i] ||
+                    disFields[i]->m_exp      != m_exp ||
+                    disFields[i]->m_traceMap != m_traceMap)
+                {
+                    ExpList::v_MultiGetFwdBwdTracePhys(
+                        fields, inarray, Fwd, Bwd);
+                    return;
+                }
+            }
+
+            if (m_elmtTraceOffset.size() != GetExpSize())
+            {
+                SetUpPartitionBndElmts();
+            }
+
+            for (i = 0; i < nFields; ++i)
+            {
+                Vmath::Zero(Fwd[i].num_elements(), Fwd[i], 1);
+                Vmath::Zero(Bwd[i].num_elements(), Bwd[i], 1);
+            }
+
+            ExtractElmtTraces(m_partitionBndElmts, inarray, Fwd, Bwd);
+
+            Array<OneD, Array<OneD, NekDouble> > traces(2*nFields);
+            for (i = 0; i < nFields; ++i)
+            {
+                traces[2*i]   = Fwd[i];
+                traces[2*i+1] = Bwd[i];
+            }
+            m_traceMap->UniversalTraceAssembleStart(traces);
+
+            ExtractElmtTraces(m_interiorElmts, inarray, Fwd, Bwd);
+
+            // Boundary conditions differ between fields. They do not touch
+            // the partition-boundary values being exchanged.
+            for (i = 0; i < nFields; ++i)
+            {
+                disFields[i]->FillBwdWithBoundCond(Fwd[i], Bwd[i]);
+            }
+        }
+
+        /**
+         * @brief Complete the exchange started by
+         * #v_MultiGetFwdBwdTracePhysStart.
+         */
+        void DisContField2D::v_MultiGetFwdBwdTracePhysFinish()
+        {
+            m_traceMap->UniversalTraceAssembleFinish();
+        }
+
+        /**
+         * @brief Extract the edge values of @a inarray for the elements
+         * @a elmts into the forwards or backwards trace spaces.
+         */
+        void DisContField2D::ExtractElmtTraces(
+            const std::vector<int>                           &elmts,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            const int nFields = inarray.num_elements();
+            int i, j, n, e, cnt, offset, phys_offset;
+            Array<OneD, NekDouble> e_tmp;
+            LocalRegions::Expansion2DSharedPtr exp2d;
+
+            Array<OneD, Array<OneD, StdRegions::StdExpansionSharedPtr> >
+                &elmtToTrace = m_traceMap->GetElmtToTrace();
+
+            for (j = 0; j < elmts.size(); ++j)
+            {
+                n           = elmts[j];
+                cnt         = m_elmtTraceOffset[n];
+                exp2d       =
+                    LocalRegions::Expansion2D::FromStdExp((*m_exp)[n]);
+                phys_offset = GetPhys_Offset(n);
+
+                for (e = 0; e < exp2d->GetNedges(); ++e, ++cnt)
+                {
+                    offset = m_trace->GetPhys_Offset(
+                        elmtToTrace[n][e]->GetElmtId());
+
+                    Array<OneD, Array<OneD, NekDouble> > &trace =
+                        m_leftAdjacentEdges[cnt] ? Fwd : Bwd;
+
+                    for (i = 0; i < nFields; ++i)
+                    {
+                        exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
+                                             inarray[i] + phys_offset,
+                                             e_tmp = trace[i] + offset);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Sort the elements into those with a edge on a partition
+         * boundary and the remainder, and record where each element's
+         * edges start in #m_leftAdjacentEdges.
+         */
+        void DisContField2D::SetUpPartitionBndElmts()
+        {
+            const int nexp = GetExpSize();
+            int n, e, i, cnt, offset, npts;
+            bool bnd;
+
+            Array<OneD, Array<OneD, StdRegions::StdExpansionSharedPtr> >
+                &elmtToTrace = m_traceMap->GetElmtToTrace();
+
+            m_elmtTraceOffset.resize(nexp);
+            m_partitionBndElmts.clear();
+            m_interiorElmts.clear();
+
+            for (cnt = n = 0; n < nexp; ++n)
+            {
+                m_elmtTraceOffset[n] = cnt;
+                bnd = false;
+
+                for (e = 0; e < (*m_exp)[n]->GetNedges(); ++e, ++cnt)
+                {
+                    offset = m_trace->GetPhys_Offset(
+                        elmtToTrace[n][e]->GetElmtId());
+                    npts   = elmtToTrace[n][e]->GetTotPoints();
+
+                    for (i = 0; i < npts && !bnd; ++i)
+                    {
+                        bnd = m_traceMap->IsTracePointShared(offset + i);
+                    }
+                }
+
+                if (bnd)
+                {
+                    m_partitionBndElmts.push_back(n);
+                }
+                else
+                {
+                    m_interiorElmts.push_back(n);
+                }
+            }
         }
         
         void DisContField2D::v_FillBndCondFromField(void)
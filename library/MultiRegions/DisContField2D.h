@@ -151,6 +151,14 @@ namespace Nektar
              */
             vector<bool> m_leftAdjacentEdges;
 
+            /// Elements with edges on a partition boundary, whose traces are
+            /// extracted before the exchange is started, and the remainder.
+            vector<int> m_partitionBndElmts;
+            vector<int> m_interiorElmts;
+
+            /// Index of the first edge of each element in #m_leftAdjacentEdges.
+            vector<int> m_elmtTraceOffset;
+
             void SetUpDG(const std::string  = "DefaultVar");
             bool SameTypeOfBoundaryConditions(const DisContField2D &In);
             void GenerateBoundaryConditionExpansion(
@@ -164,6 +172,18 @@ namespace Nektar
             
             bool IsLeftAdjacentEdge(const int n, const int e);
 
+            void FillBwdWithBoundCond(
+                const Array<OneD, const NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+
+            void ExtractElmtTraces(
+                const std::vector<int>                           &elmts,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
+            void SetUpPartitionBndElmts();
+
             virtual void v_GetFwdBwdTracePhys(
                 const Array<OneD, const NekDouble> &field,
                       Array<OneD,       NekDouble> &Fwd,
@@ -171,6 +191,17 @@ namespace Nektar
             virtual void v_GetFwdBwdTracePhys(
                       Array<OneD,       NekDouble> &Fwd,
                       Array<OneD,       NekDouble> &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhysStart(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhysFinish();
             virtual void v_AddTraceIntegral(
                 const Array<OneD, const NekDouble> &Fx,
                 const Array<OneD, const NekDouble> &Fy,
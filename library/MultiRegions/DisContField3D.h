@@ -127,6 +127,14 @@ namespace Nektar
              */
             vector<bool> m_leftAdjacentFaces;
 
+            /// Elements with faces on a partition boundary, whose traces are
+            /// extracted before the exchange is started, and the remainder.
+            vector<int> m_partitionBndElmts;
+            vector<int> m_interiorElmts;
+
+            /// Index of the first face of each element in #m_leftAdjacentFaces.
+            vector<int> m_elmtTraceOffset;
+
             /**
              * @brief A vector indicating degress of freedom which need to be
              * copied from forwards to backwards space in case of a periodic
@@ -147,6 +155,18 @@ namespace Nektar
 
             bool IsLeftAdjacentFace(const int n, const int e);
 
+            void FillBwdWithBoundCond(
+                const Array<OneD, const NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+
+            void ExtractElmtTraces(
+                const std::vector<int>                           &elmts,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
+            void SetUpPartitionBndElmts();
+
             virtual void v_GetFwdBwdTracePhys(
                 Array<OneD,NekDouble> &Fwd,
                 Array<OneD,NekDouble> &Bwd);
@@ -154,6 +174,17 @@ namespace Nektar
                 const Array<OneD,const NekDouble> &field,
                       Array<OneD,      NekDouble> &Fwd,
                       Array<OneD,      NekDouble> &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhysStart(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhysFinish();
             virtual void v_ExtractTracePhys(
                       Array<OneD,       NekDouble> &outarray);
             virtual void v_ExtractTracePhys(
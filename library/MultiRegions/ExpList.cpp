@@ -33,8 +33,11 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <MultiRegions/ExpList.h>
 #include <LibUtilities/Communication/Comm.h>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
 #include <MultiRegions/GlobalLinSys.h>
 
 #include <LocalRegions/MatrixKey.h>     // for MatrixKey
@@ -696,36 +699,77 @@ namespace Nektar
             BlkMatrix = MemoryManager<DNekScalBlkMat>
                 ::AllocateSharedPtr(nrows,ncols,blkmatStorage);
 
-            int nvarcoeffs = gkey.GetNVarCoeffs();
-            int eid;
-            Array<OneD, NekDouble> varcoeffs_wk;
+            // The local matrices are independent of each other and are
+            // generated concurrently, since each may require several dense
+            // factorisations.
+            Array<OneD, int>                  eids(n_exp);
+            Array<OneD, DNekScalMatSharedPtr> loc_mats(n_exp);
+            for(i = 0; i < n_exp; ++i)
+            {
+                eids[i] = elmt_id[i];
+            }
+
+            GetMatrixSetupThreadPool()->ParallelFor(n_exp, boost::bind(
+                &ExpList::GenLocMatrix, this, boost::cref(gkey),
+                boost::cref(eids), boost::ref(loc_mats), _1));
 
             for(i = cnt1 = 0; i < n_exp; ++i)
             {
-                // need to be initialised with zero size for non variable coefficient case
-                StdRegions::VarCoeffMap varcoeffs;
+                BlkMatrix->SetBlock(i,i,loc_mat = loc_mats[i]);
+            }
 
-                eid = elmt_id[i];
-                if(nvarcoeffs>0)
-                {
-                    StdRegions::VarCoeffMap::const_iterator x;
-                    for (x = gkey.GetVarCoeffs().begin(); x != gkey.GetVarCoeffs().end(); ++x)
-                    {
-                        varcoeffs[x->first] = x->second + m_phys_offset[eid];
-                    }
-                }
+            return BlkMatrix;
+        }
 
-                LocalRegions::MatrixKey matkey(gkey.GetMatrixType(),
-                                               (*m_exp)[eid]->DetShapeType(),
-                                               *(*m_exp)[eid],
-                                               gkey.GetConstFactors(),
-                                               varcoeffs );
+        /**
+         * The number of threads is given by the parameter
+         * MatrixSetupThreads (default 1). Elemental matrices are
+         * independent of each other, so that the setup of global matrices,
+         * linear systems and preconditioners may generate them
+         * concurrently.
+         */
+        LibUtilities::ThreadPoolSharedPtr
+            ExpList::GetMatrixSetupThreadPool() const
+        {
+            int nThreads = 1;
+            if (m_session)
+            {
+                m_session->LoadParameter("MatrixSetupThreads", nThreads, 1);
+            }
+            return LibUtilities::GetThreadPool(std::max(nThreads, 1));
+        }
 
-                loc_mat = boost::dynamic_pointer_cast<LocalRegions::Expansion>((*m_exp)[elmt_id.find(i)->second])->GetLocMatrix(matkey);
-                BlkMatrix->SetBlock(i,i,loc_mat);
+        /**
+         * Generates the local matrix of element @a eids[i] and stores it in
+         * @a mats[i]. This may be called concurrently for different @a i.
+         */
+        void ExpList::GenLocMatrix(
+            const GlobalMatrixKey                   &gkey,
+            const Array<OneD, const int>            &eids,
+                  Array<OneD, DNekScalMatSharedPtr> &mats,
+            const unsigned int                       i)
+        {
+            // need to be initialised with zero size for non variable coefficient case
+            StdRegions::VarCoeffMap varcoeffs;
+
+            int eid = eids[i];
+            if(gkey.GetNVarCoeffs() > 0)
+            {
+                StdRegions::VarCoeffMap::const_iterator x;
+                for (x = gkey.GetVarCoeffs().begin(); x != gkey.GetVarCoeffs().end(); ++x)
+                {
+                    varcoeffs[x->first] = x->second + m_phys_offset[eid];
+                }
             }
 
-            return BlkMatrix;
+            LocalRegions::MatrixKey matkey(gkey.GetMatrixType(),
+                                           (*m_exp)[eid]->DetShapeType(),
+                                           *(*m_exp)[eid],
+                                           gkey.GetConstFactors(),
+                                           varcoeffs );
+
+            mats[i] = boost::dynamic_pointer_cast<LocalRegions::Expansion>(
+                (*m_exp)[eid])->GetLocMatrix(matkey);
         }
 
         const DNekScalBlkMatSharedPtr& ExpList::GetBlockMatrix(
@@ -1108,6 +1152,95 @@ namespace Nektar
                                                         vExpList,  locToGloMap);
         }
 
+        /**
+         * If the solver info ParametricHelmholtz is True, the Helmholtz
+         * systems built for a field are kept in @a pParametric for each key
+         * without the Helmholtz constant, most recently used first. Up to
+         * ParametricHelmholtzSystems (default 2) of them remain in the
+         * manager, so that alternating constants, as in IMEX or DIRK
+         * schemes, reuse their systems. For a constant not seen before,
+         * once this limit is reached, the least recently used system is
+         * removed from the manager and changed to the new constant if it
+         * supports this (see GlobalLinSys::UpdateKey), rather than a new
+         * system being built.
+         *
+         * @param   mkey        Key of the requested system.
+         * @param   locToGloMap Local to global mapping.
+         * @param   pManager    Manager holding the systems of the field.
+         * @param   pParametric Helmholtz systems of the field.
+         */
+        GlobalLinSysSharedPtr ExpList::GenParametricGlobalLinSys(
+            const GlobalLinSysKey                   &mkey,
+            const AssemblyMapCGSharedPtr            &locToGloMap,
+            LibUtilities::NekManager<GlobalLinSysKey, GlobalLinSys>
+                                                    &pManager,
+            ParametricLinSysMap                     &pParametric)
+        {
+            bool parametric;
+            m_session->MatchSolverInfo("ParametricHelmholtz", "True",
+                                       parametric, false);
+
+            if (!parametric ||
+                mkey.GetMatrixType() != StdRegions::eHelmholtz)
+            {
+                return GenGlobalLinSys(mkey, locToGloMap);
+            }
+
+            int nSystems;
+            m_session->LoadParameter("ParametricHelmholtzSystems",
+                                     nSystems, 2);
+
+            StdRegions::ConstFactorMap factors = mkey.GetConstFactors();
+            factors.erase(StdRegions::eFactorLambda);
+            GlobalLinSysKey baseKey(mkey.GetMatrixType(), locToGloMap,
+                                    factors, mkey.GetVarCoeffs());
+
+            std::list<GlobalLinSysSharedPtr> &systems = pParametric[baseKey];
+            GlobalLinSysSharedPtr linSys;
+
+            if ((int) systems.size() >= std::max(nSystems, 1))
+            {
+                GlobalLinSysSharedPtr oldSys = systems.back();
+                GlobalLinSysKey       oldKey = oldSys->GetKey();
+                systems.pop_back();
+
+                pManager.DeleteObject(oldKey);
+                if (oldSys->UpdateKey(mkey))
+                {
+                    linSys = oldSys;
+                }
+            }
+
+            if (!linSys)
+            {
+                linSys = GenGlobalLinSys(mkey, locToGloMap);
+            }
+
+            systems.push_front(linSys);
+            return linSys;
+        }
+
+        /**
+         * Systems which are not in @a pParametric are ignored.
+         */
+        void ExpList::UseParametricGlobalLinSys(
+            const GlobalLinSysSharedPtr &pLinSys,
+            ParametricLinSysMap         &pParametric)
+        {
+            ParametricLinSysMap::iterator it;
+            for (it = pParametric.begin(); it != pParametric.end(); ++it)
+            {
+                std::list<GlobalLinSysSharedPtr>::iterator sIt = std::find(
+                    it->second.begin(), it->second.end(), pLinSys);
+
+                if (sIt != it->second.end())
+                {
+                    it->second.splice(it->second.begin(), it->second, sIt);
+                    return;
+                }
+            }
+        }
+
         GlobalLinSysSharedPtr ExpList::GenGlobalBndLinSys(
                     const GlobalLinSysKey     &mkey,
                     const AssemblyMapSharedPtr &locToGloMap)
@@ -2167,6 +2300,48 @@ namespace Nektar
                      "This method is not defined or valid for this class type");
         }
 
+        /**
+         * Extract the forwards and backwards trace spaces @a Fwd[i] and
+         * @a Bwd[i] of each field @a fields[i] from its physical values
+         * @a inarray[i]. By default each field is handled in turn;
+         * expansions whose fields share a trace override this to visit the
+         * elements and exchange the trace data once for all fields.
+         */
+        void ExpList::v_MultiGetFwdBwdTracePhys(
+            const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            ASSERTL1(fields.num_elements() == inarray.num_elements(),
+                     "Number of fields and input arrays differ.");
+
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+            }
+        }
+
+        /**
+         * Start extracting the trace spaces of @a fields, which may only be
+         * used once #v_MultiGetFwdBwdTracePhysFinish has been called.
+         * Expansions which exchange trace data between processes override
+         * this pair so that the exchange can progress while other work is
+         * done; by default the traces are completed here.
+         */
+        void ExpList::v_MultiGetFwdBwdTracePhysStart(
+            const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            v_MultiGetFwdBwdTracePhys(fields, inarray, Fwd, Bwd);
+        }
+
+        void ExpList::v_MultiGetFwdBwdTracePhysFinish()
+        {
+        }
+
         void ExpList::v_ExtractTracePhys(Array<OneD,NekDouble> &outarray)
         {
             ASSERTL0(false,
@@ -2200,6 +2375,33 @@ namespace Nektar
         {
             ASSERTL0(false, "HelmSolve not implemented.");
         }
+
+        /**
+         * Solve the Helmholtz problem defined by \a factors and \a varcoeff
+         * for each field in \a fields, where \a inarray[i] holds the forcing
+         * of the i-th field at the quadrature points and \a outarray[i] the
+         * resulting coefficients. By default each field is solved in turn;
+         * expansions which can share a global system between fields
+         * override this to solve for all fields at once.
+         */
+        void ExpList::v_MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff)
+        {
+            ASSERTL1(fields.num_elements() == inarray.num_elements() &&
+                     fields.num_elements() == outarray.num_elements(),
+                     "Number of fields and right-hand sides differ.");
+
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                fields[i]->HelmSolve(inarray[i], outarray[i], flags,
+                                     factors, varcoeff);
+            }
+        }
 		
         void ExpList::v_LinearAdvectionDiffusionReactionSolve(
                        const Array<OneD, Array<OneD, NekDouble> > &velocity,
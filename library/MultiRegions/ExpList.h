@@ -39,6 +39,7 @@
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <LibUtilities/Communication/Comm.h>
 #include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
 #include <MultiRegions/MultiRegions.hpp>
 #include <LocalRegions/Expansion.h>
 #include <MultiRegions/GlobalMatrix.h>
@@ -52,6 +53,8 @@
 
 #include <tinyxml/tinyxml.h>
 
+#include <list>
+
 namespace Nektar
 {
     namespace MultiRegions
@@ -64,6 +67,14 @@ namespace Nektar
         class GlobalLinSysKey;
         class GlobalMatrix;
 
+        /// Helmholtz systems of a field for each key without the Helmholtz
+        /// constant, most recently used first.
+        typedef std::map<GlobalLinSysKey,
+                         std::list<boost::shared_ptr<GlobalLinSys> > >
+            ParametricLinSysMap;
+        typedef boost::shared_ptr<ParametricLinSysMap>
+            ParametricLinSysMapShPtr;
+
         enum Direction
 	{
 	    eX,
@@ -266,6 +277,16 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing =
                                 NullNekDouble1DArray);
 
+            /// Solve the same helmholtz problem for several fields
+            inline void MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff =
+                                StdRegions::NullVarCoeffMap);
+
             /// Solve Advection Diffusion Reaction
             inline void LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
@@ -692,6 +713,26 @@ namespace Nektar
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
 
+            /// Extract the forwards and backwards trace spaces of several
+            /// fields sharing this field's trace
+            inline void MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
+            /// Start extracting the trace spaces of several fields; they
+            /// are only complete after MultiGetFwdBwdTracePhysFinish
+            inline void MultiGetFwdBwdTracePhysStart(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
+            /// Complete the trace spaces started by
+            /// MultiGetFwdBwdTracePhysStart
+            inline void MultiGetFwdBwdTracePhysFinish();
+
             inline void ExtractTracePhys(Array<OneD,NekDouble> &outarray);
 
             inline void ExtractTracePhys(
@@ -844,6 +885,11 @@ namespace Nektar
                 return m_comm;
             }
 
+            /// Returns the shared thread pool for generating elemental
+            /// matrices.
+            MULTI_REGIONS_EXPORT LibUtilities::ThreadPoolSharedPtr
+                GetMatrixSetupThreadPool() const;
+
             SpatialDomains::MeshGraphSharedPtr GetGraph()
             {
                 return m_graph;
@@ -969,6 +1015,13 @@ namespace Nektar
             const DNekScalBlkMatSharedPtr GenBlockMatrix(
                 const GlobalMatrixKey &gkey);
 
+            /// Generates the local matrix of one element of a block matrix.
+            void GenLocMatrix(
+                const GlobalMatrixKey                   &gkey,
+                const Array<OneD, const int>            &eids,
+                      Array<OneD, DNekScalMatSharedPtr> &mats,
+                const unsigned int                       i);
+
             const DNekScalBlkMatSharedPtr& GetBlockMatrix(
                 const GlobalMatrixKey &gkey);
 
@@ -1003,6 +1056,21 @@ namespace Nektar
                 const GlobalLinSysKey     &mkey,
                 const AssemblyMapSharedPtr &locToGloMap);
 
+            /// Generate a global linear system, changing one of the
+            /// Helmholtz systems in \a pParametric to the new constant if
+            /// the solver info ParametricHelmholtz is True.
+            boost::shared_ptr<GlobalLinSys> GenParametricGlobalLinSys(
+                const GlobalLinSysKey                   &mkey,
+                const boost::shared_ptr<AssemblyMapCG>  &locToGloMap,
+                LibUtilities::NekManager<GlobalLinSysKey, GlobalLinSys>
+                                                        &pManager,
+                ParametricLinSysMap                     &pParametric);
+
+            /// Mark a system in \a pParametric as the most recently used.
+            void UseParametricGlobalLinSys(
+                const boost::shared_ptr<GlobalLinSys>   &pLinSys,
+                ParametricLinSysMap                     &pParametric);
+
             void ReadGlobalOptimizationParameters()
             {
                 v_ReadGlobalOptimizationParameters();
@@ -1066,6 +1134,20 @@ namespace Nektar
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
 
+            virtual void v_MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
+            virtual void v_MultiGetFwdBwdTracePhysStart(
+                const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
+            virtual void v_MultiGetFwdBwdTracePhysFinish();
+
             virtual void v_ExtractTracePhys(
                 Array<OneD,NekDouble> &outarray);
 
@@ -1086,6 +1168,14 @@ namespace Nektar
                 const StdRegions::VarCoeffMap &varcoeff,
                 const Array<OneD, const NekDouble> &dirForcing);
 
+            virtual void v_MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff);
+
             virtual void v_LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
                 const Array<OneD, const NekDouble> &inarray,
@@ -1577,6 +1667,21 @@ namespace Nektar
             v_HelmSolve(inarray, outarray, flags, factors, varcoeff, dirForcing);
         }
 
+        /**
+         *
+         */
+        inline void ExpList::MultiHelmSolve(
+            const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const FlagList &flags,
+            const StdRegions::ConstFactorMap &factors,
+            const StdRegions::VarCoeffMap &varcoeff)
+        {
+            v_MultiHelmSolve(fields, inarray, outarray, flags, factors,
+                             varcoeff);
+        }
+
 
         /**
          *
@@ -2021,6 +2126,29 @@ namespace Nektar
             v_GetFwdBwdTracePhys(field,Fwd,Bwd);
         }
 
+        inline void ExpList::MultiGetFwdBwdTracePhys(
+            const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            v_MultiGetFwdBwdTracePhys(fields, inarray, Fwd, Bwd);
+        }
+
+        inline void ExpList::MultiGetFwdBwdTracePhysStart(
+            const Array<OneD, boost::shared_ptr<ExpList> >   &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            v_MultiGetFwdBwdTracePhysStart(fields, inarray, Fwd, Bwd);
+        }
+
+        inline void ExpList::MultiGetFwdBwdTracePhysFinish()
+        {
+            v_MultiGetFwdBwdTracePhysFinish();
+        }
+
         inline void ExpList::ExtractTracePhys(Array<OneD,NekDouble> &outarray)
         {
             v_ExtractTracePhys(outarray);
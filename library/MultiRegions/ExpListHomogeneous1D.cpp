@@ -40,6 +40,8 @@
 #include <LocalRegions/Expansion.h>
 #include <LocalRegions/Expansion2D.h>
 
+#include <boost/bind.hpp>
+
 namespace Nektar
 {
     namespace MultiRegions
@@ -66,6 +68,10 @@ namespace Nektar
 			m_homogeneousBasis = LibUtilities::BasisManager()[HomoBasis];
 			
 			m_transposition = MemoryManager<LibUtilities::Transposition>::AllocateSharedPtr(HomoBasis,m_comm->GetColumnComm());
+
+            int nchunks;
+            m_session->LoadParameter("TranspositionChunks", nchunks, 4);
+            m_transposition->SetNumChunks(nchunks);
 			
 			m_planes = Array<OneD,ExpListSharedPtr>(m_homogeneousBasis->GetNumPoints()/m_comm->GetColumnComm()->GetSize());
             
@@ -89,6 +95,34 @@ namespace Nektar
                                     "with FFTW");
                 }
             }
+
+            if(m_useFFT)
+            {
+                m_FFT->SetPlanning(m_session);
+                if(m_dealiasing)
+                {
+                    m_FFT_deal->SetPlanning(m_session);
+                }
+            }
+        }
+
+        /**
+         * Transform @a howmany contiguous pencils in the homogeneous
+         * direction, used by the pipelined transposition.
+         */
+        void ExpListHomogeneous1D::PencilFFT(int howmany,
+                                             Array<OneD, NekDouble> &inarray,
+                                             Array<OneD, NekDouble> &outarray,
+                                             bool IsForwards)
+        {
+            if(IsForwards)
+            {
+                m_FFT->FFTFwdTrans(howmany, inarray, outarray);
+            }
+            else
+            {
+                m_FFT->FFTBwdTrans(howmany, inarray, outarray);
+            }
         }
 
 
@@ -100,6 +134,7 @@ namespace Nektar
             m_transposition(In.m_transposition),
             m_useFFT(In.m_useFFT),
             m_FFT(In.m_FFT),
+            m_FFT_deal(In.m_FFT_deal),
             m_tmpIN(In.m_tmpIN),
             m_tmpOUT(In.m_tmpOUT),
             m_homogeneousBasis(In.m_homogeneousBasis),
@@ -170,43 +205,47 @@ namespace Nektar
             Array<OneD, NekDouble> ShufV2(num_dfts_per_proc*N,0.0);
             Array<OneD, NekDouble> ShufV1V2(num_dfts_per_proc*N,0.0);
 
-            Array<OneD, NekDouble> ShufV1_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV1_PAD_phys(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV2_PAD_phys(m_padsize,0.0);
-
-            Array<OneD, NekDouble> ShufV1V2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV1V2_PAD_phys(m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1_PAD_coef(num_dfts_per_proc*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV2_PAD_coef(num_dfts_per_proc*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1_PAD_phys(num_dfts_per_proc*m_padsize);
+            Array<OneD, NekDouble> ShufV2_PAD_phys(num_dfts_per_proc*m_padsize);
 
             m_transposition->Transpose(V1, ShufV1, false, LibUtilities::eXYtoZ);
             m_transposition->Transpose(V2, ShufV2, false, LibUtilities::eXYtoZ);
 
-            // Looping on the pencils
+            // Copying each pencil of length N into a longer pencil of length
+            // m_padsize. We are in Fourier space
             for(int i = 0 ; i < num_dfts_per_proc ; i++)
             {
-                // Copying the i-th pencil pf lenght N into a bigger
-                // pencil of lenght 2N We are in Fourier space
-                Vmath::Vcopy(N, &(ShufV1[i*N]), 1, &(ShufV1_PAD_coef[0]), 1);
-                Vmath::Vcopy(N, &(ShufV2[i*N]), 1, &(ShufV2_PAD_coef[0]), 1);
+                Vmath::Vcopy(N, &(ShufV1[i*N]),                 1,
+                                &(ShufV1_PAD_coef[i*m_padsize]), 1);
+                Vmath::Vcopy(N, &(ShufV2[i*N]),                 1,
+                                &(ShufV2_PAD_coef[i*m_padsize]), 1);
+            }
 
-                // Moving to physical space using the padded system
-                m_FFT_deal->FFTBwdTrans(ShufV1_PAD_coef, ShufV1_PAD_phys);
-                m_FFT_deal->FFTBwdTrans(ShufV2_PAD_coef, ShufV2_PAD_phys);
+            // Moving all pencils to physical space using the padded system
+            m_FFT_deal->FFTBwdTrans(num_dfts_per_proc,
+                                    ShufV1_PAD_coef, ShufV1_PAD_phys);
+            m_FFT_deal->FFTBwdTrans(num_dfts_per_proc,
+                                    ShufV2_PAD_coef, ShufV2_PAD_phys);
 
-                // Perfroming the vectors multiplication in physical space on
-                // the padded system
-                Vmath::Vmul(m_padsize, ShufV1_PAD_phys,   1,
-                                       ShufV2_PAD_phys,   1,
-                                       ShufV1V2_PAD_phys, 1);
+            // Perfroming the vectors multiplication in physical space on
+            // the padded system
+            Vmath::Vmul(num_dfts_per_proc*m_padsize, ShufV1_PAD_phys, 1,
+                                                     ShufV2_PAD_phys, 1,
+                                                     ShufV1_PAD_phys, 1);
 
-                // Moving back the result (V1*V2)_phys in Fourier space, padded
-                // system
-                m_FFT_deal->FFTFwdTrans(ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
+            // Moving back the result (V1*V2)_phys in Fourier space, padded
+            // system
+            m_FFT_deal->FFTFwdTrans(num_dfts_per_proc,
+                                    ShufV1_PAD_phys, ShufV1_PAD_coef);
 
-                // Copying the first half of the padded pencil in the full
-                // vector (Fourier space)
-                Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[0]), 1,
-                                &(ShufV1V2[i*N]),        1);
+            // Copying the first N modes of each padded pencil in the full
+            // vector (Fourier space)
+            for(int i = 0 ; i < num_dfts_per_proc ; i++)
+            {
+                Vmath::Vcopy(N, &(ShufV1_PAD_coef[i*m_padsize]), 1,
+                                &(ShufV1V2[i*N]),                1);
             }
 
             m_transposition->Transpose(ShufV1V2, V1V2, false,
@@ -358,6 +397,16 @@ namespace Nektar
             if(m_useFFT)
             {		
                 
+                if(Shuff && UnShuff)
+                {
+                    // Pipeline the exchanges with the transforms
+                    m_transposition->TransformPencils(inarray, outarray,
+                        boost::bind(&ExpListHomogeneous1D::PencilFFT, this,
+                                    _1, _2, _3, IsForwards),
+                        IsForwards);
+                    return;
+                }
+
                 int num_points_per_plane = num_dofs/m_planes.num_elements();
                 int num_dfts_per_proc    = num_points_per_plane/m_comm->GetColumnComm()->GetSize() + (num_points_per_plane%m_comm->GetColumnComm()->GetSize() > 0);
                 
@@ -376,17 +425,11 @@ namespace Nektar
                 
                 if(IsForwards)
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTFwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTFwdTrans(num_dfts_per_proc, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTBwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTBwdTrans(num_dfts_per_proc, fft_in, fft_out);
                 }
 		
                 if(UnShuff)
@@ -272,6 +272,11 @@ namespace Nektar
             bool m_dealiasing;
             int m_padsize;
 
+            void PencilFFT(int howmany,
+                           Array<OneD, NekDouble> &inarray,
+                           Array<OneD, NekDouble> &outarray,
+                           bool IsForwards);
+
             /// Spectral vanishing Viscosity coefficient for stabilisation 
             Array<OneD, NekDouble> m_specVanVisc;
         };
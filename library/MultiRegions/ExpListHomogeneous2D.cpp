@@ -90,6 +90,8 @@ namespace Nektar
 			{
 				m_FFT_y = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_ny);
 				m_FFT_z = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_nz);
+				m_FFT_y->SetPlanning(m_session);
+				m_FFT_z->SetPlanning(m_session);
 			}
 			
 			if(m_dealiasing)
@@ -373,36 +375,22 @@ namespace Nektar
                 
                 if(IsForwards)
                 {
-                    for(int i=0;i<(p*m_nz);i++)
-                    {
-                        m_FFT_y->FFTFwdTrans(m_tmpIN = fft_in + i*m_ny, m_tmpOUT = fft_out + i*m_ny);
-                    }
-                    
+                    m_FFT_y->FFTFwdTrans(p*m_nz, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i=0;i<(p*m_nz);i++)
-                    {
-                        m_FFT_y->FFTBwdTrans(m_tmpIN = fft_in + i*m_ny, m_tmpOUT = fft_out + i*m_ny);
-                    }
+                    m_FFT_y->FFTBwdTrans(p*m_nz, fft_in, fft_out);
                 }
 		
                 m_transposition->Transpose(fft_out,fft_in,false,LibUtilities::eYZtoZY);
                 
                 if(IsForwards)
                 {
-                    for(int i=0;i<(p*m_ny);i++)
-                    {
-                        m_FFT_z->FFTFwdTrans(m_tmpIN = fft_in + i*m_nz, m_tmpOUT = fft_out + i*m_nz);
-                    }
-                    
+                    m_FFT_z->FFTFwdTrans(p*m_ny, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i=0;i<(p*m_ny);i++)
-                    {
-                        m_FFT_z->FFTBwdTrans(m_tmpIN = fft_in + i*m_nz, m_tmpOUT = fft_out + i*m_nz);
-                    }
+                    m_FFT_z->FFTBwdTrans(p*m_ny, fft_in, fft_out);
                 }
 		
                 //TODO: required ZYtoX routine
@@ -34,9 +34,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <MultiRegions/GlobalLinSys.h>
+#include <MultiRegions/SetupCache.h>
 #include <LocalRegions/MatrixKey.h>
 #include <LocalRegions/Expansion.h>
 #include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
 
 #include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
 #include <LibUtilities/LinearAlgebra/NekMatrix.hpp>
@@ -45,7 +47,7 @@ namespace Nektar
 {
     namespace MultiRegions
     {
-        std::string GlobalLinSys::lookupIds[8] = {
+        std::string GlobalLinSys::lookupIds[10] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "GlobalSysSoln", "DirectFull",
                 MultiRegions::eDirectFullMatrix),
@@ -69,7 +71,13 @@ namespace Nektar
                 MultiRegions::eXxtFullMatrix),
             LibUtilities::SessionReader::RegisterEnumValue(
                 "GlobalSysSoln", "XxtStaticCond",
-                MultiRegions::eXxtStaticCond)
+                MultiRegions::eXxtStaticCond),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "GlobalSysSoln", "DirectSparseStaticCond",
+                MultiRegions::eDirectSparseStaticCond),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "GlobalSysSoln", "IterativeMatrixFree",
+                MultiRegions::eIterativeMatrixFree)
         };
 
         std::string GlobalLinSys::def = LibUtilities::SessionReader::
@@ -314,7 +322,36 @@ namespace Nektar
                                            m_linSysKey.GetConstFactors(),
                                            vVarCoeffMap);
 
-            loc_mat = vExp->GetLocStaticCondMatrix(matkey);
+            if (m_staticCondBlocks.num_elements() > 0 && m_staticCondBlocks[n])
+            {
+                loc_mat = m_staticCondBlocks[n];
+            }
+            else
+            {
+                if (m_parametricBlocks.num_elements() > 0)
+                {
+                    if (!m_parametricBlocks[n])
+                    {
+                        m_parametricBlocks[n] = MemoryManager<
+                            ParametricStaticCondBlk>::AllocateSharedPtr(
+                                boost::dynamic_pointer_cast<
+                                    LocalRegions::Expansion>(vExp),
+                                matkey);
+                    }
+                    loc_mat = m_parametricBlocks[n]->GetStaticCondBlock(
+                        m_linSysKey.GetConstFactor(StdRegions::eFactorLambda));
+                }
+                else
+                {
+                    loc_mat = vExp->GetLocStaticCondMatrix(matkey);
+                }
+
+                // Keep the block for the setup cache.
+                if (m_staticCondCache)
+                {
+                    m_staticCondBlocks[n] = loc_mat;
+                }
+            }
 
             if(m_robinBCInfo.count(n) != 0) // add robin mass matrix
             {
@@ -337,10 +374,24 @@ namespace Nektar
                         rBC->m_robinID, rBC->m_robinPrimitiveCoeffs, new_mat);
                 }
 
-                // redeclare loc_mat to point to new_mat plus the scalar.
+                // redeclare loc_mat to point to new_mat plus the scalar. The
+                // static condensation matrix is pooled, and may be shared
+                // by all congruent elements, so a new block matrix is built
+                // which shares the remaining blocks rather than modifying
+                // the pooled one.
+                unsigned int exp_size[] = {
+                    loc_mat->GetNumberOfRowsInBlockRow(0),
+                    loc_mat->GetNumberOfRowsInBlockRow(1)};
+                DNekScalBlkMatSharedPtr robin_mat = MemoryManager<
+                    DNekScalBlkMat>::AllocateSharedPtr(2, 2, exp_size, exp_size);
+
                 tmp_mat = MemoryManager<DNekScalMat>::AllocateSharedPtr(
                     1.0, new_mat);
-                loc_mat->SetBlock(0,0,tmp_mat);
+                robin_mat->SetBlock(0,0,tmp_mat);
+                robin_mat->SetBlock(0,1,tmp_mat = loc_mat->GetBlock(0,1));
+                robin_mat->SetBlock(1,0,tmp_mat = loc_mat->GetBlock(1,0));
+                robin_mat->SetBlock(1,1,tmp_mat = loc_mat->GetBlock(1,1));
+                loc_mat = robin_mat;
             }
 
             return loc_mat;
@@ -356,6 +407,11 @@ namespace Nektar
         {
             boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
 
+            if (m_staticCondBlocks.num_elements() > 0)
+            {
+                m_staticCondBlocks[n] = DNekScalBlkMatSharedPtr();
+            }
+
             StdRegions::StdExpansionSharedPtr vExp = expList->GetExp(n);
 
             // need to be initialised with zero size for non variable
@@ -383,6 +439,324 @@ namespace Nektar
             vExp->DropLocStaticCondMatrix(matkey);
         }
 
+        /**
+         * Both the statically condensed matrix and the full elemental
+         * matrix of each element are removed, as well as any static
+         * condensation block held for the setup cache. This is used when
+         * the key of the system changes, so that the matrices of the old
+         * key do not accumulate in the managers of the elements.
+         */
+        void GlobalLinSys::DropElementalMatrices()
+        {
+            boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
+
+            m_staticCondBlocks = Array<OneD, DNekScalBlkMatSharedPtr>();
+
+            for (int n = 0; n < expList->GetExpSize(); ++n)
+            {
+                StdRegions::StdExpansionSharedPtr vExp = expList->GetExp(n);
+
+                StdRegions::VarCoeffMap vVarCoeffMap;
+                if(m_linSysKey.GetNVarCoeffs() > 0)
+                {
+                    StdRegions::VarCoeffMap::const_iterator x;
+                    int cnt = expList->GetPhys_Offset(n);
+                    for (x  = m_linSysKey.GetVarCoeffs().begin();
+                         x != m_linSysKey.GetVarCoeffs().end  (); ++x)
+                    {
+                        vVarCoeffMap[x->first] = x->second + cnt;
+                    }
+                }
+
+                LocalRegions::MatrixKey matkey(m_linSysKey.GetMatrixType(),
+                                               vExp->DetShapeType(),
+                                               *vExp,
+                                               m_linSysKey.GetConstFactors(),
+                                               vVarCoeffMap);
+
+                vExp->DropLocStaticCondMatrix(matkey);
+                vExp->DropLocMatrix(matkey);
+            }
+        }
+
+        /**
+         * By default a system is always built again for a new key.
+         */
+        bool GlobalLinSys::v_UpdateKey(const GlobalLinSysKey &pKey)
+        {
+            return false;
+        }
+
+        /**
+         * If the solver info SetupCacheDir is set, the static condensation
+         * blocks of all elements, without the Robin boundary terms, are read
+         * from the setup cache. If there is no entry for this system, they
+         * are collected by #v_GetStaticCondBlock as they are computed, so
+         * that #SaveStaticCondBlockCache can store them. This is called
+         * before the top level of a statically condensed system is set up.
+         *
+         * The key holds the matrix type, constant factors and variable
+         * coefficients of the system, the expansion of each element and the
+         * coordinates of all quadrature points, on which the elemental
+         * matrices depend through the geometric factors.
+         */
+        void GlobalLinSys::LoadStaticCondBlockCache()
+        {
+            boost::shared_ptr<ExpList> expList = m_expList.lock();
+            LibUtilities::SessionReaderSharedPtr session =
+                expList->GetSession();
+
+            if (!session->DefinesSolverInfo("SetupCacheDir") ||
+                m_linSysKey.GetMatrixType() ==
+                    StdRegions::eHybridDGHelmBndLam)
+            {
+                return;
+            }
+
+            int i, j, n;
+            int nExp = expList->GetExpSize();
+            int nq   = expList->GetTotPoints();
+
+            m_staticCondCache  = MemoryManager<SetupCache>::AllocateSharedPtr(
+                session->GetSolverInfo("SetupCacheDir"), "staticcond");
+            m_staticCondBlocks = Array<OneD, DNekScalBlkMatSharedPtr>(nExp);
+
+            SetupCache &cache = *m_staticCondCache;
+            cache.AddKey((int)m_linSysKey.GetMatrixType());
+
+            StdRegions::ConstFactorMap::const_iterator fIt;
+            for (fIt  = m_linSysKey.GetConstFactors().begin();
+                 fIt != m_linSysKey.GetConstFactors().end(); ++fIt)
+            {
+                cache.AddKey((int)fIt->first);
+                cache.AddKey(fIt->second);
+            }
+
+            StdRegions::VarCoeffMap::const_iterator vIt;
+            for (vIt  = m_linSysKey.GetVarCoeffs().begin();
+                 vIt != m_linSysKey.GetVarCoeffs().end(); ++vIt)
+            {
+                cache.AddKey((int)vIt->first);
+                cache.AddKey(vIt->second.get(), vIt->second.num_elements());
+            }
+
+            cache.AddKey(nExp);
+            for (n = 0; n < nExp; ++n)
+            {
+                LocalRegions::ExpansionSharedPtr exp = expList->GetExp(n);
+                cache.AddKey((int)exp->DetShapeType());
+                cache.AddKey(exp->GetGeom()->GetGlobalID());
+                cache.AddKey(exp->GetNcoeffs());
+                cache.AddKey(exp->NumBndryCoeffs());
+                for (j = 0; j < exp->GetNumBases(); ++j)
+                {
+                    LibUtilities::BasisKey bkey =
+                        exp->GetBasis(j)->GetBasisKey();
+                    cache.AddKey((int)bkey.GetBasisType());
+                    cache.AddKey(bkey.GetNumModes());
+                    cache.AddKey((int)bkey.GetPointsType());
+                    cache.AddKey(bkey.GetNumPoints());
+                }
+            }
+
+            Array<OneD, NekDouble> coords[3];
+            for (i = 0; i < 3; ++i)
+            {
+                coords[i] = Array<OneD, NekDouble>(nq, 0.0);
+            }
+            expList->GetCoords(coords[0], coords[1], coords[2]);
+            for (i = 0; i < (nExp ? expList->GetCoordim(0) : 0); ++i)
+            {
+                cache.AddKey(coords[i].get(), nq);
+            }
+
+            if (!cache.Load())
+            {
+                return;
+            }
+
+            // Elemental matrices shared between blocks, for example by
+            // congruent elements, are stored once and shared again.
+            int  nMat;
+            bool ok = cache.Get(nMat);
+            vector<DNekMatSharedPtr> mats;
+            for (i = 0; ok && i < nMat; ++i)
+            {
+                int                    info[5];
+                Array<OneD, NekDouble> data;
+                ok = cache.Get(info, 5) && cache.GetArray(data);
+                if (!ok)
+                {
+                    break;
+                }
+
+                DNekMatSharedPtr mat = MemoryManager<DNekMat>::
+                    AllocateSharedPtr(info[0], info[1], (MatrixStorage)info[2],
+                                      info[3], info[4]);
+                ok = mat->GetStorageSize() == data.num_elements();
+                if (ok)
+                {
+                    Vmath::Vcopy(data.num_elements(), data.get(), 1,
+                                 mat->GetRawPtr(), 1);
+                    mats.push_back(mat);
+                }
+            }
+
+            Array<OneD, DNekScalBlkMatSharedPtr> blocks(nExp);
+            for (n = 0; ok && n < nExp; ++n)
+            {
+                unsigned int exp_size[2];
+                ok = cache.Get(exp_size, 2);
+                if (!ok)
+                {
+                    break;
+                }
+
+                blocks[n] = MemoryManager<DNekScalBlkMat>::AllocateSharedPtr(
+                    2, 2, exp_size, exp_size);
+
+                for (i = 0; ok && i < 2; ++i)
+                {
+                    for (j = 0; ok && j < 2; ++j)
+                    {
+                        int       idx;
+                        NekDouble scale;
+                        ok = cache.Get(idx) && cache.Get(scale) &&
+                            idx < (int)mats.size();
+                        if (ok && idx >= 0)
+                        {
+                            DNekScalMatSharedPtr tmp_mat = MemoryManager<
+                                DNekScalMat>::AllocateSharedPtr(
+                                    scale, mats[idx]);
+                            blocks[n]->SetBlock(i, j, tmp_mat);
+                        }
+                    }
+                }
+            }
+
+            if (ok && cache.AtEnd())
+            {
+                m_staticCondBlocks = blocks;
+                m_staticCondCache.reset();
+            }
+        }
+
+        /**
+         * Called after the top level has been set up. Blocks are only
+         * stored if all of them were computed, and are then released to the
+         * matrix managers.
+         */
+        void GlobalLinSys::SaveStaticCondBlockCache()
+        {
+            if (!m_staticCondCache)
+            {
+                return;
+            }
+
+            int i, j, n;
+            int nExp = m_staticCondBlocks.num_elements();
+            bool complete = true;
+            for (n = 0; n < nExp; ++n)
+            {
+                complete = complete && m_staticCondBlocks[n];
+            }
+
+            if (complete)
+            {
+                SetupCache &cache = *m_staticCondCache;
+
+                // Number the distinct elemental matrices.
+                map<const DNekMat*, int> matIds;
+                vector<boost::shared_ptr<const DNekMat> > mats;
+                for (n = 0; n < nExp; ++n)
+                {
+                    for (i = 0; i < 2; ++i)
+                    {
+                        for (j = 0; j < 2; ++j)
+                        {
+                            DNekScalMatSharedPtr tmp_mat =
+                                m_staticCondBlocks[n]->GetBlock(i, j);
+                            if (tmp_mat && matIds.count(
+                                    tmp_mat->GetOwnedMatrix().get()) == 0)
+                            {
+                                matIds[tmp_mat->GetOwnedMatrix().get()] =
+                                    mats.size();
+                                mats.push_back(tmp_mat->GetOwnedMatrix());
+                            }
+                        }
+                    }
+                }
+
+                cache.Put((int)mats.size());
+                for (i = 0; i < (int)mats.size(); ++i)
+                {
+                    int info[5] = {
+                        (int)mats[i]->GetRows(),
+                        (int)mats[i]->GetColumns(),
+                        (int)mats[i]->GetType(),
+                        (int)mats[i]->GetNumberOfSubDiagonals(),
+                        (int)mats[i]->GetNumberOfSuperDiagonals() };
+                    cache.Put(info, 5);
+                    cache.Put(mats[i]->GetStorageSize());
+                    cache.Put(mats[i]->GetRawPtr(), mats[i]->GetStorageSize());
+                }
+
+                for (n = 0; n < nExp; ++n)
+                {
+                    unsigned int exp_size[2] = {
+                        m_staticCondBlocks[n]->GetNumberOfRowsInBlockRow(0),
+                        m_staticCondBlocks[n]->GetNumberOfRowsInBlockRow(1)};
+                    cache.Put(exp_size, 2);
+
+                    for (i = 0; i < 2; ++i)
+                    {
+                        for (j = 0; j < 2; ++j)
+                        {
+                            DNekScalMatSharedPtr tmp_mat =
+                                m_staticCondBlocks[n]->GetBlock(i, j);
+                            int       idx   = -1;
+                            NekDouble scale = 0.0;
+                            if (tmp_mat)
+                            {
+                                idx   = matIds[
+                                    tmp_mat->GetOwnedMatrix().get()];
+                                scale = tmp_mat->Scale();
+                            }
+                            cache.Put(idx);
+                            cache.Put(scale);
+                        }
+                    }
+                }
+
+                cache.Save();
+            }
+
+            m_staticCondCache.reset();
+            m_staticCondBlocks = Array<OneD, DNekScalBlkMatSharedPtr>();
+        }
+
+        /**
+         * @brief Solve the system for several right-hand sides.
+         *
+         * By default each right-hand side is solved in turn; solvers which
+         * can share work between right-hand sides override this method.
+         *
+         * @param   in          Right-hand sides.
+         * @param   out         On input, Dirichlet values and initial guesses;
+         *                      on output, the solutions.
+         * @param   locToGloMap Local to global mapping.
+         */
+        void GlobalLinSys::v_SolveMultiple(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap)
+        {
+            for (int i = 0; i < in.num_elements(); ++i)
+            {
+                v_Solve(in[i], out[i], locToGloMap);
+            }
+        }
+
         void GlobalLinSys::v_InitObject()
         {
             NEKERROR(ErrorUtil::efatal, "Method does not exist" );
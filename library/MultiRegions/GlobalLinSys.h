@@ -41,6 +41,7 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <MultiRegions/ExpList.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+#include <MultiRegions/ParametricStaticCondBlk.h>
 
 namespace Nektar
 {
@@ -49,6 +50,7 @@ namespace Nektar
         // Forward declarations
         class ExpList;
         class GlobalLinSys;
+        class SetupCache;
 
         /// Pointer to a GlobalLinSys object.
         typedef boost::shared_ptr<GlobalLinSys> GlobalLinSysSharedPtr;
@@ -97,6 +99,14 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides which
+            /// share this operator.
+            MULTI_REGIONS_EXPORT
+            inline void Solve(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
             /// Returns a shared pointer to the current object.
             boost::shared_ptr<GlobalLinSys> GetSharedThisPtr()
             {
@@ -108,6 +118,10 @@ namespace Nektar
             inline DNekScalBlkMatSharedPtr GetStaticCondBlock(unsigned int n);
             inline void                    DropStaticCondBlock(unsigned int n);
 
+            /// Change the system to that of a key which differs only in
+            /// its constant factors, if this is cheaper than building it.
+            inline bool UpdateKey(const GlobalLinSysKey &pKey);
+
             /// Solve the linear system for given input and output vectors.
             inline void SolveLinearSystem(
                 const int                          pNumRows,
@@ -118,16 +132,42 @@ namespace Nektar
             
         protected:
             /// Key associated with this linear system.
-            const GlobalLinSysKey                m_linSysKey;
+            GlobalLinSysKey                      m_linSysKey;
             /// Local Matrix System
             const boost::weak_ptr<ExpList>       m_expList;
             /// Robin boundary info
             const map<int, RobinBCInfoSharedPtr> m_robinBCInfo;
+            /// Setup cache entry in which the static condensation blocks
+            /// are to be stored.
+            boost::shared_ptr<SetupCache>        m_staticCondCache;
+            /// Static condensation blocks read from, or to be stored in, the
+            /// setup cache.
+            Array<OneD, DNekScalBlkMatSharedPtr> m_staticCondBlocks;
+            /// Split mass and Laplacian blocks of each element, from which
+            /// the static condensation blocks of a Helmholtz system are
+            /// formed once its constant has been changed.
+            Array<OneD, ParametricStaticCondBlkSharedPtr> m_parametricBlocks;
+
+            /// Read the static condensation blocks from the setup cache.
+            void LoadStaticCondBlockCache();
+            /// Store the static condensation blocks in the setup cache.
+            void SaveStaticCondBlockCache();
+            /// Remove the elemental matrices of the current key from the
+            /// matrix managers of the elements.
+            void DropElementalMatrices();
 
             virtual int                     v_GetNumBlocks      ();
             virtual DNekScalMatSharedPtr    v_GetBlock          (unsigned int n);
             virtual DNekScalBlkMatSharedPtr v_GetStaticCondBlock(unsigned int n);
             virtual void                    v_DropStaticCondBlock(unsigned int n);
+            virtual bool                    v_UpdateKey(
+                const GlobalLinSysKey &pKey);
+
+            /// Solve a linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
 
         private:
             /// Solve a linear system based on mapping.
@@ -183,6 +223,22 @@ namespace Nektar
         }
 
 
+        /**
+         * Each entry of @a out holds the Dirichlet values and initial guess
+         * for the corresponding right-hand side in @a in, as for the single
+         * right-hand side version.
+         */
+        inline void GlobalLinSys::Solve(
+                    const Array<OneD, const Array<OneD, NekDouble> > &in,
+                          Array<OneD,       Array<OneD, NekDouble> > &out,
+                    const AssemblyMapSharedPtr &locToGloMap)
+        {
+            ASSERTL1(in.num_elements() == out.num_elements(),
+                     "Number of right-hand sides and solutions differ.");
+            v_SolveMultiple(in,out,locToGloMap);
+        }
+
+
         /**
          *
          */
@@ -220,6 +276,16 @@ namespace Nektar
         {
             return v_GetNumBlocks();
         }
+
+        /**
+         * @returns     False if the system cannot be changed to @a pKey, in
+         *              which case it is left unchanged and a new system
+         *              must be built.
+         */
+        inline bool GlobalLinSys::UpdateKey(const GlobalLinSysKey &pKey)
+        {
+            return v_UpdateKey(pKey);
+        }
     } //end of namespace
 } //end of namespace
 
@@ -0,0 +1,996 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File GlobalLinSysAMGFull.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: GlobalLinSysAMGFull definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/VDmathArray.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <MultiRegions/GlobalLinSysAMGFull.h>
+#include <MultiRegions/ExpList.h>
+#include <math.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @class GlobalLinSysAMGFull
+         *
+         * Solves a symmetric positive definite global system with a single
+         * smoothed aggregation algebraic multigrid V-cycle. It is intended
+         * as a drop-in replacement for GlobalLinSysXxtFull as the coarse
+         * space solver of the linear space preconditioner, since XXT's setup
+         * cost and memory grow with the number of processes.
+         *
+         * Each process holds the operator as the sum of the elemental
+         * contributions of its own elements, so that the assembled operator
+         * is the sum of these partial matrices over all processes. Vectors
+         * are held assembled (consistent) on every process holding a dof and
+         * the matrix-vector product is completed by a gather-scatter
+         * operation over the dofs shared between processes.
+         *
+         * Aggregates are formed in two stages. Dofs shared between processes
+         * are aggregated only by the lowest-ranked process holding them,
+         * which then publishes the universal id of each aggregate; the
+         * remaining, process-interior dofs are then aggregated locally. The
+         * rows of the tentative prolongator belonging to interior dofs are
+         * smoothed with one damped Jacobi step, for which the local rows of
+         * the operator are complete; rows of shared dofs are left unsmoothed
+         * so that all processes hold identical copies. The coarse operators
+         * are then formed as \f$P^T A_p P\f$ on each process without further
+         * communication.
+         *
+         * Chebyshev smoothing is used on every level. Once the global size
+         * of a level drops below the parameter @c AMGCoarsestSize the
+         * operator is gathered onto all processes and factorised directly.
+         */
+
+        /**
+         * Registers the class with the Factory.
+         */
+        string GlobalLinSysAMGFull::className
+                = GetGlobalLinSysFactory().RegisterCreatorFunction(
+                    "AMGFull",
+                    GlobalLinSysAMGFull::create,
+                    "Algebraic multigrid Full Matrix.");
+
+
+        /// Constructor for full matrix AMG solve.
+        GlobalLinSysAMGFull::GlobalLinSysAMGFull(
+                    const GlobalLinSysKey &pLinSysKey,
+                    const boost::weak_ptr<ExpList> &pExp,
+                    const boost::shared_ptr<AssemblyMap>
+                                                            &pLocToGloMap)
+                : GlobalLinSys(pLinSysKey, pExp, pLocToGloMap),
+                  m_coarseSize(0),
+                  m_comm(pLocToGloMap->GetComm())
+        {
+            LibUtilities::SessionReaderSharedPtr vSession
+                                            = m_expList.lock()->GetSession();
+
+            vSession->LoadParameter("AMGStrengthThreshold",
+                                    m_strengthThreshold, 0.08);
+            vSession->LoadParameter("AMGCoarsestSize", m_coarsestSize, 256);
+            vSession->LoadParameter("AMGMaxLevels", m_maxLevels, 20);
+            vSession->LoadParameter("AMGSmoothingSteps", m_smoothingSteps, 2);
+
+            AssembleFinestLevel(pLocToGloMap);
+            SetupLevel(0);
+
+            // Coarsen until the system is small enough to be solved
+            // directly, or until coarsening stagnates.
+            NekDouble nFine   = GlobalSize(0);
+            NekDouble nCoarse = nFine;
+            while ((int) m_levels.size() < m_maxLevels &&
+                   nFine > m_coarsestSize)
+            {
+                Coarsen(m_levels.size() - 1);
+                nCoarse = GlobalSize(m_levels.size() - 1);
+
+                if (nCoarse > 0.9 * nFine)
+                {
+                    break;
+                }
+                nFine = nCoarse;
+            }
+
+            if (nCoarse <= m_coarsestSize)
+            {
+                SetupCoarsestSolve();
+            }
+
+            if (m_comm->GetRank() == 0 &&
+                vSession->DefinesCmdLineArgument("verbose"))
+            {
+                cout << "AMG: " << m_levels.size() << " levels, coarsest "
+                     << "level size " << nCoarse
+                     << (m_coarseSize ? " (direct solve)" : " (smoothed)")
+                     << endl;
+            }
+        }
+
+
+        GlobalLinSysAMGFull::~GlobalLinSysAMGFull()
+        {
+            for (int i = 0; i < m_levels.size(); ++i)
+            {
+                Gs::Finalise(m_levels[i].m_gsh);
+            }
+        }
+
+
+        /**
+         * Solve the linear system using a full global matrix system.
+         */
+        void GlobalLinSysAMGFull::v_Solve(
+                    const Array<OneD, const NekDouble>  &pInput,
+                          Array<OneD,       NekDouble>  &pOutput,
+                    const AssemblyMapSharedPtr &pLocToGloMap,
+                    const Array<OneD, const NekDouble>  &pDirForcing)
+        {
+            bool dirForcCalculated = (bool) pDirForcing.num_elements();
+            int nDirDofs  = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobDofs = pLocToGloMap->GetNumGlobalCoeffs();
+
+            Array<OneD, NekDouble> tmp (nGlobDofs);
+            Array<OneD, NekDouble> tmp2(nGlobDofs);
+            Array<OneD, NekDouble> tmp3 = pOutput + nDirDofs;
+
+            if(nDirDofs)
+            {
+                // calculate the dirichlet forcing
+                if(dirForcCalculated)
+                {
+                    Vmath::Vsub(nGlobDofs, pInput.get(), 1,
+                                pDirForcing.get(), 1,
+                                tmp.get(), 1);
+                }
+                else
+                {
+                    // Calculate the dirichlet forcing and substract it
+                    // from the rhs
+                    m_expList.lock()->GeneralMatrixOp(
+                            m_linSysKey,
+                            pOutput, tmp, eGlobal);
+
+                    Vmath::Vsub( nGlobDofs, pInput.get(),1,
+                                            tmp.get(),   1,
+                                            tmp.get(),   1);
+                }
+            }
+            else
+            {
+                Vmath::Vcopy(nGlobDofs, pInput, 1, tmp, 1);
+            }
+
+            SolveLinearSystem(pLocToGloMap->GetNumLocalCoeffs(),
+                              tmp, tmp2, pLocToGloMap);
+
+            // Perturb the output array (previous solution) by the result of
+            // this solve to get full solution.
+            Vmath::Vadd(nGlobDofs - nDirDofs,
+                        tmp2 + nDirDofs, 1, tmp3, 1, tmp3, 1);
+        }
+
+
+        /**
+         * Apply one V-cycle to the non-Dirichlet entries of @a pInput, a
+         * globally assembled right-hand side. Dirichlet entries of
+         * @a pOutput are set to zero.
+         */
+        void GlobalLinSysAMGFull::v_SolveLinearSystem(
+                const int pNumRows,
+                const Array<OneD,const NekDouble> &pInput,
+                      Array<OneD,      NekDouble> &pOutput,
+                const AssemblyMapSharedPtr &pLocToGloMap,
+                const int pNumDir)
+        {
+            int nDir  = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nDofs = m_levels[0].m_nDofs;
+
+            Array<OneD, NekDouble> vOut(nDofs, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            VCycle(0, pInput + nDir, vOut);
+
+            Vmath::Zero(nDir, pOutput, 1);
+            Vmath::Vcopy(nDofs, vOut, 1, tmp = pOutput + nDir, 1);
+        }
+
+
+        /**
+         * Assemble the contribution of the elements on this process to the
+         * non-Dirichlet part of the global matrix, numbered by the global
+         * dof numbering of @a pLocToGloMap.
+         */
+        void GlobalLinSysAMGFull::AssembleFinestLevel(
+                        const boost::shared_ptr<AssemblyMap> &pLocToGloMap)
+        {
+            ExpListSharedPtr vExp = m_expList.lock();
+            unsigned int nElmt    = vExp->GetNumElmts();
+            int nDir              = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nDofs             = pLocToGloMap->GetNumGlobalCoeffs() - nDir;
+            const Array<OneD, NekDouble> &vMapSign
+                                  = pLocToGloMap->GetLocalToGlobalSign();
+            bool doSign           = pLocToGloMap->GetSignChange();
+            unsigned int iCount   = 0;
+            unsigned int nRows, i, j, n;
+            int gid1, gid2;
+            NekDouble value;
+            DNekScalMatSharedPtr loc_mat;
+
+            RowMapVector vRows(nDofs);
+
+            for (n = 0; n < nElmt; ++n)
+            {
+                loc_mat = GetBlock(vExp->GetOffset_Elmt_Id(n));
+                nRows   = loc_mat->GetRows();
+
+                for (i = 0; i < nRows; ++i)
+                {
+                    gid1 = pLocToGloMap->GetLocalToGlobalMap(iCount + i) - nDir;
+                    if (gid1 < 0)
+                    {
+                        continue;
+                    }
+
+                    for (j = 0; j < nRows; ++j)
+                    {
+                        gid2 = pLocToGloMap->GetLocalToGlobalMap(iCount + j)
+                                                                    - nDir;
+                        if (gid2 < 0)
+                        {
+                            continue;
+                        }
+
+                        value = (*loc_mat)(i,j);
+                        if (doSign)
+                        {
+                            value *= vMapSign[iCount+i]*vMapSign[iCount+j];
+                        }
+                        vRows[gid1][gid2] += value;
+                    }
+                }
+                iCount += nRows;
+            }
+
+            AMGLevel vLevel;
+            vLevel.m_nDofs = nDofs;
+            vLevel.m_ids   = Array<OneD, long>(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                vLevel.m_ids[i]
+                    = pLocToGloMap->GetGlobalToUniversalMap(i + nDir);
+            }
+            RowMapToCsr(vRows, vLevel.m_A);
+
+            m_levels.push_back(vLevel);
+        }
+
+
+        /**
+         * Set up the communication pattern, multiplicity, ownership, inverse
+         * diagonal and spectral bound of the level @a level, whose operator
+         * and universal ids have already been set.
+         */
+        void GlobalLinSysAMGFull::SetupLevel(const int level)
+        {
+            AMGLevel &vLevel = m_levels[level];
+            int nDofs = vLevel.m_nDofs;
+            int vRank = m_comm->GetRank();
+            int i, k;
+
+            Array<OneD, NekDouble> tmp(nDofs, 1.0);
+
+            vLevel.m_gsh = Gs::Init(vLevel.m_ids, m_comm);
+
+            // Number of processes holding each dof
+            Gs::Gather(tmp, Gs::gs_add, vLevel.m_gsh);
+            vLevel.m_invMult = Array<OneD, NekDouble>(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                vLevel.m_invMult[i] = 1.0/tmp[i];
+            }
+
+            // Each dof is owned by the lowest ranked process holding it
+            Vmath::Fill(nDofs, (NekDouble) vRank, tmp, 1);
+            Gs::Gather(tmp, Gs::gs_min, vLevel.m_gsh);
+            vLevel.m_owned = Array<OneD, int>(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                vLevel.m_owned[i] = ((int) tmp[i] == vRank) ? 1 : 0;
+            }
+
+            // Assembled diagonal
+            Vmath::Zero(nDofs, tmp, 1);
+            for (i = 0; i < nDofs; ++i)
+            {
+                for (k = vLevel.m_A.m_rowPtr[i];
+                     k < vLevel.m_A.m_rowPtr[i+1]; ++k)
+                {
+                    if (vLevel.m_A.m_colIdx[k] == i)
+                    {
+                        tmp[i] += vLevel.m_A.m_val[k];
+                    }
+                }
+            }
+            Gs::Gather(tmp, Gs::gs_add, vLevel.m_gsh);
+
+            vLevel.m_invDiag = Array<OneD, NekDouble>(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                ASSERTL0(tmp[i] > 0.0, "AMG requires a positive diagonal");
+                vLevel.m_invDiag[i] = 1.0/tmp[i];
+            }
+
+            vLevel.m_lambdaMax = EstimateLambdaMax(level);
+        }
+
+
+        /**
+         * Form the aggregates of level @a level, the smoothed prolongator
+         * and the Galerkin coarse operator, and append the resulting coarse
+         * level to the hierarchy.
+         */
+        void GlobalLinSysAMGFull::Coarsen(const int level)
+        {
+            AMGLevel &vFine = m_levels[level];
+            const CsrMatrix &A = vFine.m_A;
+            int nDofs = vFine.m_nDofs;
+            int nAgg  = 0;
+            int i, j, k, l, m, best;
+            NekDouble s, bestStrength;
+            bool isRoot;
+
+            // Strength of connection
+            std::vector<std::vector<int> >       vStrong(nDofs);
+            std::vector<std::vector<NekDouble> > vStrength(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                for (k = A.m_rowPtr[i]; k < A.m_rowPtr[i+1]; ++k)
+                {
+                    j = A.m_colIdx[k];
+                    if (j == i)
+                    {
+                        continue;
+                    }
+                    s = fabs(A.m_val[k]) *
+                        sqrt(vFine.m_invDiag[i] * vFine.m_invDiag[j]);
+                    if (s >= m_strengthThreshold)
+                    {
+                        vStrong[i].push_back(j);
+                        vStrength[i].push_back(s);
+                    }
+                }
+            }
+
+            Array<OneD, int>  vAgg(nDofs, -1);
+            std::vector<long> vAggIds;
+            std::map<long, int> vIdToAgg;
+
+            // Aggregates rooted at shared dofs owned by this process. These
+            // may absorb any neighbour this process owns.
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vFine.m_invMult[i] == 1.0 || !vFine.m_owned[i] ||
+                    vAgg[i] >= 0)
+                {
+                    continue;
+                }
+
+                isRoot = true;
+                for (l = 0; l < vStrong[i].size(); ++l)
+                {
+                    j = vStrong[i][l];
+                    if (vFine.m_owned[j] && vAgg[j] >= 0)
+                    {
+                        isRoot = false;
+                        break;
+                    }
+                }
+
+                if (isRoot)
+                {
+                    vAgg[i] = nAgg;
+                    for (l = 0; l < vStrong[i].size(); ++l)
+                    {
+                        j = vStrong[i][l];
+                        if (vFine.m_owned[j])
+                        {
+                            vAgg[j] = nAgg;
+                        }
+                    }
+                    vAggIds.push_back(vFine.m_ids[i]);
+                    ++nAgg;
+                }
+            }
+
+            // Remaining owned shared dofs join their strongest aggregated
+            // neighbour, or form an aggregate of their own.
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vFine.m_invMult[i] == 1.0 || !vFine.m_owned[i] ||
+                    vAgg[i] >= 0)
+                {
+                    continue;
+                }
+
+                best = -1;
+                bestStrength = 0.0;
+                for (l = 0; l < vStrong[i].size(); ++l)
+                {
+                    j = vStrong[i][l];
+                    if (vAgg[j] >= 0 && vStrength[i][l] > bestStrength)
+                    {
+                        best = j;
+                        bestStrength = vStrength[i][l];
+                    }
+                }
+
+                if (best >= 0)
+                {
+                    vAgg[i] = vAgg[best];
+                }
+                else
+                {
+                    vAgg[i] = nAgg++;
+                    vAggIds.push_back(vFine.m_ids[i]);
+                }
+            }
+
+            for (i = 0; i < nAgg; ++i)
+            {
+                vIdToAgg[vAggIds[i]] = i;
+            }
+
+            // Publish the aggregate of each shared dof to the other
+            // processes holding it.
+            Array<OneD, NekDouble> tmp(nDofs, 0.0);
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vFine.m_invMult[i] < 1.0 && vFine.m_owned[i])
+                {
+                    tmp[i] = (NekDouble) vAggIds[vAgg[i]];
+                }
+            }
+            Gs::Gather(tmp, Gs::gs_add, vFine.m_gsh);
+
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vFine.m_invMult[i] == 1.0 || vFine.m_owned[i])
+                {
+                    continue;
+                }
+
+                long vId = (long) (tmp[i] + 0.5);
+                std::map<long, int>::iterator it = vIdToAgg.find(vId);
+                if (it == vIdToAgg.end())
+                {
+                    vIdToAgg[vId] = nAgg;
+                    vAggIds.push_back(vId);
+                    vAgg[i] = nAgg++;
+                }
+                else
+                {
+                    vAgg[i] = it->second;
+                }
+            }
+
+            // Aggregate the remaining (process-interior) dofs. First form
+            // aggregates around dofs none of whose strong neighbours are
+            // aggregated.
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vAgg[i] >= 0)
+                {
+                    continue;
+                }
+
+                isRoot = true;
+                for (l = 0; l < vStrong[i].size(); ++l)
+                {
+                    if (vAgg[vStrong[i][l]] >= 0)
+                    {
+                        isRoot = false;
+                        break;
+                    }
+                }
+
+                if (isRoot)
+                {
+                    vAgg[i] = nAgg;
+                    for (l = 0; l < vStrong[i].size(); ++l)
+                    {
+                        vAgg[vStrong[i][l]] = nAgg;
+                    }
+                    vAggIds.push_back(0);
+                    ++nAgg;
+                }
+            }
+
+            // Then attach left-over dofs to their strongest aggregated
+            // neighbour, or make them singletons if isolated.
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vAgg[i] >= 0)
+                {
+                    continue;
+                }
+
+                best = -1;
+                bestStrength = 0.0;
+                for (l = 0; l < vStrong[i].size(); ++l)
+                {
+                    j = vStrong[i][l];
+                    if (vAgg[j] >= 0 && vStrength[i][l] > bestStrength)
+                    {
+                        best = j;
+                        bestStrength = vStrength[i][l];
+                    }
+                }
+
+                if (best >= 0)
+                {
+                    vAgg[i] = vAgg[best];
+                }
+                else
+                {
+                    vAgg[i] = nAgg++;
+                    vAggIds.push_back(0);
+                }
+            }
+
+            // Smoothed prolongator P = (I - omega D^{-1} A) P_tent. Only
+            // rows of process-interior dofs are smoothed, since only these
+            // rows of the local operator are complete.
+            NekDouble omega = 4.0/(3.0*vFine.m_lambdaMax);
+            RowMapVector vP(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                vP[i][vAgg[i]] += 1.0;
+
+                if (vFine.m_invMult[i] < 1.0)
+                {
+                    continue;
+                }
+
+                for (k = A.m_rowPtr[i]; k < A.m_rowPtr[i+1]; ++k)
+                {
+                    vP[i][vAgg[A.m_colIdx[k]]]
+                        -= omega * vFine.m_invDiag[i] * A.m_val[k];
+                }
+            }
+
+            // Galerkin coarse operator P^T A_p P of this process
+            RowMapVector vAc(nAgg);
+            std::map<int, NekDouble>::const_iterator itI, itJ;
+            for (i = 0; i < nDofs; ++i)
+            {
+                for (k = A.m_rowPtr[i]; k < A.m_rowPtr[i+1]; ++k)
+                {
+                    j = A.m_colIdx[k];
+                    for (itI = vP[i].begin(); itI != vP[i].end(); ++itI)
+                    {
+                        s = itI->second * A.m_val[k];
+                        for (itJ = vP[j].begin(); itJ != vP[j].end(); ++itJ)
+                        {
+                            vAc[itI->first][itJ->first] += s * itJ->second;
+                        }
+                    }
+                }
+            }
+
+            RowMapToCsr(vP, vFine.m_P);
+
+            AMGLevel vCoarse;
+            vCoarse.m_nDofs = nAgg;
+            vCoarse.m_ids   = Array<OneD, long>(nAgg);
+            for (m = 0; m < nAgg; ++m)
+            {
+                vCoarse.m_ids[m] = vAggIds[m];
+            }
+            RowMapToCsr(vAc, vCoarse.m_A);
+
+            m_levels.push_back(vCoarse);
+            SetupLevel(level + 1);
+        }
+
+
+        /**
+         * Number the dofs of the coarsest level consecutively across all
+         * processes, then assemble and LU-factorise its operator on every
+         * process.
+         */
+        void GlobalLinSysAMGFull::SetupCoarsestSolve()
+        {
+            AMGLevel &vLevel = m_levels.back();
+            int nDofs  = vLevel.m_nDofs;
+            int nProcs = m_comm->GetSize();
+            int vRank  = m_comm->GetRank();
+            int i, k, offset = 0, nOwned = 0, info = 0;
+
+            for (i = 0; i < nDofs; ++i)
+            {
+                nOwned += vLevel.m_owned[i];
+            }
+
+            Array<OneD, int> vCounts(nProcs, 0);
+            vCounts[vRank] = nOwned;
+            m_comm->AllReduce(vCounts, LibUtilities::ReduceSum);
+
+            m_coarseSize = 0;
+            for (i = 0; i < nProcs; ++i)
+            {
+                if (i < vRank)
+                {
+                    offset += vCounts[i];
+                }
+                m_coarseSize += vCounts[i];
+            }
+
+            // Owners number their dofs and communicate the number to the
+            // other processes holding them. Indices are stored offset by
+            // one so that non-owners contribute zero.
+            Array<OneD, NekDouble> tmp(nDofs, 0.0);
+            for (i = 0; i < nDofs; ++i)
+            {
+                if (vLevel.m_owned[i])
+                {
+                    tmp[i] = (NekDouble) (++offset);
+                }
+            }
+            Gs::Gather(tmp, Gs::gs_add, vLevel.m_gsh);
+
+            m_coarseIndex = Array<OneD, int>(nDofs);
+            for (i = 0; i < nDofs; ++i)
+            {
+                m_coarseIndex[i] = (int) (tmp[i] + 0.5) - 1;
+            }
+
+            // Assemble the full coarsest operator in column-major order
+            m_coarseMat = Array<OneD, NekDouble>(m_coarseSize*m_coarseSize,
+                                                 0.0);
+            for (i = 0; i < nDofs; ++i)
+            {
+                for (k = vLevel.m_A.m_rowPtr[i];
+                     k < vLevel.m_A.m_rowPtr[i+1]; ++k)
+                {
+                    m_coarseMat[m_coarseIndex[i] + m_coarseSize *
+                                m_coarseIndex[vLevel.m_A.m_colIdx[k]]]
+                        += vLevel.m_A.m_val[k];
+                }
+            }
+            m_comm->AllReduce(m_coarseMat, LibUtilities::ReduceSum);
+
+            m_coarsePivot = Array<OneD, int>(m_coarseSize);
+            Lapack::Dgetrf(m_coarseSize, m_coarseSize, m_coarseMat.get(),
+                           m_coarseSize, m_coarsePivot.get(), info);
+            ASSERTL0(info == 0, "AMG coarsest level factorisation failed");
+        }
+
+
+        /**
+         * Number of dofs of level @a level summed over all processes,
+         * counting shared dofs once.
+         */
+        NekDouble GlobalLinSysAMGFull::GlobalSize(const int level)
+        {
+            const AMGLevel &vLevel = m_levels[level];
+            NekDouble vSize = Vmath::Vsum(vLevel.m_nDofs,
+                                          vLevel.m_invMult, 1);
+            m_comm->AllReduce(vSize, LibUtilities::ReduceSum);
+            return vSize;
+        }
+
+
+        /**
+         * Inner product of two assembled vectors of level @a level, summed
+         * across all processes.
+         */
+        NekDouble GlobalLinSysAMGFull::GlobalDot(
+                const int                           level,
+                const Array<OneD, const NekDouble> &pIn1,
+                const Array<OneD, const NekDouble> &pIn2)
+        {
+            const AMGLevel &vLevel = m_levels[level];
+            NekDouble vDot = 0.0;
+            for (int i = 0; i < vLevel.m_nDofs; ++i)
+            {
+                vDot += vLevel.m_invMult[i] * pIn1[i] * pIn2[i];
+            }
+            m_comm->AllReduce(vDot, LibUtilities::ReduceSum);
+            return vDot;
+        }
+
+
+        /**
+         * Estimate the largest eigenvalue of \f$D^{-1}A\f$ on level
+         * @a level by power iteration, with a safety margin.
+         */
+        NekDouble GlobalLinSysAMGFull::EstimateLambdaMax(const int level)
+        {
+            const AMGLevel &vLevel = m_levels[level];
+            int nDofs = vLevel.m_nDofs;
+            int nIter = 10;
+            NekDouble lambda = 1.0;
+            NekDouble norm;
+
+            Array<OneD, NekDouble> x(nDofs);
+            Array<OneD, NekDouble> y(nDofs);
+
+            // Non-smooth starting vector, made consistent across processes
+            for (int i = 0; i < nDofs; ++i)
+            {
+                x[i] = vLevel.m_invMult[i] * (1.0 + 0.5*sin((NekDouble) i));
+            }
+            Gs::Gather(x, Gs::gs_add, vLevel.m_gsh);
+
+            for (int i = 0; i < nIter; ++i)
+            {
+                norm = sqrt(GlobalDot(level, x, x));
+                if (norm < NekConstants::kNekZeroTol)
+                {
+                    break;
+                }
+                Vmath::Smul(nDofs, 1.0/norm, x, 1, x, 1);
+
+                Multiply(level, x, y);
+                Vmath::Vmul(nDofs, vLevel.m_invDiag, 1, y, 1, y, 1);
+
+                lambda = sqrt(GlobalDot(level, y, y));
+                Vmath::Vcopy(nDofs, y, 1, x, 1);
+            }
+
+            return 1.1 * lambda;
+        }
+
+
+        /**
+         * Multiply an assembled vector by the operator of level @a level.
+         */
+        void GlobalLinSysAMGFull::Multiply(
+                const int                           level,
+                const Array<OneD, const NekDouble> &pInput,
+                      Array<OneD,       NekDouble> &pOutput)
+        {
+            const AMGLevel &vLevel = m_levels[level];
+            const CsrMatrix &A = vLevel.m_A;
+            NekDouble vSum;
+
+            for (int i = 0; i < vLevel.m_nDofs; ++i)
+            {
+                vSum = 0.0;
+                for (int k = A.m_rowPtr[i]; k < A.m_rowPtr[i+1]; ++k)
+                {
+                    vSum += A.m_val[k] * pInput[A.m_colIdx[k]];
+                }
+                pOutput[i] = vSum;
+            }
+
+            Gs::Gather(pOutput, Gs::gs_add, vLevel.m_gsh);
+        }
+
+
+        /**
+         * Apply a Jacobi-preconditioned Chebyshev smoother of degree
+         * @c AMGSmoothingSteps to the system on level @a level.
+         */
+        void GlobalLinSysAMGFull::Smooth(
+                const int                           level,
+                const Array<OneD, const NekDouble> &pRhs,
+                      Array<OneD,       NekDouble> &pSoln)
+        {
+            const AMGLevel &vLevel = m_levels[level];
+            int nDofs = vLevel.m_nDofs;
+
+            // Target the upper part of the spectrum, leaving the smooth
+            // components to the coarser levels.
+            NekDouble lambdaMax = vLevel.m_lambdaMax;
+            NekDouble lambdaMin = lambdaMax / 10.0;
+            NekDouble theta     = 0.5 * (lambdaMax + lambdaMin);
+            NekDouble delta     = 0.5 * (lambdaMax - lambdaMin);
+            NekDouble sigma     = theta / delta;
+            NekDouble rho       = 1.0 / sigma;
+            NekDouble rhoNew;
+
+            Array<OneD, NekDouble> r (nDofs);
+            Array<OneD, NekDouble> d (nDofs);
+            Array<OneD, NekDouble> Ad(nDofs);
+
+            // r = b - A x
+            Multiply(level, pSoln, r);
+            Vmath::Vsub(nDofs, pRhs, 1, r, 1, r, 1);
+
+            // d = D^{-1} r / theta
+            Vmath::Vmul(nDofs, vLevel.m_invDiag, 1, r, 1, d, 1);
+            Vmath::Smul(nDofs, 1.0/theta, d, 1, d, 1);
+
+            for (int k = 0; k < m_smoothingSteps; ++k)
+            {
+                Vmath::Vadd(nDofs, d, 1, pSoln, 1, pSoln, 1);
+
+                if (k == m_smoothingSteps - 1)
+                {
+                    break;
+                }
+
+                // r = r - A d
+                Multiply(level, d, Ad);
+                Vmath::Vsub(nDofs, r, 1, Ad, 1, r, 1);
+
+                // d = rho_{k+1} rho_k d + 2 rho_{k+1}/delta D^{-1} r
+                rhoNew = 1.0 / (2.0*sigma - rho);
+                Vmath::Vmul(nDofs, vLevel.m_invDiag, 1, r, 1, Ad, 1);
+                Vmath::Smul(nDofs, rhoNew*rho, d, 1, d, 1);
+                Vmath::Svtvp(nDofs, 2.0*rhoNew/delta, Ad, 1, d, 1, d, 1);
+                rho = rhoNew;
+            }
+        }
+
+
+        /**
+         * Solve the coarsest level system with the LU factors held on every
+         * process.
+         */
+        void GlobalLinSysAMGFull::CoarsestSolve(
+                const Array<OneD, const NekDouble> &pRhs,
+                      Array<OneD,       NekDouble> &pSoln)
+        {
+            const AMGLevel &vLevel = m_levels.back();
+            int i, info = 0;
+
+            Array<OneD, NekDouble> vRhs(m_coarseSize, 0.0);
+            for (i = 0; i < vLevel.m_nDofs; ++i)
+            {
+                if (vLevel.m_owned[i])
+                {
+                    vRhs[m_coarseIndex[i]] = pRhs[i];
+                }
+            }
+            m_comm->AllReduce(vRhs, LibUtilities::ReduceSum);
+
+            Lapack::Dgetrs('N', m_coarseSize, 1, m_coarseMat.get(),
+                           m_coarseSize, m_coarsePivot.get(), vRhs.get(),
+                           m_coarseSize, info);
+            ASSERTL0(info == 0, "AMG coarsest level solve failed");
+
+            for (i = 0; i < vLevel.m_nDofs; ++i)
+            {
+                pSoln[i] = vRhs[m_coarseIndex[i]];
+            }
+        }
+
+
+        /**
+         * Recursively apply the V-cycle starting at level @a level with a
+         * zero initial guess.
+         */
+        void GlobalLinSysAMGFull::VCycle(
+                const int                           level,
+                const Array<OneD, const NekDouble> &pRhs,
+                      Array<OneD,       NekDouble> &pSoln)
+        {
+            const AMGLevel &vLevel = m_levels[level];
+            int nDofs = vLevel.m_nDofs;
+            int i, k;
+
+            Vmath::Zero(nDofs, pSoln, 1);
+
+            if (level == (int) m_levels.size() - 1)
+            {
+                if (m_coarseSize)
+                {
+                    CoarsestSolve(pRhs, pSoln);
+                }
+                else
+                {
+                    Smooth(level, pRhs, pSoln);
+                    Smooth(level, pRhs, pSoln);
+                }
+                return;
+            }
+
+            const CsrMatrix &P = vLevel.m_P;
+            int nCoarse = m_levels[level+1].m_nDofs;
+
+            Array<OneD, NekDouble> r (nDofs);
+            Array<OneD, NekDouble> rc(nCoarse, 0.0);
+            Array<OneD, NekDouble> ec(nCoarse);
+
+            // Pre-smoothing
+            Smooth(level, pRhs, pSoln);
+
+            // Restrict the residual. Each dof contributes once in total
+            // across the processes holding it.
+            Multiply(level, pSoln, r);
+            Vmath::Vsub(nDofs, pRhs, 1, r, 1, r, 1);
+            Vmath::Vmul(nDofs, vLevel.m_invMult, 1, r, 1, r, 1);
+            for (i = 0; i < nDofs; ++i)
+            {
+                for (k = P.m_rowPtr[i]; k < P.m_rowPtr[i+1]; ++k)
+                {
+                    rc[P.m_colIdx[k]] += P.m_val[k] * r[i];
+                }
+            }
+            Gs::Gather(rc, Gs::gs_add, m_levels[level+1].m_gsh);
+
+            // Coarse grid correction
+            VCycle(level + 1, rc, ec);
+            for (i = 0; i < nDofs; ++i)
+            {
+                for (k = P.m_rowPtr[i]; k < P.m_rowPtr[i+1]; ++k)
+                {
+                    pSoln[i] += P.m_val[k] * ec[P.m_colIdx[k]];
+                }
+            }
+
+            // Post-smoothing
+            Smooth(level, pRhs, pSoln);
+        }
+
+
+        /**
+         * Convert a row-wise map representation of a sparse matrix into
+         * compressed row storage.
+         */
+        void GlobalLinSysAMGFull::RowMapToCsr(
+                const RowMapVector &pRows,
+                      CsrMatrix    &pMat)
+        {
+            int nRows = pRows.size();
+            int nnz   = 0;
+            int i, k;
+            std::map<int, NekDouble>::const_iterator it;
+
+            for (i = 0; i < nRows; ++i)
+            {
+                nnz += pRows[i].size();
+            }
+
+            pMat.m_rowPtr = Array<OneD, int>      (nRows + 1);
+            pMat.m_colIdx = Array<OneD, int>      (nnz);
+            pMat.m_val    = Array<OneD, NekDouble>(nnz);
+
+            pMat.m_rowPtr[0] = 0;
+            for (i = k = 0; i < nRows; ++i)
+            {
+                for (it = pRows[i].begin(); it != pRows[i].end(); ++it, ++k)
+                {
+                    pMat.m_colIdx[k] = it->first;
+                    pMat.m_val[k]    = it->second;
+                }
+                pMat.m_rowPtr[i+1] = k;
+            }
+        }
+    }
+}
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File GlobalLinSysAMGFull.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: GlobalLinSysAMGFull header
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_GLOBALLINSYSAMGFULL_H
+#define NEKTAR_LIB_MULTIREGIONS_GLOBALLINSYSAMGFULL_H
+
+#include <LibUtilities/Communication/GsLib.hpp>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/GlobalLinSys.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+
+#include <map>
+#include <vector>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        // Forward declarations
+        class ExpList;
+
+        /// A global linear system solved by an algebraic multigrid V-cycle.
+        class GlobalLinSysAMGFull : public GlobalLinSys
+        {
+        public:
+
+            /// Creates an instance of this class
+            static GlobalLinSysSharedPtr create(const GlobalLinSysKey &pLinSysKey,
+                    const boost::weak_ptr<ExpList> &pExpList,
+                    const boost::shared_ptr<AssemblyMap>
+                                                           &pLocToGloMap)
+            {
+                return MemoryManager<GlobalLinSysAMGFull>::AllocateSharedPtr(pLinSysKey, pExpList, pLocToGloMap);
+            }
+
+            /// Name of class
+            MULTI_REGIONS_EXPORT static std::string className;
+
+            /// Constructor for full matrix AMG solve.
+            MULTI_REGIONS_EXPORT GlobalLinSysAMGFull(const GlobalLinSysKey &pLinSysKey,
+                         const boost::weak_ptr<ExpList> &pExpList,
+                         const boost::shared_ptr<AssemblyMap>
+                                                                &pLocToGloMap);
+
+            MULTI_REGIONS_EXPORT virtual ~GlobalLinSysAMGFull();
+
+        private:
+            typedef std::vector<std::map<int, NekDouble> > RowMapVector;
+
+            /// Sparse matrix in compressed row storage.
+            struct CsrMatrix
+            {
+                Array<OneD, int>        m_rowPtr;
+                Array<OneD, int>        m_colIdx;
+                Array<OneD, NekDouble>  m_val;
+            };
+
+            /// One level of the multigrid hierarchy.
+            struct AMGLevel
+            {
+                /// Number of degrees of freedom held by this process.
+                int                     m_nDofs;
+                /// Contribution of this process to the level operator.
+                CsrMatrix               m_A;
+                /// Prolongation from the next coarser level.
+                CsrMatrix               m_P;
+                /// Universal ids of the dofs, zero if held by this process only.
+                Array<OneD, long>       m_ids;
+                /// Gather-scatter handle for dofs shared between processes.
+                Gs::gs_data            *m_gsh;
+                /// Reciprocal of the number of processes holding each dof.
+                Array<OneD, NekDouble>  m_invMult;
+                /// Inverse of the assembled diagonal.
+                Array<OneD, NekDouble>  m_invDiag;
+                /// Non-zero if this process owns the dof.
+                Array<OneD, int>        m_owned;
+                /// Upper bound on the spectrum of the Jacobi-scaled operator.
+                NekDouble               m_lambdaMax;
+            };
+
+            /// Multigrid hierarchy, finest level first.
+            std::vector<AMGLevel>       m_levels;
+            /// LU factors of the assembled coarsest level operator.
+            Array<OneD, NekDouble>      m_coarseMat;
+            /// Pivots of the coarsest level LU factorisation.
+            Array<OneD, int>            m_coarsePivot;
+            /// Row of each coarsest level dof in the assembled operator.
+            Array<OneD, int>            m_coarseIndex;
+            /// Global size of the coarsest level.
+            int                         m_coarseSize;
+            /// Communicator spanning the processes sharing the system.
+            LibUtilities::CommSharedPtr m_comm;
+            /// Threshold below which matrix couplings are considered weak.
+            NekDouble                   m_strengthThreshold;
+            /// Global size below which coarsening stops.
+            int                         m_coarsestSize;
+            /// Maximum number of levels in the hierarchy.
+            int                         m_maxLevels;
+            /// Degree of the Chebyshev smoother.
+            int                         m_smoothingSteps;
+
+            /// Solve the linear system for given input and output vectors
+            /// using a specified local to global map.
+            virtual void v_Solve( const Array<OneD, const NekDouble> &in,
+                              Array<OneD,       NekDouble> &out,
+                        const AssemblyMapSharedPtr &locToGloMap,
+                        const Array<OneD, const NekDouble> &dirForcing
+                                                        = NullNekDouble1DArray);
+
+            /// Solve the linear system for given input and output vectors.
+            virtual void v_SolveLinearSystem(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir = 0);
+
+            void AssembleFinestLevel(
+                    const boost::shared_ptr<AssemblyMap> &pLocToGloMap);
+
+            void SetupLevel(const int level);
+
+            void Coarsen(const int level);
+
+            void SetupCoarsestSolve();
+
+            NekDouble GlobalSize(const int level);
+
+            NekDouble GlobalDot(
+                    const int                           level,
+                    const Array<OneD, const NekDouble> &pIn1,
+                    const Array<OneD, const NekDouble> &pIn2);
+
+            NekDouble EstimateLambdaMax(const int level);
+
+            void Multiply(
+                    const int                           level,
+                    const Array<OneD, const NekDouble> &pInput,
+                          Array<OneD,       NekDouble> &pOutput);
+
+            void Smooth(
+                    const int                           level,
+                    const Array<OneD, const NekDouble> &pRhs,
+                          Array<OneD,       NekDouble> &pSoln);
+
+            void CoarsestSolve(
+                    const Array<OneD, const NekDouble> &pRhs,
+                          Array<OneD,       NekDouble> &pSoln);
+
+            void VCycle(
+                    const int                           level,
+                    const Array<OneD, const NekDouble> &pRhs,
+                          Array<OneD,       NekDouble> &pSoln);
+
+            static void RowMapToCsr(
+                    const RowMapVector &pRows,
+                          CsrMatrix    &pMat);
+        };
+    }
+}
+
+#endif
@@ -61,6 +61,12 @@ namespace Nektar
                     GlobalLinSysDirectStaticCond::create,
                     "Direct multi-level static condensation.");
 
+        string GlobalLinSysDirectStaticCond::className3
+                = GetGlobalLinSysFactory().RegisterCreatorFunction(
+                    "DirectSparseStaticCond",
+                    GlobalLinSysDirectStaticCond::create,
+                    "Direct static condensation with sparse Cholesky.");
+
         /**
          * For a matrix system of the form @f[
          * \left[ \begin{array}{cc}
@@ -88,7 +94,8 @@ namespace Nektar
                 : GlobalLinSysDirect(pKey, pExpList, pLocToGloMap)
         {
             ASSERTL1((pKey.GetGlobalSysSolnType()==eDirectStaticCond)||
-                     (pKey.GetGlobalSysSolnType()==eDirectMultiLevelStaticCond),
+                     (pKey.GetGlobalSysSolnType()==eDirectMultiLevelStaticCond)||
+                     (pKey.GetGlobalSysSolnType()==eDirectSparseStaticCond),
                      "This constructor is only valid when using static "
                      "condensation");
             ASSERTL1(pKey.GetGlobalSysSolnType()
@@ -241,7 +248,12 @@ namespace Nektar
                 }
 
                 // solve boundary system
-                if(atLastLevel)
+                if(atLastLevel && m_sparseLinSys)
+                {
+                    Array<OneD, NekDouble> tmp2 = out + nDirBndDofs;
+                    m_sparseLinSys->Solve(tmp = F + nDirBndDofs, tmp2);
+                }
+                else if(atLastLevel)
                 {
                     m_linSys->Solve(F_HomBnd,V_GlobHomBnd);
                 }
@@ -332,6 +344,8 @@ namespace Nektar
             m_invD       = MemoryManager<DNekScalBlkMat>
                     ::AllocateSharedPtr(nint_size , nint_size , blkmatStorage);
 
+            LoadStaticCondBlockCache();
+
             for(n = 0; n < n_exp; ++n)
             {
                 if (m_linSysKey.GetMatrixType() == StdRegions::eHybridDGHelmBndLam)
@@ -349,6 +363,8 @@ namespace Nektar
                     m_invD      ->SetBlock(n,n, tmp_mat = loc_mat->GetBlock(1,1));
                 }
             }
+
+            SaveStaticCondBlockCache();
         }
 
         MatrixStorage GlobalLinSysDirectStaticCond::DetermineMatrixStorage(const AssemblyMapSharedPtr &pLocToGloMap)
@@ -419,6 +435,17 @@ namespace Nektar
 
             DNekMatSharedPtr Gmat;
             int bwidth = pLocToGloMap->GetBndSystemBandWidth();
+
+            // The sparse factorisation is only available for symmetric
+            // positive definite systems; other operators fall back to the
+            // dense solver below.
+            if(pLocToGloMap->GetGlobalSysSolnType() == eDirectSparseStaticCond
+               && (matStorage == ePOSITIVE_DEFINITE_SYMMETRIC_BANDED ||
+                   matStorage == ePOSITIVE_DEFINITE_SYMMETRIC))
+            {
+                AssembleSparseSchurComplement(pLocToGloMap);
+                return;
+            }
          
             switch(matStorage)
             {
@@ -501,6 +528,73 @@ namespace Nektar
         }
 
 
+        /**
+         * Assemble the upper triangular part of the Schur complement in
+         * coordinate storage and compute its sparse Cholesky factorisation.
+         * The fill-in of the factor depends on the boundary numbering of
+         * @a pLocToGloMap, which uses a nested dissection ordering
+         * (MultiLevelBisectionReordering) for this solution type. The number
+         * of threads used by the factorisation and solves is set by the
+         * parameter SparseCholeskyThreads (default 1).
+         * @param   pLocToGloMap    Local to global mapping information.
+         */
+        void GlobalLinSysDirectStaticCond::AssembleSparseSchurComplement(
+                      const AssemblyMapSharedPtr &pLocToGloMap)
+        {
+            int i,j,n,cnt,gid1,gid2;
+            NekDouble sign1,sign2;
+
+            int nBndDofs  = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int NumDirBCs = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            unsigned int rows = nBndDofs - NumDirBCs;
+
+            DNekScalBlkMatSharedPtr SchurCompl = m_schurCompl;
+            DNekScalMatSharedPtr loc_mat;
+            int loc_lda;
+            COOMatType spaMat;
+
+            for(n = cnt = 0; n < SchurCompl->GetNumberOfBlockRows(); ++n)
+            {
+                loc_mat = SchurCompl->GetBlock(n,n);
+                loc_lda = loc_mat->GetRows();
+
+                for(i = 0; i < loc_lda; ++i)
+                {
+                    gid1  = pLocToGloMap->GetLocalToGlobalBndMap (cnt + i)
+                                                                    - NumDirBCs;
+                    sign1 = pLocToGloMap->GetLocalToGlobalBndSign(cnt + i);
+
+                    if(gid1 >= 0)
+                    {
+                        for(j = 0; j < loc_lda; ++j)
+                        {
+                            gid2  = pLocToGloMap->GetLocalToGlobalBndMap(cnt+j)
+                                                                 - NumDirBCs;
+                            sign2 = pLocToGloMap->GetLocalToGlobalBndSign(cnt+j);
+
+                            if(gid2 >= gid1)
+                            {
+                                spaMat[CoordType(gid1,gid2)]
+                                    += sign1*sign2*(*loc_mat)(i,j);
+                            }
+                        }
+                    }
+                }
+                cnt += loc_lda;
+            }
+
+            if(rows)
+            {
+                int nThreads;
+                m_expList.lock()->GetSession()->LoadParameter(
+                    "SparseCholeskyThreads", nThreads, 1);
+
+                m_sparseLinSys = MemoryManager<SparseCholesky>
+                    ::AllocateSharedPtr(rows, spaMat, nThreads);
+            }
+        }
+
+
         /**
          *
          */
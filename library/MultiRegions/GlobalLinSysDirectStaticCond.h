@@ -35,6 +35,7 @@
 #ifndef NEKTAR_LIB_MULTIREGIONS_GLOBALLINSYSDIRECTSTATICCOND_H
 #define NEKTAR_LIB_MULTIREGIONS_GLOBALLINSYSDIRECTSTATICCOND_H
 
+#include <LibUtilities/LinearAlgebra/SparseCholesky.hpp>
 #include <MultiRegions/GlobalLinSysDirect.h>
 #include <MultiRegions/MultiRegionsDeclspec.h>
 
@@ -67,6 +68,7 @@ namespace Nektar
             /// Name of class
             MULTI_REGIONS_EXPORT static std::string className;
             static std::string className2;
+            static std::string className3;
 
             /// Constructor for full direct matrix solve.
             MULTI_REGIONS_EXPORT GlobalLinSysDirectStaticCond(
@@ -106,6 +108,10 @@ namespace Nektar
             DNekScalBlkMatSharedPtr m_C;
             DNekScalBlkMatSharedPtr m_invD;
 
+            /// Sparse Cholesky factorisation of the Schur complement, used
+            /// in place of #m_linSys for DirectSparseStaticCond.
+            SparseCholeskySharedPtr m_sparseLinSys;
+
             /// Solve the linear system for given input and output vectors
             /// using a specified local to global map.
             virtual void v_Solve(
@@ -134,6 +140,11 @@ namespace Nektar
                                          const boost::shared_ptr<AssemblyMap>& locToGloMap,
                                          const MatrixStorage matStorage);
 
+            /// Assemble the Schur complement matrix in sparse form and
+            /// factorise it.
+            void AssembleSparseSchurComplement(
+                    const boost::shared_ptr<AssemblyMap>& locToGloMap);
+
             ///
             void ConstructNextLevelCondensedSystem(
                     const boost::shared_ptr<AssemblyMap>& locToGloMap);
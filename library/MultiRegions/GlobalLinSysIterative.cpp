@@ -56,6 +56,8 @@ namespace Nektar
                   m_precon(NullPreconditionerSharedPtr),
                   m_totalIterations(0),
                   m_useProjection(false),
+                  m_mixedPrecision(false),
+                  m_singlePrecision(false),
                   m_numPrevSols(0)
         {
             LibUtilities::SessionReaderSharedPtr vSession
@@ -66,6 +68,9 @@ namespace Nektar
             LibUtilities::CommSharedPtr vComm = m_expList.lock()->GetComm()->GetRowComm();
             m_root    = (vComm->GetRank())? false : true;
             m_verbose = (vSession->DefinesCmdLineArgument("verbose"))? true :false;
+
+            vSession->MatchSolverInfo("IterativeSolverPrecision", "Mixed",
+                                      m_mixedPrecision, false);
             
             int successiveRHS;
             
@@ -117,6 +122,12 @@ namespace Nektar
                     std::cout << "norm of solutions difference is = " << norm << std::endl;
                 }
             }
+            else if (m_mixedPrecision && UseSinglePrecision(true))
+            {
+                // single-precision CG corrected in double precision
+                DoIterativeRefinement(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                UseSinglePrecision(false);
+            }
             else
             {
                 // applying plain Conjugate Gradient
@@ -125,6 +136,113 @@ namespace Nektar
         }
 
 
+        /**
+         * Solve the global system by mixed-precision iterative refinement.
+         * Each correction is computed by #DoConjugateGradient using the
+         * single-precision copies of the operator and preconditioner, which
+         * halves the memory traffic of the inner iterations. The residual
+         * of the accumulated solution is then evaluated with the
+         * double-precision operator, so that the final solution satisfies
+         * the same stopping criterion as a double-precision solve.
+         *
+         * Each inner solve only reduces the current residual by a fixed
+         * factor, since the single-precision operator cannot resolve the
+         * residual much below the rounding of its entries.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoIterativeRefinement(
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            // Maximum number of refinement steps and the reduction of the
+            // residual requested from each single-precision solve.
+            const int       maxSteps   = 20;
+            const NekDouble innerRatio = 1.0e-5;
+
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            int nNonDir = nGlobal - nDir;
+            Array<OneD, NekDouble> r_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> e_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> x_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> Ax_A(nGlobal, 0.0);
+
+            // Copy initial residual from input before zeroing the output,
+            // in case the two vectors coincide.
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[nDir], 1);
+            Vmath::Zero (nNonDir, &pOutput[nDir], 1);
+
+            NekDouble eps = Vmath::Dot2(nNonDir,
+                                        r_A   + nDir,
+                                        r_A   + nDir,
+                                        m_map + nDir);
+            vComm->AllReduce(eps, Nektar::LibUtilities::ReduceSum);
+
+            // Use the same normalisation of the stopping criterion as the
+            // double-precision solve would have.
+            NekDouble rhsMag = m_rhs_magnitude;
+            if (rhsMag == NekConstants::kNekUnsetDouble)
+            {
+                rhsMag = 1.0/eps;
+            }
+
+            const NekDouble tol = m_tolerance * m_tolerance * rhsMag;
+            int step, totalIterations = 0;
+
+            for (step = 0; step < maxSteps && eps >= tol; ++step)
+            {
+                // Solve A e = r in single precision.
+                UseSinglePrecision(true);
+                m_rhs_magnitude = std::max(
+                    rhsMag, innerRatio * innerRatio * eps /
+                                (m_tolerance * m_tolerance));
+                m_totalIterations = 0;
+                DoConjugateGradient(nGlobal, r_A, e_A, plocToGloMap, nDir);
+                totalIterations += m_totalIterations;
+
+                Vmath::Vadd(nNonDir, &e_A[nDir], 1, &pOutput[nDir], 1,
+                                     &pOutput[nDir], 1);
+
+                // r = b - A x in double precision.
+                UseSinglePrecision(false);
+                Vmath::Vcopy(nNonDir, &pOutput[nDir], 1, &x_A[nDir], 1);
+                v_DoMatrixMultiply(x_A, Ax_A);
+                Vmath::Vsub (nNonDir, &pInput[nDir], 1, &Ax_A[nDir], 1,
+                                      &r_A[nDir], 1);
+
+                eps = Vmath::Dot2(nNonDir,
+                                  r_A   + nDir,
+                                  r_A   + nDir,
+                                  m_map + nDir);
+                vComm->AllReduce(eps, Nektar::LibUtilities::ReduceSum);
+            }
+
+            m_totalIterations = totalIterations;
+            m_rhs_magnitude   = NekConstants::kNekUnsetDouble;
+
+            if (m_verbose && m_root)
+            {
+                cout << "Mixed-precision refinement steps made = " << step
+                     << " (CG iterations made = " << m_totalIterations
+                     << ", error = " << sqrt(eps/rhsMag) << ")" << endl;
+            }
+
+            if (eps >= tol)
+            {
+                NEKERROR(ErrorUtil::ewarning,
+                         "Mixed-precision iterative refinement did not "
+                         "converge; consider IterativeSolverPrecision = "
+                         "Double.");
+            }
+        }
+
+
         /**
          * This method implements A-conjugate projection technique
          * in order to speed up successive linear solves with
@@ -378,14 +496,8 @@ namespace Nektar
                                                         const AssemblyMapSharedPtr &plocToGloMap,
                                                         const int nDir)
         {
-            if (!m_precon)
-            {
-                MultiRegions::PreconditionerType pType = plocToGloMap->GetPreconType();
-                std::string PreconType = MultiRegions::PreconditionerTypeMap[pType];
-                v_UniqueMap();
-                m_precon = GetPreconFactory().CreateInstance(PreconType,GetSharedThisPtr(),plocToGloMap);
-                m_precon -> BuildPreconditioner();
-            }
+            SetUpPreconditioner(plocToGloMap);
+            m_precon->UseSinglePrecision(m_singlePrecision);
 
             // Get the communicator for performing data exchanges
             LibUtilities::CommSharedPtr vComm
@@ -547,6 +659,260 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve the global system for several right-hand sides at once using
+         * simultaneous preconditioned conjugate gradients. Each right-hand
+         * side follows exactly the same recurrence as in
+         * #DoConjugateGradient, but the operator is applied to all active
+         * search directions in a single call to
+         * #v_DoMatrixMultiplyMultiple, so the matrices are streamed once per
+         * iteration, and the inner products of all right-hand sides are
+         * exchanged in a single reduction. Right-hand sides which have
+         * converged are removed from the active set.
+         *
+         * @param       pInput          Input residuals of all DOFs.
+         * @param       pOutput         Solution vectors of all DOFs.
+         * @param       pRhsMagnitude   Optional normalisation of the
+         *                              stopping criterion for each
+         *                              right-hand side.
+         */
+        void GlobalLinSysIterative::DoConjugateGradientMultiple(
+                    const int nGlobal,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir,
+                    const Array<OneD, const NekDouble> &pRhsMagnitude)
+        {
+            SetUpPreconditioner(plocToGloMap);
+            m_precon->UseSinglePrecision(m_singlePrecision);
+
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            int nVec    = pInput.num_elements();
+            int nNonDir = nGlobal - nDir;
+            int i, k, v, nActive;
+
+            // Allocate array storage
+            Array<OneD, Array<OneD, NekDouble> > w_A(nVec);
+            Array<OneD, Array<OneD, NekDouble> > s_A(nVec);
+            Array<OneD, Array<OneD, NekDouble> > p_A(nVec);
+            Array<OneD, Array<OneD, NekDouble> > r_A(nVec);
+            Array<OneD, Array<OneD, NekDouble> > q_A(nVec);
+            Array<OneD, NekDouble> tmp;
+
+            Array<OneD, NekDouble> alpha    (nVec, 0.0);
+            Array<OneD, NekDouble> beta     (nVec, 0.0);
+            Array<OneD, NekDouble> rho      (nVec, 0.0);
+            Array<OneD, NekDouble> rhsMag   (nVec, 0.0);
+            Array<OneD, NekDouble> vExchange(3*nVec, 0.0);
+            Array<OneD, int>       active   (nVec);
+
+            for (v = 0; v < nVec; ++v)
+            {
+                w_A[v] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                s_A[v] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                p_A[v] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                q_A[v] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                r_A[v] = Array<OneD, NekDouble>(nNonDir, 0.0);
+
+                // Copy initial residual from input and zero homogeneous out
+                // array ready for solution updates.
+                Vmath::Vcopy(nNonDir, &pInput[v][nDir], 1, &r_A[v][0], 1);
+                Vmath::Zero (nNonDir, tmp = pOutput[v] + nDir, 1);
+
+                vExchange[v] = Vmath::Dot2(nNonDir,
+                                           r_A[v],
+                                           r_A[v],
+                                           m_map + nDir);
+            }
+
+            // evaluate initial residual errors for exit check
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            for (v = nActive = 0; v < nVec; ++v)
+            {
+                rhsMag[v] = (pRhsMagnitude.num_elements() &&
+                             pRhsMagnitude[v] != NekConstants::kNekUnsetDouble)
+                    ? pRhsMagnitude[v] : 1.0/vExchange[v];
+
+                // If input residual is less than tolerance skip solve.
+                if (vExchange[v] >= m_tolerance * m_tolerance * rhsMag[v])
+                {
+                    active[nActive++] = v;
+                }
+            }
+
+            // As in #DoConjugateGradient, the iteration count is only reset
+            // when there is something to solve, and the initial
+            // preconditioned step counts as the first iteration.
+            if (nActive > 0)
+            {
+                m_totalIterations = 0;
+            }
+            k = 0;
+
+            Array<OneD, Array<OneD, NekDouble> > w_act;
+            Array<OneD, Array<OneD, NekDouble> > s_act;
+
+            while (nActive > 0)
+            {
+                ASSERTL0(k < 5000,
+                         "Exceeded maximum number of iterations (5000)");
+
+                w_act = Array<OneD, Array<OneD, NekDouble> >(nActive);
+                s_act = Array<OneD, Array<OneD, NekDouble> >(nActive);
+
+                for (i = 0; i < nActive; ++i)
+                {
+                    v = active[i];
+
+                    if (k > 0)
+                    {
+                        // Compute new search direction p_k, q_k
+                        Vmath::Svtvp(nNonDir, beta[v], &p_A[v][0], 1,
+                                     &w_A[v][nDir], 1, &p_A[v][0], 1);
+                        Vmath::Svtvp(nNonDir, beta[v], &q_A[v][0], 1,
+                                     &s_A[v][nDir], 1, &q_A[v][0], 1);
+
+                        // Update solution x_{k+1}
+                        Vmath::Svtvp(nNonDir, alpha[v], &p_A[v][0], 1,
+                                     &pOutput[v][nDir], 1,
+                                     &pOutput[v][nDir], 1);
+
+                        // Update residual vector r_{k+1}
+                        Vmath::Svtvp(nNonDir, -alpha[v], &q_A[v][0], 1,
+                                     &r_A[v][0], 1, &r_A[v][0], 1);
+                    }
+
+                    // Apply preconditioner
+                    m_precon->DoPreconditioner(r_A[v], tmp = w_A[v] + nDir);
+
+                    w_act[i] = w_A[v];
+                    s_act[i] = s_A[v];
+                }
+
+                // Perform the method-specific matrix-vector multiply
+                // operation for all active right-hand sides.
+                v_DoMatrixMultiplyMultiple(w_act, s_act);
+
+                Vmath::Zero(3*nVec, vExchange, 1);
+                for (i = 0; i < nActive; ++i)
+                {
+                    v = active[i];
+
+                    // <r_{k+1}, w_{k+1}>
+                    vExchange[3*i]   = Vmath::Dot2(nNonDir,
+                                                   r_A[v],
+                                                   w_A[v] + nDir,
+                                                   m_map + nDir);
+                    // <s_{k+1}, w_{k+1}>
+                    vExchange[3*i+1] = Vmath::Dot2(nNonDir,
+                                                   s_A[v] + nDir,
+                                                   w_A[v] + nDir,
+                                                   m_map + nDir);
+                    // <r_{k+1}, r_{k+1}>
+                    vExchange[3*i+2] = Vmath::Dot2(nNonDir,
+                                                   r_A[v],
+                                                   r_A[v],
+                                                   m_map + nDir);
+                }
+
+                // Perform inner-product exchanges for all right-hand sides
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                m_totalIterations++;
+
+                int nStillActive = 0;
+                for (i = 0; i < nActive; ++i)
+                {
+                    v = active[i];
+
+                    NekDouble rho_new = vExchange[3*i];
+                    NekDouble mu      = vExchange[3*i+1];
+                    NekDouble eps     = vExchange[3*i+2];
+
+                    if (k == 0)
+                    {
+                        rho  [v] = rho_new;
+                        beta [v] = 0.0;
+                        alpha[v] = rho_new/mu;
+                        active[nStillActive++] = v;
+                        continue;
+                    }
+
+                    // test if norm is within tolerance
+                    if (eps < m_tolerance * m_tolerance * rhsMag[v])
+                    {
+                        if (m_verbose && m_root)
+                        {
+                            cout << "CG iterations made = " << m_totalIterations
+                                 << " using tolerance of "  << m_tolerance
+                                 << " (error = " << sqrt(eps/rhsMag[v])
+                                 << ", rhs " << v << ")" << endl;
+                        }
+                        continue;
+                    }
+
+                    // Compute search direction and solution coefficients
+                    beta [v] = rho_new/rho[v];
+                    alpha[v] = rho_new/(mu - rho_new*beta[v]/alpha[v]);
+                    rho  [v] = rho_new;
+                    active[nStillActive++] = v;
+                }
+
+                nActive = nStillActive;
+                k++;
+            }
+
+            m_rhs_magnitude = NekConstants::kNekUnsetDouble;
+        }
+
+        /**
+         * Default implementation applying the operator to each vector in
+         * turn. Solvers which can share the cost of reading their matrices
+         * between vectors override this method.
+         */
+        void GlobalLinSysIterative::v_DoMatrixMultiplyMultiple(
+                const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                      Array<OneD, Array<OneD, NekDouble> > &pOutput)
+        {
+            for (int i = 0; i < pInput.num_elements(); ++i)
+            {
+                v_DoMatrixMultiply(pInput[i], pOutput[i]);
+            }
+        }
+
+        /**
+         * Create and build the preconditioner the first time it is needed.
+         */
+        void GlobalLinSysIterative::SetUpPreconditioner(
+                const AssemblyMapSharedPtr &plocToGloMap)
+        {
+            if (!m_precon)
+            {
+                MultiRegions::PreconditionerType pType = plocToGloMap->GetPreconType();
+                std::string PreconType = MultiRegions::PreconditionerTypeMap[pType];
+                v_UniqueMap();
+                m_precon = GetPreconFactory().CreateInstance(PreconType,GetSharedThisPtr(),plocToGloMap);
+                m_precon -> BuildPreconditioner();
+            }
+        }
+
+        /**
+         * Records whether the operator is now applied in single precision,
+         * so that the preconditioner of the following conjugate gradient
+         * solves is applied in the same precision.
+         */
+        bool GlobalLinSysIterative::UseSinglePrecision(const bool pUse)
+        {
+            bool available    = v_UseSinglePrecision(pUse);
+            m_singlePrecision = pUse && available;
+            return available;
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn)
         {
 
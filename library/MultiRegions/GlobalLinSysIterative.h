@@ -61,6 +61,12 @@ namespace Nektar
 
             MULTI_REGIONS_EXPORT virtual ~GlobalLinSysIterative();
 
+            /// Apply the global operator to a vector of global degrees of
+            /// freedom (including the Dirichlet entries).
+            inline void DoMatrixMultiply(
+                    const Array<OneD, NekDouble>& pInput,
+                          Array<OneD, NekDouble>& pOutput);
+
         protected:
             /// Global to universal unique map
             Array<OneD, int>                            m_map;
@@ -81,6 +87,13 @@ namespace Nektar
             /// Whether to apply projection technique
             bool                                        m_useProjection;
 
+            /// Whether to solve in single precision with iterative
+            /// refinement in double precision
+            bool                                        m_mixedPrecision;
+
+            /// Whether the operator is currently applied in single precision
+            bool                                        m_singlePrecision;
+
             /// Provide verbose output and root if parallel. 
             bool                                        m_root;
             bool                                        m_verbose;
@@ -108,11 +121,45 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Simultaneous iterative solve for several right-hand sides
+            void DoConjugateGradientMultiple(
+                    const int pNumRows,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir,
+                    const Array<OneD, const NekDouble> &pRhsMagnitude
+                                                    = NullNekDouble1DArray);
+
+            /// Mixed-precision solve by iterative refinement
+            void DoIterativeRefinement(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
 
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
+
+            /// Switch the operator and preconditioner to (or from) their
+            /// single-precision copies. Returns whether these exist.
+            bool UseSinglePrecision(const bool pUse);
+
+            virtual bool v_UseSinglePrecision(const bool pUse)
+            {
+                return false;
+            }
+
+            /// Apply the global operator to several vectors at once.
+            virtual void v_DoMatrixMultiplyMultiple(
+                    const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                          Array<OneD, Array<OneD, NekDouble> > &pOutput);
             
         private:
 
+            void SetUpPreconditioner(
+                    const AssemblyMapSharedPtr &locToGloMap);
+
             void printArray(
                     const std::string& msg,
                     const Array<OneD, const NekDouble>  &in,
@@ -145,6 +192,16 @@ namespace Nektar
 
             virtual void v_UniqueMap() = 0;
         };
+
+        /**
+         *
+         */
+        inline void GlobalLinSysIterative::DoMatrixMultiply(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            v_DoMatrixMultiply(pInput, pOutput);
+        }
     }
 }
 
@@ -0,0 +1,279 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File GlobalLinSysIterativeMatrixFree.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: GlobalLinSysIterativeMatrixFree definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/GlobalLinSysIterativeMatrixFree.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @class GlobalLinSysIterativeMatrixFree
+         *
+         * This class implements a conjugate gradient solver for the full
+         * (uncondensed) global system in which the action of the operator is
+         * evaluated element by element using the sum-factorised
+         * StdRegions::StdExpansion::GeneralMatrixOp routines. These
+         * only require the geometric factors cached by each expansion, so
+         * no elemental, block or global matrices are ever constructed. At
+         * high polynomial order this reduces the memory footprint from
+         * \f$O(P^{2d})\f$ to \f$O(P^d)\f$ per element.
+         *
+         * Only the Null and Diagonal preconditioners are supported; the
+         * diagonal is computed from the elemental operator one column at a
+         * time.
+         */
+
+        /**
+         * Registers the class with the Factory.
+         */
+        string GlobalLinSysIterativeMatrixFree::className
+                = GetGlobalLinSysFactory().RegisterCreatorFunction(
+                    "IterativeMatrixFree",
+                    GlobalLinSysIterativeMatrixFree::create,
+                    "Matrix-free iterative solver for full matrix system.");
+
+
+        /**
+         * Constructor for matrix-free iterative solve.
+         * @param   pKey        Key specifying matrix to solve.
+         * @param   pExp        Shared pointer to expansion list for applying
+         *                      matrix evaluations.
+         * @param   pLocToGloMap Local to global mapping.
+         */
+        GlobalLinSysIterativeMatrixFree::GlobalLinSysIterativeMatrixFree(
+                    const GlobalLinSysKey &pKey,
+                    const boost::weak_ptr<ExpList> &pExp,
+                    const boost::shared_ptr<AssemblyMap> &pLocToGloMap)
+                : GlobalLinSysIterative(pKey, pExp, pLocToGloMap),
+                  m_locToGloMap(pLocToGloMap)
+        {
+            ASSERTL1(m_linSysKey.GetGlobalSysSolnType()==eIterativeMatrixFree,
+                     "This routine should only be used when using a "
+                     "matrix-free iterative conjugate gradient solve.");
+            ASSERTL0(boost::dynamic_pointer_cast<AssemblyMapCG>(pLocToGloMap),
+                     "Matrix-free solve is only available for continuous "
+                     "Galerkin discretisations.");
+            ASSERTL0(pLocToGloMap->GetPreconType() == eNull ||
+                     pLocToGloMap->GetPreconType() == eDiagonal,
+                     "Matrix-free solve only supports the Null and Diagonal "
+                     "preconditioners.");
+
+            // The sum-factorised elemental operators fall back to a generic
+            // implementation which ignores variable coefficients and the
+            // spectral vanishing viscosity terms.
+            ASSERTL0(m_linSysKey.GetNVarCoeffs() == 0,
+                     "Matrix-free solve does not support variable "
+                     "coefficients.");
+            ASSERTL0(m_linSysKey.GetConstFactors().count(
+                         StdRegions::eFactorSVVCutoffRatio) == 0,
+                     "Matrix-free solve does not support spectral vanishing "
+                     "viscosity.");
+        }
+
+
+        /**
+         *
+         */
+        GlobalLinSysIterativeMatrixFree::~GlobalLinSysIterativeMatrixFree()
+        {
+
+        }
+
+
+        /**
+         * Solve a global linear system with Dirichlet forcing using a
+         * conjugate gradient method. The Dirichlet forcing is lifted as in
+         * GlobalLinSysIterativeFull, with the operator evaluated matrix-free.
+         *
+         * @param           pInput      RHS of linear system, \f$b\f$.
+         * @param           pOutput     On input, values of dirichlet degrees
+         *                              of freedom with initial guess on other
+         *                              values. On output, the solution
+         *                              \f$x\f$.
+         * @param           pLocToGloMap    Local to global mapping.
+         * @param           pDirForcing Precalculated Dirichlet forcing.
+         */
+        void GlobalLinSysIterativeMatrixFree::v_Solve(
+                    const Array<OneD, const NekDouble>  &pInput,
+                          Array<OneD,       NekDouble>  &pOutput,
+                    const AssemblyMapSharedPtr &pLocToGloMap,
+                    const Array<OneD, const NekDouble>  &pDirForcing)
+        {
+            boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
+            m_locToGloMap = pLocToGloMap;
+
+            bool dirForcCalculated = (bool) pDirForcing.num_elements();
+            int nDirDofs  = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobDofs = pLocToGloMap->GetNumGlobalCoeffs();
+            int nDirTotal = nDirDofs;
+
+            expList->GetComm()->AllReduce(nDirTotal, LibUtilities::ReduceSum);
+
+            Array<OneD, NekDouble> tmp(nGlobDofs);
+
+            if(nDirTotal)
+            {
+                // calculate the Dirichlet forcing
+                if(dirForcCalculated)
+                {
+                    Vmath::Vsub(nGlobDofs, pInput.get(), 1,
+                                pDirForcing.get(), 1,
+                                tmp.get(), 1);
+                }
+                else
+                {
+                    // Calculate the dirichlet forcing B_b (== X_b) and
+                    // substract it from the rhs
+                    GlobalMatrixOp(pOutput, tmp);
+
+                    Vmath::Vsub(nGlobDofs, pInput.get(), 1,
+                                           tmp.get(),    1,
+                                           tmp.get(),    1);
+                }
+
+                Array<OneD, NekDouble> out(nGlobDofs,0.0);
+                // solve for perturbation from intiial guess in pOutput
+                SolveLinearSystem(nGlobDofs, tmp, out, pLocToGloMap, nDirDofs);
+                Vmath::Vadd(nGlobDofs - nDirDofs, &out    [nDirDofs], 1,
+                                                  &pOutput[nDirDofs], 1,
+                                                  &pOutput[nDirDofs], 1);
+            }
+            else
+            {
+                Vmath::Vcopy(nGlobDofs, pInput, 1, tmp, 1);
+                SolveLinearSystem(nGlobDofs, tmp, pOutput, pLocToGloMap);
+            }
+        }
+
+
+        /**
+         * Evaluates the elemental operator described by #m_linSysKey on
+         * expansion @a n using the matrix-free sum-factorisation kernels and
+         * adds the contribution of any Robin boundary conditions on its
+         * edges or faces.
+         *
+         * @param   n           Index of the expansion.
+         * @param   pInput      Local coefficients of expansion @a n.
+         * @param   pOutput     Result of the operator applied to @a pInput.
+         */
+        void GlobalLinSysIterativeMatrixFree::ElmtMatrixOp(
+                const int                           n,
+                const Array<OneD, const NekDouble> &pInput,
+                      Array<OneD,       NekDouble> &pOutput)
+        {
+            boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
+            StdRegions::StdExpansionSharedPtr vExp = expList->GetExp(n);
+
+            StdRegions::StdMatrixKey mkey(m_linSysKey.GetMatrixType(),
+                                          vExp->DetShapeType(), *vExp,
+                                          m_linSysKey.GetConstFactors());
+
+            vExp->GeneralMatrixOp(pInput, pOutput, mkey);
+
+            // apply robin boundary conditions. Each call replaces its
+            // argument with the contribution of a single edge or face, so
+            // work on a copy of the input.
+            map<int, RobinBCInfoSharedPtr>::const_iterator it
+                                                    = m_robinBCInfo.find(n);
+            if(it != m_robinBCInfo.end())
+            {
+                int ncoeffs = vExp->GetNcoeffs();
+                Array<OneD, NekDouble> robin(ncoeffs);
+
+                for(RobinBCInfoSharedPtr rBC = it->second; rBC;
+                    rBC = rBC->next)
+                {
+                    Vmath::Vcopy(ncoeffs, pInput, 1, robin, 1);
+                    vExp->AddRobinEdgeContribution(
+                        rBC->m_robinID, rBC->m_robinPrimitiveCoeffs, robin);
+                    Vmath::Vadd(ncoeffs, robin, 1, pOutput, 1, pOutput, 1);
+                }
+            }
+        }
+
+
+        /**
+         * Scatters global coefficients to the elements, applies the
+         * elemental operators and assembles the result. As for
+         * ContField::GeneralMatrixOp, the output is assembled across all
+         * processes through AssemblyMapCG::Assemble.
+         */
+        void GlobalLinSysIterativeMatrixFree::GlobalMatrixOp(
+                const Array<OneD, const NekDouble> &pInput,
+                      Array<OneD,       NekDouble> &pOutput)
+        {
+            boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
+            int nLocal = m_locToGloMap->GetNumLocalCoeffs();
+
+            Array<OneD, NekDouble> wsp(2*nLocal);
+            Array<OneD, NekDouble> loc_in (wsp);
+            Array<OneD, NekDouble> loc_out(wsp + nLocal);
+            Array<OneD, NekDouble> tmp1, tmp2;
+
+            m_locToGloMap->GlobalToLocal(pInput, loc_in);
+
+            for (int n = 0; n < expList->GetExpSize(); ++n)
+            {
+                int offset = expList->GetCoeff_Offset(n);
+                ElmtMatrixOp(n, tmp1 = loc_in  + offset,
+                                tmp2 = loc_out + offset);
+            }
+
+            m_locToGloMap->Assemble(loc_out, pOutput);
+        }
+
+
+        /**
+         *
+         */
+        void GlobalLinSysIterativeMatrixFree::v_DoMatrixMultiply(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            GlobalMatrixOp(pInput, pOutput);
+        }
+
+
+        /**
+         *
+         */
+        void GlobalLinSysIterativeMatrixFree::v_UniqueMap()
+        {
+            m_map = m_locToGloMap->GetGlobalToUniversalMapUnique();
+        }
+    }
+}
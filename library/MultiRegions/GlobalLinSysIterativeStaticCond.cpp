@@ -111,6 +111,7 @@ namespace Nektar
             const boost::weak_ptr<ExpList>       &pExpList,
             const boost::shared_ptr<AssemblyMap> &pLocToGloMap)
                 : GlobalLinSysIterative(pKey, pExpList, pLocToGloMap),
+                  m_useSingle   (false),
                   m_locToGloMap (pLocToGloMap)
         {
             ASSERTL1((pKey.GetGlobalSysSolnType()==eIterativeStaticCond)||
@@ -142,6 +143,7 @@ namespace Nektar
               m_BinvD      ( pBinvD ),
               m_C          ( pC ),
               m_invD       ( pInvD ),
+              m_useSingle  ( false ),
               m_locToGloMap( pLocToGloMap ),
               m_precon     ( pPrecon )
         {
@@ -194,11 +196,8 @@ namespace Nektar
             int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
             int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
             int nLocBndDofs        = pLocToGloMap->GetNumLocalBndCoeffs();
-            int nIntDofs           = pLocToGloMap->GetNumGlobalCoeffs()
-                - nGlobBndDofs;
             
             Array<OneD, NekDouble> F = m_wsp + 2*nLocBndDofs;
-            Array<OneD, NekDouble> tmp;
             if(nDirBndDofs && dirForcCalculated)
             {
                 Vmath::Vsub(nGlobDofs,in.get(),1,dirForcing.get(),1,F.get(),1);
@@ -208,97 +207,25 @@ namespace Nektar
                 Vmath::Vcopy(nGlobDofs,in.get(),1,F.get(),1);
             }
             
-            NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,tmp=F+nDirBndDofs,
-                                          eWrapper);
-            NekVector<NekDouble> F_GlobBnd(nGlobBndDofs,F,eWrapper);
-            NekVector<NekDouble> F_LocBnd(nLocBndDofs,0.0);
-            NekVector<NekDouble> F_Int(nIntDofs,tmp=F+nGlobBndDofs,eWrapper);
-            
-            NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,out,eWrapper);
-            NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,
-                                              tmp=out+nDirBndDofs,
-                                              eWrapper);
-            NekVector<NekDouble> V_Int(nIntDofs,tmp=out+nGlobBndDofs,eWrapper);
-            NekVector<NekDouble> V_LocBnd(nLocBndDofs,m_wsp,eWrapper);
-            
-            NekVector<NekDouble> V_GlobHomBndTmp(nGlobHomBndDofs,0.0);
-
             // set up normalisation factor for right hand side on first SC level
             if(scLevel == 0)
             {
+                NekVector<NekDouble> F_GlobBnd(nGlobBndDofs,F,eWrapper);
                 Set_Rhs_Magnitude(F_GlobBnd);
             }
 
-            // Select correct matrix to use at difference levels: top level
-            // should use the transformed matrix, all other levels should use
-            // original matrix since the transformed matrix is recursively
-            // passed down.
-            DNekScalBlkMatSharedPtr sc = scLevel == 0 ? m_S1Blk : m_schurCompl;
-
             if(nGlobHomBndDofs)
             {
-                // construct boundary forcing
-                if( nIntDofs  && ((!dirForcCalculated) && (atLastLevel)) )
-                {
-                    DNekScalBlkMat &BinvD      = *m_BinvD;
-                    DNekScalBlkMat &SchurCompl = *sc;
-                    
-                    // include dirichlet boundary forcing 
-                    pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
-                    V_LocBnd = BinvD*F_Int + SchurCompl*V_LocBnd;
-                    
-                }
-                else if((!dirForcCalculated) && (atLastLevel))
-                {
-                    // include dirichlet boundary forcing
-                    DNekScalBlkMat &SchurCompl = *sc;
-                    pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
-                    V_LocBnd = SchurCompl*V_LocBnd;
-                }
-                else
-                {
-                    DNekScalBlkMat &BinvD      = *m_BinvD;
-                    V_LocBnd = BinvD*F_Int;
-                }
-                
-                pLocToGloMap->AssembleBnd(V_LocBnd,V_GlobHomBndTmp,
-                                          nDirBndDofs);
-                F_HomBnd = F_HomBnd - V_GlobHomBndTmp;
+                CondenseBoundaryForcing(F, out, pLocToGloMap,
+                                        dirForcCalculated);
 
-                
-                //transform from original basis to low energy
-                Array<OneD, NekDouble> tmp;
-                m_precon->DoTransformToLowEnergy(F,nDirBndDofs);
-
-                // For parallel multi-level static condensation some
-                // processors may have different levels to others. This
-                // routine receives contributions to partition vertices from
-                // those lower levels, whilst not sending anything to the
-                // other partitions, and includes them in the modified right
-                // hand side vector.
-                int lcLevel = pLocToGloMap->GetLowestStaticCondLevel();
-                if(atLastLevel && scLevel < lcLevel)
-                {
-                    // If this level is not the lowest level across all
-                    // processes, we must do dummy communication for the
-                    // remaining levels
-                    Array<OneD, NekDouble> tmp(nGlobBndDofs);
-                    for (int i = scLevel; i < lcLevel; ++i)
-                    {
-                        Vmath::Fill(nGlobBndDofs, 0.0, tmp, 1);
-                        pLocToGloMap->UniversalAssembleBnd(tmp);
-                        Vmath::Vcopy(nGlobHomBndDofs,
-                                     tmp.get()+nDirBndDofs,          1,
-                                     V_GlobHomBndTmp.GetPtr().get(), 1);
-                        F_HomBnd = F_HomBnd - V_GlobHomBndTmp;
-                    }
-                }
+                Array<OneD, Array<OneD, NekDouble> > Fs(1, F);
+                AddLowerLevelForcing(Fs, pLocToGloMap);
 
                 // solve boundary system
                 if(atLastLevel)
                 {
                     Array<OneD, NekDouble> pert(nGlobBndDofs,0.0);
-                    NekVector<NekDouble>   Pert(nGlobBndDofs,pert,eWrapper);
 
                     // Solve for difference from initial solution given inout;
                     SolveLinearSystem(
@@ -313,38 +240,285 @@ namespace Nektar
                 }
                 else
                 {
-                    m_recursiveSchurCompl->Solve(F,
-                                V_GlobBnd.GetPtr(),
+                    m_recursiveSchurCompl->Solve(F, out,
                                 pLocToGloMap->GetNextLevelLocalToGlobalMap());
                 }
             }
 
-            // solve interior system
-            if(nIntDofs)
+            SolveInteriorSystem(F, out, pLocToGloMap, dirForcCalculated);
+        }
+
+
+        /**
+         * Solve the condensed system for several right-hand sides. The
+         * boundary forcing of each right-hand side is condensed in turn and
+         * the boundary systems are then solved simultaneously, so that the
+         * Schur complement is only streamed from memory once per iteration
+         * for all right-hand sides. Successive right-hand-side projection
+         * stores a single history of solutions and so is not combined with
+         * the simultaneous solve.
+         */
+        void GlobalLinSysIterativeStaticCond::v_SolveMultiple(
+            const Array<OneD, const Array<OneD, NekDouble> > &in,
+                  Array<OneD,       Array<OneD, NekDouble> > &out,
+            const AssemblyMapSharedPtr                       &pLocToGloMap)
+        {
+            if (m_useProjection)
             {
-                DNekScalBlkMat &invD  = *m_invD;
+                GlobalLinSys::v_SolveMultiple(in, out, pLocToGloMap);
+                return;
+            }
 
-                if(nGlobHomBndDofs || nDirBndDofs)
+            bool atLastLevel       = pLocToGloMap->AtLastLevel();
+            int  scLevel           = pLocToGloMap->GetStaticCondLevel();
+
+            int nVec               = in.num_elements();
+            int nGlobDofs          = pLocToGloMap->GetNumGlobalCoeffs();
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+            int v;
+
+            Array<OneD, Array<OneD, NekDouble> > F(nVec);
+            for (v = 0; v < nVec; ++v)
+            {
+                F[v] = Array<OneD, NekDouble>(nGlobDofs);
+                Vmath::Vcopy(nGlobDofs, in[v], 1, F[v], 1);
+            }
+
+            // set up normalisation factors for the right hand sides on the
+            // first SC level using a single reduction
+            Array<OneD, NekDouble> rhsMag;
+            if (scLevel == 0)
+            {
+                rhsMag = Array<OneD, NekDouble>(nVec);
+                for (v = 0; v < nVec; ++v)
+                {
+                    rhsMag[v] = Vmath::Dot(nGlobBndDofs, F[v], F[v]);
+                }
+                m_expList.lock()->GetComm()->GetRowComm()->AllReduce(
+                    rhsMag, Nektar::LibUtilities::ReduceSum);
+                for (v = 0; v < nVec; ++v)
                 {
-                    DNekScalBlkMat &C     = *m_C;
+                    rhsMag[v] = (rhsMag[v] > 1e-6) ? rhsMag[v] : 1.0;
+                }
+            }
 
-                    if(dirForcCalculated && nDirBndDofs)
+            if (nGlobHomBndDofs)
+            {
+                for (v = 0; v < nVec; ++v)
+                {
+                    CondenseBoundaryForcing(F[v], out[v], pLocToGloMap,
+                                            false);
+                }
+
+                AddLowerLevelForcing(F, pLocToGloMap);
+
+                // solve boundary systems
+                if (atLastLevel)
+                {
+                    Array<OneD, Array<OneD, NekDouble> > pert(nVec);
+                    for (v = 0; v < nVec; ++v)
                     {
-                        pLocToGloMap->GlobalToLocalBnd(V_GlobHomBnd,V_LocBnd,
-                                                      nDirBndDofs);
+                        pert[v] = Array<OneD, NekDouble>(nGlobBndDofs, 0.0);
                     }
-                    else
+
+                    DoConjugateGradientMultiple(
+                        nGlobBndDofs, F, pert, pLocToGloMap, nDirBndDofs,
+                        rhsMag);
+
+                    for (v = 0; v < nVec; ++v)
                     {
-                        pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
+                        //transform back to original basis
+                        m_precon->DoTransformFromLowEnergy(pert[v]);
+
+                        // Add back initial conditions onto difference
+                        Vmath::Vadd(nGlobHomBndDofs, &out[v][nDirBndDofs], 1,
+                                    &pert[v][nDirBndDofs], 1,
+                                    &out[v][nDirBndDofs], 1);
                     }
-                    F_Int = F_Int - C*V_LocBnd;
                 }
+                else
+                {
+                    m_recursiveSchurCompl->Solve(
+                        F, out, pLocToGloMap->GetNextLevelLocalToGlobalMap());
+                }
+            }
 
-                V_Int = invD*F_Int;
+            for (v = 0; v < nVec; ++v)
+            {
+                SolveInteriorSystem(F[v], out[v], pLocToGloMap, false);
             }
         }
 
 
+        /**
+         * Subtract the coupling of the interior forcing and of the known
+         * boundary values from the boundary forcing in \a pF, and transform
+         * the result into the low energy basis.
+         */
+        void GlobalLinSysIterativeStaticCond::CondenseBoundaryForcing(
+                  Array<OneD, NekDouble> &pF,
+                  Array<OneD, NekDouble> &pOut,
+            const AssemblyMapSharedPtr   &pLocToGloMap,
+            const bool                    dirForcCalculated)
+        {
+            bool atLastLevel       = pLocToGloMap->AtLastLevel();
+            int  scLevel           = pLocToGloMap->GetStaticCondLevel();
+            
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+            int nLocBndDofs        = pLocToGloMap->GetNumLocalBndCoeffs();
+            int nIntDofs           = pLocToGloMap->GetNumGlobalCoeffs()
+                - nGlobBndDofs;
+
+            Array<OneD, NekDouble> tmp;
+            NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,tmp=pF+nDirBndDofs,
+                                          eWrapper);
+            NekVector<NekDouble> F_Int(nIntDofs,tmp=pF+nGlobBndDofs,eWrapper);
+
+            NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,pOut,eWrapper);
+            NekVector<NekDouble> V_LocBnd(nLocBndDofs,m_wsp,eWrapper);
+            
+            NekVector<NekDouble> V_GlobHomBndTmp(nGlobHomBndDofs,0.0);
+
+            // Select correct matrix to use at difference levels: top level
+            // should use the transformed matrix, all other levels should use
+            // original matrix since the transformed matrix is recursively
+            // passed down.
+            DNekScalBlkMatSharedPtr sc = scLevel == 0 ? m_S1Blk : m_schurCompl;
+
+            // construct boundary forcing
+            if( nIntDofs  && ((!dirForcCalculated) && (atLastLevel)) )
+            {
+                DNekScalBlkMat &BinvD      = *m_BinvD;
+                DNekScalBlkMat &SchurCompl = *sc;
+                
+                // include dirichlet boundary forcing 
+                pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
+                V_LocBnd = BinvD*F_Int + SchurCompl*V_LocBnd;
+                
+            }
+            else if((!dirForcCalculated) && (atLastLevel))
+            {
+                // include dirichlet boundary forcing
+                DNekScalBlkMat &SchurCompl = *sc;
+                pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
+                V_LocBnd = SchurCompl*V_LocBnd;
+            }
+            else
+            {
+                DNekScalBlkMat &BinvD      = *m_BinvD;
+                V_LocBnd = BinvD*F_Int;
+            }
+            
+            pLocToGloMap->AssembleBnd(V_LocBnd,V_GlobHomBndTmp,
+                                      nDirBndDofs);
+            F_HomBnd = F_HomBnd - V_GlobHomBndTmp;
+
+            //transform from original basis to low energy
+            m_precon->DoTransformToLowEnergy(pF,nDirBndDofs);
+        }
+
+
+        /**
+         * For parallel multi-level static condensation some processors may
+         * have different levels to others. This routine receives
+         * contributions to partition vertices from those lower levels,
+         * whilst not sending anything to the other partitions, and includes
+         * them in the modified right hand side vectors \a pF. The remaining
+         * levels form the outer loop so that the exchanges are posted in the
+         * same order as the recursive solve on the other processes.
+         */
+        void GlobalLinSysIterativeStaticCond::AddLowerLevelForcing(
+                  Array<OneD, Array<OneD, NekDouble> > &pF,
+            const AssemblyMapSharedPtr                 &pLocToGloMap)
+        {
+            int scLevel = pLocToGloMap->GetStaticCondLevel();
+            int lcLevel = pLocToGloMap->GetLowestStaticCondLevel();
+
+            if (!pLocToGloMap->AtLastLevel() || scLevel >= lcLevel)
+            {
+                return;
+            }
+
+            // If this level is not the lowest level across all processes, we
+            // must do dummy communication for the remaining levels
+            int nGlobBndDofs    = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs     = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs = nGlobBndDofs - nDirBndDofs;
+
+            Array<OneD, NekDouble> tmp(nGlobBndDofs);
+            for (int i = scLevel; i < lcLevel; ++i)
+            {
+                for (int v = 0; v < pF.num_elements(); ++v)
+                {
+                    Vmath::Fill(nGlobBndDofs, 0.0, tmp, 1);
+                    pLocToGloMap->UniversalAssembleBnd(tmp);
+                    Vmath::Vsub(nGlobHomBndDofs,
+                                pF[v].get()+nDirBndDofs, 1,
+                                tmp.get()  +nDirBndDofs, 1,
+                                pF[v].get()+nDirBndDofs, 1);
+                }
+            }
+        }
+
+
+        /**
+         * Recover the interior degrees of freedom in \a pOut from the
+         * interior forcing in \a pF and the boundary solution.
+         */
+        void GlobalLinSysIterativeStaticCond::SolveInteriorSystem(
+                  Array<OneD, NekDouble> &pF,
+                  Array<OneD, NekDouble> &pOut,
+            const AssemblyMapSharedPtr   &pLocToGloMap,
+            const bool                    dirForcCalculated)
+        {
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+            int nLocBndDofs        = pLocToGloMap->GetNumLocalBndCoeffs();
+            int nIntDofs           = pLocToGloMap->GetNumGlobalCoeffs()
+                - nGlobBndDofs;
+
+            if(nIntDofs == 0)
+            {
+                return;
+            }
+
+            Array<OneD, NekDouble> tmp;
+            NekVector<NekDouble> F_Int(nIntDofs,tmp=pF+nGlobBndDofs,eWrapper);
+            NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,pOut,eWrapper);
+            NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,
+                                              tmp=pOut+nDirBndDofs,
+                                              eWrapper);
+            NekVector<NekDouble> V_Int(nIntDofs,tmp=pOut+nGlobBndDofs,
+                                       eWrapper);
+            NekVector<NekDouble> V_LocBnd(nLocBndDofs,m_wsp,eWrapper);
+
+            DNekScalBlkMat &invD  = *m_invD;
+
+            if(nGlobHomBndDofs || nDirBndDofs)
+            {
+                DNekScalBlkMat &C     = *m_C;
+
+                if(dirForcCalculated && nDirBndDofs)
+                {
+                    pLocToGloMap->GlobalToLocalBnd(V_GlobHomBnd,V_LocBnd,
+                                                  nDirBndDofs);
+                }
+                else
+                {
+                    pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
+                }
+                F_Int = F_Int - C*V_LocBnd;
+            }
+
+            V_Int = invD*F_Int;
+        }
+
+
 
         /**
          * If at the last level of recursion (or the only level in the case of
@@ -407,6 +581,69 @@ namespace Nektar
             return schurComplBlock;
         }
 
+        /**
+         * A Helmholtz system is changed in place to a new Helmholtz
+         * constant. On the first change the elemental Helmholtz and
+         * statically condensed matrices of the original key are removed.
+         * From then on the condensed blocks of each element are formed
+         * from its mass and Laplacian matrices, which are kept split into
+         * boundary and interior blocks (see ParametricStaticCondBlk), so
+         * that no elemental matrix is regenerated or factorised again. The
+         * lower levels of a multi-level system and the preconditioner are
+         * computed for the new key, while the local to global maps and the
+         * parts of the preconditioner which only depend on the mesh are
+         * kept.
+         */
+        bool GlobalLinSysIterativeStaticCond::v_UpdateKey(
+            const GlobalLinSysKey &pKey)
+        {
+            if (m_linSysKey.GetMatrixType() != StdRegions::eHelmholtz ||
+                pKey.GetMatrixType()        != StdRegions::eHelmholtz ||
+                m_locToGloMap->GetStaticCondLevel() != 0)
+            {
+                return false;
+            }
+
+            ASSERTL1(pKey.GetNVarCoeffs() == m_linSysKey.GetNVarCoeffs(),
+                     "Keys differ in their variable coefficients.");
+
+            if (m_parametricBlocks.num_elements() == 0)
+            {
+                DropElementalMatrices();
+                m_parametricBlocks = Array<OneD,
+                    ParametricStaticCondBlkSharedPtr>(
+                        m_expList.lock()->GetExpSize());
+            }
+            m_staticCondBlocks = Array<OneD, DNekScalBlkMatSharedPtr>();
+            m_linSysKey = pKey;
+
+            m_useSingle        = false;
+            m_singleSchurCompl = SinglePrecisionBlkMatSharedPtr();
+
+            SetupTopLevel(m_locToGloMap);
+            Initialise(m_locToGloMap);
+
+            // The preconditioner used by the conjugate gradient solve, as
+            // opposed to the one holding the low energy transformation.
+            if (GlobalLinSysIterative::m_precon)
+            {
+                GlobalLinSysIterative::m_precon->UpdatePreconditioner();
+            }
+
+            // Previous solutions are not solutions of the new system.
+            m_prevLinSol.clear();
+            m_numPrevSols = 0;
+
+            if (m_verbose && m_root)
+            {
+                cout << "Updated static condensation system for lambda = "
+                     << m_linSysKey.GetConstFactor(StdRegions::eFactorLambda)
+                     << endl;
+            }
+
+            return true;
+        }
+
         /**
          * For the first level in multi-level static condensation, or the only
          * level in the case of single-level static condensation, allocate the
@@ -440,25 +677,33 @@ namespace Nektar
             m_S1Blk      = MemoryManager<DNekScalBlkMat>
                 ::AllocateSharedPtr(nbdry_size, nbdry_size , blkmatStorage);
 
+            LoadStaticCondBlockCache();
+
+            // The elemental matrices are computed concurrently, since each
+            // requires several dense factorisations.
+            Array<OneD, DNekScalMatSharedPtr>    locMat  (n_exp);
+            Array<OneD, DNekScalBlkMatSharedPtr> locS1   (n_exp);
+            Array<OneD, DNekScalBlkMatSharedPtr> locSchur(n_exp);
+
+            m_expList.lock()->GetMatrixSetupThreadPool()->ParallelFor(
+                n_exp, boost::bind(
+                &GlobalLinSysIterativeStaticCond::SetupTopLevelElmt, this,
+                boost::ref(locMat), boost::ref(locS1), boost::ref(locSchur),
+                _1));
+
             for(n = 0; n < n_exp; ++n)
             {
                 if (m_linSysKey.GetMatrixType() ==
                         StdRegions::eHybridDGHelmBndLam)
                 {
-                    DNekScalMatSharedPtr loc_mat
-                        = GlobalLinSys::v_GetBlock(
-                            m_expList.lock()->GetOffset_Elmt_Id(n));
+                    DNekScalMatSharedPtr &loc_mat = locMat[n];
                     m_schurCompl->SetBlock(n,n,loc_mat);
                     m_S1Blk     ->SetBlock(n,n,loc_mat);
                 }
                 else
                 {
-                    DNekScalBlkMatSharedPtr loc_S1
-                        = GlobalLinSys::v_GetStaticCondBlock(
-                            m_expList.lock()->GetOffset_Elmt_Id(n));
-                    DNekScalBlkMatSharedPtr loc_schur
-                        = m_precon->TransformedSchurCompl(
-                            m_expList.lock()->GetOffset_Elmt_Id(n),loc_S1);
+                    DNekScalBlkMatSharedPtr &loc_S1    = locS1[n];
+                    DNekScalBlkMatSharedPtr &loc_schur = locSchur[n];
 
                     DNekScalMatSharedPtr t;
                     m_schurCompl->SetBlock(n, n, t = loc_schur->GetBlock(0,0));
@@ -468,6 +713,32 @@ namespace Nektar
                     m_S1Blk     ->SetBlock(n, n, t = loc_S1   ->GetBlock(0,0));
                 }
             }
+
+            SaveStaticCondBlockCache();
+        }
+
+        /**
+         * For the HDG trace system only the elemental matrix @a locMat is
+         * computed. This may be called concurrently for different elements.
+         */
+        void GlobalLinSysIterativeStaticCond::SetupTopLevelElmt(
+            Array<OneD, DNekScalMatSharedPtr>    &locMat,
+            Array<OneD, DNekScalBlkMatSharedPtr> &locS1,
+            Array<OneD, DNekScalBlkMatSharedPtr> &locSchur,
+            const unsigned int                    n)
+        {
+            int eid = m_expList.lock()->GetOffset_Elmt_Id(n);
+
+            if (m_linSysKey.GetMatrixType() ==
+                    StdRegions::eHybridDGHelmBndLam)
+            {
+                locMat[n] = GlobalLinSys::v_GetBlock(eid);
+            }
+            else
+            {
+                locS1[n]    = GlobalLinSys::v_GetStaticCondBlock(eid);
+                locSchur[n] = m_precon->TransformedSchurCompl(eid, locS1[n]);
+            }
         }
 
         /**
@@ -556,6 +827,14 @@ namespace Nektar
          */
         void GlobalLinSysIterativeStaticCond::PrepareLocalSchurComplement()
         {
+            // Keep a single-precision copy for the inner iterations of a
+            // mixed-precision solve before the blocks are repacked below.
+            if (m_mixedPrecision)
+            {
+                m_singleSchurCompl = MemoryManager<SinglePrecisionBlkMat>
+                    ::AllocateSharedPtr(*m_schurCompl);
+            }
+
             LocalMatrixStorageStrategy storageStrategy =
                 m_expList.lock()->GetSession()->
                     GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
@@ -997,6 +1276,15 @@ namespace Nektar
                 m_sparseSchurCompl->Multiply(in,out);
                 m_locToGloMap->UniversalAssembleBnd(pOutput, nDir);
             }
+            else if (m_useSingle)
+            {
+                // Do matrix multiply locally using single-precision blocks
+                Array<OneD, NekDouble> tmp = m_wsp + nLocal;
+
+                m_locToGloMap->GlobalToLocalBnd(pInput, m_wsp);
+                m_singleSchurCompl->Multiply(m_wsp.get(), tmp.get());
+                m_locToGloMap->AssembleBnd(tmp, pOutput);
+            }
             else if (m_sparseSchurCompl)
             {
                 // Do matrix multiply locally using block-diagonal sparse matrix
@@ -1024,6 +1312,67 @@ namespace Nektar
             }
         }
 
+        /**
+         * The single-precision Schur complement is only available when it
+         * is applied locally, i.e. when the global matrix is not assembled.
+         */
+        bool GlobalLinSysIterativeStaticCond::v_UseSinglePrecision(
+                const bool pUse)
+        {
+            m_useSingle = pUse && m_singleSchurCompl;
+            return m_singleSchurCompl ? true : false;
+        }
+
+        /**
+         * When the local Schur complement blocks are held in dense storage,
+         * each block is applied to all vectors with a single matrix-matrix
+         * product so that it is read from memory only once. The local
+         * vectors are stored column-wise with a leading dimension of the
+         * number of local boundary coefficients.
+         */
+        void GlobalLinSysIterativeStaticCond::v_DoMatrixMultiplyMultiple(
+                const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                      Array<OneD, Array<OneD, NekDouble> > &pOutput)
+        {
+            bool doGlobalOp = m_expList.lock()->GetGlobalOptParam()->
+                    DoGlobalMatOp(m_linSysKey.GetMatrixType());
+
+            if (doGlobalOp || m_sparseSchurCompl)
+            {
+                GlobalLinSysIterative::v_DoMatrixMultiplyMultiple(
+                    pInput, pOutput);
+                return;
+            }
+
+            int nLocal = m_locToGloMap->GetNumLocalBndCoeffs();
+            int nVec   = pInput.num_elements();
+            int i, v, cnt;
+
+            Array<OneD, NekDouble> locIn (nLocal*nVec);
+            Array<OneD, NekDouble> locOut(nLocal*nVec);
+            Array<OneD, NekDouble> tmp;
+
+            for (v = 0; v < nVec; ++v)
+            {
+                m_locToGloMap->GlobalToLocalBnd(pInput[v],
+                                                tmp = locIn + v*nLocal);
+            }
+
+            for (i = cnt = 0; i < m_denseBlocks.size(); cnt += m_rows[i], ++i)
+            {
+                const int rows = m_rows[i];
+                Blas::Dgemm('N', 'N', rows, nVec, rows,
+                            m_scale[i], m_denseBlocks[i], rows,
+                            locIn.get()+cnt, nLocal,
+                            0.0, locOut.get()+cnt, nLocal);
+            }
+
+            for (v = 0; v < nVec; ++v)
+            {
+                m_locToGloMap->AssembleBnd(locOut + v*nLocal, pOutput[v]);
+            }
+        }
+
         void GlobalLinSysIterativeStaticCond::v_UniqueMap()
         {
             m_map = m_locToGloMap->GetGlobalToUniversalBndMapUnique();
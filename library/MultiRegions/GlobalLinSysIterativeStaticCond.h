@@ -37,6 +37,7 @@
 
 #include <MultiRegions/GlobalMatrix.h>
 #include <MultiRegions/GlobalLinSysIterative.h>
+#include <MultiRegions/SinglePrecisionBlkMat.h>
 #include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
 
 
@@ -115,6 +116,7 @@ namespace Nektar
         protected:
             virtual int v_GetNumBlocks();
             virtual DNekScalBlkMatSharedPtr v_GetStaticCondBlock(unsigned int n);
+            virtual bool v_UpdateKey(const GlobalLinSysKey &pKey);
 
         private:
             /// Schur complement for Direct Static Condensation.
@@ -144,6 +146,10 @@ namespace Nektar
 
             /// Sparse representation of Schur complement matrix at this level
             DNekSmvBsrDiagBlkMatSharedPtr            m_sparseSchurCompl;
+            /// Single-precision copy of the local Schur complement
+            SinglePrecisionBlkMatSharedPtr           m_singleSchurCompl;
+            /// Whether the single-precision copy is currently in use
+            bool                                     m_useSingle;
 
             /// Local to global map.
             boost::shared_ptr<AssemblyMap>           m_locToGloMap;
@@ -166,6 +172,31 @@ namespace Nektar
                 const Array<OneD, const NekDouble>  &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
+            /// Condense the boundary forcing of a single right-hand side.
+            void CondenseBoundaryForcing(
+                      Array<OneD, NekDouble> &pF,
+                      Array<OneD, NekDouble> &pOut,
+                const AssemblyMapSharedPtr   &locToGloMap,
+                const bool                    dirForcCalculated);
+
+            /// Include contributions from lower levels on other processes.
+            void AddLowerLevelForcing(
+                      Array<OneD, Array<OneD, NekDouble> > &pF,
+                const AssemblyMapSharedPtr                 &locToGloMap);
+
+            /// Recover the interior degrees of freedom.
+            void SolveInteriorSystem(
+                      Array<OneD, NekDouble> &pF,
+                      Array<OneD, NekDouble> &pOut,
+                const AssemblyMapSharedPtr   &locToGloMap,
+                const bool                    dirForcCalculated);
+
             virtual void v_InitObject();
 
             /// Initialise this object
@@ -177,6 +208,14 @@ namespace Nektar
             void SetupTopLevel(
                     const boost::shared_ptr<AssemblyMap>& locToGloMap);
 
+            /// Compute the statically condensed matrix of one element and
+            /// its Schur complement in the preconditioner's basis.
+            void SetupTopLevelElmt(
+                    Array<OneD, DNekScalMatSharedPtr>    &locMat,
+                    Array<OneD, DNekScalBlkMatSharedPtr> &locS1,
+                    Array<OneD, DNekScalBlkMatSharedPtr> &locSchur,
+                    const unsigned int                    n);
+
             void SetupLowEnergyTopLevel(
                     const boost::shared_ptr<AssemblyMap>& locToGloMap);
 
@@ -197,6 +236,13 @@ namespace Nektar
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
 
+            /// Perform Schur-complement multiplies for several vectors.
+            virtual void v_DoMatrixMultiplyMultiple(
+                    const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                          Array<OneD, Array<OneD, NekDouble> > &pOutput);
+
+            virtual bool v_UseSinglePrecision(const bool pUse);
+
             virtual void v_UniqueMap();
         };
     }
@@ -315,6 +315,8 @@ namespace Nektar
             m_invD       = MemoryManager<DNekScalBlkMat>
                     ::AllocateSharedPtr(nint_size , nint_size , blkmatStorage);
 
+            LoadStaticCondBlockCache();
+
             for(n = 0; n < n_exp; ++n)
             {
                 if (m_linSysKey.GetMatrixType() == StdRegions::eHybridDGHelmBndLam)
@@ -332,6 +334,8 @@ namespace Nektar
                     m_invD      ->SetBlock(n,n, tmp_mat = loc_mat->GetBlock(1,1));
                 }
             }
+
+            SaveStaticCondBlockCache();
         }
 
 
@@ -35,11 +35,13 @@
 
 #include <MultiRegions/GlobalMatrix.h>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSellCS.hpp>
 #include <LibUtilities/LinearAlgebra/SparseMatrix.hpp>
 #include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
 
 #include <iomanip>
 #include <fstream>
+#include <sstream>
 
 
 namespace Nektar
@@ -48,9 +50,11 @@ namespace Nektar
     {
         std::string GlobalMatrix::def = LibUtilities::SessionReader::
             RegisterDefaultSolverInfo("GlobalMatrixStorageType","SmvBSR");
-        std::string GlobalMatrix::lookupIds[3] = {
+        std::string GlobalMatrix::lookupIds[2] = {
             LibUtilities::SessionReader::RegisterEnumValue(
-                "GlobalMatrixStorageType", "SmvBSR", MultiRegions::eSmvBSR)
+                "GlobalMatrixStorageType", "SmvBSR", MultiRegions::eSmvBSR),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "GlobalMatrixStorageType", "SellCS", MultiRegions::eSellCS)
         };
 
 
@@ -72,8 +76,10 @@ namespace Nektar
                                    const COOMatType &cooMat,
                                    const MatrixStorage& matStorage):
             m_smvbsrmatrix(),
+            m_sellcsmatrix(),
             m_rows(rows),
-            m_mulCallsCounter(0)
+            m_mulCallsCounter(0),
+            m_copyOp(false)
         {
             MatrixStorageType storageType = pSession->
                 GetSolverInfoAsEnum<MatrixStorageType>("GlobalMatrixStorageType");
@@ -94,6 +100,13 @@ namespace Nektar
                 ASSERTL1(block_size > 0,"SparseBlockSize parameter must to be positive");
             }
 
+            // SELL-C-sigma storage is scalar, and stores the matrix in
+            // its original size
+            if (storageType == eSellCS)
+            {
+                block_size = 1;
+            }
+
             brows = rows / block_size + (rows % block_size > 0);
             bcols = columns / block_size + (columns % block_size > 0);
 
@@ -105,13 +118,27 @@ namespace Nektar
                 m_tmpout = Array<OneD, NekDouble> (brows*block_size, 0.0);
             }
 
-            convertCooToBco(brows, bcols, block_size, cooMat, bcoMat);
+            bool exportMatrix;
+            pSession->MatchSolverInfo("GlobalMatrixExport", "True",
+                                      exportMatrix, false);
+            if (exportMatrix)
+            {
+                ExportMatrixMarket(pSession, rows, columns, cooMat);
+            }
+
+            int nThreads;
+            pSession->LoadParameter("GlobalMatrixThreads", nThreads, 1);
+            if (nThreads > 1)
+            {
+                m_threadPool = LibUtilities::GetThreadPool(nThreads);
+            }
 
             size_t matBytes;
             switch(storageType)
             {
                 case eSmvBSR:
                     {
+                    convertCooToBco(brows, bcols, block_size, cooMat, bcoMat);
 
                     // Create zero-based Smv-multiply BSR sparse storage holder
                     DNekSmvBsrMat::SparseStorageSharedPtr sparseStorage =
@@ -123,11 +150,45 @@ namespace Nektar
                     m_smvbsrmatrix = MemoryManager<DNekSmvBsrMat>::
                                             AllocateSharedPtr( sparseStorage );
 
+                    m_smvbsrmatrix->SetThreadPool(m_threadPool);
+
                     matBytes = m_smvbsrmatrix->GetMemoryFootprint();
 
                     }
                     break;
 
+                case eSellCS:
+                    {
+                    // Rows per chunk (C) and size of the window within
+                    // which rows are sorted by length (sigma)
+                    int chunkSize, sortScope;
+                    pSession->LoadParameter("SellChunkSize", chunkSize,   8);
+                    pSession->LoadParameter("SellSortScope", sortScope, 256);
+                    ASSERTL0(chunkSize > 0 && sortScope > 0,
+                             "SellChunkSize and SellSortScope parameters "
+                             "must be positive");
+
+                    DNekSellCSMat::SparseStorageSharedPtr sparseStorage =
+                            MemoryManager<DNekSellCSMat::StorageType>::
+                                    AllocateSharedPtr(
+                                        rows, columns, chunkSize, sortScope,
+                                        cooMat, matStorage );
+
+                    m_sellcsmatrix = MemoryManager<DNekSellCSMat>::
+                                            AllocateSharedPtr( sparseStorage );
+
+                    m_sellcsmatrix->SetThreadPool(m_threadPool);
+
+                    matBytes = m_sellcsmatrix->GetMemoryFootprint();
+
+                    std::cout << "SELL-C-sigma chunk size = " << chunkSize
+                              << ", sorting scope = " << sortScope
+                              << ", fill-in ratio = "
+                              << m_sellcsmatrix->GetFillInRatio()
+                              << std::endl;
+                    }
+                    break;
+
                 default:
                     NEKERROR(ErrorUtil::efatal,"Unsupported sparse storage type chosen");
             }
@@ -144,6 +205,48 @@ namespace Nektar
                 std::cout << " ("<< matBytes/1024 <<" KB)" << std::endl;
             }
             std::cout << "Sparse storage block size = " << block_size << std::endl;
+            std::cout << "Global matrix multiply threads = "
+                      << (m_threadPool ? nThreads : 1) << std::endl;
+        }
+
+        /**
+         * Writes the assembled matrix in Matrix Market coordinate format so
+         * that the sparse kernels can be benchmarked on matrices of real
+         * operators outside of a solver. The files are named after the
+         * session, numbered in order of construction and, in parallel,
+         * suffixed by the rank owning the matrix.
+         */
+        void GlobalMatrix::ExportMatrixMarket(
+            const LibUtilities::SessionReaderSharedPtr &pSession,
+                  unsigned int                         rows,
+                  unsigned int                         columns,
+            const COOMatType                          &cooMat)
+        {
+            static int nExported = 0;
+
+            std::stringstream filename;
+            filename << pSession->GetSessionName() << "_GlobalMatrix_"
+                     << nExported++;
+            if (pSession->GetComm()->GetSize() > 1)
+            {
+                filename << "_P" << pSession->GetComm()->GetRank();
+            }
+            filename << ".mtx";
+
+            std::ofstream mtx(filename.str().c_str());
+            ASSERTL0(mtx.good(), "Unable to open file: " + filename.str());
+
+            mtx << "%%MatrixMarket matrix coordinate real general" << endl;
+            mtx << rows << " " << columns << " " << cooMat.size() << endl;
+            mtx << std::setprecision(17) << std::scientific;
+
+            for (COOMatTypeConstIt entry = cooMat.begin();
+                 entry != cooMat.end(); ++entry)
+            {
+                mtx << entry->first.first  + 1 << " "
+                    << entry->first.second + 1 << " "
+                    << entry->second << endl;
+            }
         }
 
         /**
@@ -155,7 +258,11 @@ namespace Nektar
         void GlobalMatrix::Multiply(const Array<OneD,const NekDouble> &in, 
                                           Array<OneD,      NekDouble> &out)
         {
-            if (!m_copyOp)
+            if (m_sellcsmatrix)
+            {
+                m_sellcsmatrix->Multiply(in.get(),out.get());
+            }
+            else if (!m_copyOp)
             {
                 if (m_smvbsrmatrix)  m_smvbsrmatrix->Multiply(in,out);
             }
@@ -176,12 +283,14 @@ namespace Nektar
         const unsigned long GlobalMatrix::GetMulCallsCounter() const 
         {
             if (m_smvbsrmatrix)  return m_smvbsrmatrix->GetMulCallsCounter();
+            if (m_sellcsmatrix)  return m_sellcsmatrix->GetMulCallsCounter();
             return -1;
         }
 
         const unsigned int GlobalMatrix::GetNumNonZeroEntries() const
         {
             if (m_smvbsrmatrix)  return m_smvbsrmatrix->GetNumNonZeroEntries();
+            if (m_sellcsmatrix)  return m_sellcsmatrix->GetNumNonZeroEntries();
             return -1;
         }
 
@@ -37,6 +37,7 @@
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <MultiRegions/GlobalMatrixKey.h>
 #include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
 
 namespace Nektar
 {
@@ -49,6 +50,8 @@ namespace Nektar
         public:
             typedef NekSparseMatrix<StorageSmvBsr<NekDouble> >      DNekSmvBsrMat;
             typedef boost::shared_ptr<DNekSmvBsrMat>                DNekSmvBsrMatSharedPtr;
+            typedef NekSparseMatrix<StorageSellCS<NekDouble> >      DNekSellCSMat;
+            typedef boost::shared_ptr<DNekSellCSMat>                DNekSellCSMatSharedPtr;
 
             /// Construct a new matrix.
             MULTI_REGIONS_EXPORT GlobalMatrix(
@@ -72,6 +75,11 @@ namespace Nektar
         private:
             /// Pointer to a double-precision Nektar++ sparse matrix.
             DNekSmvBsrMatSharedPtr       m_smvbsrmatrix;
+            /// Pointer to a double-precision SELL-C-sigma sparse matrix.
+            DNekSellCSMatSharedPtr       m_sellcsmatrix;
+            /// Threads used for the matrix-vector multiply, shared with all
+            /// other global matrices.
+            LibUtilities::ThreadPoolSharedPtr m_threadPool;
 
             unsigned int                 m_rows;
             Array<OneD, NekDouble>       m_tmpin;
@@ -83,6 +91,12 @@ namespace Nektar
 
             static std::string           def;
             static std::string           lookupIds[];
+
+            void ExportMatrixMarket(
+                const LibUtilities::SessionReaderSharedPtr &pSession,
+                      unsigned int                         rows,
+                      unsigned int                         columns,
+                const COOMatType                          &cooMat);
         };
 
         /// Shared pointer to a GlobalMatrix object.
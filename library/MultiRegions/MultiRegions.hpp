@@ -86,6 +86,8 @@ namespace Nektar
             eXxtFullMatrix,
             eXxtStaticCond,
             eXxtMultiLevelStaticCond,
+            eDirectSparseStaticCond,
+            eIterativeMatrixFree,
             eSIZE_GlobalSysSolnType
         };
 
@@ -101,7 +103,9 @@ namespace Nektar
             "IterativeMultiLevelStaticCond",
             "XxtFull",
             "XxtStaticCond",
-            "XxtMultiLevelStaticCond"
+            "XxtMultiLevelStaticCond",
+            "DirectSparseStaticCond",
+            "IterativeMatrixFree"
         };
 
         /// Type of Galerkin projection.
@@ -121,7 +125,9 @@ namespace Nektar
             eLowEnergy,
             eLinearWithLowEnergy,
             eBlock,
-            eLinearWithBlock
+            eLinearWithBlock,
+            ePMultigrid,
+            eLinearAMG
         };
 
         const char* const PreconditionerTypeMap[] =
@@ -133,7 +139,9 @@ namespace Nektar
 	        "LowEnergyBlock",
             "FullLinearSpaceWithLowEnergyBlock",
             "Block",
-            "FullLinearSpaceWithBlock"
+            "FullLinearSpaceWithBlock",
+            "PMultigrid",
+            "FullLinearSpaceAMG"
         };
 
 
@@ -141,12 +149,14 @@ namespace Nektar
         // sparse libraries
         enum MatrixStorageType
         {
-            eSmvBSR
+            eSmvBSR,
+            eSellCS
         };
 
         const char* const MatrixStorageTypeMap[] =
         {
-            "SmvBSR"
+            "SmvBSR",
+            "SellCS"
         };
 
 
@@ -0,0 +1,258 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: ParametricStaticCondBlk.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Static condensation blocks of an elemental Helmholtz matrix
+// for any Helmholtz constant
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/ParametricStaticCondBlk.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * The interior mass block is factorised as \f$M_{ii} = RR^T\f$ and
+         * the eigenvectors \f$Q\f$ of the symmetric matrix \f$R^{-1} L_{ii}
+         * R^{-T}\f$ are transformed to \f$V = R^{-T}Q\f$. All blocks are
+         * stored in column-major order.
+         *
+         * @param   pExp        Expansion of the element.
+         * @param   pKey        Helmholtz matrix key of the element.
+         */
+        ParametricStaticCondBlk::ParametricStaticCondBlk(
+            const LocalRegions::ExpansionSharedPtr &pExp,
+            const LocalRegions::MatrixKey          &pKey)
+        {
+            ASSERTL0(pKey.GetMatrixType() == StdRegions::eHelmholtz,
+                     "Parametric static condensation requires a Helmholtz "
+                     "matrix key.");
+
+            LocalRegions::MatrixKey masskey(pKey, StdRegions::eMass);
+            LocalRegions::MatrixKey lapkey (pKey, StdRegions::eLaplacian);
+            DNekScalMat &mass = *pExp->GetLocMatrix(masskey);
+            DNekScalMat &lap  = *pExp->GetLocMatrix(lapkey);
+
+            const int nb = pExp->NumBndryCoeffs();
+            const int ni = pExp->GetNcoeffs() - nb;
+            int i, j, cnt, info;
+
+            m_nbdry = nb;
+            m_nint  = ni;
+
+            Array<OneD, unsigned int> bmap(nb);
+            Array<OneD, unsigned int> imap(ni);
+            pExp->GetBoundaryMap(bmap);
+            pExp->GetInteriorMap(imap);
+
+            m_Lbb = Array<OneD, NekDouble>(nb*nb);
+            m_Mbb = Array<OneD, NekDouble>(nb*nb);
+            m_Lib = Array<OneD, NekDouble>(ni*nb);
+            m_Mib = Array<OneD, NekDouble>(ni*nb);
+
+            Array<OneD, NekDouble> Lbi(nb*ni), Mbi(nb*ni);
+            Array<OneD, NekDouble> Lii(ni*ni), Mii(ni*ni);
+
+            for (j = 0; j < nb; ++j)
+            {
+                for (i = 0; i < nb; ++i)
+                {
+                    m_Lbb[i + j*nb] = lap (bmap[i], bmap[j]);
+                    m_Mbb[i + j*nb] = mass(bmap[i], bmap[j]);
+                }
+                for (i = 0; i < ni; ++i)
+                {
+                    m_Lib[i + j*ni] = lap (imap[i], bmap[j]);
+                    m_Mib[i + j*ni] = mass(imap[i], bmap[j]);
+                }
+            }
+
+            for (j = 0; j < ni; ++j)
+            {
+                for (i = 0; i < nb; ++i)
+                {
+                    Lbi[i + j*nb] = lap (bmap[i], imap[j]);
+                    Mbi[i + j*nb] = mass(bmap[i], imap[j]);
+                }
+                for (i = 0; i < ni; ++i)
+                {
+                    Lii[i + j*ni] = lap (imap[i], imap[j]);
+                    Mii[i + j*ni] = mass(imap[i], imap[j]);
+                }
+            }
+
+            if (ni == 0)
+            {
+                return;
+            }
+
+            // M_ii = R R^T, with R stored in the lower triangle of Mii.
+            Lapack::Dpotrf('L', ni, Mii.get(), ni, info);
+            ASSERTL0(info == 0, "Interior mass matrix is not positive "
+                                "definite.");
+
+            // Lii = R^{-1} L_ii R^{-T}
+            Blas::Dtrsm('L', 'L', 'N', 'N', ni, ni, 1.0,
+                        Mii.get(), ni, Lii.get(), ni);
+            Blas::Dtrsm('R', 'L', 'T', 'N', ni, ni, 1.0,
+                        Mii.get(), ni, Lii.get(), ni);
+
+            // Eigenvectors of the lower triangle in packed storage.
+            Array<OneD, NekDouble> packed(ni*(ni+1)/2);
+            Array<OneD, NekDouble> work  (3*ni);
+            for (cnt = j = 0; j < ni; ++j)
+            {
+                for (i = j; i < ni; ++i)
+                {
+                    packed[cnt++] = 0.5*(Lii[i + j*ni] + Lii[j + i*ni]);
+                }
+            }
+
+            m_mu = Array<OneD, NekDouble>(ni);
+            m_V  = Array<OneD, NekDouble>(ni*ni);
+            Lapack::Dspev('V', 'L', ni, packed.get(), m_mu.get(),
+                          m_V.get(), ni, work.get(), info);
+            ASSERTL0(info == 0, "Interior eigenvalue problem failed.");
+
+            // V = R^{-T} Q
+            Blas::Dtrsm('L', 'L', 'T', 'N', ni, ni, 1.0,
+                        Mii.get(), ni, m_V.get(), ni);
+
+            m_LbiV  = Array<OneD, NekDouble>(nb*ni);
+            m_MbiV  = Array<OneD, NekDouble>(nb*ni);
+            m_VtLib = Array<OneD, NekDouble>(ni*nb);
+            m_VtMib = Array<OneD, NekDouble>(ni*nb);
+
+            if (nb == 0)
+            {
+                return;
+            }
+
+            Blas::Dgemm('N', 'N', nb, ni, ni, 1.0, Lbi.get(), nb,
+                        m_V.get(), ni, 0.0, m_LbiV.get(), nb);
+            Blas::Dgemm('N', 'N', nb, ni, ni, 1.0, Mbi.get(), nb,
+                        m_V.get(), ni, 0.0, m_MbiV.get(), nb);
+            Blas::Dgemm('T', 'N', ni, nb, ni, 1.0, m_V.get(), ni,
+                        m_Lib.get(), ni, 0.0, m_VtLib.get(), ni);
+            Blas::Dgemm('T', 'N', ni, nb, ni, 1.0, m_V.get(), ni,
+                        m_Mib.get(), ni, 0.0, m_VtMib.get(), ni);
+        }
+
+        /**
+         * With \f$d = 1/(\mu + \lambda)\f$ and \f$W = H_{bi} V
+         * \mathrm{diag}(d)\f$ the blocks are \f$H_{ii}^{-1} = V
+         * \mathrm{diag}(d) V^T\f$, \f$H_{bi}H_{ii}^{-1} = WV^T\f$, \f$H_{ib}\f$
+         * and the Schur complement \f$H_{bb} - W V^T H_{ib}\f$.
+         *
+         * @param   lambda      Helmholtz constant.
+         * @return              2x2 block matrix of the Schur complement,
+         *                      \f$BD^{-1}\f$, \f$C\f$ and \f$D^{-1}\f$.
+         */
+        DNekScalBlkMatSharedPtr ParametricStaticCondBlk::GetStaticCondBlock(
+            const NekDouble lambda) const
+        {
+            const int nb = m_nbdry;
+            const int ni = m_nint;
+            int k;
+
+            unsigned int exp_size[] = {(unsigned int) nb, (unsigned int) ni};
+            DNekScalBlkMatSharedPtr returnval = MemoryManager<DNekScalBlkMat>
+                ::AllocateSharedPtr(2, 2, exp_size, exp_size);
+
+            DNekMatSharedPtr A = MemoryManager<DNekMat>::
+                AllocateSharedPtr(nb, nb);
+            DNekMatSharedPtr B = MemoryManager<DNekMat>::
+                AllocateSharedPtr(nb, ni);
+            DNekMatSharedPtr C = MemoryManager<DNekMat>::
+                AllocateSharedPtr(ni, nb);
+            DNekMatSharedPtr D = MemoryManager<DNekMat>::
+                AllocateSharedPtr(ni, ni);
+
+            // H_bb and H_ib
+            Vmath::Svtvp(nb*nb, lambda, m_Mbb.get(), 1, m_Lbb.get(), 1,
+                         A->GetRawPtr(), 1);
+            Vmath::Svtvp(ni*nb, lambda, m_Mib.get(), 1, m_Lib.get(), 1,
+                         C->GetRawPtr(), 1);
+
+            if (ni)
+            {
+                Array<OneD, NekDouble> d (ni);
+                Array<OneD, NekDouble> W (nb*ni);
+                Array<OneD, NekDouble> Z (ni*nb);
+                Array<OneD, NekDouble> Vd(ni*ni);
+
+                Vmath::Sadd(ni, lambda, m_mu.get(), 1, d.get(), 1);
+                Vmath::Sdiv(ni, 1.0, d.get(), 1, d.get(), 1);
+
+                // W = H_bi V diag(d), Z = V^T H_ib, Vd = V diag(d)
+                Vmath::Svtvp(nb*ni, lambda, m_MbiV.get(), 1, m_LbiV.get(), 1,
+                             W.get(), 1);
+                Vmath::Svtvp(ni*nb, lambda, m_VtMib.get(), 1,
+                             m_VtLib.get(), 1, Z.get(), 1);
+                for (k = 0; k < ni; ++k)
+                {
+                    Vmath::Smul(nb, d[k], W.get() + k*nb, 1,
+                                W.get() + k*nb, 1);
+                    Vmath::Smul(ni, d[k], m_V.get() + k*ni, 1,
+                                Vd.get() + k*ni, 1);
+                }
+
+                Blas::Dgemm('N', 'T', ni, ni, ni, 1.0, Vd.get(), ni,
+                            m_V.get(), ni, 0.0, D->GetRawPtr(), ni);
+
+                if (nb)
+                {
+                    Blas::Dgemm('N', 'T', nb, ni, ni, 1.0, W.get(), nb,
+                                m_V.get(), ni, 0.0, B->GetRawPtr(), nb);
+                    Blas::Dgemm('N', 'N', nb, nb, ni, -1.0, W.get(), nb,
+                                Z.get(), ni, 1.0, A->GetRawPtr(), nb);
+                }
+            }
+
+            NekDouble one = 1.0;
+            DNekScalMatSharedPtr Atmp;
+            returnval->SetBlock(0, 0, Atmp = MemoryManager<DNekScalMat>::
+                                    AllocateSharedPtr(one, A));
+            returnval->SetBlock(0, 1, Atmp = MemoryManager<DNekScalMat>::
+                                    AllocateSharedPtr(one, B));
+            returnval->SetBlock(1, 0, Atmp = MemoryManager<DNekScalMat>::
+                                    AllocateSharedPtr(one, C));
+            returnval->SetBlock(1, 1, Atmp = MemoryManager<DNekScalMat>::
+                                    AllocateSharedPtr(one, D));
+
+            return returnval;
+        }
+    }
+}
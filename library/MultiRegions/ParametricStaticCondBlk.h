@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: ParametricStaticCondBlk.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Static condensation blocks of an elemental Helmholtz matrix
+// for any Helmholtz constant
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_PARAMETRICSTATICCONDBLK_H
+#define NEKTAR_LIB_MULTIREGIONS_PARAMETRICSTATICCONDBLK_H
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
+#include <LocalRegions/Expansion.h>
+#include <LocalRegions/MatrixKey.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        class ParametricStaticCondBlk;
+
+        typedef boost::shared_ptr<ParametricStaticCondBlk>
+            ParametricStaticCondBlkSharedPtr;
+
+        /**
+         * Statically condensed blocks of the elemental Helmholtz matrix
+         * \f$H = L + \lambda M\f$ of one element, formed for any value of
+         * \f$\lambda\f$ from the mass and Laplacian matrices, which are kept
+         * separately. The interior blocks are diagonalised simultaneously
+         * once, \f$V^T M_{ii} V = I\f$ and \f$V^T L_{ii} V = \mathrm{diag}
+         * (\mu)\f$, so that \f$H_{ii}^{-1} = V\,\mathrm{diag}(1/(\mu +
+         * \lambda))\,V^T\f$. A new constant then only costs dense matrix
+         * products; no elemental matrix is regenerated and no interior block
+         * is factorised again.
+         */
+        class ParametricStaticCondBlk
+        {
+        public:
+            /// Split the mass and Laplacian matrices of the Helmholtz key
+            /// @a pKey on expansion @a pExp.
+            MULTI_REGIONS_EXPORT ParametricStaticCondBlk(
+                const LocalRegions::ExpansionSharedPtr &pExp,
+                const LocalRegions::MatrixKey          &pKey);
+
+            /// Static condensation blocks for the Helmholtz constant
+            /// @a lambda, laid out as by CreateStaticCondMatrix.
+            MULTI_REGIONS_EXPORT DNekScalBlkMatSharedPtr GetStaticCondBlock(
+                const NekDouble lambda) const;
+
+        private:
+            /// Number of boundary and interior modes.
+            int                    m_nbdry;
+            int                    m_nint;
+            /// Boundary-boundary blocks of L and M.
+            Array<OneD, NekDouble> m_Lbb;
+            Array<OneD, NekDouble> m_Mbb;
+            /// Interior-boundary blocks of L and M.
+            Array<OneD, NekDouble> m_Lib;
+            Array<OneD, NekDouble> m_Mib;
+            /// Eigenvalues \f$\mu\f$ and M-orthonormal eigenvectors \f$V\f$
+            /// of the interior blocks.
+            Array<OneD, NekDouble> m_mu;
+            Array<OneD, NekDouble> m_V;
+            /// \f$L_{bi}V\f$ and \f$M_{bi}V\f$.
+            Array<OneD, NekDouble> m_LbiV;
+            Array<OneD, NekDouble> m_MbiV;
+            /// \f$V^T L_{ib}\f$ and \f$V^T M_{ib}\f$.
+            Array<OneD, NekDouble> m_VtLib;
+            Array<OneD, NekDouble> m_VtMib;
+        };
+    }
+}
+
+#endif
@@ -42,7 +42,7 @@ namespace Nektar
 {
     namespace MultiRegions
     {
-        std::string Preconditioner::lookupIds[9] = {
+        std::string Preconditioner::lookupIds[10] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "Preconditioner", "Null", eNull),
             LibUtilities::SessionReader::RegisterEnumValue(
@@ -61,6 +61,10 @@ namespace Nektar
                 "Preconditioner", "Block",eBlock),
             LibUtilities::SessionReader::RegisterEnumValue(
                 "Preconditioner", "FullLinearSpaceWithBlock",eLinearWithBlock),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "Preconditioner", "PMultigrid",ePMultigrid),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "Preconditioner", "FullLinearSpaceAMG",eLinearAMG),
         };
         std::string Preconditioner::def =
             LibUtilities::SessionReader::RegisterDefaultSolverInfo(
@@ -78,7 +82,8 @@ namespace Nektar
             const AssemblyMapSharedPtr &pLocToGloMap)
             : m_linsys(plinsys),
               m_preconType(pLocToGloMap->GetPreconType()),
-              m_locToGloMap(pLocToGloMap)
+              m_locToGloMap(pLocToGloMap),
+              m_useSingle(false)
         {
         }
         
@@ -172,6 +177,16 @@ namespace Nektar
         {
 	}
 
+        /**
+         * By default the preconditioner is built again from scratch.
+         * Preconditioners which hold data depending only on the mesh and
+         * the local to global map override this to keep it.
+         */
+        void Preconditioner::v_UpdatePreconditioner()
+        {
+            v_BuildPreconditioner();
+        }
+
         /**
          * \brief Get block elemental transposed transformation matrix
          * \f$\mathbf{R}^{T}\f$
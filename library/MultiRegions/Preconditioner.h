@@ -103,6 +103,10 @@ namespace Nektar
 
 	    inline void BuildPreconditioner();
 
+            inline void UpdatePreconditioner();
+
+            inline void UseSinglePrecision(const bool pUse);
+
    	    inline void InitObject();
 
             Array<OneD, NekDouble> AssembleStaticCondGlobalDiagonals();
@@ -135,6 +139,11 @@ namespace Nektar
             boost::shared_ptr<AssemblyMap>      m_locToGloMap;
             LibUtilities::CommSharedPtr         m_comm;
 
+            /// Whether the solver currently applies its operator in single
+            /// precision, in which case a single-precision copy of the
+            /// preconditioner may be used
+            bool                                m_useSingle;
+
             virtual DNekScalBlkMatSharedPtr v_TransformedSchurCompl(
                 int offset, const boost::shared_ptr<DNekScalBlkMat > &loc_mat);
 
@@ -175,11 +184,24 @@ namespace Nektar
 
 	    virtual void v_BuildPreconditioner();
 
+            virtual void v_UpdatePreconditioner();
+
             static std::string lookupIds[];
             static std::string def;
 	};
         typedef boost::shared_ptr<Preconditioner>  PreconditionerSharedPtr;
 
+        /**
+         * Called by the iterative solver before each conjugate gradient
+         * solve, so that preconditioners holding single-precision copies of
+         * their blocks only apply these within the single-precision inner
+         * solves of a mixed-precision refinement.
+         */
+        inline void Preconditioner::UseSinglePrecision(const bool pUse)
+        {
+            m_useSingle = pUse;
+        }
+
         /**
          *
          */
@@ -275,6 +297,16 @@ namespace Nektar
         {
 	    v_BuildPreconditioner();
         }
+
+        /**
+         * Rebuild the preconditioner after the matrices of the linear system
+         * it was built for have changed, without changing the local to
+         * global map.
+         */
+        inline void Preconditioner::UpdatePreconditioner()
+        {
+            v_UpdatePreconditioner();
+        }
     }
 }
 
@@ -100,6 +100,16 @@ namespace Nektar
                 BlockPreconditioner3D();
             }
 
+            // Apply the preconditioner in single precision as part of a
+            // mixed-precision solve.
+            bool mixed;
+            expList->GetSession()->MatchSolverInfo(
+                "IterativeSolverPrecision", "Mixed", mixed, false);
+            if (mixed)
+            {
+                m_singleBlkMat = MemoryManager<SinglePrecisionBlkMat>
+                    ::AllocateSharedPtr(*m_blkMat);
+            }
         }
 
        /**
@@ -978,6 +988,13 @@ namespace Nektar
             int nDir    = m_locToGloMap->GetNumGlobalDirBndCoeffs();
             int nGlobal = m_locToGloMap->GetNumGlobalBndCoeffs();
             int nNonDir = nGlobal-nDir;
+
+            if (m_useSingle && m_singleBlkMat)
+            {
+                m_singleBlkMat->Multiply(pInput.get(), pOutput.get());
+                return;
+            }
+
             DNekBlkMat &M = (*m_blkMat);
             
             NekVector<NekDouble> r(nNonDir,pInput,eWrapper);
@@ -36,6 +36,7 @@
 #define NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERBLOCK_H
 #include <MultiRegions/GlobalLinSys.h>
 #include <MultiRegions/Preconditioner.h>
+#include <MultiRegions/SinglePrecisionBlkMat.h>
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
 #include <LocalRegions/TetExp.h>
@@ -82,6 +83,9 @@ namespace Nektar
 
 	    DNekBlkMatSharedPtr                         m_blkMat;
 
+            /// Single-precision copy of #m_blkMat for mixed-precision solves
+            SinglePrecisionBlkMatSharedPtr              m_singleBlkMat;
+
             boost::shared_ptr<AssemblyMap>              m_locToGloMap;
 
 	private:
@@ -37,6 +37,7 @@
 #include <MultiRegions/PreconditionerDiagonal.h>
 #include <MultiRegions/GlobalMatrixKey.h>
 #include <MultiRegions/GlobalLinSysIterativeStaticCond.h>
+#include <MultiRegions/GlobalLinSysIterativeMatrixFree.h>
 #include <math.h>
 
 namespace Nektar
@@ -78,6 +79,10 @@ namespace Nektar
             {
                 DiagonalPreconditionerSum();
             }
+            else if (solvertype == eIterativeMatrixFree)
+            {
+                MatrixFreeDiagonalPreconditionerSum();
+            }
             else if(solvertype == eIterativeStaticCond ||
                     solvertype == eIterativeMultiLevelStaticCond)
             {
@@ -151,6 +156,75 @@ namespace Nektar
              Vmath::Sdiv(nInt, 1.0, &vOutput[nDir], 1, &m_diagonals[0], 1);
          }
 
+        /**
+         * Diagonal preconditioner for the matrix-free solver. The local
+         * matrices are never formed; instead each column of the elemental
+         * operator is obtained by applying it to a unit vector, and only the
+         * entries contributing to the global diagonal are retained.
+         */
+        void PreconditionerDiagonal::MatrixFreeDiagonalPreconditionerSum()
+        {
+            GlobalLinSysIterativeMatrixFreeSharedPtr linsys =
+                boost::dynamic_pointer_cast<GlobalLinSysIterativeMatrixFree>(
+                    m_linsys.lock());
+            ASSERTL0(linsys, "Matrix-free diagonal preconditioner requires "
+                             "a matrix-free linear system.");
+
+            boost::shared_ptr<MultiRegions::ExpList> expList =
+                linsys->GetLocMat().lock();
+
+            int i,j,n,cnt,gid1,gid2,eid,ncoeffs;
+            NekDouble sign1,sign2;
+            int nGlobal = m_locToGloMap->GetNumGlobalCoeffs();
+            int nDir    = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int nInt    = nGlobal - nDir;
+
+            Array<OneD, NekDouble> vOutput(nGlobal,0.0);
+
+            int nElmt = expList->GetNumElmts();
+            for(n = cnt = 0; n < nElmt; ++n)
+            {
+                eid     = expList->GetOffset_Elmt_Id(n);
+                ncoeffs = expList->GetExp(eid)->GetNcoeffs();
+
+                Array<OneD, NekDouble> unit  (ncoeffs, 0.0);
+                Array<OneD, NekDouble> column(ncoeffs);
+
+                for(i = 0; i < ncoeffs; ++i)
+                {
+                    gid1 = m_locToGloMap->GetLocalToGlobalMap(cnt + i) - nDir;
+                    if(gid1 < 0)
+                    {
+                        continue;
+                    }
+                    sign1 = m_locToGloMap->GetLocalToGlobalSign(cnt + i);
+
+                    unit[i] = 1.0;
+                    linsys->ElmtMatrixOp(eid, unit, column);
+                    unit[i] = 0.0;
+
+                    for(j = 0; j < ncoeffs; ++j)
+                    {
+                        gid2 = m_locToGloMap->GetLocalToGlobalMap(cnt + j)
+                                                                    - nDir;
+                        if(gid2 == gid1)
+                        {
+                            sign2 = m_locToGloMap->GetLocalToGlobalSign(
+                                                                    cnt + j);
+                            vOutput[gid1 + nDir] += sign1*sign2*column[j];
+                        }
+                    }
+                }
+                cnt += ncoeffs;
+            }
+
+            // Assemble diagonal contributions across processes
+            m_locToGloMap->UniversalAssemble(vOutput);
+
+            m_diagonals = Array<OneD, NekDouble> (nInt);
+            Vmath::Sdiv(nInt, 1.0, &vOutput[nDir], 1, &m_diagonals[0], 1);
+        }
+
         /**
          * Diagonal preconditioner defined as the inverse of the main
 	 * diagonal of the Schur complement
@@ -188,7 +262,8 @@ namespace Nektar
             GlobalSysSolnType solvertype = 
                 m_locToGloMap->GetGlobalSysSolnType();            
 
-            int nGlobal = solvertype == eIterativeFull ?
+            int nGlobal = (solvertype == eIterativeFull ||
+                           solvertype == eIterativeMatrixFree) ?
                 m_locToGloMap->GetNumGlobalCoeffs() :
                 m_locToGloMap->GetNumGlobalBndCoeffs();
             int nDir    = m_locToGloMap->GetNumGlobalDirBndCoeffs();
@@ -82,6 +82,8 @@ namespace Nektar
 
             void DiagonalPreconditionerSum(void);
 
+            void MatrixFreeDiagonalPreconditionerSum(void);
+
 	    void StaticCondDiagonalPreconditionerSum(void);
 
             virtual void v_InitObject();
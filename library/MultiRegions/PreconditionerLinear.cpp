@@ -39,6 +39,7 @@
 #include <MultiRegions/GlobalLinSysIterativeStaticCond.h>
 #include <MultiRegions/GlobalLinSys.h>
 #include <MultiRegions/GlobalLinSysXxtFull.h>
+#include <MultiRegions/GlobalLinSysAMGFull.h>
 #include <LocalRegions/MatrixKey.h>
 #include <math.h>
 
@@ -55,6 +56,12 @@ namespace Nektar
                     "FullLinearSpace",
                     PreconditionerLinear::create,
                     "Full Linear space inverse Preconditioning");
+
+        string PreconditionerLinear::className2
+                = GetPreconFactory().RegisterCreatorFunction(
+                    "FullLinearSpaceAMG",
+                    PreconditionerLinear::create,
+                    "Full Linear space algebraic multigrid Preconditioning");
  
        /**
          * @class PreconditionerLinear
@@ -86,13 +93,43 @@ namespace Nektar
                 expList=((m_linsys.lock())->GetLocMat()).lock();
             m_vertLocToGloMap = m_locToGloMap->XxtLinearSpaceMap(*expList);
 
-            // Generate XXT system. 
+            BuildVertexSystem();
+	}
+
+        /**
+         * The linear space map only depends on the mesh, so only the vertex
+         * system is rebuilt for the new constant factors of the system.
+         */
+        void PreconditionerLinear::v_UpdatePreconditioner()
+        {
+            BuildVertexSystem();
+        }
+
+        /**
+         * Build the linear system in the space of the vertex modes, using
+         * the constant factors of the system being preconditioned.
+         */
+        void PreconditionerLinear::BuildVertexSystem()
+        {
+            boost::shared_ptr<MultiRegions::ExpList> 
+                expList=((m_linsys.lock())->GetLocMat()).lock();
+
             GlobalLinSysKey preconKey(StdRegions::ePreconLinearSpace,
                                       m_vertLocToGloMap,
                                       (m_linsys.lock())->GetKey().GetConstFactors());
 
-            m_vertLinsys = MemoryManager<GlobalLinSysXxtFull>::
-                AllocateSharedPtr(preconKey,expList,m_vertLocToGloMap);
+            if (m_preconType == eLinearAMG)
+            {
+                // Generate algebraic multigrid hierarchy.
+                m_vertLinsys = MemoryManager<GlobalLinSysAMGFull>::
+                    AllocateSharedPtr(preconKey,expList,m_vertLocToGloMap);
+            }
+            else
+            {
+                // Generate XXT system.
+                m_vertLinsys = MemoryManager<GlobalLinSysXxtFull>::
+                    AllocateSharedPtr(preconKey,expList,m_vertLocToGloMap);
+            }
 
 	}
 
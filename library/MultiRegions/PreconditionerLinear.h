@@ -65,6 +65,7 @@ namespace Nektar
 
             /// Name of class
             static std::string className1;
+            static std::string className2;
 
             MULTI_REGIONS_EXPORT PreconditionerLinear(
                          const boost::shared_ptr<GlobalLinSys> &plinsys,
@@ -94,6 +95,10 @@ namespace Nektar
 		      
             virtual void v_BuildPreconditioner();
 
+            virtual void v_UpdatePreconditioner();
+
+            void BuildVertexSystem();
+
         };
     }
 }
@@ -85,6 +85,15 @@ namespace Nektar
             m_blockPrecon->BuildPreconditioner();
 	}
 
+        /**
+         * The linear space preconditioner keeps its linear space map.
+         */
+        void PreconditionerLinearWithBlock::v_UpdatePreconditioner()
+        {
+            m_linSpacePrecon->UpdatePreconditioner();
+            m_blockPrecon->UpdatePreconditioner();
+        }
+
 
         /**
          *
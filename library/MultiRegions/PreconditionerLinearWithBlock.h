@@ -85,6 +85,8 @@ namespace Nektar
 
             virtual void v_BuildPreconditioner();
 
+            virtual void v_UpdatePreconditioner();
+
         };
     }
 }
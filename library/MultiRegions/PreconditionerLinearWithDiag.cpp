@@ -85,6 +85,15 @@ namespace Nektar
             m_diagonalPrecon->BuildPreconditioner();
 	}
 
+        /**
+         * The linear space preconditioner keeps its linear space map.
+         */
+        void PreconditionerLinearWithDiag::v_UpdatePreconditioner()
+        {
+            m_linSpacePrecon->UpdatePreconditioner();
+            m_diagonalPrecon->UpdatePreconditioner();
+        }
+
 
         /**
          *
@@ -113,6 +113,15 @@ namespace Nektar
             m_lowEnergyPrecon->BuildPreconditioner();
 	}
 
+        /**
+         * The linear space preconditioner keeps its linear space map.
+         */
+        void PreconditionerLinearWithLowEnergy::v_UpdatePreconditioner()
+        {
+            m_linSpacePrecon->UpdatePreconditioner();
+            m_lowEnergyPrecon->UpdatePreconditioner();
+        }
+
 
         /**
          *
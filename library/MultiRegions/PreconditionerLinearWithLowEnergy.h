@@ -96,6 +96,8 @@ namespace Nektar
 
             virtual void v_BuildPreconditioner();
 
+            virtual void v_UpdatePreconditioner();
+
         };
     }
 }
@@ -39,6 +39,7 @@
 #include <MultiRegions/GlobalLinSysIterativeStaticCond.h>
 #include <MultiRegions/GlobalLinSys.h>
 #include <LocalRegions/MatrixKey.h>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
 #include <math.h>
 
 namespace Nektar
@@ -129,7 +130,7 @@ namespace Nektar
 
             int vMap1, vMap2, sign1, sign2;
             int m, v, eMap1, eMap2, fMap1, fMap2;
-            int offset, globalrow, globalcol, nCoeffs;
+            int offset, globalrow, globalcol;
 
             // Periodic information
             PeriodicMap periodicVerts;
@@ -142,19 +143,6 @@ namespace Nektar
             MatrixStorage vertstorage = eDIAGONAL;
             MatrixStorage blkmatStorage = eDIAGONAL;
 
-            //local element static condensed matrices
-            DNekScalBlkMatSharedPtr loc_mat;
-            DNekScalMatSharedPtr    bnd_mat;
-
-            DNekMatSharedPtr    pRS;
-            DNekMatSharedPtr    pRSRT;
-
-            //Transformation matrices
-            DNekMat R;
-            DNekMat RT;
-            DNekMat RS;
-            DNekMat RSRT;
-            
             int nDirBnd = m_locToGloMap->GetNumGlobalDirBndCoeffs();
             int nNonDirVerts  = m_locToGloMap->GetNumNonDirVertexModes();
 
@@ -579,49 +567,42 @@ namespace Nektar
             m_RTBlk      = MemoryManager<DNekScalBlkMat>
                 ::AllocateSharedPtr(nbdry_size, nbdry_size , blkmatStorage);
             
+            //The elemental low energy matrices are computed concurrently,
+            //since each requires the statically condensed matrix of the
+            //element. Only a few elements per thread are held at a time, so
+            //that the memory needed does not grow with the mesh.
+            LibUtilities::ThreadPoolSharedPtr pool =
+                expList->GetMatrixSetupThreadPool();
+
+            const int chunk = 4*pool->GetNumThreads();
+            Array<OneD, DNekMatSharedPtr> elmtRSRT(chunk);
+
             //Here we loop over the expansion and build the block low energy
             //preconditioner as well as the block versions of the transformation
             //matrices.
             for(cnt=n=0; n < n_exp; ++n)
             {
+                if (n % chunk == 0)
+                {
+                    pool->ParallelFor(std::min(chunk, n_exp - n), boost::bind(
+                        &PreconditionerLowEnergy::SetupElmtLowEnergyMatrix,
+                        this, boost::ref(elmtRSRT), n, _1));
+                }
+
                 eid = expList->GetOffset_Elmt_Id(n);
                 
                 locExpansion = expList->GetExp(eid);
-                nCoeffs=locExpansion->NumBndryCoeffs();
                 LibUtilities::ShapeType eType=locExpansion->DetShapeType();
 
-                //Get correct transformation matrix for element type
-                R=(*(transmatrixmap[eType]));
-                RT=(*(transposedtransmatrixmap[eType]));
-                
-                pRS = MemoryManager<DNekMat>::AllocateSharedPtr
-                    (nCoeffs, nCoeffs, zero, storage);
-                RS = (*pRS);
-                
-                pRSRT = MemoryManager<DNekMat>::AllocateSharedPtr
-                    (nCoeffs, nCoeffs, zero, storage);
-                RSRT = (*pRSRT);
-                
                 nVerts=locExpansion->GetGeom()->GetNumVerts();
                 nEdges=locExpansion->GetGeom()->GetNumEdges();
                 nFaces=locExpansion->GetGeom()->GetNumFaces();
 
-                //Get statically condensed matrix
-                loc_mat = (m_linsys.lock())->GetStaticCondBlock(n);
-		
-                //Extract boundary block (elemental S1)
-                bnd_mat=loc_mat->GetBlock(0,0);
+                //Low energy matrix R*S*trans(R) of the element
+                DNekMat &RSRT = (*elmtRSRT[n % chunk]);
 
                 //offset by number of rows
-                offset = bnd_mat->GetRows();
-
-                DNekScalMat &S=(*bnd_mat);
-
-                //Calculate S*trans(R)  (note R is already transposed)
-                RS=R*S;
-
-                //Calculate R*S*trans(R)
-                RSRT=RS*RT;
+                offset = RSRT.GetRows();
 
                 //loop over vertices of the element and return the vertex map
                 //for each vertex
@@ -768,6 +749,9 @@ namespace Nektar
                 
                 //offset for the expansion
                 cnt+=offset;
+
+                //release the elemental low energy matrix
+                elmtRSRT[n % chunk] = DNekMatSharedPtr();
                 
                 //Here we build the block matrices for R and RT
                 m_RBlk->SetBlock(n,n, transmatrixmap[eType]);
@@ -881,6 +865,17 @@ namespace Nektar
                     m_BlkMat->SetBlock(i,i,tmp_mat);
                 }
             }
+
+            // Apply the preconditioner in single precision as part of a
+            // mixed-precision solve.
+            bool mixed;
+            expList->GetSession()->MatchSolverInfo(
+                "IterativeSolverPrecision", "Mixed", mixed, false);
+            if (mixed)
+            {
+                m_singleBlkMat = MemoryManager<SinglePrecisionBlkMat>
+                    ::AllocateSharedPtr(*m_BlkMat);
+            }
         }
             
         
@@ -895,6 +890,13 @@ namespace Nektar
             int nDir    = m_locToGloMap->GetNumGlobalDirBndCoeffs();
             int nGlobal = m_locToGloMap->GetNumGlobalBndCoeffs();
             int nNonDir = nGlobal-nDir;
+
+            if (m_useSingle && m_singleBlkMat)
+            {
+                m_singleBlkMat->Multiply(pInput.get(), pOutput.get());
+                return;
+            }
+
             DNekBlkMat &M = (*m_BlkMat);
                          
             NekVector<NekDouble> r(nNonDir,pInput,eWrapper);
@@ -904,6 +906,67 @@ namespace Nektar
 	}
         
 
+        /**
+         * Compute the elemental low energy matrix \f$RSR^T\f$ of element
+         * @a offset + @a i from its statically condensed matrix S, storing
+         * it in entry @a i of @a RSRT. This may be called concurrently for
+         * different elements.
+         */
+        void PreconditionerLowEnergy::SetupElmtLowEnergyMatrix(
+                  Array<OneD, DNekMatSharedPtr> &RSRT,
+            const unsigned int                   offset,
+            const unsigned int                   i)
+        {
+            boost::shared_ptr<MultiRegions::ExpList>
+                expList=((m_linsys.lock())->GetLocMat()).lock();
+
+            const unsigned int n = offset + i;
+            int eid = expList->GetOffset_Elmt_Id(n);
+
+            //Get correct transformation matrix for element type
+            DNekScalMatSharedPtr pR, pRT;
+            switch (expList->GetExp(eid)->DetShapeType())
+            {
+                case LibUtilities::eTetrahedron:
+                    pR = m_Rtet;   pRT = m_RTtet;
+                    break;
+                case LibUtilities::ePrism:
+                    pR = m_Rprism; pRT = m_RTprism;
+                    break;
+                case LibUtilities::eHexahedron:
+                    pR = m_Rhex;   pRT = m_RThex;
+                    break;
+                default:
+                    ASSERTL0(false, "Element type not supported by the low "
+                                    "energy preconditioner");
+            }
+
+            //Get statically condensed matrix and extract the boundary
+            //block (elemental S1)
+            DNekScalBlkMatSharedPtr loc_mat
+                = (m_linsys.lock())->GetStaticCondBlock(n);
+            DNekScalMatSharedPtr bnd_mat = loc_mat->GetBlock(0,0);
+            unsigned int nCoeffs = bnd_mat->GetRows();
+
+            DNekScalMat &S  = (*bnd_mat);
+            DNekScalMat &R  = (*pR);
+            DNekScalMat &RT = (*pRT);
+
+            DNekMatSharedPtr pRS = MemoryManager<DNekMat>::AllocateSharedPtr
+                (nCoeffs, nCoeffs, 0.0, eFULL);
+            RSRT[i] = MemoryManager<DNekMat>::AllocateSharedPtr
+                (nCoeffs, nCoeffs, 0.0, eFULL);
+
+            DNekMat &RS = (*pRS);
+
+            //Calculate S*trans(R)  (note R is already transposed)
+            RS = R*S;
+
+            //Calculate R*S*trans(R)
+            (*RSRT[i]) = RS*RT;
+        }
+
+
        /**
         * Set a block transformation matrices for each element type. These are
         * needed in routines that transform the schur complement matrix to and
@@ -36,6 +36,7 @@
 #define NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERLOWENERGY_H
 #include <MultiRegions/GlobalLinSys.h>
 #include <MultiRegions/Preconditioner.h>
+#include <MultiRegions/SinglePrecisionBlkMat.h>
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
 #include <LocalRegions/TetExp.h>
@@ -80,6 +81,7 @@ namespace Nektar
             boost::shared_ptr<AssemblyMap> m_locToGloMap;
 
 	    DNekBlkMatSharedPtr     m_BlkMat;
+            SinglePrecisionBlkMatSharedPtr m_singleBlkMat;
             DNekScalMatSharedPtr    m_bnd_mat;
 
             DNekScalBlkMatSharedPtr m_RBlk;
@@ -114,6 +116,11 @@ namespace Nektar
 
             void SetupBlockTransformationMatrix(void);
 
+            void SetupElmtLowEnergyMatrix(
+                      Array<OneD, DNekMatSharedPtr> &RSRT,
+                const unsigned int                   offset,
+                const unsigned int                   i);
+
             void ModifyPrismTransformationMatrix(
                 LocalRegions::TetExpSharedPtr TetExp,
                 LocalRegions::PrismExpSharedPtr PrismExp,
@@ -0,0 +1,755 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerPMultigrid.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Polynomial multigrid preconditioner definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/VDmathArray.hpp>
+#include <MultiRegions/PreconditionerPMultigrid.h>
+#include <MultiRegions/GlobalLinSysIterative.h>
+#include <MultiRegions/GlobalMatrixKey.h>
+#include <LocalRegions/MatrixKey.h>
+#include <math.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Registers the class with the Factory.
+         */
+        string PreconditionerPMultigrid::className
+                = GetPreconFactory().RegisterCreatorFunction(
+                    "PMultigrid",
+                    PreconditionerPMultigrid::create,
+                    "Polynomial multigrid preconditioning");
+
+        std::string PreconditionerPMultigrid::smootherdef =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "PMultigridSmoother",
+                "Chebyshev");
+        std::string PreconditionerPMultigrid::smootherlookupIds[2] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "PMultigridSmoother",
+                "Jacobi",
+                MultiRegions::ePMultigridJacobi),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "PMultigridSmoother",
+                "Chebyshev",
+                MultiRegions::ePMultigridChebyshev),
+        };
+
+        /**
+         * @class PreconditionerPMultigrid
+         *
+         * This class implements a polynomial multigrid V-cycle as a
+         * preconditioner for the statically condensed conjugate gradient
+         * solver.
+         *
+         * The boundary modes of the modified (hierarchical) expansion bases
+         * are nested: the space spanned by the modes of polynomial degree at
+         * most \f$p\f$ is exactly the boundary space of an order \f$p\f$
+         * expansion. The coarse levels are therefore obtained by restricting
+         * the Schur complement to the modes of degree at most \f$p_l\f$, with
+         * \f$p_{l+1} = p_l/2\f$, so that the restriction and prolongation
+         * operators reduce to injection. The Galerkin operator \f$R_l^T A
+         * R_l\f$ of a coarse level is formed from the rows and columns of the
+         * elemental Schur complements belonging to the retained modes, so
+         * that a sweep on a coarse level only costs as much as the size of
+         * that level. Each level but the coarsest is
+         * smoothed using either damped Jacobi or Chebyshev iteration on the
+         * Jacobi-scaled operator, and the coarsest (linear) level is solved
+         * using the linear space solve of PreconditionerLinear.
+         *
+         * Both smoothers are symmetric and the same number of pre- and
+         * post-smoothing sweeps is used, so the resulting V-cycle is a
+         * symmetric positive definite preconditioner.
+         */
+        PreconditionerPMultigrid::PreconditionerPMultigrid(
+            const boost::shared_ptr<GlobalLinSys> &plinsys,
+            const AssemblyMapSharedPtr &pLocToGloMap)
+            : Preconditioner(plinsys, pLocToGloMap)
+        {
+        }
+
+        /**
+         *
+         */
+        void PreconditionerPMultigrid::v_InitObject()
+        {
+            GlobalSysSolnType solvertype=m_locToGloMap->GetGlobalSysSolnType();
+            ASSERTL0(solvertype == MultiRegions::eIterativeStaticCond,
+                     "PMultigrid preconditioning is only implemented for "
+                     "the IterativeStaticCond solver");
+
+            LibUtilities::SessionReaderSharedPtr session
+                = m_linsys.lock()->GetLocMat().lock()->GetSession();
+
+            m_smoother = session->GetSolverInfoAsEnum<PMultigridSmootherType>(
+                "PMultigridSmoother");
+            session->LoadParameter("PMultigridSmoothingSteps",
+                                   m_smoothingSteps, 2);
+
+            // The Chebyshev smoother damps the eigenmodes of the
+            // Jacobi-scaled operator in [lambdaMax/ratio, lambdaMax] and
+            // leaves the lower part of the spectrum to the coarser levels.
+            // Halving the order between levels removes most of the modes of
+            // a level, so the interval has to reach well below lambdaMax; a
+            // larger ratio damps a wider range of modes at the cost of a
+            // smaller reduction per sweep. Values between 10 and 30 are
+            // usual for polynomial smoothers in multigrid.
+            session->LoadParameter("PMultigridChebyshevRatio",
+                                   m_chebyshevRatio, 15.0);
+            ASSERTL0(m_chebyshevRatio > 1.0,
+                     "PMultigridChebyshevRatio must be larger than one");
+
+            m_linSpacePrecon = GetPreconFactory().CreateInstance(
+                "FullLinearSpace",m_linsys.lock(),m_locToGloMap);
+        }
+
+        /**
+         *
+         */
+        void PreconditionerPMultigrid::v_BuildPreconditioner()
+        {
+            m_comm = m_linsys.lock()->GetLocMat().lock()
+                ->GetComm()->GetRowComm();
+            m_map  = m_locToGloMap->GetGlobalToUniversalBndMapUnique();
+
+            m_linSpacePrecon->BuildPreconditioner();
+
+            SetupDofDegrees();
+            SetupInverseDiagonal();
+            SetupLevels();
+        }
+
+        /**
+         * The degrees of the boundary modes and the linear space map are
+         * kept; the diagonal, the level spectra and the coarse level solve
+         * depend on the operator and are computed again.
+         */
+        void PreconditionerPMultigrid::v_UpdatePreconditioner()
+        {
+            m_linSpacePrecon->UpdatePreconditioner();
+
+            SetupInverseDiagonal();
+            SetupLevels();
+        }
+
+        /**
+         * Determine the polynomial degree of every non-Dirichlet global
+         * boundary degree of freedom. Vertex modes are linear, the k-th
+         * interior mode of an edge has degree k+2 and the interior modes of a
+         * face are assigned the total degree of the corresponding
+         * tensor-product (quadrilateral faces) or collapsed (triangular faces)
+         * mode.
+         */
+        void PreconditionerPMultigrid::SetupDofDegrees()
+        {
+            boost::shared_ptr<MultiRegions::ExpList>
+                expList=((m_linsys.lock())->GetLocMat()).lock();
+            StdRegions::StdExpansionSharedPtr locExpansion;
+
+            int nGlobBnd = m_locToGloMap->GetNumGlobalBndCoeffs();
+            int nDir     = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir  = nGlobBnd - nDir;
+            int i, j, k, n, cnt, gid;
+
+            Array<OneD, unsigned int> map;
+            Array<OneD, int>          sign;
+
+            m_dofDegree = Array<OneD, int>(nNonDir, 0);
+
+            for (n = 0; n < expList->GetExpSize(); ++n)
+            {
+                locExpansion = expList->GetExp(n);
+                cnt          = expList->GetCoeff_Offset(n);
+
+                int nDim = locExpansion->GetShapeDimension();
+                ASSERTL0(nDim > 1, "PMultigrid preconditioning requires a "
+                                   "two- or three-dimensional expansion");
+
+                // The levels rely on the nesting of the boundary modes of
+                // the hierarchical modified basis.
+                for (i = 0; i < nDim; ++i)
+                {
+                    LibUtilities::BasisType btype
+                        = locExpansion->GetBasisType(i);
+                    ASSERTL0(btype == LibUtilities::eModified_A ||
+                             btype == LibUtilities::eModified_B ||
+                             btype == LibUtilities::eModified_C,
+                             "PMultigrid preconditioning requires a modified "
+                             "(hierarchical) expansion basis");
+                }
+
+                Array<OneD, int> degree(locExpansion->GetNcoeffs(), 0);
+
+                for (i = 0; i < locExpansion->GetNverts(); ++i)
+                {
+                    degree[locExpansion->GetVertexMap(i)] = 1;
+                }
+
+                for (i = 0; i < locExpansion->GetNedges(); ++i)
+                {
+                    locExpansion->GetEdgeInteriorMap(
+                        i, StdRegions::eForwards, map, sign);
+
+                    for (j = 0; j < map.num_elements(); ++j)
+                    {
+                        degree[map[j]] = j + 2;
+                    }
+                }
+
+                if (nDim == 3)
+                {
+                    for (i = 0; i < locExpansion->GetNfaces(); ++i)
+                    {
+                        int nFaceInt = locExpansion->GetFaceIntNcoeffs(i);
+                        int nFace    = locExpansion->GetFaceNcoeffs(i);
+
+                        if (nFaceInt == 0)
+                        {
+                            continue;
+                        }
+
+                        locExpansion->GetFaceInteriorMap(
+                            i, StdRegions::eDir1FwdDir1_Dir2FwdDir2,
+                            map, sign);
+
+                        int nq = (int) (sqrt((NekDouble) nFaceInt) + 0.5);
+
+                        if (nq*nq == nFaceInt && (nq+2)*(nq+2) == nFace)
+                        {
+                            // Quadrilateral face: interior modes are
+                            // stored row by row.
+                            for (j = 0; j < nFaceInt; ++j)
+                            {
+                                degree[map[j]] = max(j / nq, j % nq) + 2;
+                            }
+                        }
+                        else
+                        {
+                            // Triangular face: interior modes are stored in
+                            // rows of decreasing length.
+                            int len = 0;
+                            while (len*(len+1)/2 < nFaceInt)
+                            {
+                                ++len;
+                            }
+
+                            int a = 0, b = 0;
+                            for (j = 0; j < nFaceInt; ++j)
+                            {
+                                degree[map[j]] = a + b + 3;
+                                if (++b >= len - a)
+                                {
+                                    b = 0;
+                                    a = min(a + 1, len - 1);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                for (k = 0; k < locExpansion->GetNcoeffs(); ++k)
+                {
+                    if (degree[k] == 0)
+                    {
+                        continue;
+                    }
+
+                    gid = m_locToGloMap->GetLocalToGlobalMap(cnt + k) - nDir;
+
+                    if (gid >= 0 && gid < nNonDir)
+                    {
+                        m_dofDegree[gid] = max(m_dofDegree[gid], degree[k]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Define the polynomial order of each level, halving the order from
+         * the maximum order of the expansion down to the linear space, form
+         * the operators of the coarse levels and estimate the largest
+         * eigenvalue of the Jacobi-scaled operator on each smoothed level.
+         */
+        void PreconditionerPMultigrid::SetupLevels()
+        {
+            int nNonDir = m_dofDegree.num_elements();
+            int i, l;
+
+            int maxDegree = 1;
+            for (i = 0; i < nNonDir; ++i)
+            {
+                maxDegree = max(maxDegree, m_dofDegree[i]);
+            }
+            m_comm->AllReduce(maxDegree, LibUtilities::ReduceMax);
+
+            // Modes whose degree could not be determined are only retained
+            // on the finest level.
+            for (i = 0; i < nNonDir; ++i)
+            {
+                if (m_dofDegree[i] == 0)
+                {
+                    m_dofDegree[i] = maxDegree;
+                }
+            }
+
+            m_levelOrder.clear();
+            m_levelOrder.push_back(maxDegree);
+            while (m_levelOrder.back() > 1)
+            {
+                m_levelOrder.push_back(max(1, m_levelOrder.back() / 2));
+            }
+
+            int nLevels = m_levelOrder.size();
+            m_levelMask.resize(nLevels);
+            m_levelLambdaMax.assign(nLevels, 0.0);
+            m_levelBlocks.assign(nLevels, Array<OneD, NekDouble>());
+            m_levelRows.assign(nLevels, Array<OneD, int>());
+            m_levelBndMap.assign(nLevels, Array<OneD, int>());
+            m_levelBndSign.assign(nLevels, Array<OneD, NekDouble>());
+
+            for (l = 0; l < nLevels; ++l)
+            {
+                m_levelMask[l] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                for (i = 0; i < nNonDir; ++i)
+                {
+                    if (m_dofDegree[i] <= m_levelOrder[l])
+                    {
+                        m_levelMask[l][i] = 1.0;
+                    }
+                }
+            }
+
+            // The finest level uses the operator of the linear system and
+            // the coarsest level the linear space solve.
+            for (l = 1; l < nLevels - 1; ++l)
+            {
+                SetupLevelOperator(l);
+            }
+
+            for (l = 0; l < nLevels - 1; ++l)
+            {
+                m_levelLambdaMax[l] = EstimateLambdaMax(l);
+            }
+        }
+
+        /**
+         * Extract the rows and columns of the elemental Schur complements
+         * belonging to the non-Dirichlet modes retained on level @a level.
+         * Since restriction is injection, the assembly of these blocks is
+         * the Galerkin operator \f$R_l^T A R_l\f$ of the level.
+         */
+        void PreconditionerPMultigrid::SetupLevelOperator(const int level)
+        {
+            boost::shared_ptr<GlobalLinSys> linsys = m_linsys.lock();
+            int nDir   = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int nBlks  = linsys->GetNumBlocks();
+            int i, j, n, cnt, gid, nRows;
+
+            DNekScalBlkMatSharedPtr loc_mat;
+            DNekScalMatSharedPtr    bnd_mat;
+            vector<vector<int> >    rows(nBlks);
+            int nBndTot = 0, nBlkTot = 0;
+
+            // Select the retained rows of each elemental block.
+            for (cnt = n = 0; n < nBlks; ++n)
+            {
+                bnd_mat = linsys->GetStaticCondBlock(n)->GetBlock(0, 0);
+                nRows   = bnd_mat->GetRows();
+
+                for (i = 0; i < nRows; ++i)
+                {
+                    gid = m_locToGloMap->GetLocalToGlobalBndMap(cnt + i)
+                        - nDir;
+                    if (gid >= 0 && m_levelMask[level][gid] > 0.0)
+                    {
+                        rows[n].push_back(i);
+                    }
+                }
+
+                nBndTot += rows[n].size();
+                nBlkTot += rows[n].size() * rows[n].size();
+                cnt     += nRows;
+            }
+
+            Array<OneD, NekDouble> blocks (nBlkTot);
+            Array<OneD, int>       nrows  (nBlks);
+            Array<OneD, int>       bndMap (nBndTot);
+            Array<OneD, NekDouble> bndSign(nBndTot);
+            int bndOff = 0, blkOff = 0;
+
+            for (cnt = n = 0; n < nBlks; ++n)
+            {
+                loc_mat = linsys->GetStaticCondBlock(n);
+                bnd_mat = loc_mat->GetBlock(0, 0);
+                nRows   = rows[n].size();
+                nrows[n] = nRows;
+
+                for (i = 0; i < nRows; ++i)
+                {
+                    bndMap [bndOff + i] = m_locToGloMap->
+                        GetLocalToGlobalBndMap (cnt + rows[n][i]) - nDir;
+                    bndSign[bndOff + i] = m_locToGloMap->
+                        GetLocalToGlobalBndSign(cnt + rows[n][i]);
+
+                    for (j = 0; j < nRows; ++j)
+                    {
+                        blocks[blkOff + j*nRows + i]
+                            = (*bnd_mat)(rows[n][i], rows[n][j]);
+                    }
+                }
+
+                bndOff += nRows;
+                blkOff += nRows*nRows;
+                cnt    += bnd_mat->GetRows();
+            }
+
+            m_levelBlocks [level] = blocks;
+            m_levelRows   [level] = nrows;
+            m_levelBndMap [level] = bndMap;
+            m_levelBndSign[level] = bndSign;
+        }
+
+        /**
+         * Assemble the inverse of the diagonal of the global Schur complement,
+         * which is used to scale the smoothers.
+         */
+        void PreconditionerPMultigrid::SetupInverseDiagonal()
+        {
+            int nGlobBnd = m_locToGloMap->GetNumGlobalBndCoeffs();
+            int nDir     = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir  = nGlobBnd - nDir;
+
+            Array<OneD, NekDouble> vOutput(nGlobBnd, 0.0);
+            Array<OneD, NekDouble> diagonals
+                = AssembleStaticCondGlobalDiagonals();
+
+            Vmath::Vcopy(nNonDir, &diagonals[0], 1, &vOutput[nDir], 1);
+
+            // Assemble diagonal contributions across processes
+            m_locToGloMap->UniversalAssembleBnd(vOutput);
+
+            m_invDiag = Array<OneD, NekDouble>(nNonDir);
+            Vmath::Sdiv(nNonDir, 1.0, &vOutput[nDir], 1, &m_invDiag[0], 1);
+        }
+
+        /**
+         * Estimate the largest eigenvalue of \f$D^{-1}A_l\f$ using a few
+         * steps of the power method. The estimate is enlarged by a safety
+         * factor since the power method approaches the eigenvalue from below.
+         */
+        NekDouble PreconditionerPMultigrid::EstimateLambdaMax(const int level)
+        {
+            int nNonDir = m_dofDegree.num_elements();
+            int nIter   = 10;
+
+            Array<OneD, NekDouble> x(nNonDir);
+            Array<OneD, NekDouble> y(nNonDir);
+            NekDouble lambda = 1.0;
+            NekDouble norm;
+
+            Vmath::Vcopy(nNonDir, m_levelMask[level], 1, x, 1);
+
+            for (int i = 0; i < nIter; ++i)
+            {
+                norm = sqrt(GlobalDot(x, x));
+                if (norm < NekConstants::kNekZeroTol)
+                {
+                    break;
+                }
+                Vmath::Smul(nNonDir, 1.0/norm, x, 1, x, 1);
+
+                ApplyLevelOperator(level, x, y);
+                Vmath::Vmul(nNonDir, m_invDiag, 1, y, 1, y, 1);
+
+                lambda = sqrt(GlobalDot(y, y));
+                Vmath::Vcopy(nNonDir, y, 1, x, 1);
+            }
+
+            return 1.1 * lambda;
+        }
+
+        /**
+         * Evaluate \f$R_l A R_l^T x\f$, the Schur complement restricted to
+         * the modes retained on level @a level. The finest level uses the
+         * matrix multiplication of the underlying iterative linear system
+         * and the coarse levels the restricted elemental blocks built by
+         * SetupLevelOperator.
+         */
+        void PreconditionerPMultigrid::ApplyLevelOperator(
+            const int                          level,
+            const Array<OneD, NekDouble>      &pInput,
+                  Array<OneD, NekDouble>      &pOutput)
+        {
+            int nGlobBnd = m_locToGloMap->GetNumGlobalBndCoeffs();
+            int nDir     = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir  = nGlobBnd - nDir;
+
+            Array<OneD, NekDouble> in (nGlobBnd, 0.0);
+            Array<OneD, NekDouble> out(nGlobBnd, 0.0);
+
+            if (level == 0)
+            {
+                Vmath::Vmul(nNonDir, &pInput[0], 1, &m_levelMask[level][0], 1,
+                            &in[nDir], 1);
+
+                GetIterativeLinSys()->DoMatrixMultiply(in, out);
+            }
+            else
+            {
+                const Array<OneD, const NekDouble> &blocks
+                                                = m_levelBlocks [level];
+                const Array<OneD, const int>       &nrows
+                                                = m_levelRows   [level];
+                const Array<OneD, const int>       &bndMap
+                                                = m_levelBndMap [level];
+                const Array<OneD, const NekDouble> &bndSign
+                                                = m_levelBndSign[level];
+                int nBnd = bndMap.num_elements();
+                int n, bndOff, blkOff;
+
+                Array<OneD, NekDouble> loc_in (nBnd);
+                Array<OneD, NekDouble> loc_out(nBnd);
+
+                Vmath::Gathr(nBnd, &bndSign[0], &pInput[0], &bndMap[0],
+                             &loc_in[0]);
+
+                for (n = bndOff = blkOff = 0; n < nrows.num_elements(); ++n)
+                {
+                    const int rows = nrows[n];
+                    if (rows > 0)
+                    {
+                        Blas::Dgemv('N', rows, rows, 1.0,
+                                    blocks.get() + blkOff, rows,
+                                    loc_in.get() + bndOff, 1, 0.0,
+                                    loc_out.get() + bndOff, 1);
+                    }
+                    bndOff += rows;
+                    blkOff += rows*rows;
+                }
+
+                Vmath::Assmb(nBnd, &bndSign[0], &loc_out[0], &bndMap[0],
+                             &out[nDir]);
+
+                // Assemble contributions across processes
+                m_locToGloMap->UniversalAssembleBnd(out);
+            }
+
+            Vmath::Vmul(nNonDir, &out[nDir], 1, &m_levelMask[level][0], 1,
+                        &pOutput[0], 1);
+        }
+
+        /**
+         * Perform #m_smoothingSteps sweeps of the selected smoother on the
+         * system \f$A_l x = b\f$, updating @a pSoln in place.
+         */
+        void PreconditionerPMultigrid::Smooth(
+            const int                          level,
+            const Array<OneD, NekDouble>      &pRhs,
+                  Array<OneD, NekDouble>      &pSoln)
+        {
+            int nNonDir = m_dofDegree.num_elements();
+            const Array<OneD, const NekDouble> &mask = m_levelMask[level];
+            NekDouble lambdaMax = m_levelLambdaMax[level];
+            int k;
+
+            Array<OneD, NekDouble> r(nNonDir);
+            Array<OneD, NekDouble> d(nNonDir);
+
+            // r = b - A x
+            ApplyLevelOperator(level, pSoln, r);
+            Vmath::Vsub(nNonDir, pRhs, 1, r, 1, r, 1);
+            Vmath::Vmul(nNonDir, mask, 1, r, 1, r, 1);
+
+            switch (m_smoother)
+            {
+                case ePMultigridJacobi:
+                {
+                    NekDouble omega = 4.0/(3.0*lambdaMax);
+                    for (k = 0; k < m_smoothingSteps; ++k)
+                    {
+                        // x = x + omega D^{-1} r
+                        Vmath::Vmul(nNonDir, m_invDiag, 1, r, 1, d, 1);
+                        Vmath::Svtvp(nNonDir, omega, d, 1, pSoln, 1, pSoln, 1);
+
+                        if (k < m_smoothingSteps - 1)
+                        {
+                            ApplyLevelOperator(level, pSoln, r);
+                            Vmath::Vsub(nNonDir, pRhs, 1, r, 1, r, 1);
+                        }
+                    }
+                    break;
+                }
+                case ePMultigridChebyshev:
+                {
+                    // Target the upper part of the spectrum, leaving the
+                    // smooth components to the coarser levels.
+                    NekDouble lambdaMin = lambdaMax / m_chebyshevRatio;
+                    NekDouble theta     = 0.5 * (lambdaMax + lambdaMin);
+                    NekDouble delta     = 0.5 * (lambdaMax - lambdaMin);
+                    NekDouble sigma     = theta / delta;
+                    NekDouble rho       = 1.0 / sigma;
+                    NekDouble rhoNew;
+
+                    Array<OneD, NekDouble> Ad(nNonDir);
+
+                    // d = D^{-1} r / theta
+                    Vmath::Vmul(nNonDir, m_invDiag, 1, r, 1, d, 1);
+                    Vmath::Smul(nNonDir, 1.0/theta, d, 1, d, 1);
+
+                    for (k = 0; k < m_smoothingSteps; ++k)
+                    {
+                        Vmath::Vadd(nNonDir, d, 1, pSoln, 1, pSoln, 1);
+
+                        if (k == m_smoothingSteps - 1)
+                        {
+                            break;
+                        }
+
+                        // r = r - A d
+                        ApplyLevelOperator(level, d, Ad);
+                        Vmath::Vsub(nNonDir, r, 1, Ad, 1, r, 1);
+
+                        // d = rho_{k+1} rho_k d + 2 rho_{k+1}/delta D^{-1} r
+                        rhoNew = 1.0 / (2.0*sigma - rho);
+                        Vmath::Vmul(nNonDir, m_invDiag, 1, r, 1, Ad, 1);
+                        Vmath::Smul(nNonDir, rhoNew*rho, d, 1, d, 1);
+                        Vmath::Svtvp(nNonDir, 2.0*rhoNew/delta, Ad, 1,
+                                     d, 1, d, 1);
+                        rho = rhoNew;
+                    }
+                    break;
+                }
+                default:
+                    ASSERTL0(false, "Unknown PMultigridSmoother");
+                    break;
+            }
+
+            Vmath::Vmul(nNonDir, mask, 1, pSoln, 1, pSoln, 1);
+        }
+
+        /**
+         * Recursively apply the V-cycle starting at level @a level with a
+         * zero initial guess.
+         */
+        void PreconditionerPMultigrid::VCycle(
+            const int                          level,
+            const Array<OneD, NekDouble>      &pRhs,
+                  Array<OneD, NekDouble>      &pSoln)
+        {
+            int nNonDir = m_dofDegree.num_elements();
+
+            Vmath::Zero(nNonDir, pSoln, 1);
+
+            // Coarsest level: linear space solve.
+            if (level == (int) m_levelOrder.size() - 1)
+            {
+                Array<OneD, NekDouble> zero(nNonDir, 0.0);
+                m_linSpacePrecon->DoPreconditionerWithNonVertOutput(
+                    pRhs, pSoln, zero);
+                return;
+            }
+
+            Array<OneD, NekDouble> r (nNonDir);
+            Array<OneD, NekDouble> e (nNonDir);
+
+            // Pre-smoothing
+            Smooth(level, pRhs, pSoln);
+
+            // Restrict the residual by injection onto the next level.
+            ApplyLevelOperator(level, pSoln, r);
+            Vmath::Vsub(nNonDir, pRhs, 1, r, 1, r, 1);
+            Vmath::Vmul(nNonDir, m_levelMask[level+1], 1, r, 1, r, 1);
+
+            // Coarse grid correction
+            VCycle(level + 1, r, e);
+            Vmath::Vadd(nNonDir, e, 1, pSoln, 1, pSoln, 1);
+
+            // Post-smoothing
+            Smooth(level, pRhs, pSoln);
+        }
+
+        /**
+         *
+         */
+        void PreconditionerPMultigrid::v_DoPreconditioner(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            GlobalSysSolnType solvertype=m_locToGloMap->GetGlobalSysSolnType();
+            switch(solvertype)
+            {
+                case MultiRegions::eIterativeStaticCond:
+                {
+                    VCycle(0, pInput, pOutput);
+                }
+                break;
+            default:
+                ASSERTL0(0,"Unsupported solver type");
+                break;
+            }
+        }
+
+        /**
+         * Inner product of two vectors of non-Dirichlet boundary degrees of
+         * freedom, summed across all processes.
+         */
+        NekDouble PreconditionerPMultigrid::GlobalDot(
+            const Array<OneD, const NekDouble> &pIn1,
+            const Array<OneD, const NekDouble> &pIn2)
+        {
+            int nDir    = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir = m_dofDegree.num_elements();
+
+            NekDouble val = Vmath::Dot2(nNonDir, pIn1, pIn2, m_map + nDir);
+            m_comm->AllReduce(val, Nektar::LibUtilities::ReduceSum);
+            return val;
+        }
+
+        /**
+         *
+         */
+        boost::shared_ptr<GlobalLinSysIterative>
+            PreconditionerPMultigrid::GetIterativeLinSys()
+        {
+            boost::shared_ptr<GlobalLinSysIterative> linsys =
+                boost::dynamic_pointer_cast<GlobalLinSysIterative>(
+                    m_linsys.lock());
+            ASSERTL1(linsys, "PMultigrid preconditioner requires an "
+                             "iterative linear system");
+            return linsys;
+        }
+    }
+}
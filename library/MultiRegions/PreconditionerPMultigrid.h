@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerPMultigrid.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Polynomial multigrid preconditioner header
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERPMULTIGRID_H
+#define NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERPMULTIGRID_H
+
+#include <MultiRegions/GlobalLinSys.h>
+#include <MultiRegions/Preconditioner.h>
+#include <MultiRegions/PreconditionerLinear.h>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        class GlobalLinSysIterative;
+
+        enum PMultigridSmootherType
+        {
+            ePMultigridJacobi,
+            ePMultigridChebyshev
+        };
+
+        const char* const PMultigridSmootherTypeMap[] =
+        {
+            "Jacobi",
+            "Chebyshev"
+        };
+
+        class PreconditionerPMultigrid;
+        typedef boost::shared_ptr<PreconditionerPMultigrid>
+            PreconditionerPMultigridSharedPtr;
+
+        class PreconditionerPMultigrid: public Preconditioner
+        {
+        public:
+            /// Creates an instance of this class
+            static PreconditionerSharedPtr create(
+                        const boost::shared_ptr<GlobalLinSys> &plinsys,
+                        const boost::shared_ptr<AssemblyMap>
+                        &pLocToGloMap)
+            {
+                PreconditionerSharedPtr p = MemoryManager<
+                    PreconditionerPMultigrid>::AllocateSharedPtr(
+                        plinsys,pLocToGloMap);
+                p->InitObject();
+                return p;
+            }
+
+            /// Name of class
+            static std::string className;
+
+            MULTI_REGIONS_EXPORT PreconditionerPMultigrid(
+                         const boost::shared_ptr<GlobalLinSys> &plinsys,
+                         const AssemblyMapSharedPtr &pLocToGloMap);
+
+            MULTI_REGIONS_EXPORT
+            virtual ~PreconditionerPMultigrid() {}
+
+        protected:
+            /// Coarsest (linear space) level solve.
+            PreconditionerSharedPtr                     m_linSpacePrecon;
+            /// Polynomial degree of each non-Dirichlet boundary dof.
+            Array<OneD, int>                            m_dofDegree;
+            /// Polynomial order of each level, finest first.
+            std::vector<int>                            m_levelOrder;
+            /// Indicator of the dofs retained on each level.
+            std::vector<Array<OneD, NekDouble> >        m_levelMask;
+            /// Upper bound on the spectrum of the Jacobi-scaled operator
+            /// restricted to each level.
+            std::vector<NekDouble>                      m_levelLambdaMax;
+            /// Elemental Schur complements restricted to the modes of each
+            /// coarse level, stored contiguously in column-major order.
+            std::vector<Array<OneD, NekDouble> >        m_levelBlocks;
+            /// Number of rows of each restricted elemental block.
+            std::vector<Array<OneD, int> >              m_levelRows;
+            /// Non-Dirichlet global boundary id of each row of the
+            /// restricted elemental blocks.
+            std::vector<Array<OneD, int> >              m_levelBndMap;
+            /// Sign of each row of the restricted elemental blocks.
+            std::vector<Array<OneD, NekDouble> >        m_levelBndSign;
+            /// Inverse of the assembled Schur complement diagonal.
+            Array<OneD, NekDouble>                      m_invDiag;
+            /// Universal unique map used for parallel inner products.
+            Array<OneD, const int>                      m_map;
+            /// Smoother used on all but the coarsest level.
+            PMultigridSmootherType                      m_smoother;
+            /// Number of pre- and post-smoothing sweeps per level.
+            int                                         m_smoothingSteps;
+            /// Ratio of the upper to the lower end of the spectrum targeted
+            /// by the Chebyshev smoother.
+            NekDouble                                   m_chebyshevRatio;
+
+        private:
+            void SetupDofDegrees();
+
+            void SetupLevels();
+
+            void SetupInverseDiagonal();
+
+            void SetupLevelOperator(const int level);
+
+            NekDouble EstimateLambdaMax(const int level);
+
+            void ApplyLevelOperator(
+                const int                          level,
+                const Array<OneD, NekDouble>      &pInput,
+                      Array<OneD, NekDouble>      &pOutput);
+
+            void Smooth(
+                const int                          level,
+                const Array<OneD, NekDouble>      &pRhs,
+                      Array<OneD, NekDouble>      &pSoln);
+
+            void VCycle(
+                const int                          level,
+                const Array<OneD, NekDouble>      &pRhs,
+                      Array<OneD, NekDouble>      &pSoln);
+
+            NekDouble GlobalDot(
+                const Array<OneD, const NekDouble> &pIn1,
+                const Array<OneD, const NekDouble> &pIn2);
+
+            boost::shared_ptr<GlobalLinSysIterative> GetIterativeLinSys();
+
+            virtual void v_InitObject();
+
+            virtual void v_DoPreconditioner(
+                      const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput);
+
+            virtual void v_BuildPreconditioner();
+
+            virtual void v_UpdatePreconditioner();
+
+            static std::string smootherdef;
+            static std::string smootherlookupIds[];
+        };
+    }
+}
+
+#endif
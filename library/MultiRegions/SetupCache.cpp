@@ -0,0 +1,201 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SetupCache.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Binary on-disk cache of solver setup data
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/SetupCache.h>
+#include <LibUtilities/BasicUtils/FileSystem.h>
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstdio>
+#include <boost/functional/hash.hpp>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /// Identifier at the start of a setup cache file.
+        static const char setupCacheMagic[8] =
+            {'N','E','K','S','E','T','U','P'};
+        /// Version of the setup cache file format.
+        static const int  setupCacheVersion = 1;
+
+        SetupCache::SetupCache(
+            const std::string &cacheDir,
+            const std::string &prefix)
+            : m_cacheDir(cacheDir),
+              m_prefix  (prefix),
+              m_pos     (0)
+        {
+        }
+
+        std::string SetupCache::GetFileName() const
+        {
+            size_t hash = 0;
+            boost::hash_range(hash, m_intKey.begin(),  m_intKey.end());
+            boost::hash_range(hash, m_realKey.begin(), m_realKey.end());
+
+            std::stringstream name;
+            name << m_prefix << "_" << std::hex << hash << ".bin";
+            return LibUtilities::PortablePath(
+                fs::path(m_cacheDir) / name.str());
+        }
+
+        /**
+         * @returns     True if an entry with the same key was found and read
+         *              completely.
+         */
+        bool SetupCache::Load()
+        {
+            m_data.clear();
+            m_pos = 0;
+
+            if (!IsEnabled())
+            {
+                return false;
+            }
+
+            std::ifstream in(GetFileName().c_str(), std::ios::binary);
+            if (!in.good())
+            {
+                return false;
+            }
+
+            char   magic[8];
+            int    header[3];
+            size_t nData;
+            in.read(magic, sizeof(magic));
+            in.read(reinterpret_cast<char*>(header), sizeof(header));
+            in.read(reinterpret_cast<char*>(&nData), sizeof(nData));
+            if (!in.good() ||
+                !std::equal(magic, magic + 8, setupCacheMagic) ||
+                header[0] != setupCacheVersion ||
+                header[1] != (int)m_intKey.size() ||
+                header[2] != (int)m_realKey.size())
+            {
+                return false;
+            }
+
+            std::vector<int>       intKey (m_intKey.size());
+            std::vector<NekDouble> realKey(m_realKey.size());
+            if (!intKey.empty())
+            {
+                in.read(reinterpret_cast<char*>(&intKey[0]),
+                        intKey.size() * sizeof(int));
+            }
+            if (!realKey.empty())
+            {
+                in.read(reinterpret_cast<char*>(&realKey[0]),
+                        realKey.size() * sizeof(NekDouble));
+            }
+
+            // Floating point values are compared bitwise, as they are
+            // written and read without conversion.
+            if (!in.good() || intKey != m_intKey ||
+                (!realKey.empty() &&
+                 std::memcmp(&realKey[0], &m_realKey[0],
+                             realKey.size() * sizeof(NekDouble)) != 0))
+            {
+                return false;
+            }
+
+            m_data.resize(nData);
+            if (nData > 0)
+            {
+                in.read(&m_data[0], nData);
+            }
+
+            // Reject a truncated file.
+            if (in.fail() || in.peek() != std::ifstream::traits_type::eof())
+            {
+                m_data.clear();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * The file is written under a temporary name and renamed, so that
+         * concurrent runs, or processes with identical partitions, never
+         * read a partial file. Failure to write is not fatal.
+         */
+        void SetupCache::Save() const
+        {
+            if (!IsEnabled())
+            {
+                return;
+            }
+
+            std::string filename = GetFileName();
+            std::string tmpName  =
+                filename + fs::unique_path(".%%%%-%%%%-%%%%").string();
+
+            std::ofstream out(tmpName.c_str(), std::ios::binary);
+            if (!out.good())
+            {
+                return;
+            }
+
+            int    header[3] = { setupCacheVersion, (int)m_intKey.size(),
+                                 (int)m_realKey.size() };
+            size_t nData     = m_data.size();
+            out.write(setupCacheMagic, sizeof(setupCacheMagic));
+            out.write(reinterpret_cast<const char*>(header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(&nData), sizeof(nData));
+            if (!m_intKey.empty())
+            {
+                out.write(reinterpret_cast<const char*>(&m_intKey[0]),
+                          m_intKey.size() * sizeof(int));
+            }
+            if (!m_realKey.empty())
+            {
+                out.write(reinterpret_cast<const char*>(&m_realKey[0]),
+                          m_realKey.size() * sizeof(NekDouble));
+            }
+            if (nData > 0)
+            {
+                out.write(&m_data[0], nData);
+            }
+            out.close();
+
+            if (out.fail() ||
+                std::rename(tmpName.c_str(), filename.c_str()) != 0)
+            {
+                std::remove(tmpName.c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SetupCache.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Binary on-disk cache of solver setup data
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_SETUPCACHE_H
+#define NEKTAR_LIB_MULTIREGIONS_SETUPCACHE_H
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * A file in the setup cache directory (solver info SetupCacheDir)
+         * holding data which is expensive to compute during the setup of a
+         * solver. Each entry is identified by a key which describes all the
+         * inputs to the computation. The key is stored alongside the data and
+         * compared in full when the file is read, so a hash collision or a
+         * file left by a different mesh, expansion or set of solver
+         * parameters is never used. Files are named by the prefix and a hash
+         * of the key.
+         *
+         * Data is appended to a buffer with Put and written by Save; Load
+         * reads the buffer back, after which Get returns the values in the
+         * order in which they were put. Only plain data types are supported.
+         */
+        class SetupCache
+        {
+        public:
+            /// Cache entries are only read or written if @a cacheDir is
+            /// not empty.
+            MULTI_REGIONS_EXPORT SetupCache(
+                const std::string &cacheDir,
+                const std::string &prefix);
+
+            bool IsEnabled() const
+            {
+                return !m_cacheDir.empty();
+            }
+
+            /// Append @a n values to the integer part of the key.
+            template<typename T>
+            void AddKey(const T *vals, const size_t n)
+            {
+                m_intKey.insert(m_intKey.end(), vals, vals + n);
+            }
+
+            void AddKey(const int val)
+            {
+                m_intKey.push_back(val);
+            }
+
+            /// Append @a n values to the floating point part of the key.
+            void AddKey(const NekDouble *vals, const size_t n)
+            {
+                m_realKey.insert(m_realKey.end(), vals, vals + n);
+            }
+
+            void AddKey(const NekDouble val)
+            {
+                m_realKey.push_back(val);
+            }
+
+            /// Read the entry for the current key into the buffer.
+            MULTI_REGIONS_EXPORT bool Load();
+
+            /// Write the buffer as the entry for the current key.
+            MULTI_REGIONS_EXPORT void Save() const;
+
+            template<typename T>
+            void Put(const T &val)
+            {
+                Put(&val, 1);
+            }
+
+            template<typename T>
+            void Put(const T *vals, const size_t n)
+            {
+                const char *p = reinterpret_cast<const char*>(vals);
+                m_data.insert(m_data.end(), p, p + n * sizeof(T));
+            }
+
+            /// Append the size and the entries of @a vals.
+            template<typename T>
+            void PutArray(const Array<OneD, T> &vals)
+            {
+                Put(static_cast<unsigned int>(vals.num_elements()));
+                Put(vals.get(), vals.num_elements());
+            }
+
+            template<typename T>
+            bool Get(T &val)
+            {
+                return Get(&val, 1);
+            }
+
+            template<typename T>
+            bool Get(T *vals, const size_t n)
+            {
+                if (m_pos + n * sizeof(T) > m_data.size())
+                {
+                    return false;
+                }
+                if (n > 0)
+                {
+                    std::memcpy(vals, &m_data[m_pos], n * sizeof(T));
+                }
+                m_pos += n * sizeof(T);
+                return true;
+            }
+
+            /// Read an array written by PutArray, reallocating @a vals.
+            template<typename T>
+            bool GetArray(Array<OneD, T> &vals)
+            {
+                unsigned int n;
+                if (!Get(n) || m_pos + n * sizeof(T) > m_data.size())
+                {
+                    return false;
+                }
+                vals = Array<OneD, T>(n);
+                return Get(vals.get(), n);
+            }
+
+            /// True if all data read by Load has been returned by Get.
+            bool AtEnd() const
+            {
+                return m_pos == m_data.size();
+            }
+
+        private:
+            std::string            m_cacheDir;
+            std::string            m_prefix;
+            std::vector<int>       m_intKey;
+            std::vector<NekDouble> m_realKey;
+            std::vector<char>      m_data;
+            size_t                 m_pos;
+
+            std::string GetFileName() const;
+        };
+    }
+}
+
+#endif
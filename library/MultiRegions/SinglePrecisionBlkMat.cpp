@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SinglePrecisionBlkMat.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Single-precision copy of a block-diagonal matrix
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/SinglePrecisionBlkMat.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Each block is applied column by column so that the inner loop
+         * runs over contiguous single-precision entries and accumulates
+         * into the double-precision output.
+         *
+         * @param   pIn         Input vector with as many entries as the
+         *                      matrix has columns.
+         * @param   pOut        Output vector with as many entries as the
+         *                      matrix has rows.
+         */
+        void SinglePrecisionBlkMat::Multiply(
+            const NekDouble *pIn,
+                  NekDouble *pOut) const
+        {
+            const float *a = m_data.empty() ? 0 : &m_data[0];
+
+            for (unsigned int n = 0; n < m_rows.num_elements(); ++n)
+            {
+                const unsigned int rows = m_rows[n];
+                const unsigned int cols = m_cols[n];
+
+                if (m_isDiag[n])
+                {
+                    for (unsigned int i = 0; i < rows; ++i)
+                    {
+                        pOut[i] = a[i] * pIn[i];
+                    }
+                    a += rows;
+                }
+                else
+                {
+                    for (unsigned int i = 0; i < rows; ++i)
+                    {
+                        pOut[i] = 0.0;
+                    }
+                    for (unsigned int j = 0; j < cols; ++j, a += rows)
+                    {
+                        const NekDouble x = pIn[j];
+                        for (unsigned int i = 0; i < rows; ++i)
+                        {
+                            pOut[i] += a[i] * x;
+                        }
+                    }
+                }
+
+                pIn  += cols;
+                pOut += rows;
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SinglePrecisionBlkMat.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Single-precision copy of a block-diagonal matrix
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_SINGLEPRECISIONBLKMAT_H
+#define NEKTAR_LIB_MULTIREGIONS_SINGLEPRECISIONBLKMAT_H
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
+
+#include <vector>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        class SinglePrecisionBlkMat;
+
+        typedef boost::shared_ptr<SinglePrecisionBlkMat>
+            SinglePrecisionBlkMatSharedPtr;
+
+        /**
+         * Block-diagonal matrix whose entries are stored in single precision.
+         * Products with double-precision vectors are accumulated in double
+         * precision, so only the rounding of the matrix entries is lost
+         * while the bytes read per product are halved. Blocks stored as
+         * diagonal matrices keep only their diagonal.
+         */
+        class SinglePrecisionBlkMat
+        {
+        public:
+            /// Copy the diagonal blocks of a (scaled) block matrix.
+            template<typename TBlkMat>
+            SinglePrecisionBlkMat(const TBlkMat &pMat)
+            {
+                unsigned int n, nBlk = pMat.GetNumberOfBlockRows();
+                ASSERTL0(nBlk == pMat.GetNumberOfBlockColumns(),
+                         "Block matrix is not block-diagonal.");
+
+                m_rows   = Array<OneD, unsigned int>(nBlk);
+                m_cols   = Array<OneD, unsigned int>(nBlk);
+                m_isDiag = Array<OneD, bool>        (nBlk, false);
+
+                size_t size = 0;
+                for (n = 0; n < nBlk; ++n)
+                {
+                    m_rows[n] = pMat.GetNumberOfRowsInBlockRow(n);
+                    m_cols[n] = pMat.GetNumberOfColumnsInBlockColumn(n);
+
+                    if (m_rows[n] && m_cols[n] &&
+                        pMat.GetBlock(n, n)->GetStorageType() == eDIAGONAL)
+                    {
+                        m_isDiag[n] = true;
+                        size       += m_rows[n];
+                    }
+                    else
+                    {
+                        size       += m_rows[n] * m_cols[n];
+                    }
+                }
+
+                m_data.resize(size, 0.0f);
+
+                size_t offset = 0;
+                for (n = 0; n < nBlk; ++n)
+                {
+                    if (m_rows[n] == 0 || m_cols[n] == 0)
+                    {
+                        continue;
+                    }
+
+                    const unsigned int rows = m_rows[n];
+                    const unsigned int cols = m_cols[n];
+
+                    if (m_isDiag[n])
+                    {
+                        for (unsigned int i = 0; i < rows; ++i)
+                        {
+                            m_data[offset + i] =
+                                (float)(*pMat.GetBlock(n, n))(i, i);
+                        }
+                        offset += rows;
+                    }
+                    else
+                    {
+                        for (unsigned int j = 0; j < cols; ++j)
+                        {
+                            for (unsigned int i = 0; i < rows; ++i)
+                            {
+                                m_data[offset + j*rows + i] =
+                                    (float)(*pMat.GetBlock(n, n))(i, j);
+                            }
+                        }
+                        offset += rows * cols;
+                    }
+                }
+            }
+
+            /// Compute \a pOut = M \a pIn.
+            MULTI_REGIONS_EXPORT void Multiply(
+                const NekDouble *pIn,
+                      NekDouble *pOut) const;
+
+            /// Number of bytes held by the matrix entries.
+            size_t GetStorageBytes() const
+            {
+                return m_data.size() * sizeof(float);
+            }
+
+        private:
+            /// Matrix entries, block by block in column-major order.
+            std::vector<float>         m_data;
+            /// Rows of each block.
+            Array<OneD, unsigned int>  m_rows;
+            /// Columns of each block.
+            Array<OneD, unsigned int>  m_cols;
+            /// Whether only the diagonal of each block is stored.
+            Array<OneD, bool>          m_isDiag;
+        };
+    }
+}
+
+#endif
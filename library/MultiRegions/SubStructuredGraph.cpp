@@ -35,6 +35,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <MultiRegions/SubStructuredGraph.h>
+#include <MultiRegions/SetupCache.h>
 #include <LibUtilities/BasicUtils/Metis.hpp>
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 
@@ -859,13 +860,53 @@ namespace Nektar
             }
         }
 
+        /**
+         * Reads the METIS reordering and its separator tree from @a cache,
+         * whose key holds the graph passed to METIS.
+         *
+         * @returns     True if a matching entry was found.
+         */
+        static bool ReadReorderingCache(
+                  SetupCache       &cache,
+            const int               nVerts,
+                  Array<OneD, int> &iperm,
+                  Array<OneD, int> &septree)
+        {
+            Array<OneD, int> ipermTmp;
+            Array<OneD, int> septreeTmp;
+            if (!cache.Load()                 ||
+                !cache.GetArray(ipermTmp)     ||
+                !cache.GetArray(septreeTmp)   ||
+                !cache.AtEnd()                ||
+                ipermTmp.num_elements() != nVerts)
+            {
+                return false;
+            }
+
+            // Reject a corrupt permutation.
+            Array<OneD, int> seen(nVerts, 0);
+            for (int i = 0; i < nVerts; ++i)
+            {
+                if (ipermTmp[i] < 0 || ipermTmp[i] >= nVerts ||
+                    seen[ipermTmp[i]]++)
+                {
+                    return false;
+                }
+            }
+
+            Vmath::Vcopy(nVerts, ipermTmp, 1, iperm, 1);
+            septree = septreeTmp;
+            return true;
+        }
+
         void MultiLevelBisectionReordering(
             const BoostGraph                    &graph,
             Array<OneD, int>                    &perm,
             Array<OneD, int>                    &iperm,
             BottomUpSubStructuredGraphSharedPtr &substructgraph,
             std::set<int>                        partVerts,
-            int                                  mdswitch)
+            int                                  mdswitch,
+            const std::string                   &cacheDir)
         {
             int nGraphVerts = boost::num_vertices(graph);
             int nGraphEdges = boost::num_edges   (graph);
@@ -968,40 +1009,72 @@ namespace Nektar
                     xadj[++vcnt] = acnt;
                 }
                 
-                // Step 2: use metis to reorder the dofs. We do not know on
-                // forehand the size of the separator tree that METIS will
-                // return, so we just assume a really big value and try with
-                // that
-                int sizeSeparatorTree = nGraphVerts*10;
-                Array<OneD,int> septreeTmp(sizeSeparatorTree,-1);  
-                
-                // The separator tree returned by metis has the following
-                // structure: It is a one dimensional array and information per
-                // level is contained per 5 elements:
-                //
-                // m_septree[i*5 + 0]: the level of recursion (top-level = 1)
-                // m_septree[i*5 + 1]: is this substructure a left or right
-                //                     branch? 1 = left branch, 2 = right branch
-                // m_septree[i*5 + 2]: the number of 'interior' DOFs in left 
-                //                     branch
-                // m_septree[i*5 + 3]: the number of 'interior' DOFs in right 
-                //                     branch
-                // m_septree[i*5 + 4]: the number of 'boundary' DOFs     
-                
-                // Now try to call Call METIS.
-                try
+                // Step 2: use metis to reorder the dofs. The result only
+                // depends on the graph passed to METIS, so if a cache
+                // directory is given, a previous run on the same graph can
+                // provide it instead.
+                Array<OneD,int> septree;
+                SetupCache      cache(cacheDir, "reordering");
+                if (cache.IsEnabled())
                 {
-                    Metis::as_onmetis(
-                        nNonPartition,xadj,adjncy,perm_tmp,iperm_tmp,
-                        septreeTmp, mdswitch);
+                    cache.AddKey(nNonPartition);
+                    cache.AddKey(mdswitch);
+                    cache.AddKey(xadj.get(),   nNonPartition + 1);
+                    cache.AddKey(adjncy.get(), acnt);
                 }
-                catch(...)
+
+                if (!ReadReorderingCache(cache, nNonPartition,
+                                         iperm_tmp, septree))
                 {
-                    NEKERROR(ErrorUtil::efatal,
-                             "Error in calling metis (the size of the separator"
-                             " tree might not be sufficient)");
+                    // We do not know on forehand the size of the separator
+                    // tree that METIS will return, so we just assume a
+                    // really big value and try with that
+                    int sizeSeparatorTree = nGraphVerts*10;
+                    Array<OneD,int> septreeTmp(sizeSeparatorTree,-1);
+
+                    // The separator tree returned by metis has the following
+                    // structure: It is a one dimensional array and
+                    // information per level is contained per 5 elements:
+                    //
+                    // m_septree[i*5 + 0]: the level of recursion (top-level
+                    //                     = 1)
+                    // m_septree[i*5 + 1]: is this substructure a left or
+                    //                     right branch? 1 = left branch,
+                    //                     2 = right branch
+                    // m_septree[i*5 + 2]: the number of 'interior' DOFs in
+                    //                     left branch
+                    // m_septree[i*5 + 3]: the number of 'interior' DOFs in
+                    //                     right branch
+                    // m_septree[i*5 + 4]: the number of 'boundary' DOFs
+
+                    // Now try to call Call METIS.
+                    try
+                    {
+                        Metis::as_onmetis(
+                            nNonPartition,xadj,adjncy,perm_tmp,iperm_tmp,
+                            septreeTmp, mdswitch);
+                    }
+                    catch(...)
+                    {
+                        NEKERROR(ErrorUtil::efatal,
+                                 "Error in calling metis (the size of the "
+                                 "separator tree might not be sufficient)");
+                    }
+
+                    // Post-process the separator tree
+                    int trueSizeSepTree = 0;
+                    for (i = 0; septreeTmp[i] != -1; i++)
+                    {
+                        trueSizeSepTree++;
+                    }
+                    septree = Array<OneD,int>(trueSizeSepTree);
+                    Vmath::Vcopy(trueSizeSepTree,septreeTmp,1,septree,1);
+
+                    cache.PutArray(iperm_tmp);
+                    cache.PutArray(septree);
+                    cache.Save();
                 }
-                
+
                 // Change permutations from METIS to account for initial offset.
                 for (i = 0; i < nGraphVerts; ++i)
                 {
@@ -1025,15 +1098,6 @@ namespace Nektar
                              "Perm error " + boost::lexical_cast<std::string>(i));
                 }
                 
-                // Post-process the separator tree
-                int trueSizeSepTree = 0;
-                for (i = 0; septreeTmp[i] != -1; i++)
-                {
-                    trueSizeSepTree++;
-                }
-                Array<OneD,int> septree(trueSizeSepTree);
-                Vmath::Vcopy(trueSizeSepTree,septreeTmp,1,septree,1);
-                
                 // Based upon the separator tree, where are going to set up an
                 // object of the class BottomUpSubStructuredGraph. The
                 // constructor will read the separatortree and will interprete
@@ -44,6 +44,7 @@
 
 #include <vector>
 #include <set>
+#include <string>
 #include <boost/config.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/cuthill_mckee_ordering.hpp>
@@ -263,7 +264,8 @@ namespace Nektar
             Array<OneD, int>                    &iperm,
             BottomUpSubStructuredGraphSharedPtr &substructgraph,
             std::set<int>                        partVerts = std::set<int>(),
-            int                                  mdswitch  = 1);
+            int                                  mdswitch  = 1,
+            const std::string                   &cacheDir  = std::string());
         
         // The parameter MDSWITCH.
         //
@@ -101,6 +101,29 @@ namespace Nektar
                 }
             }
 
+            // Store forwards/backwards space along trace space
+            Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
+            Array<OneD, MultiRegions::ExpListSharedPtr> convFields(
+                nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > convIn (nConvectiveFields);
+
+            for(i = 0; i < nConvectiveFields; ++i)
+            {
+                Fwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
+                Bwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
+                numflux[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
+                convFields[i] = fields [i];
+                convIn    [i] = inarray[i];
+            }
+
+            // Extract the traces of all fields together and start exchanging
+            // them between processes, so that the exchange is overlapped with
+            // the volume terms below.
+            fields[0]->MultiGetFwdBwdTracePhysStart(
+                convFields, convIn, Fwd, Bwd);
+
             ASSERTL1(m_riemann,
                      "Riemann solver must be provided for AdvectionWeakDG.");
 
@@ -119,18 +142,7 @@ namespace Nektar
                 }
             }
 
-            // Store forwards/backwards space along trace space
-            Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
-            Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
-            Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
-
-            for(i = 0; i < nConvectiveFields; ++i)
-            {
-                Fwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                Bwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                numflux[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
-            }
+            fields[0]->MultiGetFwdBwdTracePhysFinish();
 
             m_riemann->Solve(Fwd, Bwd, numflux);
 
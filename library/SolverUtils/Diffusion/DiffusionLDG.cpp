@@ -164,11 +164,19 @@ namespace Nektar
             int nvariables = fields.num_elements();
             int nDim       = uflux.num_elements();
             
-            Array<OneD, NekDouble > Fwd     (nTracePts);
-            Array<OneD, NekDouble > Bwd     (nTracePts);
+            Array<OneD, Array<OneD, NekDouble> > Fwd(nvariables);
+            Array<OneD, Array<OneD, NekDouble> > Bwd(nvariables);
             Array<OneD, NekDouble > Vn      (nTracePts, 0.0);
             Array<OneD, NekDouble > fluxtemp(nTracePts, 0.0);
 
+            // Compute Fwd and Bwd value of ufield for all variables at once
+            for (i = 0; i < nvariables; ++i)
+            {
+                Fwd[i] = Array<OneD, NekDouble>(nTracePts);
+                Bwd[i] = Array<OneD, NekDouble>(nTracePts);
+            }
+            fields[0]->MultiGetFwdBwdTracePhys(fields, ufield, Fwd, Bwd);
+
             // Get the normal velocity Vn
             for(i = 0; i < nDim; ++i)
             {
@@ -183,9 +191,6 @@ namespace Nektar
             {
                 for (i = 0; i < nvariables ; ++i)
                 {
-                    // Compute Fwd and Bwd value of ufield of i direction
-                    fields[i]->GetFwdBwdTracePhys(ufield[i], Fwd, Bwd);
-                    
                     // if Vn >= 0, flux = uFwd, i.e.,
                     // edge::eForward, if V*n>=0 <=> V*n_F>=0, pick uflux = uFwd
                     // edge::eBackward, if V*n>=0 <=> V*n_B<0, pick uflux = uFwd
@@ -195,7 +200,7 @@ namespace Nektar
                     // edge::eBackward, if V*n<0 <=> V*n_B>=0, pick uflux = uBwd
                     
                     fields[i]->GetTrace()->Upwind(/*m_traceNormals[j]*/Vn, 
-                                                    Fwd, Bwd, fluxtemp);
+                                                    Fwd[i], Bwd[i], fluxtemp);
                     
                     // Imposing weak boundary condition with flux
                     // if Vn >= 0, uflux = uBwd at Neumann, i.e.,
@@ -304,13 +309,32 @@ namespace Nektar
             int nDim       = qfield.num_elements();
             
             NekDouble C11 = 0.0;
-            Array<OneD, NekDouble > Fwd(nTracePts);
-            Array<OneD, NekDouble > Bwd(nTracePts);
             Array<OneD, NekDouble > Vn (nTracePts, 0.0);
-            
-            Array<OneD, NekDouble > qFwd     (nTracePts);
-            Array<OneD, NekDouble > qBwd     (nTracePts);
             Array<OneD, NekDouble > qfluxtemp(nTracePts, 0.0);
+
+            // Compute Fwd and Bwd values of each direction of qfield and of
+            // ufield for all variables, exchanging them in one operation.
+            // Entry j*nvariables+i holds qfield[j][i] and entry
+            // nDim*nvariables+i holds ufield[i].
+            int nTraces = (nDim+1)*nvariables;
+            Array<OneD, MultiRegions::ExpListSharedPtr> traceFields(nTraces);
+            Array<OneD, Array<OneD, NekDouble> > traceIn (nTraces);
+            Array<OneD, Array<OneD, NekDouble> > traceFwd(nTraces);
+            Array<OneD, Array<OneD, NekDouble> > traceBwd(nTraces);
+
+            for (j = 0; j <= nDim; ++j)
+            {
+                for (i = 0; i < nvariables; ++i)
+                {
+                    int n = j*nvariables + i;
+                    traceFields[n] = fields[i];
+                    traceIn    [n] = j < nDim ? qfield[j][i] : ufield[i];
+                    traceFwd   [n] = Array<OneD, NekDouble>(nTracePts);
+                    traceBwd   [n] = Array<OneD, NekDouble>(nTracePts);
+                }
+            }
+            fields[0]->MultiGetFwdBwdTracePhys(
+                traceFields, traceIn, traceFwd, traceBwd);
             
             Array<OneD, NekDouble > uterm(nTracePts);
             
@@ -338,9 +362,15 @@ namespace Nektar
                 qflux[i] = Array<OneD, NekDouble> (nTracePts, 0.0);
                 for (j = 0; j < nDim; ++j)
                 {
-                    //  Compute Fwd and Bwd value of ufield of jth direction
-                    fields[i]->GetFwdBwdTracePhys(qfield[j][i], qFwd, qBwd);
-                    
+                    const Array<OneD, NekDouble> &qFwd =
+                        traceFwd[j*nvariables + i];
+                    const Array<OneD, NekDouble> &qBwd =
+                        traceBwd[j*nvariables + i];
+                    const Array<OneD, NekDouble> &Fwd =
+                        traceFwd[nDim*nvariables + i];
+                    const Array<OneD, NekDouble> &Bwd =
+                        traceBwd[nDim*nvariables + i];
+
                     // if Vn >= 0, flux = uFwd, i.e.,
                     // edge::eForward, if V*n>=0 <=> V*n_F>=0, pick 
                     // qflux = qBwd = q+
@@ -363,8 +393,6 @@ namespace Nektar
                                 qfluxtemp, 1);
                     
                     // Generate Stability term = - C11 ( u- - u+ )
-                    fields[i]->GetFwdBwdTracePhys(ufield[i], Fwd, Bwd);
-                    
                     Vmath::Vsub(nTracePts, 
                                 Fwd, 1, Bwd, 1, 
                                 uterm, 1);
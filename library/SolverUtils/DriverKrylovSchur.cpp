@@ -0,0 +1,708 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File DriverKrylovSchur.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Driver for eigenvalue analysis using the Krylov-Schur
+//              method.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <iomanip>
+#include <algorithm>
+
+#include <SolverUtils/DriverKrylovSchur.h>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        string DriverKrylovSchur::className = GetDriverFactory().RegisterCreatorFunction("KrylovSchur", DriverKrylovSchur::create);
+        string DriverKrylovSchur::driverLookupId = LibUtilities::SessionReader::RegisterEnumValue("Driver","KrylovSchur",0);
+
+        /**
+         * @class DriverKrylovSchur
+         *
+         * Computes the leading eigenvalues of the evolution operator with
+         * the Krylov-Schur method of Stewart (2001). The projection of the
+         * operator onto a basis of at most kdim vectors is kept in real
+         * Schur form. When the basis is full, the Ritz values of largest
+         * magnitude are moved to the top of the Schur form and the basis is
+         * truncated to its first nkeep vectors. DriverModifiedArnoldi
+         * instead drops the oldest vector of the sequence.
+         *
+         * Schur vectors whose residual falls below evtol, relative to their
+         * Ritz value, are locked. Later restarts do not change them, and
+         * new vectors are only orthogonalised against them. Each
+         * application of the operator costs one time-stepper integration.
+         * The parameter nits bounds the total number of applications.
+         *
+         * If the parameter KrylovCheckpointSteps is positive, the Krylov
+         * state is written to disk every KrylovCheckpointSteps restarts.
+         * It is also written when nits is reached. Setting the solver info
+         * KrylovRestart to True resumes from that file. The number of
+         * processes and the discretisation must be unchanged.
+         */
+
+        /**
+         *
+         */
+        DriverKrylovSchur::DriverKrylovSchur(
+            const LibUtilities::SessionReaderSharedPtr        pSession)
+            : DriverModifiedArnoldi(pSession)
+        {
+        }
+
+
+        /**
+         *
+         */
+        DriverKrylovSchur::~DriverKrylovSchur()
+        {
+        }
+
+
+        /**
+         *
+         */
+        void DriverKrylovSchur::v_InitObject(ostream &out)
+        {
+            DriverArnoldi::v_InitObject(out);
+
+            m_session->LoadParameter("nkeep", m_nkeep, (m_kdim + m_nvec)/2);
+            m_session->LoadParameter("KrylovCheckpointSteps",
+                                     m_checkSteps, 0);
+
+            ASSERTL0(m_nkeep >= m_nvec && m_nkeep <= m_kdim - 2,
+                     "nkeep must lie between nvec and kdim-2.");
+
+            m_equ[0]->PrintSummary(out);
+
+            // Print session parameters
+            out << "\tArnoldi solver type   : Krylov-Schur" << endl;
+            out << "\tVectors kept          : " << m_nkeep << endl;
+
+            DriverArnoldi::ArnoldiSummary(out);
+
+            m_equ[m_nequ - 1]->DoInitialise();
+
+            //FwdTrans Initial conditions to be in Coefficient Space
+            m_equ[m_nequ-1] ->TransPhysToCoeff();
+        }
+
+
+        /**
+         *
+         */
+        void DriverKrylovSchur::v_Execute(ostream &out)
+        {
+            int i, j;
+            int nq = m_equ[0]->UpdateFields()[0]->GetNcoeffs();
+            m_ntot = m_nfields*nq;
+
+            bool restart;
+            m_session->MatchSolverInfo("KrylovRestart", "True",
+                                       restart, false);
+
+            std::string evlFile = m_session->GetFilename().substr(0,m_session->GetFilename().find_last_of('.')) + ".evl";
+            ofstream evlout(evlFile.c_str(),
+                            restart ? ios::app : ios::out);
+
+            // Allocate memory
+            m_V = Array<OneD, Array<OneD, NekDouble> > (m_kdim + 1);
+            for (i = 0; i < m_kdim + 1; ++i)
+            {
+                m_V[i] = Array<OneD, NekDouble>(m_ntot, 0.0);
+            }
+            m_H     = Array<OneD, NekDouble>((m_kdim + 1)*m_kdim, 0.0);
+            m_k     = 0;
+            m_nlock = 0;
+            m_iter  = 0;
+
+            if (restart)
+            {
+                ReadCheckpoint();
+                out << "\tInitial vector       : restarted from "
+                    << CheckpointFile() << endl;
+            }
+            else
+            {
+                // Copy starting vector into second sequence element
+                // (temporary).
+                if(m_session->DefinesFunction("InitialConditions"))
+                {
+                    out << "\tInitial vector       : specified in input file " << endl;
+                    m_equ[0]->SetInitialConditions(0.0,false);
+
+                    CopyFieldToArnoldiArray(m_V[1]);
+                }
+                else
+                {
+                    out << "\tInitial vector       : random  " << endl;
+
+                    NekDouble eps=1;
+
+                    Vmath::FillWhiteNoise(m_ntot, eps , &m_V[1][0], 1);
+                }
+
+                // Perform one iteration to enforce boundary conditions.
+                // Set this as the first vector of the basis.
+                EV_update(m_V[1], m_V[0]);
+                out << "Iteration: " << 0 <<  endl;
+
+                NekDouble norm = std::sqrt(GlobalDot(m_V[0], m_V[0]));
+                Vmath::Smul(m_ntot, 1.0/norm, m_V[0], 1, m_V[0], 1);
+                Vmath::Zero(m_ntot, m_V[1], 1);
+            }
+
+            int nrestart = 0;
+            while (m_nlock < m_nvec && Expand(out))
+            {
+                NekDouble resid0 = Restart(evlout);
+                ++nrestart;
+
+                out << "Restart: " << nrestart << " (locked : " << m_nlock
+                    << ", residual : " << resid0 << ")" << endl;
+
+                if (m_checkSteps > 0 && nrestart % m_checkSteps == 0)
+                {
+                    WriteCheckpoint();
+                }
+            }
+
+            if (m_nlock < m_nvec)
+            {
+                if (m_checkSteps > 0)
+                {
+                    WriteCheckpoint();
+                }
+                ASSERTL0(false, "Convergence was not achieved within the prescribed number of iterations.");
+            }
+
+            m_equ[0]->Output();
+
+            // Evaluate and output computation time and solution accuracy.
+            // The specific format of the error output is essential for the
+            // regression tests to work.
+            // Evaluate L2 Error
+            for(j = 0; j < m_equ[0]->GetNvariables(); ++j)
+            {
+                NekDouble vL2Error = m_equ[0]->L2Error(j,false);
+                NekDouble vLinfError = m_equ[0]->LinfError(j);
+                if (m_comm->GetRank() == 0)
+                {
+                    out << "L 2 error (variable " << m_equ[0]->GetVariable(j) << ") : " << vL2Error << endl;
+                    out << "L inf error (variable " << m_equ[0]->GetVariable(j) << ") : " << vLinfError << endl;
+                }
+            }
+
+            // Process eigenvectors and write out.
+            Finalise(out);
+
+            // Close the runtime info file.
+            evlout.close();
+        }
+
+
+        /**
+         *
+         */
+        NekDouble DriverKrylovSchur::GlobalDot(
+            const Array<OneD, const NekDouble> &a,
+            const Array<OneD, const NekDouble> &b)
+        {
+            NekDouble dot = Vmath::Dot(m_ntot, a, 1, b, 1);
+            m_comm->AllReduce(dot, LibUtilities::ReduceSum);
+            return dot;
+        }
+
+
+        /**
+         * Classical Gram-Schmidt with one step of reorthogonalisation. The
+         * projection coefficients are returned in @a h.
+         */
+        void DriverKrylovSchur::Orthogonalise(
+            const int               n,
+            Array<OneD, NekDouble> &w,
+            Array<OneD, NekDouble> &h)
+        {
+            Array<OneD, NekDouble> c(n);
+            Vmath::Zero(n, h, 1);
+
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (int i = 0; i < n; ++i)
+                {
+                    c[i] = Vmath::Dot(m_ntot, m_V[i], 1, w, 1);
+                }
+                m_comm->AllReduce(c, LibUtilities::ReduceSum);
+
+                for (int i = 0; i < n; ++i)
+                {
+                    Vmath::Svtvp(m_ntot, -c[i], m_V[i], 1, w, 1, w, 1);
+                    h[i] += c[i];
+                }
+            }
+        }
+
+
+        /**
+         * Each step applies the operator to the last basis vector and
+         * appends the orthonormalised result, adding a column to the
+         * projected matrix.
+         *
+         * @returns             False if nits was reached before the basis
+         *                      was full.
+         */
+        bool DriverKrylovSchur::Expand(ostream &out)
+        {
+            const int ldh = m_kdim + 1;
+            Array<OneD, NekDouble> h(m_kdim + 1);
+
+            for (int j = m_k; j < m_kdim; ++j)
+            {
+                if (m_iter >= m_nits)
+                {
+                    m_k = j;
+                    return false;
+                }
+
+                // Compute next vector
+                EV_update(m_V[j], m_V[j+1]);
+                ++m_iter;
+
+                Array<OneD, NekDouble> &w = m_V[j+1];
+                NekDouble wnorm = std::sqrt(GlobalDot(w, w));
+
+                Orthogonalise(j + 1, w, h);
+                Vmath::Vadd(j + 1, &h[0], 1, &m_H[j*ldh], 1, &m_H[j*ldh], 1);
+
+                NekDouble beta = std::sqrt(GlobalDot(w, w));
+                if (beta > 1e-12*wnorm)
+                {
+                    m_H[j*ldh + j + 1] = beta;
+                }
+                else
+                {
+                    // The basis spans an invariant subspace, so continue
+                    // with a random vector orthogonal to it.
+                    m_H[j*ldh + j + 1] = 0.0;
+                    Vmath::FillWhiteNoise(m_ntot, 1.0, &w[0], 1, m_iter);
+                    Orthogonalise(j + 1, w, h);
+                    beta = std::sqrt(GlobalDot(w, w));
+                }
+                Vmath::Smul(m_ntot, 1.0/beta, w, 1, w, 1);
+
+                out << "Iteration: " << m_iter << endl;
+            }
+
+            m_k = m_kdim;
+            return true;
+        }
+
+
+        /**
+         * The Krylov-Schur relation \f$ A V_k = V_k S + v_k b^T \f$ is
+         * stored with \f$S\f$ in the leading block of #m_H and \f$b^T\f$ in
+         * row k. The leading #m_nlock columns of \f$S\f$ are quasi-upper
+         * triangular and their entries of \f$b\f$ are zero.
+         *
+         * @returns             Residual of the leading active Ritz value.
+         */
+        NekDouble DriverKrylovSchur::Restart(ostream &evlout)
+        {
+            const int ldh = m_kdim + 1;
+            const int m   = m_k;
+            const int na  = m - m_nlock;
+            int i, j, s, info;
+
+            // Real Schur decomposition of the active block.
+            Array<OneD, NekDouble> T (na*na);
+            Array<OneD, NekDouble> Q (na*na);
+            Array<OneD, NekDouble> wr(na);
+            Array<OneD, NekDouble> wi(na);
+            int lwork = 6*na;
+            Array<OneD, NekDouble> work(lwork);
+
+            for (j = 0; j < na; ++j)
+            {
+                Vmath::Vcopy(na, &m_H[(m_nlock + j)*ldh + m_nlock], 1,
+                                 &T[j*na], 1);
+            }
+
+            Lapack::Dgees('V', na, T.get(), na, wr.get(), wi.get(),
+                          Q.get(), na, work.get(), lwork, info);
+            ASSERTL0(!info, "Error with dgees");
+
+            // Order the Schur form so that the Ritz values of largest
+            // magnitude come first.
+            for (int pos = 0; pos < na;)
+            {
+                SchurEigenvalues(na, T, na, wr, wi);
+
+                int       best    = pos;
+                NekDouble bestMag = -1.0;
+                for (i = pos; i < na;)
+                {
+                    NekDouble mag = hypot(wr[i], wi[i]);
+                    if (mag > bestMag)
+                    {
+                        bestMag = mag;
+                        best    = i;
+                    }
+                    i += (i + 1 < na && T[i*na + i + 1] != 0.0) ? 2 : 1;
+                }
+
+                if (best != pos)
+                {
+                    // A rejected swap leaves the ordering slightly
+                    // perturbed, which is harmless.
+                    int ifst = best + 1;
+                    int ilst = pos  + 1;
+                    Lapack::Dtrexc('V', na, T.get(), na, Q.get(), na,
+                                   ifst, ilst, work.get(), info);
+                }
+
+                pos += (pos + 1 < na && T[pos*na + pos + 1] != 0.0) ? 2 : 1;
+            }
+            SchurEigenvalues(na, T, na, wr, wi);
+
+            // Transform the residual row, b^T Q.
+            Array<OneD, NekDouble> b(na, 0.0);
+            Blas::Dgemv('T', na, na, 1.0, Q.get(), na,
+                        &m_H[m_nlock*ldh + m], ldh, 0.0, b.get(), 1);
+
+            // Residuals of the Schur vectors, combined over 2x2 blocks.
+            Array<OneD, NekDouble> resid(na);
+            for (i = 0; i < na;)
+            {
+                if (i + 1 < na && T[i*na + i + 1] != 0.0)
+                {
+                    resid[i] = resid[i+1] = hypot(b[i], b[i+1]);
+                    i += 2;
+                }
+                else
+                {
+                    resid[i] = std::fabs(b[i]);
+                    ++i;
+                }
+            }
+
+            evlout << "-- Iteration = " << m_iter << ", locked = "
+                   << m_nlock << endl;
+
+            evlout.precision(4);
+            evlout.setf(ios::scientific, ios::floatfield);
+            if(m_timeSteppingAlgorithm)
+            {
+                evlout << "EV  Magnitude   Angle       Growth      Frequency   Residual"
+                       << endl;
+            }
+            else
+            {
+                evlout << "EV  Real        Imaginary   inverse real  inverse imag  Residual"
+                       << endl;
+            }
+
+            for (i = 0; i < na; ++i)
+            {
+                WriteEvs(evlout, m_nlock + i, wr[i], wi[i], resid[i]);
+            }
+
+            // Lock the leading Schur vectors which have converged.
+            int nconv = 0;
+            while (nconv < na &&
+                   resid[nconv] <= m_evtol*hypot(wr[nconv], wi[nconv]))
+            {
+                nconv += (nconv + 1 < na && T[nconv*na + nconv + 1] != 0.0)
+                    ? 2 : 1;
+            }
+            for (i = 0; i < nconv; ++i)
+            {
+                b[i] = 0.0;
+            }
+
+            // Number of active vectors kept, which must include the newly
+            // locked ones and must not split a complex conjugate pair.
+            int keep = std::max(m_nkeep - m_nlock, nconv + 1);
+            keep = std::max(std::min(keep, na - 1), nconv);
+            if (keep > nconv && keep < na && T[(keep-1)*na + keep] != 0.0)
+            {
+                keep = keep + 1 < na ? keep + 1 : keep - 1;
+            }
+            const int knew = m_nlock + keep;
+
+            // Truncated relation: columns of the locked rows coupling to
+            // the active block are transformed by Q.
+            Array<OneD, NekDouble> Hnew(ldh*m_kdim, 0.0);
+            for (j = 0; j < m_nlock; ++j)
+            {
+                Vmath::Vcopy(m_nlock, &m_H[j*ldh], 1, &Hnew[j*ldh], 1);
+            }
+            if (m_nlock > 0)
+            {
+                Blas::Dgemm('N', 'N', m_nlock, keep, na, 1.0,
+                            &m_H[m_nlock*ldh], ldh, Q.get(), na, 0.0,
+                            &Hnew[m_nlock*ldh], ldh);
+            }
+            for (j = 0; j < keep; ++j)
+            {
+                Vmath::Vcopy(keep, &T[j*na], 1,
+                                   &Hnew[(m_nlock + j)*ldh + m_nlock], 1);
+                Hnew[(m_nlock + j)*ldh + knew] = b[j];
+            }
+            m_H = Hnew;
+
+            // Rotate the active basis vectors, V Q, in blocks of degrees
+            // of freedom so that no further full vectors are needed.
+            const int bs = 256;
+            Array<OneD, NekDouble> vin (bs*na);
+            Array<OneD, NekDouble> vout(bs*keep);
+            for (int p = 0; p < m_ntot; p += bs)
+            {
+                int nb = std::min(bs, m_ntot - p);
+                for (s = 0; s < na; ++s)
+                {
+                    Vmath::Vcopy(nb, &m_V[m_nlock + s][p], 1, &vin[s*nb], 1);
+                }
+                Blas::Dgemm('N', 'N', nb, keep, na, 1.0, vin.get(), nb,
+                            Q.get(), na, 0.0, vout.get(), nb);
+                for (s = 0; s < keep; ++s)
+                {
+                    Vmath::Vcopy(nb, &vout[s*nb], 1, &m_V[m_nlock + s][p], 1);
+                }
+            }
+            Vmath::Vcopy(m_ntot, m_V[m], 1, m_V[knew], 1);
+
+            m_nlock += nconv;
+            m_k      = knew;
+
+            return nconv < na ? resid[nconv] : 0.0;
+        }
+
+
+        /**
+         * Eigenvalues of the 1x1 and 2x2 diagonal blocks of a matrix in
+         * real Schur form.
+         */
+        void DriverKrylovSchur::SchurEigenvalues(
+            const int                           n,
+            const Array<OneD, const NekDouble> &T,
+            const int                           ldt,
+            Array<OneD, NekDouble>             &wr,
+            Array<OneD, NekDouble>             &wi)
+        {
+            for (int i = 0; i < n;)
+            {
+                if (i + 1 < n && T[i*ldt + i + 1] != 0.0)
+                {
+                    NekDouble a = T[ i   *ldt + i  ];
+                    NekDouble b = T[(i+1)*ldt + i  ];
+                    NekDouble c = T[ i   *ldt + i+1];
+                    NekDouble d = T[(i+1)*ldt + i+1];
+                    NekDouble p = 0.5*(a - d);
+
+                    wr[i]   = wr[i+1] = 0.5*(a + d);
+                    wi[i]   = std::sqrt(std::max(-(p*p + b*c), 0.0));
+                    wi[i+1] = -wi[i];
+                    i += 2;
+                }
+                else
+                {
+                    wr[i] = T[i*ldt + i];
+                    wi[i] = 0.0;
+                    ++i;
+                }
+            }
+        }
+
+
+        /**
+         * The eigenvectors of the locked block of the projected matrix,
+         * ordered by decreasing magnitude of the eigenvalue, give the
+         * eigenvectors of the operator as combinations of the basis
+         * vectors.
+         */
+        void DriverKrylovSchur::Finalise(ostream &out)
+        {
+            const int ldh = m_kdim + 1;
+            const int n   = m_nlock;
+            int i, j, info;
+
+            Array<OneD, NekDouble> S   (n*n);
+            Array<OneD, NekDouble> zvec(n*n);
+            Array<OneD, NekDouble> wr  (n);
+            Array<OneD, NekDouble> wi  (n);
+            int lwork = 10*n;
+            Array<OneD, NekDouble> work(lwork);
+
+            for (j = 0; j < n; ++j)
+            {
+                Vmath::Vcopy(n, &m_H[j*ldh], 1, &S[j*n], 1);
+            }
+
+            Lapack::Dgeev('N', 'V', n, S.get(), n, wr.get(), wi.get(),
+                          0, 1, zvec.get(), n, work.get(), lwork, info);
+            ASSERTL0(!info, "Error with dgeev");
+
+            // Sort by decreasing magnitude, keeping conjugate pairs
+            // together.
+            std::vector<std::pair<NekDouble, int> > order;
+            for (i = 0; i < n; i += (wi[i] > 0.0 ? 2 : 1))
+            {
+                order.push_back(std::make_pair(-hypot(wr[i], wi[i]), i));
+            }
+            std::stable_sort(order.begin(), order.end());
+
+            Array<OneD, NekDouble> zsort(n*n);
+            Array<OneD, NekDouble> wrsort(n);
+            Array<OneD, NekDouble> wisort(n);
+            for (i = j = 0; i < (int)order.size(); ++i)
+            {
+                int src  = order[i].second;
+                int size = wi[src] > 0.0 ? 2 : 1;
+                for (int l = 0; l < size; ++l, ++j)
+                {
+                    wrsort[j] = wr[src + l];
+                    wisort[j] = wi[src + l];
+                    Vmath::Vcopy(n, &zvec[(src + l)*n], 1, &zsort[j*n], 1);
+                }
+            }
+
+            int nvec = m_nvec;
+            if (wisort[nvec-1] > 0.0)
+            {
+                ++nvec;
+            }
+
+            out << "Converged eigenvalues: " << endl;
+            for (i = 0; i < nvec; ++i)
+            {
+                WriteEvs(out, i, wrsort[i], wisort[i]);
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > evecs(nvec);
+            for (i = 0; i < nvec; ++i)
+            {
+                evecs[i] = Array<OneD, NekDouble>(m_ntot, 0.0);
+            }
+            EV_big(m_V, evecs, m_ntot, n, nvec, zsort, wrsort, wisort);
+
+            for (j = 0; j < nvec; ++j)
+            {
+                std::string file = m_session->GetFilename().substr(0,m_session->GetFilename().find_last_of('.')) + "_eig_" + boost::lexical_cast<std::string>(j);
+
+                WriteFld(file, evecs[j]);
+            }
+
+            // store eigenvalues so they can be access from driver class
+            m_real_evl = wrsort;
+            m_imag_evl = wisort;
+        }
+
+
+        /**
+         * One file is written per process.
+         */
+        std::string DriverKrylovSchur::CheckpointFile()
+        {
+            std::string file = m_session->GetSessionName();
+            if (m_comm->GetSize() > 1)
+            {
+                file += "_P" + boost::lexical_cast<std::string>(
+                    m_comm->GetRank());
+            }
+            return file + ".krylov";
+        }
+
+
+        /**
+         * The state is first written to a temporary file which then
+         * replaces the previous checkpoint, so that a job killed while
+         * writing leaves the previous checkpoint intact.
+         */
+        void DriverKrylovSchur::WriteCheckpoint()
+        {
+            std::string file = CheckpointFile();
+            std::string tmp  = file + ".tmp";
+
+            ofstream ofs(tmp.c_str(), ios::binary);
+            ASSERTL0(ofs.good(), "Unable to open file: " + tmp);
+
+            int header[5] = { m_ntot, m_kdim, m_k, m_nlock, m_iter };
+            ofs.write((const char *)header, sizeof(header));
+            ofs.write((const char *)m_H.get(),
+                      m_H.num_elements()*sizeof(NekDouble));
+            for (int i = 0; i <= m_k; ++i)
+            {
+                ofs.write((const char *)m_V[i].get(),
+                          m_ntot*sizeof(NekDouble));
+            }
+            ofs.close();
+            ASSERTL0(!ofs.fail(), "Error writing file: " + tmp);
+
+            ASSERTL0(std::rename(tmp.c_str(), file.c_str()) == 0,
+                     "Unable to replace file: " + file);
+        }
+
+
+        /**
+         *
+         */
+        void DriverKrylovSchur::ReadCheckpoint()
+        {
+            std::string file = CheckpointFile();
+
+            ifstream ifs(file.c_str(), ios::binary);
+            ASSERTL0(ifs.good(), "Unable to open file: " + file);
+
+            int header[5];
+            ifs.read((char *)header, sizeof(header));
+            ASSERTL0(ifs.good() && header[0] == m_ntot &&
+                     header[1] == m_kdim,
+                     "Krylov state in " + file + " does not match the "
+                     "discretisation or kdim of this session.");
+
+            m_k     = header[2];
+            m_nlock = header[3];
+            m_iter  = header[4];
+
+            ifs.read((char *)m_H.get(),
+                     m_H.num_elements()*sizeof(NekDouble));
+            for (int i = 0; i <= m_k; ++i)
+            {
+                ifs.read((char *)m_V[i].get(), m_ntot*sizeof(NekDouble));
+            }
+            ASSERTL0(ifs.good(), "Error reading file: " + file);
+        }
+    }
+}
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File DriverKrylovSchur.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Driver class for eigenvalue analysis using the Krylov-Schur
+//              method.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_DRIVERKRYLOVSCHUR_H
+#define NEKTAR_SOLVERUTILS_DRIVERKRYLOVSCHUR_H
+
+#include <SolverUtils/DriverModifiedArnoldi.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        class DriverKrylovSchur: public DriverModifiedArnoldi
+        {
+        public:
+            friend class MemoryManager<DriverKrylovSchur>;
+
+            /// Creates an instance of this class
+            static DriverSharedPtr create(const LibUtilities::SessionReaderSharedPtr& pSession) {
+                DriverSharedPtr p = MemoryManager<DriverKrylovSchur>::AllocateSharedPtr(pSession);
+                p->InitObject();
+                return p;
+            }
+
+            ///Name of the class
+            static std::string className;
+
+        protected:
+
+            /// Constructor
+            DriverKrylovSchur(const LibUtilities::SessionReaderSharedPtr pSession);
+
+            /// Destructor
+            virtual ~DriverKrylovSchur();
+
+            /// Virtual function for initialisation implementation.
+            virtual void v_InitObject(ostream &out = cout );
+
+            /// Virtual function for solve implementation.
+            virtual void v_Execute(ostream &out = cout);
+
+        private:
+            /// Number of basis vectors kept at each restart, including
+            /// the locked ones.
+            int m_nkeep;
+            /// Number of restarts between checkpoints of the Krylov state,
+            /// zero if no checkpoints are written.
+            int m_checkSteps;
+            /// Number of coefficients of all fields on this process.
+            int m_ntot;
+
+            /// Basis vectors, one more than the current dimension.
+            Array<OneD, Array<OneD, NekDouble> > m_V;
+            /// Projected matrix, (kdim+1) x kdim, column-major. The leading
+            /// block is in real Schur form after each restart.
+            Array<OneD, NekDouble> m_H;
+            /// Current dimension of the basis.
+            int m_k;
+            /// Number of converged (locked) Schur vectors.
+            int m_nlock;
+            /// Number of applications of the operator so far.
+            int m_iter;
+
+            /// Inner product of two vectors over all processes.
+            NekDouble GlobalDot(const Array<OneD, const NekDouble> &a,
+                                const Array<OneD, const NekDouble> &b);
+
+            /// Orthogonalises @a w against the first @a n basis vectors.
+            void Orthogonalise(const int               n,
+                               Array<OneD, NekDouble> &w,
+                               Array<OneD, NekDouble> &h);
+
+            /// Extends the basis to dimension kdim by Arnoldi steps.
+            bool Expand(ostream &out);
+
+            /// Computes the ordered Schur form of the active part of the
+            /// projected matrix, locks converged vectors and truncates the
+            /// basis.
+            NekDouble Restart(ostream &evlout);
+
+            /// Computes eigenvalues of the quasi-triangular matrix @a T.
+            void SchurEigenvalues(const int n,
+                                  const Array<OneD, const NekDouble> &T,
+                                  const int ldt,
+                                  Array<OneD, NekDouble> &wr,
+                                  Array<OneD, NekDouble> &wi);
+
+            /// Writes eigenvalues and eigenvectors of the locked part.
+            void Finalise(ostream &out);
+
+            std::string CheckpointFile();
+
+            void WriteCheckpoint();
+
+            void ReadCheckpoint();
+
+            static std::string driverLookupId;
+        };
+    }
+} //end of namespace
+
+#endif //NEKTAR_SOLVERUTILS_DRIVERKRYLOVSCHUR_H
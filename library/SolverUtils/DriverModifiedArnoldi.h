@@ -72,11 +72,23 @@ namespace Nektar
             /// Virtual function for solve implementation.
             virtual void v_Execute(ostream &out = cout);
 
-        private:
             /// Generates a new vector in the sequence by applying the linear operator.
             void EV_update(Array<OneD, NekDouble> &src,
                            Array<OneD, NekDouble> &tgt);
 
+            /// Forms and normalises the eigenvectors from the basis
+            /// vectors and the eigenvectors of the small matrix.
+            void EV_big(Array<OneD, Array<OneD, NekDouble> > &bvecs,
+                        Array<OneD, Array<OneD, NekDouble> > &evecs,
+                        const int ntot,
+                        const int kdim,
+                        const int nvec,
+                        Array<OneD, NekDouble> &zvec,
+                        Array<OneD, NekDouble> &wr,
+                        Array<OneD, NekDouble> &wi);
+
+        private:
+
             /// Generates the upper Hessenberg matrix H and computes its eigenvalues.
             void EV_small(Array<OneD, Array<OneD, NekDouble> > &Kseq,
                           const int ntot,
@@ -116,15 +128,6 @@ namespace Nektar
                          Array<OneD, NekDouble> &wi,
                          const int icon);
 
-            void EV_big(Array<OneD, Array<OneD, NekDouble> > &bvecs,
-                        Array<OneD, Array<OneD, NekDouble> > &evecs,
-                        const int ntot,
-                        const int kdim,
-                        const int nvec,
-                        Array<OneD, NekDouble> &zvec,
-                        Array<OneD, NekDouble> &wr,
-                        Array<OneD, NekDouble> &wi);
-
             static std::string driverLookupId;
         };
     }	
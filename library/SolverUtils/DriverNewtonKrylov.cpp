@@ -0,0 +1,469 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File DriverNewtonKrylov.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Jacobian-free Newton-Krylov steady state solver.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <limits>
+
+#include <SolverUtils/DriverNewtonKrylov.h>
+#include <SolverUtils/UnsteadySystem.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        string DriverNewtonKrylov::className = GetDriverFactory().RegisterCreatorFunction("NewtonKrylov", DriverNewtonKrylov::create);
+        string DriverNewtonKrylov::driverLookupId = LibUtilities::SessionReader::RegisterEnumValue("Driver","NewtonKrylov",0);
+
+        /**
+         * @class DriverNewtonKrylov
+         *
+         * Computes a steady state as a fixed point of the flow map
+         * \f$\Phi\f$, which integrates the equations over NumSteps time
+         * steps. The nonlinear residual is \f$R(q) = \Phi(q) - q\f$. This is
+         * the steady residual preconditioned by the time stepper, as in
+         * Tuckerman's Stokes preconditioning. Each Newton step solves
+         * \f$(\Phi'(q) - I)\delta q = -R(q)\f$ with GMRES. Jacobian-vector
+         * products are approximated by finite differences of \f$\Phi\f$, so
+         * each GMRES iteration costs one flow map evaluation.
+         *
+         * With SolverInfo NewtonKrylovPreconditioner set to SFD, the flow
+         * map also carries the filtered field. At each time step it applies
+         * the exact selective frequency damping update used by
+         * DriverSteadyState, with the same FilterWidth and ControlCoeff
+         * parameters. This damps the unstable modes that slow down GMRES.
+         */
+        DriverNewtonKrylov::DriverNewtonKrylov(const LibUtilities::SessionReaderSharedPtr pSession)
+            : Driver(pSession)
+        {
+        }
+
+
+        /**
+         *
+         */
+        DriverNewtonKrylov::~DriverNewtonKrylov()
+        {
+        }
+
+
+        /**
+         *
+         */
+        void DriverNewtonKrylov::v_InitObject(ostream &out)
+        {
+            Driver::v_InitObject(out);
+
+            m_session->LoadParameter("NewtonMaxIterations", m_maxNewtonIts, 50);
+            m_session->LoadParameter("NewtonTolerance",     m_tolerance,    1.0e-8);
+            m_session->LoadParameter("NewtonKrylovKdim",    m_kdim,         30);
+            m_session->LoadParameter("NewtonKrylovForcing", m_forcing,      1.0e-2);
+            m_session->MatchSolverInfo("NewtonKrylovPreconditioner", "SFD",
+                                       m_useSFD, false);
+
+            ASSERTL0(m_kdim > 0, "NewtonKrylovKdim must be positive");
+        }
+
+
+        void DriverNewtonKrylov::v_Execute(ostream &out)
+        {
+            m_equ[0]->PrintSummary(out);
+            m_equ[0]->DoInitialise();
+
+            // The state holds every field integrated in time, e.g. the
+            // velocity components of the incompressible equations or all
+            // conserved variables of the compressible ones.
+            boost::shared_ptr<UnsteadySystem> unsteady =
+                boost::dynamic_pointer_cast<UnsteadySystem>(m_equ[0]);
+            ASSERTL0(unsteady, "The NewtonKrylov driver requires an "
+                               "unsteady equation system");
+
+            m_intVariables = unsteady->GetIntVariables();
+            m_nvar   = m_intVariables.size();
+            m_npts   = m_equ[0]->GetTotPoints();
+            m_nsteps = m_equ[0]->GetSteps();
+            m_ntot   = (m_useSFD ? 2 : 1) * m_nvar * m_npts;
+
+            m_ntotGlobal = m_ntot;
+            m_comm->AllReduce(m_ntotGlobal, LibUtilities::ReduceSum);
+
+            ASSERTL0(m_nsteps > 0,
+                     "NumSteps must be set to define the flow map used by "
+                     "the NewtonKrylov driver");
+
+            if (m_useSFD)
+            {
+                NekDouble delta0, x0;
+                m_session->LoadParameter("FilterWidth",  delta0, 1);
+                m_session->LoadParameter("ControlCoeff", x0,     1);
+
+                NekDouble dt    = m_equ[0]->GetTimeStep();
+                NekDouble X     = x0*dt;
+                NekDouble Delta = delta0/dt;
+                NekDouble c1    = 1.0/(1.0 + X*Delta);
+                NekDouble e     = exp(-(X + 1.0/Delta));
+
+                m_F11 = c1*(1.0 + X*Delta*e);
+                m_F12 = c1*(X*Delta*(1.0 - e));
+                m_F21 = c1*(1.0 - e);
+                m_F22 = c1*(X*Delta + e);
+
+                // The filter is applied after each time step.
+                m_equ[0]->SetStepsToOne();
+            }
+
+            if (m_comm->GetRank() == 0)
+            {
+                out << "------------- Newton-Krylov Parameters -------------" << endl;
+                out << "\tTime steps per map  = " << m_nsteps << endl;
+                out << "\tPreconditioner      = "
+                    << (m_useSFD ? "SFD" : "TimeStepper") << endl;
+                out << "\tKrylov dimension    = " << m_kdim << endl;
+                out << "\tForcing term        = " << m_forcing << endl;
+                out << "\tTolerance           = " << m_tolerance << endl;
+                out << "----------------------------------------------------" << endl;
+            }
+
+            Array<OneD, NekDouble> x     (m_ntot);
+            Array<OneD, NekDouble> phix  (m_ntot);
+            Array<OneD, NekDouble> r     (m_ntot);
+            Array<OneD, NekDouble> dx    (m_ntot);
+            Array<OneD, NekDouble> xnew  (m_ntot);
+            Array<OneD, NekDouble> phinew(m_ntot);
+
+            CopyFieldsToState(x);
+            EvaluateFlowMap(x, phix);
+            Vmath::Vsub(m_ntot, phix, 1, x, 1, r, 1);
+            NekDouble rnorm = sqrt(GlobalDot(r, r)/m_ntotGlobal);
+
+            if (m_comm->GetRank() == 0)
+            {
+                out << "Newton iteration: 0; |R| = " << rnorm << endl;
+            }
+
+            int it = 0;
+            while (rnorm > m_tolerance && it < m_maxNewtonIts)
+            {
+                // Solve (Phi' - I) dx = -R.
+                Vmath::Neg(m_ntot, r, 1);
+                int nits = SolveGMRES(x, phix, r, dx);
+
+                // Backtrack along dx until the residual decreases.
+                const int maxBacktrack = 4;
+                NekDouble lambda       = 1.0;
+                NekDouble rnewnorm     = 0.0;
+                for (int ls = 0; ; ++ls)
+                {
+                    Vmath::Svtvp(m_ntot, lambda, dx, 1, x, 1, xnew, 1);
+                    EvaluateFlowMap(xnew, phinew);
+                    Vmath::Vsub(m_ntot, phinew, 1, xnew, 1, r, 1);
+                    rnewnorm = sqrt(GlobalDot(r, r)/m_ntotGlobal);
+
+                    if (rnewnorm < (1.0 - 1.0e-4*lambda)*rnorm ||
+                        ls == maxBacktrack)
+                    {
+                        break;
+                    }
+                    lambda *= 0.5;
+                }
+
+                swap(x, xnew);
+                swap(phix, phinew);
+                rnorm = rnewnorm;
+                ++it;
+
+                if (m_comm->GetRank() == 0)
+                {
+                    out << "Newton iteration: " << it
+                        << "; |R| = " << rnorm
+                        << "; GMRES iterations: " << nits
+                        << "; step length: " << lambda << endl;
+                }
+
+                CopyStateToFields(x);
+                m_equ[0]->TransPhysToCoeff();
+                m_equ[0]->Checkpoint_Output(it);
+            }
+
+            if (rnorm > m_tolerance)
+            {
+                NEKERROR(ErrorUtil::ewarning,
+                         "Newton-Krylov iteration did not converge");
+            }
+
+            CopyStateToFields(x);
+            m_equ[0]->TransPhysToCoeff();
+            m_equ[0]->Output();
+
+            // Evaluate and output computation time and solution accuracy.
+            // The specific format of the error output is essential for the
+            // regression tests to work.
+            for(int i = 0; i < m_equ[0]->GetNvariables(); ++i)
+            {
+                NekDouble vL2Error = m_equ[0]->L2Error(i,false);
+                NekDouble vLinfError = m_equ[0]->LinfError(i);
+                if (m_comm->GetRank() == 0)
+                {
+                    out << "L 2 error (variable " << m_equ[0]->GetVariable(i) << ") : " << vL2Error << endl;
+                    out << "L inf error (variable " << m_equ[0]->GetVariable(i) << ") : " << vLinfError << endl;
+                }
+            }
+        }
+
+
+        NekDouble DriverNewtonKrylov::GlobalDot(
+            const Array<OneD, const NekDouble> &a,
+            const Array<OneD, const NekDouble> &b)
+        {
+            NekDouble dot = Vmath::Dot(m_ntot, a, 1, b, 1);
+            m_comm->AllReduce(dot, LibUtilities::ReduceSum);
+            return dot;
+        }
+
+
+        /**
+         * Copy the unfiltered part of @a x into the physical values of the
+         * fields integrated in time.
+         */
+        void DriverNewtonKrylov::CopyStateToFields(
+            const Array<OneD, const NekDouble> &x)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr> &fields =
+                m_equ[0]->UpdateFields();
+
+            for (int i = 0; i < m_nvar; ++i)
+            {
+                Vmath::Vcopy(m_npts, &x[i*m_npts], 1,
+                             &fields[m_intVariables[i]]->UpdatePhys()[0], 1);
+            }
+        }
+
+
+        /**
+         * Copy the fields integrated in time into @a x. With SFD the
+         * filtered part of the state is initialised to the same values.
+         */
+        void DriverNewtonKrylov::CopyFieldsToState(Array<OneD, NekDouble> &x)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr> &fields =
+                m_equ[0]->UpdateFields();
+
+            for (int i = 0; i < m_nvar; ++i)
+            {
+                Vmath::Vcopy(m_npts, &fields[m_intVariables[i]]->GetPhys()[0],
+                             1, &x[i*m_npts], 1);
+            }
+
+            if (m_useSFD)
+            {
+                Vmath::Vcopy(m_nvar*m_npts, &x[0], 1, &x[m_nvar*m_npts], 1);
+            }
+        }
+
+
+        /**
+         * Evaluate the flow map \f$\Phi(x)\f$ over NumSteps time steps.
+         */
+        void DriverNewtonKrylov::EvaluateFlowMap(
+            const Array<OneD, const NekDouble> &x,
+                  Array<OneD, NekDouble>       &phi)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr> &fields =
+                m_equ[0]->UpdateFields();
+            const int nq = m_nvar*m_npts;
+
+            Vmath::Vcopy(m_ntot, x, 1, phi, 1);
+
+            int nsolve = m_useSFD ? m_nsteps : 1;
+            for (int n = 0; n < nsolve; ++n)
+            {
+                CopyStateToFields(phi);
+                m_equ[0]->DoSolve();
+
+                for (int i = 0; i < m_nvar; ++i)
+                {
+                    const Array<OneD, const NekDouble> &q =
+                        fields[m_intVariables[i]]->GetPhys();
+
+                    if (m_useSFD)
+                    {
+                        // Exact solution of the filter equation.
+                        NekDouble *qi    = &phi[i*m_npts];
+                        NekDouble *qBari = &phi[nq + i*m_npts];
+                        for (int j = 0; j < m_npts; ++j)
+                        {
+                            NekDouble qBar = qBari[j];
+                            qi[j]    = m_F11*q[j] + m_F12*qBar;
+                            qBari[j] = m_F21*q[j] + m_F22*qBar;
+                        }
+                    }
+                    else
+                    {
+                        Vmath::Vcopy(m_npts, &q[0], 1, &phi[i*m_npts], 1);
+                    }
+                }
+            }
+        }
+
+
+        /**
+         * Finite difference approximation of the Jacobian of the residual
+         * applied to @a v, where @a phix holds \f$\Phi(x)\f$.
+         */
+        void DriverNewtonKrylov::ApplyJacobian(
+            const Array<OneD, const NekDouble> &x,
+            const Array<OneD, const NekDouble> &phix,
+            const Array<OneD, const NekDouble> &v,
+                  Array<OneD, NekDouble>       &jv)
+        {
+            NekDouble vnorm = sqrt(GlobalDot(v, v));
+            if (vnorm == 0.0)
+            {
+                Vmath::Zero(m_ntot, jv, 1);
+                return;
+            }
+
+            NekDouble xnorm = sqrt(GlobalDot(x, x));
+            NekDouble eps   =
+                sqrt(std::numeric_limits<NekDouble>::epsilon())
+                * (1.0 + xnorm) / vnorm;
+
+            Array<OneD, NekDouble> xp(m_ntot);
+            Vmath::Svtvp(m_ntot, eps, v, 1, x, 1, xp, 1);
+            EvaluateFlowMap(xp, jv);
+
+            Vmath::Vsub(m_ntot, jv, 1, phix, 1, jv, 1);
+            Vmath::Smul(m_ntot, 1.0/eps, jv, 1, jv, 1);
+            Vmath::Vsub(m_ntot, jv, 1, v, 1, jv, 1);
+        }
+
+
+        /**
+         * Solve the Newton system with a single cycle of GMRES of dimension
+         * NewtonKrylovKdim, stopping when the residual has been reduced by
+         * NewtonKrylovForcing. If the tolerance is not met the
+         * approximation is still returned, giving an inexact Newton step.
+         * Returns the number of iterations.
+         */
+        int DriverNewtonKrylov::SolveGMRES(
+            const Array<OneD, const NekDouble> &x,
+            const Array<OneD, const NekDouble> &phix,
+            const Array<OneD, const NekDouble> &rhs,
+                  Array<OneD, NekDouble>       &dx)
+        {
+            const int m   = m_kdim;
+            const int ldh = m + 1;
+
+            Array<OneD, Array<OneD, NekDouble> > V(m + 1);
+            Array<OneD, NekDouble> H (ldh*m, 0.0);
+            Array<OneD, NekDouble> cs(m,     0.0);
+            Array<OneD, NekDouble> sn(m,     0.0);
+            Array<OneD, NekDouble> g (m + 1, 0.0);
+
+            Vmath::Zero(m_ntot, dx, 1);
+
+            NekDouble beta = sqrt(GlobalDot(rhs, rhs));
+            if (beta == 0.0)
+            {
+                return 0;
+            }
+
+            V[0] = Array<OneD, NekDouble>(m_ntot);
+            Vmath::Smul(m_ntot, 1.0/beta, rhs, 1, V[0], 1);
+            g[0] = beta;
+
+            int nits = 0;
+            for (int j = 0; j < m; ++j)
+            {
+                V[j+1] = Array<OneD, NekDouble>(m_ntot);
+                ApplyJacobian(x, phix, V[j], V[j+1]);
+
+                // Modified Gram-Schmidt.
+                for (int i = 0; i <= j; ++i)
+                {
+                    NekDouble h = GlobalDot(V[j+1], V[i]);
+                    H[i + j*ldh] = h;
+                    Vmath::Svtvp(m_ntot, -h, V[i], 1, V[j+1], 1, V[j+1], 1);
+                }
+                NekDouble hnext = sqrt(GlobalDot(V[j+1], V[j+1]));
+
+                // Apply the previous Givens rotations to the new column.
+                for (int i = 0; i < j; ++i)
+                {
+                    NekDouble t      = cs[i]*H[i + j*ldh] + sn[i]*H[i+1 + j*ldh];
+                    H[i+1 + j*ldh]   = -sn[i]*H[i + j*ldh] + cs[i]*H[i+1 + j*ldh];
+                    H[i + j*ldh]     = t;
+                }
+
+                // Eliminate the subdiagonal entry.
+                NekDouble hjj = H[j + j*ldh];
+                NekDouble rho = sqrt(hjj*hjj + hnext*hnext);
+                ASSERTL0(rho > 0.0, "Breakdown in Newton-Krylov GMRES");
+                cs[j] = hjj/rho;
+                sn[j] = hnext/rho;
+                H[j + j*ldh] = rho;
+
+                g[j+1] = -sn[j]*g[j];
+                g[j]   =  cs[j]*g[j];
+                nits   = j + 1;
+
+                if (fabs(g[j+1]) <= m_forcing*beta || hnext == 0.0)
+                {
+                    break;
+                }
+
+                Vmath::Smul(m_ntot, 1.0/hnext, V[j+1], 1, V[j+1], 1);
+            }
+
+            // Back substitution for the coefficients of the update.
+            Array<OneD, NekDouble> y(nits);
+            for (int i = nits - 1; i >= 0; --i)
+            {
+                NekDouble sum = g[i];
+                for (int k = i + 1; k < nits; ++k)
+                {
+                    sum -= H[i + k*ldh]*y[k];
+                }
+                y[i] = sum/H[i + i*ldh];
+            }
+
+            for (int i = 0; i < nits; ++i)
+            {
+                Vmath::Svtvp(m_ntot, y[i], V[i], 1, dx, 1, dx, 1);
+            }
+
+            return nits;
+        }
+    }
+}
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File DriverNewtonKrylov.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Driver class for the Jacobian-free Newton-Krylov steady
+//              state solver.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_DRIVERNEWTONKRYLOV_H
+#define NEKTAR_SOLVERUTILS_DRIVERNEWTONKRYLOV_H
+
+#include <SolverUtils/Driver.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        class DriverNewtonKrylov: public Driver
+        {
+        public:
+            friend class MemoryManager<DriverNewtonKrylov>;
+
+            /// Creates an instance of this class
+            static DriverSharedPtr create(const LibUtilities::SessionReaderSharedPtr& pSession) {
+                DriverSharedPtr p = MemoryManager<DriverNewtonKrylov>::AllocateSharedPtr(pSession);
+                p->InitObject();
+                return p;
+            }
+
+            ///Name of the class
+            static std::string className;
+
+        protected:
+            /// Constructor
+            SOLVER_UTILS_EXPORT DriverNewtonKrylov(const LibUtilities::SessionReaderSharedPtr pSession);
+
+            /// Destructor
+            SOLVER_UTILS_EXPORT virtual ~DriverNewtonKrylov();
+
+            /// Second-stage initialisation
+            SOLVER_UTILS_EXPORT virtual void v_InitObject(ostream &out = cout);
+
+            /// Virtual function for solve implementation.
+            SOLVER_UTILS_EXPORT virtual void v_Execute(ostream &out = cout);
+
+            static std::string driverLookupId;
+
+        private:
+            /// Fields integrated in time, which make up the state.
+            std::vector<int> m_intVariables;
+            /// Number of fields in the state.
+            int       m_nvar;
+            /// Number of quadrature points per field.
+            int       m_npts;
+            /// Local length of the state vector.
+            int       m_ntot;
+            /// Global length of the state vector.
+            NekDouble m_ntotGlobal;
+            /// Number of time steps in one evaluation of the flow map.
+            int       m_nsteps;
+            /// Use the selective frequency damping map as preconditioner.
+            bool      m_useSFD;
+            /// Maximum dimension of the Krylov space used by GMRES.
+            int       m_kdim;
+            /// Maximum number of Newton iterations.
+            int       m_maxNewtonIts;
+            /// Tolerance on the RMS norm of the residual.
+            NekDouble m_tolerance;
+            /// Relative tolerance of the linear solve in each Newton step.
+            NekDouble m_forcing;
+
+            /// Coefficients of the exact solution of the SFD filter equation.
+            NekDouble m_F11;
+            NekDouble m_F12;
+            NekDouble m_F21;
+            NekDouble m_F22;
+
+            NekDouble GlobalDot(
+                const Array<OneD, const NekDouble> &a,
+                const Array<OneD, const NekDouble> &b);
+
+            void EvaluateFlowMap(
+                const Array<OneD, const NekDouble> &x,
+                      Array<OneD, NekDouble>       &phi);
+
+            void ApplyJacobian(
+                const Array<OneD, const NekDouble> &x,
+                const Array<OneD, const NekDouble> &phix,
+                const Array<OneD, const NekDouble> &v,
+                      Array<OneD, NekDouble>       &jv);
+
+            int SolveGMRES(
+                const Array<OneD, const NekDouble> &x,
+                const Array<OneD, const NekDouble> &phix,
+                const Array<OneD, const NekDouble> &rhs,
+                      Array<OneD, NekDouble>       &dx);
+
+            void CopyStateToFields(const Array<OneD, const NekDouble> &x);
+
+            void CopyFieldsToState(Array<OneD, NekDouble> &x);
+        };
+    }
+}
+
+#endif //NEKTAR_SOLVERUTILS_DRIVERNEWTONKRYLOV_H
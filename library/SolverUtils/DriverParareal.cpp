@@ -0,0 +1,316 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File DriverParareal.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Parareal parallel-in-time solver.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <SolverUtils/DriverParareal.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        string DriverParareal::className = GetDriverFactory().RegisterCreatorFunction("Parareal", DriverParareal::create);
+        string DriverParareal::driverLookupId = LibUtilities::SessionReader::RegisterEnumValue("Driver","Parareal",0);
+
+        /**
+         * @class DriverParareal
+         *
+         * Splits the NumSteps time steps of the session into equal time
+         * slices, given by the --npt command-line option. Each slice runs
+         * on its own group of processes, which holds the full spatial
+         * partitioning. The Parareal iteration (Lions, Maday and Turinici,
+         * 2001) updates the state at the start of slice \f$n+1\f$ as
+         * \f[ U^{k+1}_{n+1} = G(U^{k+1}_n) + F(U^k_n) - G(U^k_n). \f]
+         * The fine propagator \f$F\f$ integrates a slice with the session
+         * time step, and all slices compute it concurrently. The coarse
+         * propagator \f$G\f$ is a second instance of the equation system
+         * whose time step is PararealCoarseRatio times larger. It is
+         * applied sequentially along the slices. The iteration stops when
+         * the slice end states change by less than PararealTolerance, or
+         * after PararealMaxIterations iterations. After as many
+         * iterations as there are slices the result equals the serial
+         * fine solution.
+         *
+         * Multi-step schemes restart at the beginning of every slice, so
+         * the converged result matches a serial run that is restarted at
+         * the same times. Checkpoint output during the slices is disabled.
+         * Only the last slice writes the final solution and error norms.
+         */
+        DriverParareal::DriverParareal(const LibUtilities::SessionReaderSharedPtr pSession)
+            : Driver(pSession)
+        {
+        }
+
+
+        /**
+         *
+         */
+        DriverParareal::~DriverParareal()
+        {
+        }
+
+
+        /**
+         *
+         */
+        void DriverParareal::v_InitObject(ostream &out)
+        {
+            m_timeComm = m_session->GetTimeComm();
+            ASSERTL0(m_timeComm,
+                     "The Parareal driver requires several time slices; "
+                     "use the --npt command-line option.");
+
+            m_nslices = m_timeComm->GetSize();
+            m_slice   = m_timeComm->GetRank();
+
+            int       nsteps;
+            NekDouble dt;
+            m_session->LoadParameter("NumSteps",            nsteps,        0);
+            m_session->LoadParameter("TimeStep",            dt,            0.01);
+            m_session->LoadParameter("PararealCoarseRatio", m_coarseRatio, 10);
+            m_session->LoadParameter("PararealMaxIterations", m_maxIts,
+                                     m_nslices);
+            m_session->LoadParameter("PararealTolerance",   m_tolerance,   1.0e-8);
+
+            ASSERTL0(nsteps > 0 && nsteps % m_nslices == 0,
+                     "NumSteps must be a multiple of the number of time "
+                     "slices.");
+            m_sliceSteps = nsteps / m_nslices;
+            m_sliceTime  = m_sliceSteps * dt;
+
+            ASSERTL0(m_coarseRatio > 0 && m_sliceSteps % m_coarseRatio == 0,
+                     "The number of time steps in each slice must be a "
+                     "multiple of PararealCoarseRatio.");
+
+            // Both equation systems integrate over a single slice and
+            // write no checkpoints of their own.
+            int       zeroSteps = 0;
+            NekDouble zeroTime  = 0.0;
+            m_session->SetParameter("NumSteps",      m_sliceSteps);
+            m_session->SetParameter("FinTime",       zeroTime);
+            m_session->SetParameter("IO_CheckSteps", zeroSteps);
+            m_session->SetParameter("IO_CheckTime",  zeroTime);
+
+            // Fine propagator.
+            Driver::v_InitObject(out);
+
+            // Coarse propagator, created with the same advection type.
+            std::string vEquation = m_session->GetSolverInfo("EqType");
+            if (m_session->DefinesSolverInfo("SolverType"))
+            {
+                vEquation = m_session->GetSolverInfo("SolverType");
+            }
+
+            int       coarseSteps = m_sliceSteps / m_coarseRatio;
+            NekDouble coarseDt    = dt * m_coarseRatio;
+            m_session->SetParameter("NumSteps", coarseSteps);
+            m_session->SetParameter("TimeStep", coarseDt);
+
+            EquationSystemSharedPtr coarse =
+                GetEquationSystemFactory().CreateInstance(vEquation, m_session);
+
+            m_session->SetParameter("NumSteps", nsteps);
+            m_session->SetParameter("TimeStep", dt);
+
+            m_nequ = 2;
+            Array<OneD, EquationSystemSharedPtr> equ(m_nequ);
+            equ[0] = m_equ[0];
+            equ[1] = coarse;
+            m_equ  = equ;
+        }
+
+
+        void DriverParareal::v_Execute(ostream &out)
+        {
+            if (m_slice == 0)
+            {
+                m_equ[0]->PrintSummary(out);
+            }
+
+            m_equ[0]->DoInitialise();
+            m_equ[1]->DoInitialise();
+
+            // Slices are timed from the initial time of the fine system,
+            // which is nonzero when restarting from a checkpoint.
+            m_initialTime = m_equ[0]->GetFinalTime();
+
+            m_ntot = m_equ[0]->GetNvariables() * m_equ[0]->GetTotPoints();
+
+            if (m_slice == 0 && m_comm->GetRank() == 0)
+            {
+                out << "------------------ Parareal Parameters -------------" << endl;
+                out << "\tTime slices         = " << m_nslices << endl;
+                out << "\tSteps per slice     = " << m_sliceSteps << endl;
+                out << "\tCoarse ratio        = " << m_coarseRatio << endl;
+                out << "\tTolerance           = " << m_tolerance << endl;
+                out << "----------------------------------------------------" << endl;
+            }
+
+            // Start and end state of this slice, and the fine and coarse
+            // solutions over it.
+            Array<OneD, NekDouble> u0  (m_ntot);
+            Array<OneD, NekDouble> uEnd(m_ntot);
+            Array<OneD, NekDouble> f   (m_ntot);
+            Array<OneD, NekDouble> g   (m_ntot);
+            Array<OneD, NekDouble> gOld(m_ntot);
+            Array<OneD, NekDouble> uNew(m_ntot);
+
+            // Initial guess from the coarse propagator. Each slice repeats
+            // the coarse sweep up to its own start, which avoids waiting
+            // for the previous slices.
+            CopyFieldsToState(m_equ[0], u0);
+            for (int s = 0; s < m_slice; ++s)
+            {
+                Propagate(m_equ[1], s, u0, u0);
+            }
+            Propagate(m_equ[1], m_slice, u0, gOld);
+            Vmath::Vcopy(m_ntot, gOld, 1, uEnd, 1);
+
+            int k;
+            for (k = 1; k <= m_maxIts; ++k)
+            {
+                // Fine propagation, concurrently on all slices.
+                Propagate(m_equ[0], m_slice, u0, f);
+
+                // Sequential coarse correction.
+                if (m_slice > 0)
+                {
+                    m_timeComm->Recv(m_slice - 1, u0);
+                }
+
+                Propagate(m_equ[1], m_slice, u0, g);
+
+                Vmath::Vsub(m_ntot, f,    1, gOld, 1, uNew, 1);
+                Vmath::Vadd(m_ntot, uNew, 1, g,    1, uNew, 1);
+
+                Vmath::Vsub(m_ntot, uNew, 1, uEnd, 1, uEnd, 1);
+                NekDouble diff = Vmath::Vamax(m_ntot, uEnd, 1);
+                m_comm->AllReduce(diff, LibUtilities::ReduceMax);
+
+                Vmath::Vcopy(m_ntot, uNew, 1, uEnd, 1);
+                Vmath::Vcopy(m_ntot, g,    1, gOld, 1);
+
+                if (m_slice < m_nslices - 1)
+                {
+                    m_timeComm->Send(m_slice + 1, uEnd);
+                }
+
+                m_timeComm->AllReduce(diff, LibUtilities::ReduceMax);
+
+                if (m_slice == 0 && m_comm->GetRank() == 0)
+                {
+                    out << "Parareal iteration: " << k
+                        << "; |dU|inf = " << diff << endl;
+                }
+
+                if (diff < m_tolerance)
+                {
+                    break;
+                }
+            }
+
+            if (m_slice != m_nslices - 1)
+            {
+                return;
+            }
+
+            CopyStateToFields(m_equ[0], uEnd);
+            m_equ[0]->SetTime(m_initialTime + m_nslices * m_sliceTime);
+            m_equ[0]->TransPhysToCoeff();
+            m_equ[0]->Output();
+
+            // Evaluate and output computation time and solution accuracy.
+            // The specific format of the error output is essential for the
+            // regression tests to work.
+            for(int i = 0; i < m_equ[0]->GetNvariables(); ++i)
+            {
+                NekDouble vL2Error = m_equ[0]->L2Error(i,false);
+                NekDouble vLinfError = m_equ[0]->LinfError(i);
+                if (m_comm->GetRank() == 0)
+                {
+                    out << "L 2 error (variable " << m_equ[0]->GetVariable(i) << ") : " << vL2Error << endl;
+                    out << "L inf error (variable " << m_equ[0]->GetVariable(i) << ") : " << vLinfError << endl;
+                }
+            }
+        }
+
+
+        /**
+         * Integrate @a equ over time slice @a slice from the state @a u0,
+         * returning the final state in @a u1. The two arrays may coincide.
+         */
+        void DriverParareal::Propagate(
+            const EquationSystemSharedPtr      &equ,
+            const int                           slice,
+            const Array<OneD, const NekDouble> &u0,
+                  Array<OneD, NekDouble>       &u1)
+        {
+            CopyStateToFields(equ, u0);
+            equ->SetTime(m_initialTime + slice * m_sliceTime);
+            equ->DoSolve();
+            CopyFieldsToState(equ, u1);
+        }
+
+
+        void DriverParareal::CopyStateToFields(
+            const EquationSystemSharedPtr      &equ,
+            const Array<OneD, const NekDouble> &u)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr> &fields =
+                equ->UpdateFields();
+            int npts = equ->GetTotPoints();
+
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                Vmath::Vcopy(npts, &u[i*npts], 1,
+                             &fields[i]->UpdatePhys()[0], 1);
+            }
+        }
+
+
+        void DriverParareal::CopyFieldsToState(
+            const EquationSystemSharedPtr      &equ,
+                  Array<OneD, NekDouble>       &u)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr> &fields =
+                equ->UpdateFields();
+            int npts = equ->GetTotPoints();
+
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                Vmath::Vcopy(npts, &fields[i]->GetPhys()[0], 1,
+                             &u[i*npts], 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File DriverParareal.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Driver class for the Parareal parallel-in-time solver.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_DRIVERPARAREAL_H
+#define NEKTAR_SOLVERUTILS_DRIVERPARAREAL_H
+
+#include <SolverUtils/Driver.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        class DriverParareal: public Driver
+        {
+        public:
+            friend class MemoryManager<DriverParareal>;
+
+            /// Creates an instance of this class
+            static DriverSharedPtr create(const LibUtilities::SessionReaderSharedPtr& pSession) {
+                DriverSharedPtr p = MemoryManager<DriverParareal>::AllocateSharedPtr(pSession);
+                p->InitObject();
+                return p;
+            }
+
+            ///Name of the class
+            static std::string className;
+
+        protected:
+            /// Constructor
+            SOLVER_UTILS_EXPORT DriverParareal(const LibUtilities::SessionReaderSharedPtr pSession);
+
+            /// Destructor
+            SOLVER_UTILS_EXPORT virtual ~DriverParareal();
+
+            /// Second-stage initialisation
+            SOLVER_UTILS_EXPORT virtual void v_InitObject(ostream &out = cout);
+
+            /// Virtual function for solve implementation.
+            SOLVER_UTILS_EXPORT virtual void v_Execute(ostream &out = cout);
+
+            static std::string driverLookupId;
+
+        private:
+            /// Communicator linking the time slices.
+            LibUtilities::CommSharedPtr m_timeComm;
+            /// Number of time slices.
+            int       m_nslices;
+            /// Index of the time slice of this process.
+            int       m_slice;
+            /// Number of fine time steps in each slice.
+            int       m_sliceSteps;
+            /// Length of each time slice.
+            NekDouble m_sliceTime;
+            /// Time at the start of the first slice.
+            NekDouble m_initialTime;
+            /// Ratio of the coarse to the fine time step.
+            int       m_coarseRatio;
+            /// Maximum number of Parareal iterations.
+            int       m_maxIts;
+            /// Tolerance on the change of the slice end states.
+            NekDouble m_tolerance;
+            /// Local length of the state vector.
+            int       m_ntot;
+
+            void Propagate(
+                const EquationSystemSharedPtr      &equ,
+                const int                           slice,
+                const Array<OneD, const NekDouble> &u0,
+                      Array<OneD, NekDouble>       &u1);
+
+            void CopyStateToFields(
+                const EquationSystemSharedPtr      &equ,
+                const Array<OneD, const NekDouble> &u);
+
+            void CopyFieldsToState(
+                const EquationSystemSharedPtr      &equ,
+                      Array<OneD, NekDouble>       &u);
+        };
+    }
+}
+
+#endif //NEKTAR_SOLVERUTILS_DRIVERPARAREAL_H
@@ -341,6 +341,8 @@ namespace Nektar
                                                             Array<OneD, NekDouble> &output);
             
             SOLVER_UTILS_EXPORT inline void SetStepsToOne();
+
+            SOLVER_UTILS_EXPORT inline void SetTime(const NekDouble time);
             
             SOLVER_UTILS_EXPORT void ZeroPhysFields();
             
@@ -826,6 +828,12 @@ namespace Nektar
         {
             m_steps=1;
         }
+
+        /// Set the time at which the next call to DoSolve starts
+        inline void EquationSystem::SetTime(const NekDouble time)
+        {
+            m_time = time;
+        }
         
         inline void EquationSystem::CopyFromPhysField(const int i,
                                                       Array<OneD, NekDouble> &output)
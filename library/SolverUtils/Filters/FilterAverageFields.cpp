@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterAverageFields.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Accumulates time-averaged fields during time-stepping.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <SolverUtils/Filters/FilterAverageFields.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        std::string FilterAverageFields::className = GetFilterFactory().RegisterCreatorFunction("AverageFields", FilterAverageFields::create);
+
+        /**
+         * @class FilterAverageFields
+         *
+         * Keeps a running mean of the coefficients of every field. One
+         * sample is taken every SampleFrequency time steps (default 1).
+         * When OutputFrequency is set, the statistics are written to
+         * OutputFile_n.fld every OutputFrequency time steps and then reset,
+         * so each file holds one averaging window. Any partial window is
+         * written when time-stepping finishes. Without OutputFrequency a
+         * single window covers the whole run and is written to
+         * OutputFile.fld.
+         */
+        FilterAverageFields::FilterAverageFields(
+            const LibUtilities::SessionReaderSharedPtr &pSession,
+            const std::map<std::string, std::string> &pParams,
+            const std::string &pDefaultSuffix) :
+            Filter(pSession)
+        {
+            std::map<std::string, std::string>::const_iterator it;
+
+            it = pParams.find("OutputFile");
+            if (it == pParams.end())
+            {
+                m_outputFile = m_session->GetSessionName() + pDefaultSuffix;
+            }
+            else
+            {
+                ASSERTL0(!(it->second.empty()),
+                         "Missing parameter 'OutputFile'.");
+                m_outputFile = it->second;
+            }
+
+            it = pParams.find("SampleFrequency");
+            m_sampleFrequency = it == pParams.end() ? 1 :
+                atoi(it->second.c_str());
+            ASSERTL0(m_sampleFrequency > 0,
+                     "Parameter 'SampleFrequency' must be positive.");
+
+            it = pParams.find("OutputFrequency");
+            m_outputFrequency = it == pParams.end() ? 0 :
+                atoi(it->second.c_str());
+
+            m_index       = 0;
+            m_outputIndex = 0;
+            m_numSamples  = 0;
+            m_windowStart = 0.0;
+            m_fld = MemoryManager<LibUtilities::FieldIO>::AllocateSharedPtr(pSession->GetComm());
+        }
+
+        FilterAverageFields::~FilterAverageFields()
+        {
+
+        }
+
+        void FilterAverageFields::v_Initialise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            m_avgFields = Array<OneD, Array<OneD, NekDouble> >(pFields.num_elements());
+            for (int i = 0; i < pFields.num_elements(); ++i)
+            {
+                m_avgFields[i] = Array<OneD, NekDouble>(pFields[i]->GetNcoeffs(), 0.0);
+            }
+
+            m_index       = 0;
+            m_outputIndex = 0;
+            m_numSamples  = 0;
+            m_windowStart = time;
+        }
+
+        void FilterAverageFields::v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            m_index++;
+
+            if (m_index % m_sampleFrequency == 0)
+            {
+                m_numSamples++;
+                v_ProcessSample(pFields, time);
+            }
+
+            if (m_outputFrequency && m_index % m_outputFrequency == 0)
+            {
+                OutputStatistics(pFields, time);
+            }
+        }
+
+        void FilterAverageFields::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            if (m_numSamples > 0)
+            {
+                OutputStatistics(pFields, time);
+            }
+        }
+
+        bool FilterAverageFields::v_IsTimeDependent()
+        {
+            return true;
+        }
+
+        /**
+         * Updates the mean as \f$\bar{u} \leftarrow \bar{u} +
+         * (u - \bar{u})/n\f$, which avoids keeping a large running sum.
+         */
+        void FilterAverageFields::v_ProcessSample(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            NekDouble fac = 1.0 / m_numSamples;
+
+            for (int i = 0; i < pFields.num_elements(); ++i)
+            {
+                int ncoeffs = m_avgFields[i].num_elements();
+                Array<OneD, NekDouble> tmp(ncoeffs);
+
+                Vmath::Vsub(ncoeffs, pFields[i]->GetCoeffs(), 1,
+                            m_avgFields[i], 1, tmp, 1);
+                Vmath::Svtvp(ncoeffs, fac, tmp, 1,
+                             m_avgFields[i], 1, m_avgFields[i], 1);
+            }
+        }
+
+        void FilterAverageFields::v_PrepareOutput(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+            std::vector<std::string>                                &pVariables,
+            std::vector<Array<OneD, NekDouble> >                    &pCoeffs)
+        {
+            for (int i = 0; i < pFields.num_elements(); ++i)
+            {
+                pVariables.push_back(m_session->GetVariable(i));
+
+                // Fields of a different order are written in the layout of
+                // the first field.
+                if (pFields[i]->GetNcoeffs() == pFields[0]->GetNcoeffs())
+                {
+                    pCoeffs.push_back(m_avgFields[i]);
+                }
+                else
+                {
+                    Array<OneD, NekDouble> tmp(pFields[0]->GetNcoeffs());
+                    pFields[0]->ExtractCoeffsToCoeffs(pFields[i],
+                                                      m_avgFields[i], tmp);
+                    pCoeffs.push_back(tmp);
+                }
+            }
+        }
+
+        void FilterAverageFields::v_ResetStatistics()
+        {
+            for (int i = 0; i < m_avgFields.num_elements(); ++i)
+            {
+                Vmath::Zero(m_avgFields[i].num_elements(), m_avgFields[i], 1);
+            }
+        }
+
+        /**
+         * Writes the statistics of the current window and starts a new one.
+         */
+        void FilterAverageFields::OutputStatistics(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            std::vector<std::string>              variables;
+            std::vector<Array<OneD, NekDouble> >  coeffs;
+            v_PrepareOutput(pFields, variables, coeffs);
+
+            std::stringstream vOutputFilename;
+            if (m_outputFrequency)
+            {
+                vOutputFilename << m_outputFile << "_" << m_outputIndex << ".fld";
+            }
+            else
+            {
+                vOutputFilename << m_outputFile << ".fld";
+            }
+
+            std::vector<LibUtilities::FieldDefinitionsSharedPtr> FieldDef
+                = pFields[0]->GetFieldDefinitions();
+            std::vector<std::vector<NekDouble> > FieldData(FieldDef.size());
+
+            // copy Data into FieldData and set variable
+            for(int j = 0; j < variables.size(); ++j)
+            {
+                for(int i = 0; i < FieldDef.size(); ++i)
+                {
+                    FieldDef[i]->m_fields.push_back(variables[j]);
+                    pFields[0]->AppendFieldData(FieldDef[i], FieldData[i], coeffs[j]);
+                }
+            }
+
+            LibUtilities::FieldMetaDataMap fieldMetaDataMap;
+            fieldMetaDataMap["NumberOfFieldDumps"] =
+                boost::lexical_cast<std::string>(m_numSamples);
+            fieldMetaDataMap["StartTime"] =
+                boost::lexical_cast<std::string>(m_windowStart);
+            fieldMetaDataMap["Time"] =
+                boost::lexical_cast<std::string>(time);
+
+            m_fld->Write(vOutputFilename.str(), FieldDef, FieldData, fieldMetaDataMap);
+
+            m_outputIndex++;
+            m_numSamples  = 0;
+            m_windowStart = time;
+            v_ResetStatistics();
+        }
+    }
+}
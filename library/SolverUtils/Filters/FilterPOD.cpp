@@ -0,0 +1,523 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterPOD.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Streaming proper orthogonal decomposition of the solution
+//              fields.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <limits>
+
+#include <SolverUtils/Filters/FilterPOD.h>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        std::string FilterPOD::className = GetFilterFactory().RegisterCreatorFunction("POD", FilterPOD::create);
+
+        /**
+         * @class FilterPOD
+         *
+         * Computes the proper orthogonal decomposition of the snapshots
+         * while the solver runs, so the snapshots never need to be stored.
+         * Each sample updates a thin singular value decomposition
+         * \f$X \approx U \Sigma V^T\f$ of the snapshot matrix with the
+         * incremental algorithm of Brand (2006). It is truncated to at
+         * most NumModes modes (default 10). Each snapshot holds all
+         * fields. The inner product is the \f$L^2\f$ (mass matrix) inner
+         * product evaluated by quadrature. For this the snapshots are
+         * scaled by the square root of the quadrature weights. Homogeneous
+         * expansions use unit weights instead. Only the projections onto
+         * the current modes need global reductions, so the update works in
+         * parallel.
+         *
+         * The POD modes are written to OutputFile_pod_j.fld. The singular
+         * values and the temporal coefficients \f$\Sigma V^T\f$ are written
+         * to OutputFile.pod. With DMD set to 1, a dynamic mode
+         * decomposition is also computed from the temporal coefficients.
+         * This is the projected DMD of Schmid (2010). The eigenvalues
+         * go to OutputFile.dmd and the modes to OutputFile_dmd_j.fld.
+         * Complex modes are stored as consecutive real and imaginary
+         * parts. Output is written when time-stepping finishes and, if
+         * OutputFrequency is set, every OutputFrequency time steps.
+         */
+        FilterPOD::FilterPOD(
+            const LibUtilities::SessionReaderSharedPtr &pSession,
+            const std::map<std::string, std::string> &pParams) :
+            Filter(pSession)
+        {
+            std::map<std::string, std::string>::const_iterator it;
+
+            it = pParams.find("OutputFile");
+            if (it == pParams.end())
+            {
+                m_outputFile = m_session->GetSessionName() + "_pod";
+            }
+            else
+            {
+                ASSERTL0(!(it->second.empty()),
+                         "Missing parameter 'OutputFile'.");
+                m_outputFile = it->second;
+            }
+
+            it = pParams.find("SampleFrequency");
+            m_sampleFrequency = it == pParams.end() ? 1 :
+                atoi(it->second.c_str());
+            ASSERTL0(m_sampleFrequency > 0,
+                     "Parameter 'SampleFrequency' must be positive.");
+
+            it = pParams.find("OutputFrequency");
+            m_outputFrequency = it == pParams.end() ? 0 :
+                atoi(it->second.c_str());
+
+            it = pParams.find("NumModes");
+            m_maxModes = it == pParams.end() ? 10 :
+                atoi(it->second.c_str());
+            ASSERTL0(m_maxModes > 0,
+                     "Parameter 'NumModes' must be positive.");
+
+            it = pParams.find("DMD");
+            m_dmd = it != pParams.end() && atoi(it->second.c_str()) != 0;
+
+            m_index  = 0;
+            m_nmodes = 0;
+            m_comm   = pSession->GetComm();
+            m_fld = MemoryManager<LibUtilities::FieldIO>::AllocateSharedPtr(pSession->GetComm());
+        }
+
+        FilterPOD::~FilterPOD()
+        {
+
+        }
+
+        void FilterPOD::v_Initialise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            m_npts = pFields[0]->GetNpoints();
+            m_ntot = pFields.num_elements() * m_npts;
+
+            for (int i = 1; i < pFields.num_elements(); ++i)
+            {
+                ASSERTL0(pFields[i]->GetNpoints() == m_npts,
+                         "The POD filter requires all fields to use the "
+                         "same quadrature points.");
+            }
+
+            m_sqrtW = Array<OneD, NekDouble>(m_npts, 1.0);
+            if (pFields[0]->GetExpType() != MultiRegions::e3DH1D &&
+                pFields[0]->GetExpType() != MultiRegions::e3DH2D)
+            {
+                Array<OneD, NekDouble> tmp;
+                for (int n = 0; n < pFields[0]->GetExpSize(); ++n)
+                {
+                    int nq = pFields[0]->GetExp(n)->GetTotPoints();
+                    Array<OneD, NekDouble> ones(nq, 1.0);
+                    pFields[0]->GetExp(n)->MultiplyByQuadratureMetric(
+                        ones, tmp = m_sqrtW + pFields[0]->GetPhys_Offset(n));
+                }
+                Vmath::Vsqrt(m_npts, m_sqrtW, 1, m_sqrtW, 1);
+            }
+
+            m_modes  = Array<OneD, NekDouble>(m_ntot * (m_maxModes + 1), 0.0);
+            m_sigma  = Array<OneD, NekDouble>(m_maxModes + 1, 0.0);
+            m_nmodes = 0;
+            m_index  = 0;
+            m_rightVec.clear();
+            m_times.clear();
+        }
+
+        void FilterPOD::v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            m_index++;
+
+            if (m_index % m_sampleFrequency == 0)
+            {
+                AddSnapshot(pFields);
+                m_times.push_back(time);
+            }
+
+            if (m_outputFrequency && m_index % m_outputFrequency == 0)
+            {
+                OutputModes(pFields);
+                if (m_dmd)
+                {
+                    OutputDMD(pFields);
+                }
+            }
+        }
+
+        void FilterPOD::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            OutputModes(pFields);
+            if (m_dmd)
+            {
+                OutputDMD(pFields);
+            }
+        }
+
+        bool FilterPOD::v_IsTimeDependent()
+        {
+            return true;
+        }
+
+        /**
+         * Rank-one update of the decomposition. With \f$p = U^T y\f$,
+         * residual \f$\rho q = y - U p\f$ and the SVD
+         * \f[ K = \left[\begin{array}{cc} \Sigma & p \\ 0 & \rho
+         *     \end{array}\right] = U_K \Sigma_K V_K^T, \f]
+         * the new factors are \f$[U\ q]U_K\f$, \f$\Sigma_K\f$ and
+         * \f$\mathrm{diag}(V, 1) V_K\f$. They are truncated to the leading
+         * NumModes singular values.
+         */
+        void FilterPOD::AddSnapshot(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+        {
+            const int k      = m_nmodes;
+            const int kp     = k + 1;
+            const int stride = m_maxModes + 1;
+            const int nsnap  = m_times.size();
+
+            // Weighted snapshot.
+            Array<OneD, NekDouble> y(m_ntot), tmp;
+            for (int i = 0; i < pFields.num_elements(); ++i)
+            {
+                if (pFields[i]->GetWaveSpace())
+                {
+                    pFields[i]->HomogeneousBwdTrans(pFields[i]->GetPhys(),
+                                                    tmp = y + i*m_npts);
+                }
+                else
+                {
+                    Vmath::Vcopy(m_npts, pFields[i]->GetPhys(), 1,
+                                 tmp = y + i*m_npts, 1);
+                }
+                Vmath::Vmul(m_npts, m_sqrtW, 1, tmp = y + i*m_npts, 1,
+                            tmp = y + i*m_npts, 1);
+            }
+
+            NekDouble ynorm = Vmath::Dot(m_ntot, y, 1, y, 1);
+            m_comm->AllReduce(ynorm, LibUtilities::ReduceSum);
+            ynorm = sqrt(ynorm);
+
+            // Project onto the current modes, with one pass of
+            // reorthogonalisation. The residual is left in y.
+            Array<OneD, NekDouble> p(kp, 0.0);
+            if (k > 0)
+            {
+                Array<OneD, NekDouble> dp(k);
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    Blas::Dgemv('T', m_ntot, k, 1.0, m_modes.get(), m_ntot,
+                                y.get(), 1, 0.0, dp.get(), 1);
+                    m_comm->AllReduce(dp, LibUtilities::ReduceSum);
+                    Blas::Dgemv('N', m_ntot, k, -1.0, m_modes.get(), m_ntot,
+                                dp.get(), 1, 1.0, y.get(), 1);
+                    Vmath::Vadd(k, &dp[0], 1, &p[0], 1, &p[0], 1);
+                }
+            }
+
+            NekDouble rho = Vmath::Dot(m_ntot, y, 1, y, 1);
+            m_comm->AllReduce(rho, LibUtilities::ReduceSum);
+            rho = sqrt(rho);
+
+            NekDouble scale = (k > 0) ? std::max(ynorm, m_sigma[0]) : ynorm;
+            if (rho <= NekConstants::kNekZeroTol * scale)
+            {
+                // The snapshot lies in the span of the current modes.
+                rho = 0.0;
+                Vmath::Zero(m_ntot, &m_modes[k*m_ntot], 1);
+            }
+            else
+            {
+                Vmath::Smul(m_ntot, 1.0/rho, &y[0], 1, &m_modes[k*m_ntot], 1);
+            }
+
+            // SVD of the small core matrix.
+            Array<OneD, NekDouble> K  (kp*kp, 0.0);
+            Array<OneD, NekDouble> s  (kp);
+            Array<OneD, NekDouble> Uk (kp*kp);
+            Array<OneD, NekDouble> VkT(kp*kp);
+            for (int j = 0; j < k; ++j)
+            {
+                K[j + j*kp] = m_sigma[j];
+                K[j + k*kp] = p[j];
+            }
+            K[k + k*kp] = rho;
+
+            int info  = 0;
+            int lwork = 10*kp;
+            Array<OneD, NekDouble> work(lwork);
+            Lapack::Dgesvd('A', 'A', kp, kp, K.get(), kp, s.get(),
+                           Uk.get(), kp, VkT.get(), kp,
+                           work.get(), lwork, info);
+            ASSERTL0(!info, "Error with dgesvd");
+
+            int knew = 0;
+            while (knew < kp && knew < m_maxModes &&
+                   s[knew] > NekConstants::kNekZeroTol * s[0])
+            {
+                ++knew;
+            }
+
+            // Rotate the modes in blocks of rows: U <- [U q] U_K.
+            const int blk = 256;
+            Array<OneD, NekDouble> buf(blk*kp);
+            for (int r0 = 0; r0 < m_ntot && knew > 0; r0 += blk)
+            {
+                int nb = std::min(blk, m_ntot - r0);
+                for (int j = 0; j < kp; ++j)
+                {
+                    Vmath::Vcopy(nb, &m_modes[r0 + j*m_ntot], 1,
+                                 &buf[j*nb], 1);
+                }
+                Blas::Dgemm('N', 'N', nb, knew, kp, 1.0, buf.get(), nb,
+                            Uk.get(), kp, 0.0, &m_modes[r0], m_ntot);
+            }
+
+            // Update the right singular vectors: V <- diag(V, 1) V_K.
+            m_rightVec.resize((nsnap + 1)*stride, 0.0);
+            Array<OneD, NekDouble> row(kp);
+            for (int t = 0; t <= nsnap; ++t)
+            {
+                NekDouble *v = &m_rightVec[t*stride];
+                if (t < nsnap)
+                {
+                    Vmath::Vcopy(k, v, 1, &row[0], 1);
+                    row[k] = 0.0;
+                }
+                else
+                {
+                    Vmath::Zero(k, &row[0], 1);
+                    row[k] = 1.0;
+                }
+
+                Vmath::Zero(stride, v, 1);
+                for (int l = 0; l < knew; ++l)
+                {
+                    v[l] = Vmath::Dot(kp, &row[0], 1, &VkT[l], kp);
+                }
+            }
+
+            Vmath::Zero(m_maxModes + 1, m_sigma, 1);
+            Vmath::Vcopy(knew, s, 1, m_sigma, 1);
+            m_nmodes = knew;
+        }
+
+        void FilterPOD::OutputModes(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+        {
+            const int stride = m_maxModes + 1;
+
+            for (int j = 0; j < m_nmodes; ++j)
+            {
+                std::stringstream vOutputFilename;
+                vOutputFilename << m_outputFile << "_pod_" << j << ".fld";
+                WriteMode(pFields, m_modes + j*m_ntot, vOutputFilename.str());
+            }
+
+            if (m_comm->GetRank() == 0)
+            {
+                std::ofstream os((m_outputFile + ".pod").c_str());
+                os << "# Singular values:";
+                for (int j = 0; j < m_nmodes; ++j)
+                {
+                    os << " " << m_sigma[j];
+                }
+                os << endl;
+                os << "# Time, temporal coefficients" << endl;
+
+                for (int t = 0; t < m_times.size(); ++t)
+                {
+                    os << std::setw(14) << m_times[t];
+                    for (int j = 0; j < m_nmodes; ++j)
+                    {
+                        os << std::setw(25)
+                           << m_sigma[j] * m_rightVec[t*stride + j];
+                    }
+                    os << endl;
+                }
+            }
+        }
+
+        /**
+         * Projected DMD from the temporal coefficients
+         * \f$A = \Sigma V^T\f$. With \f$A_1\f$ and \f$A_2\f$ the first and
+         * last \f$m-1\f$ columns, the reduced operator is
+         * \f$\tilde{A} = A_2 A_1^{+}\f$. The DMD modes are \f$U W\f$, where
+         * \f$W\f$ holds the eigenvectors of \f$\tilde{A}\f$.
+         */
+        void FilterPOD::OutputDMD(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+        {
+            const int k      = m_nmodes;
+            const int m      = m_times.size();
+            const int stride = m_maxModes + 1;
+
+            if (k == 0 || m < 2)
+            {
+                return;
+            }
+
+            Array<OneD, NekDouble> A(k*m);
+            for (int t = 0; t < m; ++t)
+            {
+                for (int l = 0; l < k; ++l)
+                {
+                    A[l + t*k] = m_sigma[l] * m_rightVec[t*stride + l];
+                }
+            }
+
+            // Pseudo-inverse of A_1 through its SVD A_1 = Z S W^T.
+            const int r = std::min(k, m - 1);
+            Array<OneD, NekDouble> A1(k*(m-1));
+            Array<OneD, NekDouble> s (r);
+            Array<OneD, NekDouble> Z (k*r);
+            Array<OneD, NekDouble> WT(r*(m-1));
+            Vmath::Vcopy(k*(m-1), A, 1, A1, 1);
+
+            int info  = 0;
+            int lwork = 5*(k + m);
+            Array<OneD, NekDouble> work(lwork);
+            Lapack::Dgesvd('S', 'S', k, m-1, A1.get(), k, s.get(),
+                           Z.get(), k, WT.get(), r,
+                           work.get(), lwork, info);
+            ASSERTL0(!info, "Error with dgesvd");
+
+            int q = 0;
+            while (q < r && s[q] > NekConstants::kNekZeroTol * s[0])
+            {
+                ++q;
+            }
+            if (q == 0)
+            {
+                return;
+            }
+
+            // B = A_2 W S^{-1}, then At = B Z^T.
+            Array<OneD, NekDouble> B (k*r);
+            Array<OneD, NekDouble> At(k*k);
+            Blas::Dgemm('N', 'T', k, q, m-1, 1.0, &A[k], k, WT.get(), r,
+                        0.0, B.get(), k);
+            for (int j = 0; j < q; ++j)
+            {
+                Vmath::Smul(k, 1.0/s[j], &B[j*k], 1, &B[j*k], 1);
+            }
+            Blas::Dgemm('N', 'T', k, k, q, 1.0, B.get(), k, Z.get(), k,
+                        0.0, At.get(), k);
+
+            Array<OneD, NekDouble> wr(k), wi(k), W(k*k);
+            Array<OneD, NekDouble> work2(10*k);
+            Lapack::Dgeev('N', 'V', k, At.get(), k, wr.get(), wi.get(),
+                          0, 1, W.get(), k, work2.get(), 10*k, info);
+            ASSERTL0(!info, "Error with dgeev");
+
+            if (m_comm->GetRank() == 0)
+            {
+                NekDouble dt = (m_times[m-1] - m_times[0]) / (m - 1);
+
+                std::ofstream os((m_outputFile + ".dmd").c_str());
+                os << "# Mode, Re(lambda), Im(lambda), growth rate, "
+                   << "frequency" << endl;
+                for (int j = 0; j < k; ++j)
+                {
+                    // A zero eigenvalue, e.g. of a mode which vanishes
+                    // after one sample, is given the fastest decay rate
+                    // representable rather than an infinite one.
+                    NekDouble mag = sqrt(wr[j]*wr[j] + wi[j]*wi[j]);
+                    mag = std::max(mag, std::numeric_limits<NekDouble>::min());
+                    os << std::setw(6)  << j
+                       << std::setw(25) << wr[j]
+                       << std::setw(25) << wi[j]
+                       << std::setw(25) << log(mag) / dt
+                       << std::setw(25) << atan2(wi[j], wr[j]) / dt
+                       << endl;
+                }
+            }
+
+            Array<OneD, NekDouble> mode(m_ntot);
+            for (int j = 0; j < k; ++j)
+            {
+                Blas::Dgemv('N', m_ntot, k, 1.0, m_modes.get(), m_ntot,
+                            &W[j*k], 1, 0.0, mode.get(), 1);
+
+                std::stringstream vOutputFilename;
+                vOutputFilename << m_outputFile << "_dmd_" << j << ".fld";
+                WriteMode(pFields, mode, vOutputFilename.str());
+            }
+        }
+
+        /**
+         * Removes the quadrature weighting from @a pMode and writes it to
+         * @a pFilename.
+         */
+        void FilterPOD::WriteMode(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+            const Array<OneD, const NekDouble>                      &pMode,
+            const std::string                                       &pFilename)
+        {
+            std::vector<LibUtilities::FieldDefinitionsSharedPtr> FieldDef
+                = pFields[0]->GetFieldDefinitions();
+            std::vector<std::vector<NekDouble> > FieldData(FieldDef.size());
+
+            Array<OneD, NekDouble> phys(m_npts);
+            for (int j = 0; j < pFields.num_elements(); ++j)
+            {
+                Vmath::Vdiv(m_npts, &pMode[j*m_npts], 1, &m_sqrtW[0], 1,
+                            &phys[0], 1);
+
+                Array<OneD, NekDouble> coeffs(pFields[j]->GetNcoeffs());
+                pFields[j]->FwdTrans_IterPerExp(phys, coeffs);
+
+                // The modes are built from physical space samples, which
+                // the transform takes to be wave space if the field is.
+                if (pFields[j]->GetWaveSpace())
+                {
+                    pFields[j]->HomogeneousFwdTrans(coeffs, coeffs);
+                }
+
+                if (pFields[j]->GetNcoeffs() != pFields[0]->GetNcoeffs())
+                {
+                    Array<OneD, NekDouble> tmp(pFields[0]->GetNcoeffs());
+                    pFields[0]->ExtractCoeffsToCoeffs(pFields[j], coeffs, tmp);
+                    coeffs = tmp;
+                }
+
+                for(int i = 0; i < FieldDef.size(); ++i)
+                {
+                    FieldDef[i]->m_fields.push_back(m_session->GetVariable(j));
+                    pFields[0]->AppendFieldData(FieldDef[i], FieldData[i], coeffs);
+                }
+            }
+
+            m_fld->Write(pFilename, FieldDef, FieldData);
+        }
+    }
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterPOD.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Streaming proper orthogonal decomposition of the solution
+//              fields.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERPOD_H
+#define NEKTAR_SOLVERUTILS_FILTERS_FILTERPOD_H
+
+#include <SolverUtils/Filters/Filter.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        class FilterPOD : public Filter
+        {
+        public:
+            friend class MemoryManager<FilterPOD>;
+
+            /// Creates an instance of this class
+            static FilterSharedPtr create(
+                const LibUtilities::SessionReaderSharedPtr &pSession,
+                const std::map<std::string, std::string> &pParams) {
+                FilterSharedPtr p = MemoryManager<FilterPOD>::AllocateSharedPtr(pSession, pParams);
+                //p->InitObject();
+                return p;
+            }
+
+            ///Name of the class
+            static std::string className;
+
+            SOLVER_UTILS_EXPORT FilterPOD(
+                const LibUtilities::SessionReaderSharedPtr &pSession,
+                const std::map<std::string, std::string> &pParams);
+            SOLVER_UTILS_EXPORT ~FilterPOD();
+
+        protected:
+            virtual void v_Initialise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
+            virtual void v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
+            virtual void v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
+            virtual bool v_IsTimeDependent();
+
+        private:
+            unsigned int m_index;
+            unsigned int m_sampleFrequency;
+            unsigned int m_outputFrequency;
+            /// Maximum number of modes kept.
+            int m_maxModes;
+            /// Current number of modes.
+            int m_nmodes;
+            /// Also compute the dynamic mode decomposition on output.
+            bool m_dmd;
+            /// Number of quadrature points per field.
+            int m_npts;
+            /// Local length of a snapshot.
+            int m_ntot;
+            std::string m_outputFile;
+            LibUtilities::FieldIOSharedPtr m_fld;
+            LibUtilities::CommSharedPtr m_comm;
+
+            /// Square root of the quadrature weights.
+            Array<OneD, NekDouble> m_sqrtW;
+            /// Weighted POD modes, stored by column with one spare column.
+            Array<OneD, NekDouble> m_modes;
+            /// Singular values.
+            Array<OneD, NekDouble> m_sigma;
+            /// Right singular vectors, one row of m_maxModes + 1 entries
+            /// per snapshot.
+            std::vector<NekDouble> m_rightVec;
+            /// Time of each snapshot.
+            std::vector<NekDouble> m_times;
+
+            void AddSnapshot(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields);
+
+            void OutputModes(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields);
+
+            void OutputDMD(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields);
+
+            void WriteMode(
+                const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+                const Array<OneD, const NekDouble>                      &pMode,
+                const std::string                                       &pFilename);
+        };
+    }
+}
+
+#endif /* NEKTAR_SOLVERUTILS_FILTERS_FILTERPOD_H */
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterReynoldsStresses.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Accumulates mean fields and Reynolds stresses during
+//              time-stepping.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <SolverUtils/Filters/FilterReynoldsStresses.h>
+
+namespace Nektar
+{
+    namespace SolverUtils
+    {
+        std::string FilterReynoldsStresses::className = GetFilterFactory().RegisterCreatorFunction("ReynoldsStresses", FilterReynoldsStresses::create);
+
+        /**
+         * @class FilterReynoldsStresses
+         *
+         * Writes the mean of every field, as FilterAverageFields does, and
+         * the Reynolds stresses \f$\overline{u_i' u_j'}\f$ of the velocity
+         * components. The velocity components are the first fields, one
+         * for each direction of space. The products are not linear in
+         * the coefficients, so the stresses are accumulated at the
+         * quadrature points. They are projected onto the expansion only
+         * when a file is written. Welford's update is used, which avoids
+         * the cancellation of forming \f$\overline{u_i u_j} - \bar{u}_i
+         * \bar{u}_j\f$ over long windows.
+         */
+        FilterReynoldsStresses::FilterReynoldsStresses(
+            const LibUtilities::SessionReaderSharedPtr &pSession,
+            const std::map<std::string, std::string> &pParams) :
+            FilterAverageFields(pSession, pParams, "_stress")
+        {
+        }
+
+        FilterReynoldsStresses::~FilterReynoldsStresses()
+        {
+
+        }
+
+        void FilterReynoldsStresses::v_Initialise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            FilterAverageFields::v_Initialise(pFields, time);
+
+            // Homogeneous expansions have three velocity components on a
+            // mesh of lower dimension.
+            m_nvel = pFields[0]->GetCoordim(0);
+            if (m_session->DefinesSolverInfo("HOMOGENEOUS"))
+            {
+                m_nvel = 3;
+            }
+            ASSERTL0(m_nvel <= pFields.num_elements(),
+                     "Not enough fields for the velocity components.");
+
+            m_stressPairs.clear();
+            for (int i = 0; i < m_nvel; ++i)
+            {
+                m_stressPairs.push_back(std::make_pair(i, i));
+            }
+            for (int i = 0; i < m_nvel; ++i)
+            {
+                for (int j = i + 1; j < m_nvel; ++j)
+                {
+                    m_stressPairs.push_back(std::make_pair(i, j));
+                }
+            }
+
+            int npts  = pFields[0]->GetNpoints();
+            m_velMean = Array<OneD, Array<OneD, NekDouble> >(m_nvel);
+            m_stress  = Array<OneD, Array<OneD, NekDouble> >(m_stressPairs.size());
+            for (int i = 0; i < m_nvel; ++i)
+            {
+                m_velMean[i] = Array<OneD, NekDouble>(npts, 0.0);
+            }
+            for (int i = 0; i < m_stressPairs.size(); ++i)
+            {
+                m_stress[i] = Array<OneD, NekDouble>(npts, 0.0);
+            }
+        }
+
+        /**
+         * For each sample \f$n\f$ the update is
+         * \f$\delta_i = u_i - \bar{u}_i\f$, \f$\bar{u}_i \leftarrow
+         * \bar{u}_i + \delta_i/n\f$ and \f$S_{ij} \leftarrow S_{ij} +
+         * \delta_i (u_j - \bar{u}_j)\f$.
+         */
+        void FilterReynoldsStresses::v_ProcessSample(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            FilterAverageFields::v_ProcessSample(pFields, time);
+
+            int npts      = m_velMean[0].num_elements();
+            NekDouble fac = 1.0 / m_numSamples;
+
+            Array<OneD, Array<OneD, NekDouble> > delta(m_nvel);
+            Array<OneD, Array<OneD, NekDouble> > vel  (m_nvel);
+            for (int i = 0; i < m_nvel; ++i)
+            {
+                vel[i]   = Array<OneD, NekDouble>(npts);
+                delta[i] = Array<OneD, NekDouble>(npts);
+
+                if (pFields[i]->GetWaveSpace())
+                {
+                    pFields[i]->HomogeneousBwdTrans(pFields[i]->GetPhys(),
+                                                    vel[i]);
+                }
+                else
+                {
+                    Vmath::Vcopy(npts, pFields[i]->GetPhys(), 1, vel[i], 1);
+                }
+
+                Vmath::Vsub (npts, vel[i], 1, m_velMean[i], 1, delta[i], 1);
+                Vmath::Svtvp(npts, fac, delta[i], 1, m_velMean[i], 1,
+                             m_velMean[i], 1);
+
+                // Deviation from the updated mean.
+                Vmath::Vsub (npts, vel[i], 1, m_velMean[i], 1, vel[i], 1);
+            }
+
+            for (int n = 0; n < m_stressPairs.size(); ++n)
+            {
+                int i = m_stressPairs[n].first;
+                int j = m_stressPairs[n].second;
+                Vmath::Vvtvp(npts, delta[i], 1, vel[j], 1,
+                             m_stress[n], 1, m_stress[n], 1);
+            }
+        }
+
+        void FilterReynoldsStresses::v_PrepareOutput(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+            std::vector<std::string>                                &pVariables,
+            std::vector<Array<OneD, NekDouble> >                    &pCoeffs)
+        {
+            FilterAverageFields::v_PrepareOutput(pFields, pVariables, pCoeffs);
+
+            int npts      = m_velMean[0].num_elements();
+            NekDouble fac = 1.0 / m_numSamples;
+            Array<OneD, NekDouble> tmp(npts);
+
+            for (int n = 0; n < m_stressPairs.size(); ++n)
+            {
+                int i = m_stressPairs[n].first;
+                int j = m_stressPairs[n].second;
+
+                Array<OneD, NekDouble> coeffs(pFields[0]->GetNcoeffs());
+                Vmath::Smul(npts, fac, m_stress[n], 1, tmp, 1);
+                pFields[0]->FwdTrans_IterPerExp(tmp, coeffs);
+
+                // The stresses are held in physical space, which the
+                // transform takes to be wave space if the field is.
+                if (pFields[0]->GetWaveSpace())
+                {
+                    pFields[0]->HomogeneousFwdTrans(coeffs, coeffs);
+                }
+
+                pVariables.push_back(m_session->GetVariable(i) +
+                                     m_session->GetVariable(j));
+                pCoeffs.push_back(coeffs);
+            }
+        }
+
+        void FilterReynoldsStresses::v_ResetStatistics()
+        {
+            FilterAverageFields::v_ResetStatistics();
+
+            for (int i = 0; i < m_nvel; ++i)
+            {
+                Vmath::Zero(m_velMean[i].num_elements(), m_velMean[i], 1);
+            }
+            for (int i = 0; i < m_stress.num_elements(); ++i)
+            {
+                Vmath::Zero(m_stress[i].num_elements(), m_stress[i], 1);
+            }
+        }
+    }
+}
@@ -157,8 +157,27 @@ namespace Nektar
             switch(velLoc.num_elements())
             {
                 case 1:
-                    ASSERTL0(false, "1D not implemented yet.");
+                {
+                    // The rotation is a reflection by the sign of the normal
+                    // and is its own inverse.
+                    const int vx = (int)velLoc[0];
+                    const int nq = inarray[0].num_elements();
+
+                    Vmath::Vmul (nq, inarray [vx], 1, normals [0],  1,
+                                     outarray[vx], 1);
+
+                    for (int i = 0; i < inarray.num_elements(); ++i)
+                    {
+                        if (i == vx)
+                        {
+                            continue;
+                        }
+
+                        Vmath::Vcopy(inarray [i].num_elements(), inarray[i], 1,
+                                     outarray[i], 1);
+                    }
                     break;
+                }
 
                 case 2:
                 {
@@ -255,8 +274,27 @@ namespace Nektar
             switch(normals.num_elements())
             {
                 case 1:
-                    ASSERTL0(false, "1D not implemented yet.");
+                {
+                    // The rotation is a reflection by the sign of the normal
+                    // and is its own inverse.
+                    const int vx = (int)velLoc[0];
+                    const int nq = inarray[0].num_elements();
+
+                    Vmath::Vmul (nq, inarray [vx], 1, normals [0],  1,
+                                     outarray[vx], 1);
+
+                    for (int i = 0; i < inarray.num_elements(); ++i)
+                    {
+                        if (i == vx)
+                        {
+                            continue;
+                        }
+
+                        Vmath::Vcopy(inarray [i].num_elements(), inarray[i], 1,
+                                     outarray[i], 1);
+                    }
                     break;
+                }
                     
                 case 2:
                 {
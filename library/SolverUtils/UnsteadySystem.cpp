@@ -380,6 +380,11 @@ namespace Nektar
                          << "CFL time-step     : " << m_timestep        << endl;
                 }
                 cout << "Time-integration  : " << intTime  << "s"   << endl;
+
+                if (m_session->DefinesCmdLineArgument("verbose"))
+                {
+                    SpatialDomains::GeomFactors::PrintCacheStatistics(cout);
+                }
             }
             
             // If homogeneous, transform back into physical space if necessary.
@@ -655,6 +660,26 @@ namespace Nektar
             }
         }
 
+        /**
+         * Unless the equation system integrates only some of its fields,
+         * such as the velocity components of the incompressible
+         * Navier-Stokes equations, all fields are integrated.
+         */
+        std::vector<int> UnsteadySystem::GetIntVariables()
+        {
+            if (!m_intVariables.empty())
+            {
+                return m_intVariables;
+            }
+
+            std::vector<int> intVariables;
+            for (int i = 0; i < m_fields.num_elements(); ++i)
+            {
+                intVariables.push_back(i);
+            }
+            return intVariables;
+        }
+
         void UnsteadySystem::CheckForRestartTime(NekDouble &time)
         {
             if (m_session->DefinesFunction("InitialConditions"))
@@ -55,6 +55,9 @@ namespace Nektar
             SOLVER_UTILS_EXPORT NekDouble GetTimeStep(
                 const Array<OneD, const Array<OneD, NekDouble> > &inarray);
 		
+            /// Indices of the fields which are integrated in time.
+            SOLVER_UTILS_EXPORT std::vector<int> GetIntVariables();
+
             /// CFL safety factor (comprise between 0 to 1).
             NekDouble m_cflSafetyFactor;
 		                        
@@ -36,6 +36,12 @@
 #include <SpatialDomains/GeomFactors.h>
 #include <LibUtilities/Foundations/Interp.h>
 
+#include <boost/weak_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <cmath>
+#include <iomanip>
+
 namespace Nektar
 {
     namespace SpatialDomains
@@ -96,7 +102,8 @@ namespace Nektar
             m_coordDim(coordim),
             m_valid(true),
             m_xmap(xmap),
-            m_coords(coords)
+            m_coords(coords),
+            m_congruentSet(false)
         {
             CheckIfValid();
         }
@@ -112,7 +119,8 @@ namespace Nektar
             m_coordDim(S.m_coordDim),
             m_valid(S.m_valid),
             m_xmap(S.m_xmap),
-            m_coords(S.m_coords)
+            m_coords(S.m_coords),
+            m_congruentSet(false)
         {
         }
 
@@ -120,8 +128,434 @@ namespace Nektar
         /**
          *
          */
+        /// Guards the geometric factor caches of all elements, which may be
+        /// filled concurrently while elemental matrices are set up.
+        static boost::mutex cacheMutex;
+
+        /// Guards the representatives of congruent elements.
+        static boost::mutex congruentMutex;
+
         GeomFactors::~GeomFactors()
         {
+            boost::mutex::scoped_lock lock(cacheMutex);
+            for (JacCache::iterator it = m_jacCache.begin();
+                 it != m_jacCache.end(); ++it)
+            {
+                RemoveCacheEntry(it->second.m_lru, false);
+            }
+            for (DerivCache::iterator it = m_derivFactorCache.begin();
+                 it != m_derivFactorCache.end(); ++it)
+            {
+                RemoveCacheEntry(it->second.m_lru, false);
+            }
+        }
+
+
+        NekDouble GeomFactors::m_congruenceTol = 1e-12;
+
+        /// Representatives of each class of congruent elements, binned by
+        /// GeomFactors::GetCongruenceHash.
+        static std::multimap<size_t, boost::weak_ptr<GeomFactors> >
+                                                congruentFactors;
+
+        /**
+         * Two elements are congruent if their Jacobians and derivative
+         * factors, evaluated at the points of the coordinate map, agree to
+         * within the congruence tolerance relative to their magnitude. Since
+         * these do not depend on the position of the element, translated
+         * copies of an element are congruent and all quantities built from the
+         * metric terms, such as elemental matrices, can be shared between
+         * them. Moving geometries are never identified.
+         *
+         * The result is cached, so that subsequent calls only return a
+         * pointer.
+         *
+         * @param   geom        Geometric factors of an element.
+         * @returns             Representative of the elements congruent to
+         *                      @a geom, which may be @a geom itself.
+         */
+        GeomFactorsSharedPtr GeomFactors::GetCongruent(
+                const GeomFactorsSharedPtr &geom)
+        {
+            boost::mutex::scoped_lock lock(congruentMutex);
+
+            if (geom->m_congruentSet)
+            {
+                return geom->m_congruent ? geom->m_congruent : geom;
+            }
+
+            geom->m_congruentSet = true;
+
+            if (m_congruenceTol < 0.0 || !geom->m_valid ||
+                (geom->m_type != eRegular && geom->m_type != eDeformed))
+            {
+                return geom;
+            }
+
+            size_t hash = geom->GetCongruenceHash();
+
+            typedef std::multimap<size_t, boost::weak_ptr<GeomFactors> >
+                                                    CongruentMap;
+            std::pair<CongruentMap::iterator, CongruentMap::iterator> range =
+                congruentFactors.equal_range(hash);
+
+            CongruentMap::iterator it = range.first;
+            while (it != range.second)
+            {
+                GeomFactorsSharedPtr rep = it->second.lock();
+                if (!rep)
+                {
+                    congruentFactors.erase(it++);
+                    continue;
+                }
+
+                if (rep.get() == geom.get())
+                {
+                    return geom;
+                }
+
+                if (geom->IsCongruent(*rep))
+                {
+                    geom->m_congruent = rep;
+                    return rep;
+                }
+                ++it;
+            }
+
+            congruentFactors.insert(
+                std::make_pair(hash, boost::weak_ptr<GeomFactors>(geom)));
+            return geom;
+        }
+
+
+        /**
+         * @param   tol         Relative tolerance. Only affects elements not
+         *                      yet identified.
+         */
+        void GeomFactors::SetCongruenceTolerance(const NekDouble tol)
+        {
+            m_congruenceTol = tol;
+        }
+
+
+        GeomFactors::CacheList GeomFactors::m_cacheLRU;
+        size_t GeomFactors::m_cacheBudget = 0;
+        size_t GeomFactors::m_cacheBytes  = 0;
+
+        /// Memory statistics of the geometric factor caches, per element
+        /// type.
+        struct CacheStatistics
+        {
+            CacheStatistics() : m_bytes(0), m_peakBytes(0), m_computed(0),
+                                m_evicted(0) {}
+
+            size_t m_bytes;
+            size_t m_peakBytes;
+            size_t m_computed;
+            size_t m_evicted;
+        };
+        static CacheStatistics cacheStats[LibUtilities::SIZE_ShapeType];
+
+        /**
+         * Returns cached value if available, otherwise computes Jacobian and
+         * stores result in cache.
+         *
+         * @param   keyTgt      Target point distributions.
+         * @returns             Jacobian evaluated at target point
+         *                      distributions.
+         * @see                 GeomFactors::ComputeJac
+         */
+        const Array<OneD, const NekDouble> GeomFactors::GetJac(
+                const LibUtilities::PointsKeyVector &keyTgt)
+        {
+            {
+                boost::mutex::scoped_lock lock(cacheMutex);
+                JacCache::iterator x = m_jacCache.find(keyTgt);
+
+                if (x != m_jacCache.end())
+                {
+                    m_cacheLRU.splice(m_cacheLRU.begin(), m_cacheLRU,
+                                      x->second.m_lru);
+                    return x->second.m_data;
+                }
+            }
+
+            CacheValue<Array<OneD, NekDouble> > val;
+            val.m_data = ComputeJac(keyTgt);
+
+            // Another thread may have computed the same entry meanwhile.
+            boost::mutex::scoped_lock lock(cacheMutex);
+            JacCache::iterator x = m_jacCache.find(keyTgt);
+            if (x != m_jacCache.end())
+            {
+                return x->second.m_data;
+            }
+
+            val.m_lru  = AddCacheEntry(
+                keyTgt, true, val.m_data.num_elements() * sizeof(NekDouble));
+            m_jacCache[keyTgt] = val;
+
+            return val.m_data;
+        }
+
+
+        /**
+         * Returns cached value if available, otherwise computes derivative
+         * factors and stores result in cache.
+         *
+         * @param   keyTgt      Target point distributions.
+         * @returns             Derivative factors evaluated at target point
+         *                      distributions.
+         * @see                 GeomFactors::ComputeDerivFactors
+         */
+        const Array<TwoD, const NekDouble> GeomFactors::GetDerivFactors(
+                const LibUtilities::PointsKeyVector &keyTgt)
+        {
+            {
+                boost::mutex::scoped_lock lock(cacheMutex);
+                DerivCache::iterator x = m_derivFactorCache.find(keyTgt);
+
+                if (x != m_derivFactorCache.end())
+                {
+                    m_cacheLRU.splice(m_cacheLRU.begin(), m_cacheLRU,
+                                      x->second.m_lru);
+                    return x->second.m_data;
+                }
+            }
+
+            CacheValue<Array<TwoD, NekDouble> > val;
+            val.m_data = ComputeDerivFactors(keyTgt);
+
+            // Another thread may have computed the same entry meanwhile.
+            boost::mutex::scoped_lock lock(cacheMutex);
+            DerivCache::iterator x = m_derivFactorCache.find(keyTgt);
+            if (x != m_derivFactorCache.end())
+            {
+                return x->second.m_data;
+            }
+
+            val.m_lru  = AddCacheEntry(
+                keyTgt, false, val.m_data.num_elements() * sizeof(NekDouble));
+            m_derivFactorCache[keyTgt] = val;
+
+            return val.m_data;
+        }
+
+
+        /**
+         * Entries are evicted from the tail of the list, i.e. those of any
+         * element which have been used least recently, until the total lies
+         * within the budget. An evicted entry is simply recomputed from the
+         * coordinate map when next requested. Arrays already handed out
+         * remain valid since their storage is reference counted. The new
+         * entry itself is never evicted.
+         *
+         * @param   keyTgt      Target point distributions of the entry.
+         * @param   isJac       True for a Jacobian, false for derivative
+         *                      factors.
+         * @param   bytes       Size of the cached data.
+         * @returns             Position of the new entry in m_cacheLRU.
+         */
+        GeomFactors::CacheList::iterator GeomFactors::AddCacheEntry(
+                const LibUtilities::PointsKeyVector &keyTgt,
+                const bool                           isJac,
+                const size_t                         bytes)
+        {
+            CacheEntry entry;
+            entry.m_owner = this;
+            entry.m_isJac = isJac;
+            entry.m_key   = keyTgt;
+            entry.m_bytes = bytes;
+            m_cacheLRU.push_front(entry);
+
+            CacheStatistics &stats = cacheStats[m_xmap->DetShapeType()];
+            stats.m_bytes += bytes;
+            stats.m_peakBytes = std::max(stats.m_peakBytes, stats.m_bytes);
+            stats.m_computed++;
+            m_cacheBytes += bytes;
+
+            while (m_cacheBudget > 0 && m_cacheBytes > m_cacheBudget &&
+                   m_cacheLRU.size() > 1)
+            {
+                CacheList::iterator last = --m_cacheLRU.end();
+                GeomFactors *owner = last->m_owner;
+                if (last->m_isJac)
+                {
+                    owner->m_jacCache.erase(last->m_key);
+                }
+                else
+                {
+                    owner->m_derivFactorCache.erase(last->m_key);
+                }
+                owner->RemoveCacheEntry(last, true);
+            }
+
+            return m_cacheLRU.begin();
+        }
+
+
+        /**
+         * @param   entry       Entry of m_cacheLRU owned by this object.
+         * @param   evicted     Whether the entry is removed to satisfy the
+         *                      budget.
+         */
+        void GeomFactors::RemoveCacheEntry(
+                const CacheList::iterator &entry,
+                const bool                 evicted)
+        {
+            CacheStatistics &stats = cacheStats[m_xmap->DetShapeType()];
+            stats.m_bytes -= entry->m_bytes;
+            if (evicted)
+            {
+                stats.m_evicted++;
+            }
+            m_cacheBytes -= entry->m_bytes;
+            m_cacheLRU.erase(entry);
+        }
+
+
+        /**
+         * Entries beyond a reduced budget are evicted on the next
+         * computation of geometric factors.
+         *
+         * @param   bytes       Maximum number of bytes, or zero for no limit.
+         */
+        void GeomFactors::SetCacheBudget(const size_t bytes)
+        {
+            boost::mutex::scoped_lock lock(cacheMutex);
+            m_cacheBudget = bytes;
+        }
+
+
+        /**
+         * For each element type, reports the bytes currently resident in the
+         * caches, the peak, and how many entries were computed and evicted.
+         * Computations beyond the number of distinct entries are
+         * recomputations after eviction.
+         *
+         * @param   out         Stream to write to.
+         */
+        void GeomFactors::PrintCacheStatistics(std::ostream &out)
+        {
+            boost::mutex::scoped_lock lock(cacheMutex);
+            out << "Geometric factor cache";
+            if (m_cacheBudget > 0)
+            {
+                out << " (budget " << m_cacheBudget << " bytes)";
+            }
+            out << ":" << std::endl;
+            out << "    " << std::setw(14) << std::left << "Element"
+                << std::right
+                << std::setw(14) << "Bytes"
+                << std::setw(14) << "Peak bytes"
+                << std::setw(12) << "Computed"
+                << std::setw(12) << "Evicted" << std::endl;
+
+            for (int i = 0; i < LibUtilities::SIZE_ShapeType; ++i)
+            {
+                const CacheStatistics &stats = cacheStats[i];
+                if (stats.m_computed == 0)
+                {
+                    continue;
+                }
+                out << "    " << std::setw(14) << std::left
+                    << LibUtilities::ShapeTypeMap[i] << std::right
+                    << std::setw(14) << stats.m_bytes
+                    << std::setw(14) << stats.m_peakBytes
+                    << std::setw(12) << stats.m_computed
+                    << std::setw(12) << stats.m_evicted << std::endl;
+            }
+        }
+
+
+        /**
+         * The hash combines the geometry type, dimensions, coordinate map
+         * basis and the first Jacobian value rounded to six significant
+         * digits, so congruent elements almost always share a bin.
+         */
+        size_t GeomFactors::GetCongruenceHash()
+        {
+            LibUtilities::PointsKeyVector ptsKeys = m_xmap->GetPointsKeys();
+            const Array<OneD, const NekDouble> jac = GetJac(ptsKeys);
+
+            size_t hash = 0;
+            boost::hash_combine(hash, (int)m_type);
+            boost::hash_combine(hash, m_expDim);
+            boost::hash_combine(hash, m_coordDim);
+            for (int i = 0; i < m_expDim; ++i)
+            {
+                boost::hash_combine(hash, m_xmap->GetBasisNumModes(i));
+                boost::hash_combine(hash, (int)ptsKeys[i].GetPointsType());
+                boost::hash_combine(hash, ptsKeys[i].GetNumPoints());
+            }
+
+            int exponent;
+            NekDouble mantissa = frexp(jac[0], &exponent);
+            boost::hash_combine(hash, exponent);
+            boost::hash_combine(hash, (long)floor(mantissa * 1e6 + 0.5));
+
+            return hash;
+        }
+
+
+        /**
+         * @param   other       Geometric factors to compare against.
+         * @returns             True if the elements are congruent.
+         */
+        bool GeomFactors::IsCongruent(GeomFactors &other)
+        {
+            if (m_type     != other.m_type   ||
+                m_expDim   != other.m_expDim ||
+                m_coordDim != other.m_coordDim)
+            {
+                return false;
+            }
+
+            LibUtilities::PointsKeyVector ptsKeys = m_xmap->GetPointsKeys();
+            if (!(ptsKeys == other.m_xmap->GetPointsKeys()))
+            {
+                return false;
+            }
+
+            for (int i = 0; i < m_expDim; ++i)
+            {
+                if (m_xmap->GetBasisNumModes(i) !=
+                    other.m_xmap->GetBasisNumModes(i))
+                {
+                    return false;
+                }
+            }
+
+            const Array<OneD, const NekDouble> jac1 = GetJac(ptsKeys);
+            const Array<OneD, const NekDouble> jac2 = other.GetJac(ptsKeys);
+            const Array<TwoD, const NekDouble> df1  = GetDerivFactors(ptsKeys);
+            const Array<TwoD, const NekDouble> df2  =
+                                            other.GetDerivFactors(ptsKeys);
+
+            if (jac1.num_elements() != jac2.num_elements() ||
+                df1.num_elements()  != df2.num_elements())
+            {
+                return false;
+            }
+
+            NekDouble jacScale = 0.0, dfScale = 0.0, jacDiff = 0.0, dfDiff = 0.0;
+            int i;
+            for (i = 0; i < jac1.num_elements(); ++i)
+            {
+                jacScale = std::max(jacScale, fabs(jac1[i]));
+                jacDiff  = std::max(jacDiff,  fabs(jac1[i] - jac2[i]));
+            }
+
+            const NekDouble *d1 = df1.data();
+            const NekDouble *d2 = df2.data();
+            for (i = 0; i < df1.num_elements(); ++i)
+            {
+                dfScale = std::max(dfScale, fabs(d1[i]));
+                dfDiff  = std::max(dfDiff,  fabs(d1[i] - d2[i]));
+            }
+
+            return jacDiff <= m_congruenceTol * jacScale &&
+                   dfDiff  <= m_congruenceTol * dfScale;
         }
 
 
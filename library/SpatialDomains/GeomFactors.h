@@ -38,6 +38,9 @@
 
 #include <boost/unordered_set.hpp>
 
+#include <list>
+#include <ostream>
+
 #include <LibUtilities/Foundations/Basis.h>
 #include <SpatialDomains/SpatialDomains.hpp>
 #include <SpatialDomains/SpatialDomainsDeclspec.h>
@@ -104,7 +107,7 @@ namespace SpatialDomains
                     const LibUtilities::PointsKeyVector &keyTgt);
 
             /// Return the Jacobian of the mapping and cache the result.
-            inline const Array<OneD, const NekDouble> GetJac(
+            SPATIAL_DOMAINS_EXPORT const Array<OneD, const NekDouble> GetJac(
                     const LibUtilities::PointsKeyVector &keyTgt);
 
             /// Return the Laplacian coefficients \f$g_{ij}\f$.
@@ -113,8 +116,8 @@ namespace SpatialDomains
 
             /// Return the derivative of the reference coordinates with respect
             /// to the mapping, \f$\frac{\partial \xi_i}{\partial \chi_j}\f$.
-            inline const Array<TwoD, const NekDouble> GetDerivFactors(
-                    const LibUtilities::PointsKeyVector &keyTgt);
+            SPATIAL_DOMAINS_EXPORT const Array<TwoD, const NekDouble>
+                GetDerivFactors(const LibUtilities::PointsKeyVector &keyTgt);
 
             /// Returns whether the geometry is regular or deformed.
             inline GeomType GetGtype();
@@ -128,6 +131,26 @@ namespace SpatialDomains
             /// Computes a hash of this GeomFactors element.
             inline size_t GetHash();
 
+            /// Return the GeomFactors object shared by all elements congruent
+            /// to @a geom up to a translation.
+            SPATIAL_DOMAINS_EXPORT static GeomFactorsSharedPtr GetCongruent(
+                    const GeomFactorsSharedPtr &geom);
+
+            /// Set the relative tolerance used to identify congruent
+            /// elements. A negative value disables the identification.
+            SPATIAL_DOMAINS_EXPORT static void SetCongruenceTolerance(
+                    const NekDouble tol);
+
+            /// Set the maximum number of bytes held by the Jacobian and
+            /// derivative factor caches of all elements. Zero means no limit.
+            SPATIAL_DOMAINS_EXPORT static void SetCacheBudget(
+                    const size_t bytes);
+
+            /// Write the memory held by the geometric factor caches, broken
+            /// down by element type, to @a out.
+            SPATIAL_DOMAINS_EXPORT static void PrintCacheStatistics(
+                    std::ostream &out);
+
         protected:
             /// Type of geometry (e.g. eRegular, eDeformed, eMovingRegular).
             GeomType m_type;
@@ -141,18 +164,69 @@ namespace SpatialDomains
             StdRegions::StdExpansionSharedPtr m_xmap;
             /// Stores coordinates of the geometry.
             Array<OneD, Array<OneD, NekDouble> > m_coords;
+            /// Entry of the least-recently-used list shared by the caches of
+            /// all elements.
+            struct CacheEntry
+            {
+                GeomFactors                   *m_owner;
+                bool                           m_isJac;
+                LibUtilities::PointsKeyVector  m_key;
+                size_t                         m_bytes;
+            };
+            typedef std::list<CacheEntry>               CacheList;
+
+            template<typename TData>
+            struct CacheValue
+            {
+                TData                          m_data;
+                CacheList::iterator            m_lru;
+            };
+            typedef std::map<LibUtilities::PointsKeyVector,
+                             CacheValue<Array<OneD, NekDouble> > > JacCache;
+            typedef std::map<LibUtilities::PointsKeyVector,
+                             CacheValue<Array<TwoD, NekDouble> > > DerivCache;
+
             /// Jacobian vector cache
-            std::map<LibUtilities::PointsKeyVector, Array<OneD, NekDouble> >
-                                                m_jacCache;
+            JacCache                            m_jacCache;
             /// DerivFactors vector cache
-            std::map<LibUtilities::PointsKeyVector, Array<TwoD, NekDouble> >
-                                                m_derivFactorCache;
+            DerivCache                          m_derivFactorCache;
+            /// Whether m_congruent has been determined.
+            bool m_congruentSet;
+            /// Congruent object standing for this one, null if this object
+            /// is itself the representative.
+            GeomFactorsSharedPtr m_congruent;
+            /// Relative tolerance for congruence.
+            static NekDouble m_congruenceTol;
+            /// Cache entries of all elements, most recently used first.
+            static CacheList m_cacheLRU;
+            /// Maximum number of bytes held in m_cacheLRU, zero if unlimited.
+            static size_t m_cacheBudget;
+            /// Number of bytes currently held in m_cacheLRU.
+            static size_t m_cacheBytes;
 
 //        private:
         protected:
             /// Tests if the element is valid and not self-intersecting.
             void CheckIfValid();
 
+            /// Hash of the quantities compared by IsCongruent.
+            size_t GetCongruenceHash();
+
+            /// Tests if the metric terms of two elements agree to within
+            /// m_congruenceTol.
+            bool IsCongruent(GeomFactors &other);
+
+            /// Record a newly computed cache entry and evict the least
+            /// recently used entries beyond the budget.
+            CacheList::iterator AddCacheEntry(
+                    const LibUtilities::PointsKeyVector &keyTgt,
+                    const bool                           isJac,
+                    const size_t                         bytes);
+
+            /// Remove a cache entry from m_cacheLRU.
+            void RemoveCacheEntry(const CacheList::iterator &entry,
+                                  const bool                 evicted);
+
             SPATIAL_DOMAINS_EXPORT virtual DerivStorage ComputeDeriv(
                     const LibUtilities::PointsKeyVector &keyTgt) const;
 
@@ -209,33 +283,6 @@ namespace SpatialDomains
     }
 
 
-    /**
-     * Returns cached value if available, otherwise computes Jacobian and
-     * stores result in cache.
-     *
-     * @param   keyTgt      Target point distributions.
-     * @returns             Jacobian evaluated at target point
-     *                      distributions.
-     * @see                 GeomFactors::ComputeJac
-     */
-    inline const Array<OneD, const NekDouble> GeomFactors::GetJac(
-            const LibUtilities::PointsKeyVector &keyTgt)
-    {
-        std::map<LibUtilities::PointsKeyVector,
-                 Array<OneD, NekDouble> >::const_iterator x;
-
-        if ((x = m_jacCache.find(keyTgt)) != m_jacCache.end())
-        {
-            return x->second;
-        }
-
-        m_jacCache[keyTgt] = ComputeJac(keyTgt);
-
-        return m_jacCache[keyTgt];
-
-    }
-
-
     /**
      * @param   keyTgt      Target point distributions.
      * @returns             Inverse metric tensor evaluated at target point
@@ -249,33 +296,6 @@ namespace SpatialDomains
     }
 
 
-    /**
-     * Returns cached value if available, otherwise computes derivative
-     * factors and stores result in cache.
-     *
-     * @param   keyTgt      Target point distributions.
-     * @returns             Derivative factors evaluated at target point
-     *                      distributions.
-     * @see                 GeomFactors::ComputeDerivFactors
-     */
-    inline const Array<TwoD, const NekDouble> GeomFactors::GetDerivFactors(
-            const LibUtilities::PointsKeyVector &keyTgt)
-    {
-        std::map<LibUtilities::PointsKeyVector,
-                 Array<TwoD, NekDouble> >::const_iterator x;
-
-        if ((x = m_derivFactorCache.find(keyTgt)) != m_derivFactorCache.end())
-        {
-            return x->second;
-        }
-
-        m_derivFactorCache[keyTgt] = ComputeDerivFactors(keyTgt);
-
-        return m_derivFactorCache[keyTgt];
-
-    }
-
-
     /**
      * A geometric shape is considered regular if it has constant geometric
      * information, and deformed if this information changes throughout the
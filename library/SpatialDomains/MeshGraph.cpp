@@ -37,6 +37,7 @@
 #include <SpatialDomains/MeshGraph.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
 #include <LibUtilities/BasicUtils/Equation.h>
+#include <LibUtilities/BasicUtils/CompressData.h>
 #include <StdRegions/StdTriExp.h>
 #include <StdRegions/StdTetExp.h>
 #include <StdRegions/StdPyrExp.h>
@@ -149,6 +150,18 @@ namespace Nektar
                 attr = attr->Next();
             }
 
+            // relative tolerance used to identify congruent elements, which
+            // then share their elemental matrices; negative disables this
+            NekDouble congruenceTol;
+            pSession->LoadParameter("GeomCongruenceTol", congruenceTol, 1e-12);
+            GeomFactors::SetCongruenceTolerance(congruenceTol);
+
+            // memory budget in megabytes for the cached Jacobians and
+            // derivative factors of all elements; zero means unlimited
+            NekDouble cacheBudget;
+            pSession->LoadParameter("GeomFactorsCacheBudget", cacheBudget, 0.0);
+            GeomFactors::SetCacheBudget((size_t)(cacheBudget * 1048576.0));
+
             // instantiate the dimension-specific meshgraph classes
 
             switch(meshDim)
@@ -392,6 +405,31 @@ namespace Nektar
                 zmove = expEvaluator.Evaluate(expr_id);
             }
 
+            // Compressed vertex data is stored as an array of IDs and
+            // an array of coordinate triples.
+            if (LibUtilities::CompressData::IsCompressed(element))
+            {
+                std::vector<int>       vertId;
+                std::vector<NekDouble> vertX;
+                LibUtilities::CompressData::ReadCompressedData(
+                    element, "ID", 1, vertId);
+                LibUtilities::CompressData::ReadCompressedData(
+                    element, "X",  3, vertX);
+
+                ASSERTL0(vertX.size() == 3*vertId.size(),
+                         "Compressed VERTEX data is inconsistent.");
+
+                for (int i = 0; i < vertId.size(); ++i)
+                {
+                    m_vertSet[vertId[i]] = MemoryManager<PointGeom>
+                        ::AllocateSharedPtr(m_spaceDimension, vertId[i],
+                                            vertX[3*i  ]*xscale + xmove,
+                                            vertX[3*i+1]*yscale + ymove,
+                                            vertX[3*i+2]*zscale + zmove);
+                }
+                return;
+            }
+
             TiXmlElement *vertex = element->FirstChildElement("V");
 
             int indx;
@@ -462,6 +500,7 @@ namespace Nektar
         }
 
 
+
         /**
          * Read the geometry-related information from the given file. This
          * information is located within the XML tree under
@@ -1110,6 +1149,78 @@ namespace Nektar
                 return;
             }
 
+            /// Compressed curves are stored as records of (ID, EDGEID or
+            /// FACEID, NUMPOINTS, points type, number of coordinate
+            /// triples) in the E and F tags, with the coordinates of all
+            /// curves of each kind in the EPOINTS and FPOINTS tags.
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                const std::string curveTypes[2] = {"E", "F"};
+                for (int t = 0; t < 2; ++t)
+                {
+                    std::vector<int>       info;
+                    std::vector<NekDouble> pts;
+                    LibUtilities::CompressData::ReadCompressedData(
+                        field, curveTypes[t], 5, info);
+                    LibUtilities::CompressData::ReadCompressedData(
+                        field, curveTypes[t] + "POINTS", 3, pts);
+
+                    int offset = 0;
+                    for (int i = 0; i < info.size(); i += 5)
+                    {
+                        ASSERTL0(info[i+3] >= 0 &&
+                                 info[i+3] < LibUtilities::SIZE_PointsType,
+                                 "Invalid points type.");
+                        ASSERTL0(offset + 3*info[i+4] <= pts.size(),
+                                 "Compressed CURVED data is inconsistent.");
+
+                        CurveSharedPtr curve(
+                            MemoryManager<Curve>::AllocateSharedPtr(
+                                info[i+1],
+                                (LibUtilities::PointsType) info[i+3]));
+
+                        for (int j = 0; j < info[i+4]; ++j, offset += 3)
+                        {
+                            NekDouble xval = pts[offset];
+                            NekDouble yval = pts[offset+1];
+                            NekDouble zval = pts[offset+2];
+
+                            // As in the text form, only edge points are
+                            // scaled.
+                            if (t == 0)
+                            {
+                                xval *= xscale;
+                                yval *= yscale;
+                                zval *= zscale;
+                            }
+
+                            PointGeomSharedPtr vert(
+                                MemoryManager<PointGeom>::AllocateSharedPtr(
+                                    m_meshDimension, info[i],
+                                    xval, yval, zval));
+                            curve->m_points.push_back(vert);
+                        }
+
+                        if (t == 0)
+                        {
+                            ASSERTL0(curve->m_points.size() == info[i+2],
+                                     "Number of points specificed by "
+                                     "attribute NUMPOINTS is different "
+                                     "from number of points in list");
+                            m_curvedEdges.push_back(curve);
+                        }
+                        else
+                        {
+                            m_curvedFaces.push_back(curve);
+                        }
+                    }
+
+                    ASSERTL0(offset == pts.size(),
+                             "Compressed CURVED data is inconsistent.");
+                }
+                return;
+            }
+
             /// All curves are of the form: "<? ID="#" TYPE="GLL OR other
             /// points type" NUMPOINTS="#"> ... </?>", with ? being an
             /// element type (either E or F).
@@ -36,6 +36,7 @@
 
 #include <SpatialDomains/MeshGraph1D.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicUtils/CompressData.h>
 #include <tinyxml/tinyxml.h>
 
 namespace Nektar
@@ -105,6 +106,28 @@ namespace Nektar
 
             ASSERTL0(field, "Unable to find ELEMENT tag in file.");
 
+            /// Compressed segments are stored as (ID, vertex1, vertex2).
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<int> data;
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "S", 3, data);
+
+                ASSERTL0(data.size() > 0,
+                         "At least one element must be specified.");
+
+                for (int i = 0; i < data.size(); i += 3)
+                {
+                    PointGeomSharedPtr v1 = GetVertex(data[i+1]);
+                    PointGeomSharedPtr v2 = GetVertex(data[i+2]);
+                    SegGeomSharedPtr seg = MemoryManager<SegGeom>
+                        ::AllocateSharedPtr(data[i], v1, v2);
+                    seg->SetGlobalID(data[i]);
+                    m_segGeoms[data[i]] = seg;
+                }
+                return;
+            }
+
             int nextElementNumber = -1;
 
             /// All elements are of the form: "<S ID = n> ... </S>", with
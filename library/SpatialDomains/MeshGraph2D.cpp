@@ -37,6 +37,7 @@
 #include <SpatialDomains/SegGeom.h>
 #include <SpatialDomains/TriGeom.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicUtils/CompressData.h>
 #include <tinyxml/tinyxml.h>
 
 namespace Nektar
@@ -128,6 +129,38 @@ namespace Nektar
                 edge_curved[m_curvedEdges[i]->m_curveID] = i;
             }
 
+            /// Compressed edges are stored as (ID, vertex1, vertex2).
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<int> data;
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "E", 3, data);
+
+                for (i = 0; i < data.size(); i += 3)
+                {
+                    indx = data[i];
+                    PointGeomSharedPtr vertices[2] =
+                        {GetVertex(data[i+1]), GetVertex(data[i+2])};
+
+                    SegGeomSharedPtr edge;
+                    if (edge_curved.count(indx) == 0)
+                    {
+                        edge = MemoryManager<SegGeom>::AllocateSharedPtr(
+                            indx, m_spaceDimension, vertices);
+                    }
+                    else
+                    {
+                        edge = MemoryManager<SegGeom>::AllocateSharedPtr(
+                            indx, m_spaceDimension, vertices,
+                            m_curvedEdges[edge_curved.find(indx)->second]);
+                    }
+                    edge->SetGlobalID(indx);
+
+                    m_segGeoms[indx] = edge;
+                }
+                return;
+            }
+
             while(edge)
             {
                 nextEdgeNumber++;
@@ -208,6 +241,81 @@ namespace Nektar
                 faceCurves[m_curvedFaces[i]->m_curveID] = i;
             }
 
+            /// Compressed elements are stored as (ID, edge1, ..., edgeN) in
+            /// the T and Q tags.
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<int> data;
+
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "T", TriGeom::kNedges + 1, data);
+                for (int i = 0; i < data.size(); i += TriGeom::kNedges + 1)
+                {
+                    int indx = data[i];
+                    SegGeomSharedPtr edges[TriGeom::kNedges] =
+                        {GetSegGeom(data[i+1]), GetSegGeom(data[i+2]),
+                         GetSegGeom(data[i+3])};
+
+                    StdRegions::Orientation edgeorient[TriGeom::kNedges] =
+                    {
+                        SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                        SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                        SegGeom::GetEdgeOrientation(*edges[2], *edges[0])
+                    };
+
+                    TriGeomSharedPtr trigeom;
+                    if (faceCurves.count(indx) == 0)
+                    {
+                        trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient);
+                    }
+                    else
+                    {
+                        trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient,
+                            m_curvedFaces[faceCurves.find(indx)->second]);
+                    }
+                    trigeom->SetGlobalID(indx);
+
+                    m_triGeoms[indx] = trigeom;
+                }
+
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "Q", QuadGeom::kNedges + 1, data);
+                for (int i = 0; i < data.size(); i += QuadGeom::kNedges + 1)
+                {
+                    int indx = data[i];
+                    SegGeomSharedPtr edges[QuadGeom::kNedges] =
+                        {GetSegGeom(data[i+1]), GetSegGeom(data[i+2]),
+                         GetSegGeom(data[i+3]), GetSegGeom(data[i+4])};
+
+                    StdRegions::Orientation edgeorient[QuadGeom::kNedges] =
+                    {
+                        SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                        SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                        SegGeom::GetEdgeOrientation(*edges[2], *edges[3]),
+                        SegGeom::GetEdgeOrientation(*edges[3], *edges[0])
+                    };
+
+                    QuadGeomSharedPtr quadgeom;
+                    if (faceCurves.count(indx) == 0)
+                    {
+                        quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient);
+                    }
+                    else
+                    {
+                        quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient,
+                            m_curvedFaces[faceCurves.find(indx)->second]);
+                    }
+                    quadgeom->SetGlobalID(indx);
+
+                    m_quadGeoms[indx] = quadgeom;
+                }
+                return;
+            }
+
             int nextElementNumber = -1;
 
             /// All elements are of the form: "<? ID="#"> ... </?>", with
@@ -37,6 +37,7 @@
 #include <SpatialDomains/MeshGraph3D.h>
 #include <SpatialDomains/TriGeom.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicUtils/CompressData.h>
 #include <tinyxml/tinyxml.h>
 
 namespace Nektar
@@ -128,6 +129,37 @@ namespace Nektar
                 edge_curved[m_curvedEdges[i]->m_curveID] = i;
             }
 
+            /// Compressed edges are stored as (ID, vertex1, vertex2).
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<int> data;
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "E", 3, data);
+
+                for (i = 0; i < data.size(); i += 3)
+                {
+                    indx = data[i];
+                    PointGeomSharedPtr vertices[2] =
+                        {GetVertex(data[i+1]), GetVertex(data[i+2])};
+
+                    SegGeomSharedPtr edge;
+                    if (edge_curved.count(indx) == 0)
+                    {
+                        edge = MemoryManager<SegGeom>::AllocateSharedPtr(
+                            indx, m_spaceDimension, vertices);
+                    }
+                    else
+                    {
+                        edge = MemoryManager<SegGeom>::AllocateSharedPtr(
+                            indx, m_spaceDimension, vertices,
+                            m_curvedEdges[edge_curved.find(indx)->second]);
+                    }
+
+                    m_segGeoms[indx] = edge;
+                }
+                return;
+            }
+
             while(edge)
             {
                 nextEdgeNumber++;
@@ -201,6 +233,81 @@ namespace Nektar
                 face_curved[m_curvedFaces[i]->m_curveID] = i;
             }
 
+            /// Compressed faces are stored as (ID, edge1, ..., edgeN) in
+            /// the T and Q tags.
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<int> data;
+
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "T", TriGeom::kNedges + 1, data);
+                for (int i = 0; i < data.size(); i += TriGeom::kNedges + 1)
+                {
+                    int indx = data[i];
+                    SegGeomSharedPtr edges[TriGeom::kNedges] =
+                        {GetSegGeom(data[i+1]), GetSegGeom(data[i+2]),
+                         GetSegGeom(data[i+3])};
+
+                    StdRegions::Orientation edgeorient[TriGeom::kNedges] =
+                    {
+                        SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                        SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                        SegGeom::GetEdgeOrientation(*edges[2], *edges[0])
+                    };
+
+                    TriGeomSharedPtr trigeom;
+                    if (face_curved.count(indx) == 0)
+                    {
+                        trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient);
+                    }
+                    else
+                    {
+                        trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient,
+                            m_curvedFaces[face_curved.find(indx)->second]);
+                    }
+                    trigeom->SetGlobalID(indx);
+
+                    m_triGeoms[indx] = trigeom;
+                }
+
+                LibUtilities::CompressData::ReadCompressedData(
+                    field, "Q", QuadGeom::kNedges + 1, data);
+                for (int i = 0; i < data.size(); i += QuadGeom::kNedges + 1)
+                {
+                    int indx = data[i];
+                    SegGeomSharedPtr edges[QuadGeom::kNedges] =
+                        {GetSegGeom(data[i+1]), GetSegGeom(data[i+2]),
+                         GetSegGeom(data[i+3]), GetSegGeom(data[i+4])};
+
+                    StdRegions::Orientation edgeorient[QuadGeom::kNedges] =
+                    {
+                        SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                        SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                        SegGeom::GetEdgeOrientation(*edges[2], *edges[3]),
+                        SegGeom::GetEdgeOrientation(*edges[3], *edges[0])
+                    };
+
+                    QuadGeomSharedPtr quadgeom;
+                    if (face_curved.count(indx) == 0)
+                    {
+                        quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient);
+                    }
+                    else
+                    {
+                        quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(
+                            indx, edges, edgeorient,
+                            m_curvedFaces[face_curved.find(indx)->second]);
+                    }
+                    quadgeom->SetGlobalID(indx);
+
+                    m_quadGeoms[indx] = quadgeom;
+                }
+                return;
+            }
+
             /// All faces are of the form: "<? ID="#"> ... </?>", with
             /// ? being an element type (either Q or T).
 
@@ -347,6 +454,121 @@ namespace Nektar
 
             ASSERTL0(field, "Unable to find ELEMENT tag in file.");
 
+            /// Compressed elements are stored as (ID, face1, ..., faceN) in
+            /// the A, P, R and H tags.
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                const std::string elementTypes[4] = {"A", "P", "R", "H"};
+                const int kNfaces [4] = {TetGeom::kNfaces,  PyrGeom::kNfaces,
+                                         PrismGeom::kNfaces, HexGeom::kNfaces};
+                const int kNtfaces[4] = {TetGeom::kNtfaces, PyrGeom::kNtfaces,
+                                         PrismGeom::kNtfaces,
+                                         HexGeom::kNtfaces};
+                const int kNqfaces[4] = {TetGeom::kNqfaces, PyrGeom::kNqfaces,
+                                         PrismGeom::kNqfaces,
+                                         HexGeom::kNqfaces};
+
+                std::vector<int> data;
+                for (int t = 0; t < 4; ++t)
+                {
+                    LibUtilities::CompressData::ReadCompressedData(
+                        field, elementTypes[t], kNfaces[t] + 1, data);
+
+                    for (int i = 0; i < data.size(); i += kNfaces[t] + 1)
+                    {
+                        int indx = data[i];
+
+                        Geometry2DSharedPtr faces[HexGeom::kNfaces];
+                        TriGeomSharedPtr    tfaces[TetGeom::kNfaces];
+                        QuadGeomSharedPtr   qfaces[HexGeom::kNfaces];
+                        int Ntfaces = 0;
+                        int Nqfaces = 0;
+
+                        std::stringstream errorstring;
+                        errorstring << "Element " << indx << " must have "
+                                    << kNtfaces[t] << " triangle face(s), and "
+                                    << kNqfaces[t]
+                                    << " quadrilateral face(s).";
+
+                        for (int j = 0; j < kNfaces[t]; ++j)
+                        {
+                            faces[j] = GetGeometry2D(data[i+j+1]);
+                            if (faces[j] == Geometry2DSharedPtr() ||
+                                (faces[j]->GetShapeType() != LibUtilities::eTriangle &&
+                                 faces[j]->GetShapeType() != LibUtilities::eQuadrilateral))
+                            {
+                                std::stringstream errorstring;
+                                errorstring << "Element " << indx
+                                            << " has invalid face: "
+                                            << data[i+j+1];
+                                ASSERTL0(false, errorstring.str().c_str());
+                            }
+                            else if (faces[j]->GetShapeType() ==
+                                         LibUtilities::eTriangle)
+                            {
+                                ASSERTL0(Ntfaces < kNtfaces[t],
+                                         errorstring.str().c_str());
+                                tfaces[Ntfaces++] = boost::static_pointer_cast<
+                                    TriGeom>(faces[j]);
+                            }
+                            else
+                            {
+                                ASSERTL0(Nqfaces < kNqfaces[t],
+                                         errorstring.str().c_str());
+                                qfaces[Nqfaces++] = boost::static_pointer_cast<
+                                    QuadGeom>(faces[j]);
+                            }
+                        }
+
+                        ASSERTL0(Ntfaces == kNtfaces[t],
+                                 errorstring.str().c_str());
+                        ASSERTL0(Nqfaces == kNqfaces[t],
+                                 errorstring.str().c_str());
+
+                        Geometry3DSharedPtr geom;
+                        switch (t)
+                        {
+                            case 0:
+                            {
+                                TetGeomSharedPtr tetgeom = MemoryManager<
+                                    TetGeom>::AllocateSharedPtr(tfaces);
+                                m_tetGeoms[indx] = tetgeom;
+                                geom = tetgeom;
+                                break;
+                            }
+                            case 1:
+                            {
+                                PyrGeomSharedPtr pyrgeom = MemoryManager<
+                                    PyrGeom>::AllocateSharedPtr(faces);
+                                m_pyrGeoms[indx] = pyrgeom;
+                                geom = pyrgeom;
+                                break;
+                            }
+                            case 2:
+                            {
+                                PrismGeomSharedPtr prismgeom = MemoryManager<
+                                    PrismGeom>::AllocateSharedPtr(faces);
+                                m_prismGeoms[indx] = prismgeom;
+                                geom = prismgeom;
+                                break;
+                            }
+                            case 3:
+                            {
+                                HexGeomSharedPtr hexgeom = MemoryManager<
+                                    HexGeom>::AllocateSharedPtr(qfaces);
+                                m_hexGeoms[indx] = hexgeom;
+                                geom = hexgeom;
+                                break;
+                            }
+                        }
+
+                        geom->SetGlobalID(indx);
+                        PopulateFaceToElMap(geom, kNfaces[t]);
+                    }
+                }
+                return;
+            }
+
             int nextElementNumber = -1;
 
             /// All elements are of the form: "<? ID="#"> ... </?>", with
@@ -1024,6 +1024,11 @@ namespace Nektar
             NEKERROR(ErrorUtil::efatal, "This function is only valid for LocalRegions");
         }
 
+        void StdExpansion::v_DropLocMatrix(const LocalRegions::MatrixKey &mkey)
+        {
+            NEKERROR(ErrorUtil::efatal, "This function is only valid for LocalRegions");
+        }
+
         StdRegions::Orientation StdExpansion::v_GetFaceOrient(int face)
 
         {
@@ -689,6 +689,11 @@ namespace Nektar
                 return v_DropLocStaticCondMatrix(mkey);
             }
 
+            STD_REGIONS_EXPORT void DropLocMatrix(const LocalRegions::MatrixKey &mkey)
+            {
+                return v_DropLocMatrix(mkey);
+            }
+
             StdRegions::Orientation GetFaceOrient(int face)
             {
                 return v_GetFaceOrient(face);
@@ -1154,6 +1159,8 @@ namespace Nektar
 
             STD_REGIONS_EXPORT virtual void v_DropLocStaticCondMatrix(const LocalRegions::MatrixKey &mkey);
 
+            STD_REGIONS_EXPORT virtual void v_DropLocMatrix(const LocalRegions::MatrixKey &mkey);
+
 
             STD_REGIONS_EXPORT virtual StdRegions::Orientation v_GetFaceOrient(int face);
 
@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestSparseCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// Description: Unit tests for the supernodal sparse Cholesky solver.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cmath>
+
+#include <LibUtilities/LinearAlgebra/SparseCholesky.hpp>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/test_case_template.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace SparseCholeskyUnitTests
+    {
+        /// Make @a mat symmetric and strictly diagonally dominant, and
+        /// return the upper triangular entries as expected by
+        /// SparseCholesky.
+        COOMatType MakeSPD(const int n, COOMatType &mat)
+        {
+            std::vector<NekDouble> rowSum(n, 1.0);
+            COOMatType upper;
+            COOMatTypeConstIt it;
+
+            for (it = mat.begin(); it != mat.end(); ++it)
+            {
+                IndexType i = it->first.first;
+                IndexType j = it->first.second;
+                if (i < j)
+                {
+                    upper[CoordType(i, j)] = it->second;
+                    rowSum[i] += fabs(it->second);
+                    rowSum[j] += fabs(it->second);
+                }
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                upper[CoordType(i, i)] = rowSum[i];
+            }
+
+            mat.clear();
+            for (it = upper.begin(); it != upper.end(); ++it)
+            {
+                mat[it->first] = it->second;
+                mat[CoordType(it->first.second, it->first.first)] =
+                    it->second;
+            }
+
+            return upper;
+        }
+
+        /// Solve with a random right-hand side and return the maximum
+        /// residual of the full symmetric matrix @a mat.
+        NekDouble SolveResidual(const int          n,
+                                const COOMatType  &mat,
+                                const COOMatType  &upper,
+                                const unsigned int nThreads)
+        {
+            SparseCholesky chol(n, upper, nThreads);
+
+            Array<OneD, NekDouble> b(n), x(n, 0.0), r(n);
+            for (int i = 0; i < n; ++i)
+            {
+                b[i] = rand() / (NekDouble) RAND_MAX - 0.5;
+            }
+
+            chol.Solve(b, x);
+
+            Vmath::Vcopy(n, &b[0], 1, &r[0], 1);
+            COOMatTypeConstIt it;
+            for (it = mat.begin(); it != mat.end(); ++it)
+            {
+                r[it->first.first] -= it->second * x[it->first.second];
+            }
+
+            return Vmath::Vamax(n, &r[0], 1);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestGridLaplacian)
+        {
+            // Lexicographically numbered grids give supernodes whose
+            // columns have parents outside the supernode.
+            for (int nx = 2; nx <= 8; ++nx)
+            {
+                int n = nx*nx;
+                COOMatType mat;
+                for (int j = 0; j < nx; ++j)
+                {
+                    for (int i = 0; i < nx; ++i)
+                    {
+                        int p = i + nx*j;
+                        if (i + 1 < nx)
+                        {
+                            mat[CoordType(p, p+1)] = -1.0;
+                        }
+                        if (j + 1 < nx)
+                        {
+                            mat[CoordType(p, p+nx)] = -1.0;
+                        }
+                    }
+                }
+                COOMatType upper = MakeSPD(n, mat);
+
+                BOOST_CHECK_SMALL(SolveResidual(n, mat, upper, 1), 1e-12);
+                BOOST_CHECK_SMALL(SolveResidual(n, mat, upper, 4), 1e-12);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestRandomPatterns)
+        {
+            srand(12345);
+            for (int t = 0; t < 300; ++t)
+            {
+                int n    = 5 + rand() % 60;
+                int nnz  = rand() % (3*n);
+                COOMatType mat;
+                for (int e = 0; e < nnz; ++e)
+                {
+                    IndexType i = rand() % n;
+                    IndexType j = rand() % n;
+                    if (i != j)
+                    {
+                        mat[CoordType(std::min(i, j), std::max(i, j))] =
+                            rand() / (NekDouble) RAND_MAX - 0.5;
+                    }
+                }
+                COOMatType upper = MakeSPD(n, mat);
+
+                BOOST_CHECK_SMALL(SolveResidual(n, mat, upper, 1), 1e-12);
+                BOOST_CHECK_SMALL(SolveResidual(n, mat, upper, 3), 1e-12);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestFactorNonZeros)
+        {
+            // Arrow matrix with the dense row last: no fill, and the last
+            // column has several children so every column is a supernode.
+            int n = 10;
+            COOMatType mat;
+            for (int i = 0; i < n - 1; ++i)
+            {
+                mat[CoordType(i, n-1)] = 1.0;
+            }
+            COOMatType upper = MakeSPD(n, mat);
+
+            SparseCholesky chol(n, upper);
+            BOOST_CHECK_EQUAL(chol.GetNumFactorNonZeros(), 2*n - 1);
+            BOOST_CHECK_EQUAL(chol.GetNumSupernodes(), n);
+            BOOST_CHECK_SMALL(SolveResidual(n, mat, upper, 1), 1e-12);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestIndefiniteThrows)
+        {
+            // Negating the diagonal of a few leaf columns of the arrow
+            // matrix makes supernodes on different threads fail together.
+            int n = 10;
+            COOMatType mat;
+            for (int i = 0; i < n - 1; ++i)
+            {
+                mat[CoordType(i, n-1)] = 1.0;
+            }
+            COOMatType upper = MakeSPD(n, mat);
+            for (int i = 0; i < n - 1; i += 2)
+            {
+                upper[CoordType(i, i)] *= -1.0;
+            }
+
+            BOOST_CHECK_THROW(SparseCholesky(n, upper, 1),
+                              ErrorUtil::NekError);
+            BOOST_CHECK_THROW(SparseCholesky(n, upper, 4),
+                              ErrorUtil::NekError);
+        }
+    }
+}
@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestSparseMultiply.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// Description: Unit tests comparing the threaded BSR and the SELL-C-sigma
+// sparse matrix-vector products with the CSR product.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cmath>
+
+#include <LibUtilities/LinearAlgebra/SparseMatrix.hpp>
+#include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSellCS.hpp>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/test_case_template.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace SparseMultiplyUnitTests
+    {
+        typedef NekSparseMatrix<StorageSmvBsr<NekDouble> > BsrMat;
+        typedef NekSparseMatrix<StorageSellCS<NekDouble> > SellMat;
+
+        /// Vectors are padded so that any block size up to 4 divides
+        /// their length.
+        IndexType PaddedLength(const IndexType n)
+        {
+            return (n/12 + 1)*12;
+        }
+
+        /// Random matrix with rows of very different lengths, including
+        /// empty rows and a few nearly dense ones, so that the row groups
+        /// of the threads and the chunks of SELL-C-sigma are uneven.
+        void MakeMatrix(const IndexType rows, const IndexType cols,
+                        COOMatType &coo)
+        {
+            coo.clear();
+            for (IndexType i = 0; i < rows; ++i)
+            {
+                IndexType len;
+                switch (rand() % 8)
+                {
+                    case 0:
+                        len = 0;
+                        break;
+                    case 1:
+                        len = cols/2 + rand() % (cols/2);
+                        break;
+                    default:
+                        len = 1 + rand() % 9;
+                        break;
+                }
+                for (IndexType n = 0; n < len; ++n)
+                {
+                    coo[CoordType(i, rand() % cols)] =
+                        rand() / (NekDouble) RAND_MAX - 0.5;
+                }
+            }
+        }
+
+        NekDouble MaxDifference(const Array<OneD, NekDouble> &a,
+                                const Array<OneD, NekDouble> &b,
+                                const IndexType n)
+        {
+            Array<OneD, NekDouble> d(n);
+            Vmath::Vsub(n, &a[0], 1, &b[0], 1, &d[0], 1);
+            return Vmath::Vamax(n, &d[0], 1);
+        }
+
+        /// Product with the CSR format, i.e. BSR with a block size of one,
+        /// on a single thread. It is first checked against the COO
+        /// entries.
+        void CsrMultiply(const IndexType rows, const IndexType cols,
+                         const COOMatType &coo,
+                         const Array<OneD, NekDouble> &in,
+                               Array<OneD, NekDouble> &out)
+        {
+            BCOMatType bco;
+            convertCooToBco(rows, cols, 1, coo, bco);
+            BsrMat csr(MemoryManager<StorageSmvBsr<NekDouble> >::
+                       AllocateSharedPtr(rows, cols, 1, bco));
+            csr.Multiply(in, out);
+
+            Array<OneD, NekDouble> ref(out.num_elements(), 0.0);
+            COOMatTypeConstIt it;
+            for (it = coo.begin(); it != coo.end(); ++it)
+            {
+                ref[it->first.first] += it->second * in[it->first.second];
+            }
+            BOOST_CHECK_SMALL(MaxDifference(out, ref, rows), 1e-13);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestThreadedBsr)
+        {
+            srand(4321);
+            for (int t = 0; t < 20; ++t)
+            {
+                IndexType  rows = 20 + rand() % 200;
+                IndexType  cols = rows;
+                COOMatType coo;
+                MakeMatrix(rows, cols, coo);
+
+                IndexType len = PaddedLength(rows);
+                Array<OneD, NekDouble> in(len, 0.0), ref(len, 0.0);
+                for (IndexType i = 0; i < cols; ++i)
+                {
+                    in[i] = rand() / (NekDouble) RAND_MAX - 0.5;
+                }
+                CsrMultiply(rows, cols, coo, in, ref);
+
+                for (IndexType blk = 1; blk <= 4; ++blk)
+                {
+                    IndexType brows = rows/blk + (rows % blk > 0);
+                    IndexType bcols = cols/blk + (cols % blk > 0);
+
+                    BCOMatType bco;
+                    convertCooToBco(brows, bcols, blk, coo, bco);
+                    BsrMat bsr(MemoryManager<StorageSmvBsr<NekDouble> >::
+                               AllocateSharedPtr(brows, bcols, blk, bco));
+
+                    for (unsigned int nThreads = 1; nThreads <= 4; ++nThreads)
+                    {
+                        bsr.SetThreadPool(
+                            LibUtilities::GetThreadPool(nThreads));
+
+                        Array<OneD, NekDouble> out(len, 0.0);
+                        bsr.Multiply(in, out);
+                        BOOST_CHECK_SMALL(
+                            MaxDifference(out, ref, rows), 1e-13);
+                    }
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSellCS)
+        {
+            const IndexType chunks[] = {1, 3, 4, 8, 16, 32};
+            const IndexType scopes[] = {1, 7, 32, 256, 4096};
+
+            srand(8765);
+            for (int t = 0; t < 10; ++t)
+            {
+                IndexType  rows = 20 + rand() % 200;
+                IndexType  cols = 20 + rand() % 200;
+                COOMatType coo;
+                MakeMatrix(rows, cols, coo);
+
+                IndexType len = PaddedLength(std::max(rows, cols));
+                Array<OneD, NekDouble> in(len, 0.0), ref(len, 0.0);
+                for (IndexType i = 0; i < cols; ++i)
+                {
+                    in[i] = rand() / (NekDouble) RAND_MAX - 0.5;
+                }
+                CsrMultiply(rows, cols, coo, in, ref);
+
+                for (int c = 0; c < 6; ++c)
+                {
+                    for (int s = 0; s < 5; ++s)
+                    {
+                        SellMat sell(MemoryManager<StorageSellCS<NekDouble> >
+                            ::AllocateSharedPtr(rows, cols, chunks[c],
+                                                scopes[s], coo));
+
+                        BOOST_CHECK_EQUAL(sell.GetNumNonZeroEntries(),
+                                          (IndexType) coo.size());
+
+                        for (unsigned int nThreads = 1; nThreads <= 3;
+                             ++nThreads)
+                        {
+                            sell.SetThreadPool(
+                                LibUtilities::GetThreadPool(nThreads));
+
+                            Array<OneD, NekDouble> out(len, 0.0);
+                            sell.Multiply(in, out);
+                            BOOST_CHECK_SMALL(
+                                MaxDifference(out, ref, rows), 1e-13);
+                        }
+                    }
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSharedThreadPool)
+        {
+            LibUtilities::ThreadPoolSharedPtr p1 =
+                LibUtilities::GetThreadPool(3);
+            LibUtilities::ThreadPoolSharedPtr p2 =
+                LibUtilities::GetThreadPool(3);
+            BOOST_CHECK(p1 == p2);
+            BOOST_CHECK_EQUAL(p1->GetNumThreads(), 3u);
+
+            // A new size replaces the shared pool, but the old one remains
+            // usable by its holders.
+            LibUtilities::ThreadPoolSharedPtr p3 =
+                LibUtilities::GetThreadPool(2);
+            BOOST_CHECK(p3 != p1);
+            BOOST_CHECK_EQUAL(p3->GetNumThreads(), 2u);
+            BOOST_CHECK_EQUAL(p1->GetNumThreads(), 3u);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestCompressData.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Round trip of the compressed base64 data encoding.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/BasicUtils/CompressData.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cctype>
+#include <vector>
+
+namespace Nektar
+{
+    namespace CompressDataUnitTests
+    {
+        using namespace LibUtilities;
+
+        BOOST_AUTO_TEST_CASE(TestIntRoundTrip)
+        {
+            // Record lengths giving every compressed size modulo three.
+            for (int n = 0; n < 40; ++n)
+            {
+                std::vector<int> in, out;
+                for (int i = 0; i < n; ++i)
+                {
+                    in.push_back((i * 7919) % 1013 - 500);
+                }
+
+                std::string encoded;
+                CompressData::ZlibEncodeToBase64Str(in, encoded);
+                BOOST_CHECK_EQUAL(encoded.size() % 4, 0);
+
+                CompressData::ZlibDecodeFromBase64Str(encoded, out);
+                BOOST_CHECK(in == out);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestDoubleRoundTripWithWhitespace)
+        {
+            std::vector<double> in, out;
+            for (int i = 0; i < 1000; ++i)
+            {
+                in.push_back(1.0 / (i + 1) - 0.25 * i);
+            }
+
+            std::string encoded;
+            CompressData::ZlibEncodeToBase64Str(in, encoded);
+
+            // Text nodes in a mesh file may be wrapped over several lines.
+            std::string wrapped;
+            for (int i = 0; i < encoded.size(); ++i)
+            {
+                if (i % 64 == 0)
+                {
+                    wrapped += "\n    ";
+                }
+                wrapped += encoded[i];
+            }
+            wrapped += "\n";
+
+            CompressData::ZlibDecodeFromBase64Str(wrapped, out);
+            BOOST_CHECK(in == out);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestCorruptDataRejected)
+        {
+            std::vector<int> in(100), out;
+            for (int i = 0; i < in.size(); ++i)
+            {
+                in[i] = i * i;
+            }
+
+            std::string encoded;
+            CompressData::ZlibEncodeToBase64Str(in, encoded);
+
+            // Truncated stream.
+            BOOST_CHECK_THROW(
+                CompressData::ZlibDecodeFromBase64Str(
+                    encoded.substr(0, encoded.size() / 2), out),
+                ErrorUtil::NekError);
+
+            // Altered payload, detected by the zlib checksum.
+            std::string altered(encoded);
+            int pos = altered.size() / 2;
+            altered[pos] = altered[pos] == 'A' ? 'B' : 'A';
+            BOOST_CHECK_THROW(
+                CompressData::ZlibDecodeFromBase64Str(altered, out),
+                ErrorUtil::NekError);
+
+            // Characters outside the base64 alphabet.
+            std::string invalid(encoded);
+            invalid[pos] = '*';
+            BOOST_CHECK_THROW(
+                CompressData::ZlibDecodeFromBase64Str(invalid, out),
+                ErrorUtil::NekError);
+        }
+    }
+}
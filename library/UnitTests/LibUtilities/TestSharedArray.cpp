@@ -35,6 +35,11 @@
 
 #include "LibUtilitiesUnitTestsPrecompiledHeader.h"
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/ThreadPool.h>
+
+#include <boost/bind.hpp>
+
+#include <vector>
 
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/test_case_template.hpp>
@@ -80,5 +85,45 @@ namespace Nektar
             CheckAddresses(array_1[0], array_1.data());
             CheckAddresses(array_1[1], array_1.data()+7);
         }
+    
+
+        /// Element type counting its destructions, to detect storage that
+        /// is released too early.
+        struct DestructionCounter
+        {
+            ~DestructionCounter()
+            {
+                ++destroyed;
+            }
+            static unsigned int destroyed;
+        };
+        unsigned int DestructionCounter::destroyed = 0;
+
+        void CopyRepeatedly(const Array<OneD, DestructionCounter> &shared,
+                            const unsigned int)
+        {
+            std::vector<Array<OneD, const DestructionCounter> > copies;
+            for (int i = 0; i < 1000; ++i)
+            {
+                copies.assign(100, shared);
+                copies.clear();
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestConcurrentCopies)
+        {
+            Array<OneD, DestructionCounter> shared(3);
+            DestructionCounter::destroyed = 0;
+
+            LibUtilities::ThreadPool pool(4);
+            pool.ParallelFor(8, boost::bind(
+                &CopyRepeatedly, boost::cref(shared), _1));
+
+            // The copies have all gone, but the original still holds the
+            // storage.
+            BOOST_CHECK_EQUAL(DestructionCounter::destroyed, 0u);
+            shared = Array<OneD, DestructionCounter>();
+            BOOST_CHECK_EQUAL(DestructionCounter::destroyed, 3u);
+        }
     }
 }
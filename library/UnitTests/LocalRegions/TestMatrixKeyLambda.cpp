@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestMatrixKeyLambda.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests that the mass and Laplacian matrices behind the
+// Helmholtz matrix are shared between Helmholtz constants.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LocalRegions/QuadExp.h>
+#include <LocalRegions/MatrixKey.h>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace MatrixKeyLambdaTests
+    {
+        LocalRegions::QuadExpSharedPtr CreateQuadExp()
+        {
+            SpatialDomains::PointGeomSharedPtr v[4] =
+            {
+                SpatialDomains::PointGeomSharedPtr(
+                    new SpatialDomains::PointGeom(2u, 0u, 0.0, 0.0, 0.0)),
+                SpatialDomains::PointGeomSharedPtr(
+                    new SpatialDomains::PointGeom(2u, 1u, 1.0, 0.0, 0.0)),
+                SpatialDomains::PointGeomSharedPtr(
+                    new SpatialDomains::PointGeom(2u, 2u, 1.5, 1.0, 0.0)),
+                SpatialDomains::PointGeomSharedPtr(
+                    new SpatialDomains::PointGeom(2u, 3u, 0.5, 1.0, 0.0))
+            };
+
+            SpatialDomains::SegGeomSharedPtr edges[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                SpatialDomains::PointGeomSharedPtr ev[2] = {v[i], v[(i+1)%4]};
+                edges[i] = SpatialDomains::SegGeomSharedPtr(
+                    new SpatialDomains::SegGeom(i, 2, ev));
+            }
+
+            StdRegions::Orientation eorient[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                eorient[i] = SpatialDomains::SegGeom::GetEdgeOrientation(
+                    *edges[i], *edges[(i+1)%4]);
+            }
+
+            SpatialDomains::QuadGeomSharedPtr geom(
+                new SpatialDomains::QuadGeom(0, edges, eorient));
+
+            const LibUtilities::PointsKey pkey(
+                6, LibUtilities::eGaussLobattoLegendre);
+            const LibUtilities::BasisKey bkey(
+                LibUtilities::eModified_A, 5, pkey);
+
+            return MemoryManager<LocalRegions::QuadExp>::AllocateSharedPtr(
+                bkey, bkey, geom);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestMassKeyIgnoresLambda)
+        {
+            LocalRegions::QuadExpSharedPtr exp = CreateQuadExp();
+
+            StdRegions::ConstFactorMap factors1, factors2;
+            factors1[StdRegions::eFactorLambda] = 1.0;
+            factors2[StdRegions::eFactorLambda] = 5.0;
+
+            LocalRegions::MatrixKey helm1(StdRegions::eHelmholtz,
+                                          exp->DetShapeType(), *exp,
+                                          factors1);
+            LocalRegions::MatrixKey helm2(StdRegions::eHelmholtz,
+                                          exp->DetShapeType(), *exp,
+                                          factors2);
+
+            // The Helmholtz keys must still be distinguished by lambda
+            BOOST_CHECK(helm1 < helm2 || helm2 < helm1);
+
+            // while the mass and Laplacian keys derived from them, and one
+            // built with lambda directly, are all the same key
+            LocalRegions::MatrixKey mass0(StdRegions::eMass,
+                                          exp->DetShapeType(), *exp);
+            LocalRegions::MatrixKey mass1(helm1, StdRegions::eMass);
+            LocalRegions::MatrixKey mass2(StdRegions::eMass,
+                                          exp->DetShapeType(), *exp,
+                                          factors2);
+            BOOST_CHECK(!(mass0 < mass1) && !(mass1 < mass0));
+            BOOST_CHECK(!(mass0 < mass2) && !(mass2 < mass0));
+
+            LocalRegions::MatrixKey lap1(helm1, StdRegions::eLaplacian);
+            LocalRegions::MatrixKey lap2(helm2, StdRegions::eLaplacian);
+            BOOST_CHECK(!(lap1 < lap2) && !(lap2 < lap1));
+        }
+
+        BOOST_AUTO_TEST_CASE(TestHelmholtzMatricesShareMass)
+        {
+            LocalRegions::QuadExpSharedPtr exp = CreateQuadExp();
+
+            const NekDouble lambda1 = 1.0;
+            const NekDouble lambda2 = 5.0;
+            StdRegions::ConstFactorMap factors1, factors2;
+            factors1[StdRegions::eFactorLambda] = lambda1;
+            factors2[StdRegions::eFactorLambda] = lambda2;
+
+            LocalRegions::MatrixKey helm1(StdRegions::eHelmholtz,
+                                          exp->DetShapeType(), *exp,
+                                          factors1);
+            LocalRegions::MatrixKey helm2(StdRegions::eHelmholtz,
+                                          exp->DetShapeType(), *exp,
+                                          factors2);
+
+            DNekScalMatSharedPtr H1 = exp->GetLocMatrix(helm1);
+            DNekScalMatSharedPtr H2 = exp->GetLocMatrix(helm2);
+
+            // Both constants must find the same stored mass and Laplacian
+            DNekScalMatSharedPtr M1 = exp->GetLocMatrix(
+                LocalRegions::MatrixKey(helm1, StdRegions::eMass));
+            DNekScalMatSharedPtr M2 = exp->GetLocMatrix(
+                LocalRegions::MatrixKey(helm2, StdRegions::eMass));
+            BOOST_CHECK(M1 == M2);
+
+            DNekScalMatSharedPtr L1 = exp->GetLocMatrix(
+                LocalRegions::MatrixKey(helm1, StdRegions::eLaplacian));
+            DNekScalMatSharedPtr L2 = exp->GetLocMatrix(
+                LocalRegions::MatrixKey(helm2, StdRegions::eLaplacian));
+            BOOST_CHECK(L1 == L2);
+
+            // and the Helmholtz matrices must be L + lambda M for each
+            const unsigned int n = exp->GetNcoeffs();
+            BOOST_CHECK_EQUAL(H1->GetRows(), n);
+            BOOST_CHECK_EQUAL(H2->GetRows(), n);
+
+            double epsilon = 1.0e-10;
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                for (unsigned int j = 0; j < n; ++j)
+                {
+                    BOOST_CHECK_SMALL((*H1)(i,j) - (*L1)(i,j)
+                                      - lambda1*(*M1)(i,j), epsilon);
+                    BOOST_CHECK_SMALL((*H2)(i,j) - (*L1)(i,j)
+                                      - lambda2*(*M1)(i,j), epsilon);
+                }
+            }
+        }
+    }
+}
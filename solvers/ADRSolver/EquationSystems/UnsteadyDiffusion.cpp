@@ -243,6 +243,9 @@ namespace Nektar
         // inarray = input: \hat{rhs} -> output: \hat{Y}
         // outarray = output: nabla^2 \hat{Y}
         // where \hat = modal coeffs
+        Array<OneD, MultiRegions::ExpListSharedPtr> fields(nvariables);
+        Array<OneD, Array<OneD, NekDouble> > rhs   (nvariables);
+        Array<OneD, Array<OneD, NekDouble> > coeffs(nvariables);
         for (int i = 0; i < nvariables; ++i)
         {
             // Multiply 1.0/timestep/lambda
@@ -250,14 +253,19 @@ namespace Nektar
                         -factors[StdRegions::eFactorLambda], 
                         inarray[i], 1, 
                         m_fields[i]->UpdatePhys(), 1);
-            
-            // Solve a system of equations with Helmholtz solver
-            m_fields[i]->HelmSolve(m_fields[i]->GetPhys(),
-                                   m_fields[i]->UpdateCoeffs(), 
-                                   NullFlagList, 
-                                   factors, 
-                                   m_varcoeff);
-            
+
+            fields[i] = m_fields[i];
+            rhs   [i] = m_fields[i]->UpdatePhys();
+            coeffs[i] = m_fields[i]->UpdateCoeffs();
+        }
+
+        // Solve a system of equations with Helmholtz solver for all
+        // variables at once
+        m_fields[0]->MultiHelmSolve(fields, rhs, coeffs, NullFlagList,
+                                    factors, m_varcoeff);
+
+        for (int i = 0; i < nvariables; ++i)
+        {
             m_fields[i]->BwdTrans(m_fields[i]->GetCoeffs(), 
                                   m_fields[i]->UpdatePhys());
             
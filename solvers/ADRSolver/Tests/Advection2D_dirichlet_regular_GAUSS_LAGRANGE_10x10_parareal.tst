@@ -0,0 +1,18 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>2D unsteady WeakDG advection GAUSS_LAGRANGE, P=3, Q=5 Dirichlet bcs, regular elements, Parareal over two time slices from t=0.5</description>
+    <executable>ADRSolver</executable>
+    <parameters>--npt 2 Advection2D_dirichlet_regular_GAUSS_LAGRANGE_10x10_parareal.xml</parameters>
+    <processes>2</processes>
+    <files>
+        <file description="Session File">Advection2D_dirichlet_regular_GAUSS_LAGRANGE_10x10_parareal.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-05"> 5.34741e-05 </value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="5e-05"> 8.66536e-05 </value>
+        </metric>
+    </metrics>
+</test>
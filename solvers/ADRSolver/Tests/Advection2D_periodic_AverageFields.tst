@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>2D unsteady FRDG advection of a travelling wave over one period, mean fields of AverageFields filter, u = 1 + sin(pi(x-t)), v = sin(pi(x-t)) + cos(pi(x-t))</description>
+    <executable>ADRSolver</executable>
+    <parameters>Advection2D_periodic_Statistics.xml</parameters>
+    <executable>../../utilities/PostProcessing/FieldConvert/FieldConvert</executable>
+    <parameters>-e Advection2D_periodic_Statistics.xml avg.fld avg_out.fld</parameters>
+    <files>
+        <file description="Session File">Advection2D_periodic_Statistics.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-6">2</value>
+            <value variable="v" tolerance="1e-6">0</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-6">1</value>
+            <value variable="v" tolerance="1e-6">0</value>
+        </metric>
+    </metrics>
+</test>
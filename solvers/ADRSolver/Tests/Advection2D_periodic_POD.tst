@@ -0,0 +1,42 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>2D unsteady FRDG advection of a travelling wave over one period, POD and DMD filter, u = 1 + sin(pi(x-t)), v = sin(pi(x-t)) + cos(pi(x-t))</description>
+    <executable>ADRSolver</executable>
+    <parameters>Advection2D_periodic_POD.xml</parameters>
+    <files>
+        <file description="Session File">Advection2D_periodic_POD.xml</file>
+    </files>
+    <metrics>
+        <metric type="Regex" id="1" file="wave.pod">
+            <regex>^# Singular values: (\S+) (\S+) (\S+)\s*$</regex>
+            <matches>
+                <match>
+                    <field tolerance="1e-4">20</field>
+                    <field tolerance="1e-4">17.3205</field>
+                    <field tolerance="1e-4">17.3205</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="Regex" id="2" file="wave.dmd">
+            <regex>^\s*\d+\s+(\S+)\s+0\s+(\S+)\s+(\S+)\s*$</regex>
+            <matches>
+                <match>
+                    <field tolerance="1e-5">1</field>
+                    <field tolerance="1e-5">0</field>
+                    <field tolerance="1e-5">0</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="Regex" id="3" file="wave.dmd">
+            <regex>^\s*\d+\s+(\S+)\s+(0\.\d+)\s+(\S+)\s+(\S+)\s*$</regex>
+            <matches>
+                <match>
+                    <field tolerance="1e-5">0.998027</field>
+                    <field tolerance="1e-5">0.0627905</field>
+                    <field tolerance="1e-5">0</field>
+                    <field tolerance="1e-4">3.14159</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,27 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>2D unsteady FRDG advection of a travelling wave over one period, ReynoldsStresses filter, u'u' = u'v' = 1/2, v'v' = 1</description>
+    <executable>ADRSolver</executable>
+    <parameters>Advection2D_periodic_Statistics.xml</parameters>
+    <executable>../../utilities/PostProcessing/FieldConvert/FieldConvert</executable>
+    <parameters>-e Advection2D_periodic_Statistics.xml stress.fld stress_out.fld</parameters>
+    <files>
+        <file description="Session File">Advection2D_periodic_Statistics.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u"  tolerance="1e-6">2</value>
+            <value variable="v"  tolerance="1e-6">0</value>
+            <value variable="uu" tolerance="1e-6">1</value>
+            <value variable="vv" tolerance="1e-6">2</value>
+            <value variable="uv" tolerance="1e-6">1</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u"  tolerance="1e-6">1</value>
+            <value variable="v"  tolerance="1e-6">0</value>
+            <value variable="uu" tolerance="1e-6">0.5</value>
+            <value variable="vv" tolerance="1e-6">1</value>
+            <value variable="uv" tolerance="1e-6">0.5</value>
+        </metric>
+    </metrics>
+</test>
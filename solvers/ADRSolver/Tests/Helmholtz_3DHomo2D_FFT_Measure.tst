@@ -0,0 +1,17 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>3D-Homogeneous-2D Helmholtz/Steady Diffusion (FFT, measured planning)</description>
+    <executable>ADRSolver</executable>
+    <parameters>-I FFTWPlanRigour=Measure Helmholtz_3DHomo2D_FFT.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz_3DHomo2D_FFT.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-12">1.00372e-06</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-12"> 6.32758e-06</value>
+        </metric>
+    </metrics>
+</test>
@@ -35,6 +35,8 @@
 
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 
+#include <boost/math/special_functions/fpclassify.hpp>
+
 #include <CardiacEPSolver/CellModels/CellModel.h>
 
 #include <StdRegions/StdNodalTriExp.h>
@@ -59,6 +61,22 @@ namespace Nektar
      * time-integrated using the Rush-Larsen method and for each variable y,
      * the corresponding y_inf and tau_y value is computed by Update(). The tau
      * values are stored in separate storage to inarray/outarray, #m_gates_tau.
+     *
+     * Rates and time constants which depend only on the membrane potential
+     * may be computed by the derived class in v_EvaluateVoltageTerms() and
+     * obtained in v_Update() through EvaluateVoltageTerms(). When the solver
+     * info CellModelLookupTable is set to True, these terms are tabulated
+     * over [LookupTableVmin, LookupTableVmax] with spacing LookupTableDV and
+     * linearly interpolated, avoiding the exponentials at every point.
+     *
+     * Models may instead of v_Update() implement v_UpdatePoint(), which
+     * computes the derivatives and gate time constants at a single point. In
+     * this case the whole time-step is integrated one point at a time, with
+     * the state of the point held in local storage across all substeps. The
+     * number of substeps may then also be chosen separately at each point
+     * by setting the parameter SubstepMaxDV. Such models also override
+     * v_FusedTimeIntegrate() to call FusedTimeIntegrate(this, dtPde), so that
+     * the kernel of the model is called non-virtually.
      */
 
     /**
@@ -73,6 +91,18 @@ namespace Nektar
         m_substeps = pSession->GetParameter("Substeps");
         m_nvar = 0;
         m_useNodal = false;
+        m_lutNterms = 0;
+        m_lutNint = 0;
+        m_lutMaxError = 0.0;
+
+        pSession->MatchSolverInfo("CellModelLookupTable", "True",
+                                  m_useLookupTable, false);
+        pSession->LoadParameter("LookupTableVmin", m_lutVmin, -150.0);
+        pSession->LoadParameter("LookupTableVmax", m_lutVmax,  100.0);
+        pSession->LoadParameter("LookupTableDV",   m_lutDV,      0.01);
+
+        m_useFusedKernel = false;
+        pSession->LoadParameter("SubstepMaxDV", m_substepMaxDV, 0.0);
 
         // Number of points in nodal space is the number of coefficients
         // in modified basis
@@ -147,6 +177,126 @@ namespace Nektar
         {
             v_SetInitialConditions();
         }
+
+        SetUpLookupTable();
+
+        m_useFusedKernel = v_HasPointUpdate();
+        ASSERTL0(m_substepMaxDV <= 0.0 || m_useFusedKernel,
+                 "Adaptive substepping is not supported by this cell model.");
+    }
+
+
+    void CellModel::GenerateSummary(SummaryList& s)
+    {
+        v_GenerateSummary(s);
+
+        if (m_useLookupTable)
+        {
+            std::stringstream ss;
+            ss << "[" << m_lutVmin << ", " << m_lutVmax << "], dV = "
+               << m_lutDV << ", max rel. error = " << m_lutMaxError;
+            SolverUtils::AddSummaryItem(s, "Lookup table", ss.str());
+        }
+
+        if (m_substepMaxDV > 0.0)
+        {
+            std::stringstream ss;
+            ss << "1-" << m_substeps << ", max dV = " << m_substepMaxDV;
+            SolverUtils::AddSummaryItem(s, "Adaptive substeps", ss.str());
+        }
+    }
+
+
+    /**
+     * Tabulates the voltage-dependent terms of the model and checks the
+     * accuracy of the interpolation at the midpoint of each interval, where
+     * the error of linear interpolation is largest. The error is measured
+     * relative to the magnitude of each term, with a floor based on its
+     * largest value over the table. Intervals containing one of
+     * #m_lutBreakpoints are skipped, since the model itself is
+     * discontinuous there. A warning is issued if the error exceeds the
+     * parameter LookupTableTol.
+     */
+    void CellModel::SetUpLookupTable()
+    {
+        m_lutNterms = v_GetNumVoltageTerms();
+        if (!m_useLookupTable || m_lutNterms == 0)
+        {
+            m_useLookupTable = false;
+            return;
+        }
+
+        ASSERTL0(m_lutVmax > m_lutVmin && m_lutDV > 0.0,
+                 "Invalid lookup table range.");
+
+        m_lutNint = static_cast<int>(
+            std::ceil((m_lutVmax - m_lutVmin) / m_lutDV));
+        m_lut = Array<OneD, NekDouble>((m_lutNint + 1)*m_lutNterms);
+
+        // Removable singularities of the rate expressions, e.g.
+        // x/(1-exp(-x)) at x = 0, suffer from cancellation at nearby
+        // voltages. Each entry is therefore the average of the values just
+        // either side of the node, which is accurate to O(delta^2).
+        const NekDouble delta = 1e-2*m_lutDV;
+        Array<OneD, NekDouble> lo(m_lutNterms), hi(m_lutNterms);
+        Array<OneD, NekDouble> scale(m_lutNterms, 0.0);
+        for (int i = 0; i <= m_lutNint; ++i)
+        {
+            const NekDouble V = m_lutVmin + i*m_lutDV;
+            v_EvaluateVoltageTerms(V - delta, &lo[0]);
+            v_EvaluateVoltageTerms(V + delta, &hi[0]);
+            for (int k = 0; k < m_lutNterms; ++k)
+            {
+                m_lut[i*m_lutNterms + k] = 0.5*(lo[k] + hi[k]);
+                scale[k] = max(scale[k], fabs(m_lut[i*m_lutNterms + k]));
+            }
+        }
+
+        // Accuracy check
+        Array<OneD, NekDouble> exact(m_lutNterms), approx(m_lutNterms);
+        Array<OneD, NekDouble> error(m_lutNterms, 0.0);
+        for (int i = 0; i < m_lutNint; ++i)
+        {
+            const NekDouble V = m_lutVmin + (i + 0.5)*m_lutDV;
+
+            bool skip = false;
+            for (int j = 0; j < m_lutBreakpoints.size(); ++j)
+            {
+                skip = skip ||
+                    fabs(m_lutBreakpoints[j] - V) <= 0.501*m_lutDV;
+            }
+            if (skip)
+            {
+                continue;
+            }
+
+            v_EvaluateVoltageTerms(V, &exact[0]);
+            EvaluateVoltageTerms(V, &approx[0]);
+            for (int k = 0; k < m_lutNterms; ++k)
+            {
+                if (!boost::math::isfinite(exact[k]))
+                {
+                    continue;
+                }
+                NekDouble e = fabs(approx[k] - exact[k])
+                            / max(fabs(exact[k]), 1e-6*scale[k]);
+                error[k] = max(error[k], e);
+            }
+        }
+
+        m_lutMaxError = Vmath::Vmax(m_lutNterms, error, 1);
+
+        NekDouble tol;
+        m_session->LoadParameter("LookupTableTol", tol, 1e-4);
+        if (m_lutMaxError > tol)
+        {
+            std::stringstream ss;
+            ss << "Cell model lookup table error " << m_lutMaxError
+               << " in term " << Vmath::Imax(m_lutNterms, error, 1)
+               << " exceeds LookupTableTol = " << tol
+               << "; consider reducing LookupTableDV.";
+            NEKERROR(ErrorUtil::ewarning, ss.str().c_str());
+        }
     }
 
     /**
@@ -211,20 +361,45 @@ namespace Nektar
         }
         // -------------------------
 
-        NekDouble delta_t = (time - m_lastTime)/m_substeps;
+        if (m_useFusedKernel)
+        {
+            v_FusedTimeIntegrate(time - m_lastTime);
+        }
+        else
+        {
+            NekDouble delta_t = (time - m_lastTime)/m_substeps;
 
 
-        // Perform substepping
-        for (unsigned int i = 0; i < m_substeps - 1; ++i)
-        {
+            // Perform substepping
+            for (unsigned int i = 0; i < m_substeps - 1; ++i)
+            {
+                Update(m_cellSol, m_wsp, time);
+                // Voltage
+                Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
+                // Ion concentrations
+                for (unsigned int j = 0; j < m_concentrations.size(); ++j)
+                {
+                    Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+                }
+                // Gating variables: Rush-Larsen scheme
+                for (unsigned int j = 0; j < m_gates.size(); ++j)
+                {
+                    Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                    Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                    Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                    Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                }
+            }
+
+            // Perform final cell model step
             Update(m_cellSol, m_wsp, time);
-            // Voltage
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
+
             // Ion concentrations
             for (unsigned int j = 0; j < m_concentrations.size(); ++j)
             {
                 Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
             }
+
             // Gating variables: Rush-Larsen scheme
             for (unsigned int j = 0; j < m_gates.size(); ++j)
             {
@@ -235,9 +410,6 @@ namespace Nektar
             }
         }
 
-        // Perform final cell model step
-        Update(m_cellSol, m_wsp, time);
-
         // Output dV/dt from last step but integrate remaining cell model vars
         // Transform cell model I_total from nodal to modal space
         if (m_useNodal)
@@ -268,24 +440,65 @@ namespace Nektar
             Vmath::Vcopy(m_nq, m_wsp[0], 1, outarray[0], 1);
         }
 
-        // Ion concentrations
-        for (unsigned int j = 0; j < m_concentrations.size(); ++j)
-        {
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
-        }
+        m_lastTime = time;
+    }
 
-        // Gating variables: Rush-Larsen scheme
-        for (unsigned int j = 0; j < m_gates.size(); ++j)
+    /**
+     * Models providing v_UpdatePoint() override this with a call to
+     * FusedTimeIntegrate(this, dtPde).
+     */
+    void CellModel::v_FusedTimeIntegrate(const NekDouble dtPde)
+    {
+        ASSERTL0(false, "Cell model must implement v_FusedTimeIntegrate.");
+    }
+
+
+    /**
+     * Default implementation for models providing v_UpdatePoint(), which is
+     * evaluated at each point in turn.
+     */
+    void CellModel::v_Update(
+            const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                  Array<OneD,        Array<OneD, NekDouble> >&outarray,
+            const NekDouble time)
+    {
+        ASSERTL0(v_HasPointUpdate(),
+                 "Cell model must implement v_Update or v_UpdatePoint.");
+
+        const int ngates = m_gates.size();
+        Array<OneD, NekDouble> y(m_nvar), dy(m_nvar), tau(max(ngates, 1));
+
+        for (int i = 0; i < m_nq; ++i)
         {
-            Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
-            Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+            for (int k = 0; k < m_nvar; ++k)
+            {
+                y[k] = inarray[k][i];
+            }
+
+            v_UpdatePoint(&y[0], &dy[0], &tau[0]);
+
+            for (int k = 0; k < m_nvar; ++k)
+            {
+                outarray[k][i] = dy[k];
+            }
+            for (int j = 0; j < ngates; ++j)
+            {
+                m_gates_tau[j][i] = tau[j];
+            }
         }
+    }
 
-        m_lastTime = time;
+
+    void CellModel::v_UpdatePoint(
+            const NekDouble *y,
+                  NekDouble *dy,
+                  NekDouble *tau)
+    {
+        NEKERROR(ErrorUtil::efatal,
+                 "Point-wise update not available for this cell model.");
     }
 
+
     Array<OneD, NekDouble> CellModel::GetCellSolutionCoeffs(unsigned int idx)
     {
         ASSERTL0(idx < m_nvar, "Index out of range for cell model.");
@@ -36,6 +36,9 @@
 #ifndef NEKTAR_SOLVERS_ADRSOLVER_CELLMODELS_CELLMODEL
 #define NEKTAR_SOLVERS_ADRSOLVER_CELLMODELS_CELLMODEL
 
+#include <algorithm>
+#include <cmath>
+
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/BasicUtils/SessionReader.h>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
@@ -89,10 +92,7 @@ namespace Nektar
         }
 
         /// Print a summary of the cell model
-        void GenerateSummary(SummaryList& s)
-        {
-            v_GenerateSummary(s);
-        }
+        void GenerateSummary(SummaryList& s);
 
         unsigned int GetNumCellVariables()
         {
@@ -142,10 +142,49 @@ namespace Nektar
         /// Storage for gate tau values
         Array<OneD, Array<OneD, NekDouble> > m_gates_tau;
 
+        /// Flag indicating whether voltage terms are tabulated
+        bool m_useLookupTable;
+        /// Number of voltage-dependent terms computed by the model
+        int m_lutNterms;
+        /// Number of intervals in the lookup table
+        int m_lutNint;
+        /// Voltage range and spacing of the lookup table
+        NekDouble m_lutVmin;
+        NekDouble m_lutVmax;
+        NekDouble m_lutDV;
+        /// Largest relative interpolation error found by the accuracy check
+        NekDouble m_lutMaxError;
+        /// Tabulated terms, one row of m_lutNterms values per voltage
+        Array<OneD, NekDouble> m_lut;
+        /// Potentials at which tabulated terms are discontinuous
+        std::vector<NekDouble> m_lutBreakpoints;
+
+        /// Flag indicating whether the fused per-point integrator is used
+        bool m_useFusedKernel;
+        /// Largest change in potential per substep (adaptive if positive)
+        NekDouble m_substepMaxDV;
+
         virtual void v_Update(
                 const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                       Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                const NekDouble time) = 0;
+                const NekDouble time);
+
+        /// Whether the model implements v_UpdatePoint
+        virtual bool v_HasPointUpdate()
+        {
+            return false;
+        }
+
+        /// Compute the derivatives and gate time constants at one point
+        virtual void v_UpdatePoint(
+                const NekDouble *y,
+                      NekDouble *dy,
+                      NekDouble *tau);
+
+        /// Integrate all points over one PDE time-step; point-wise models
+        /// instantiate FusedTimeIntegrate here so that v_UpdatePoint is
+        /// inlined.
+        virtual void v_FusedTimeIntegrate(const NekDouble dtPde);
 
         virtual void v_GenerateSummary(SummaryList& s) = 0;
 
@@ -156,9 +195,140 @@ namespace Nektar
 
         virtual void v_SetInitialConditions() = 0;
 
+        /// Number of terms computed by v_EvaluateVoltageTerms
+        virtual int v_GetNumVoltageTerms()
+        {
+            return 0;
+        }
+
+        /// Compute the terms which depend only on the membrane potential
+        virtual void v_EvaluateVoltageTerms(
+                const NekDouble  V,
+                      NekDouble *terms)
+        {
+        }
+
+        /// Voltage-dependent terms at V, interpolated if tabulated
+        inline void EvaluateVoltageTerms(
+                const NekDouble  V,
+                      NekDouble *terms);
+
         void LoadCellModel();
+
+        template <class ModelType>
+        void FusedTimeIntegrate(
+                      ModelType *model,
+                const NekDouble  dtPde);
+
+    private:
+        void SetUpLookupTable();
     };
 
+    /**
+     * Voltages outside the table range are evaluated directly.
+     */
+    inline void CellModel::EvaluateVoltageTerms(
+            const NekDouble  V,
+                  NekDouble *terms)
+    {
+        const NekDouble x = (V - m_lutVmin) / m_lutDV;
+        if (!m_useLookupTable || !(x >= 0.0 && x < m_lutNint))
+        {
+            v_EvaluateVoltageTerms(V, terms);
+            return;
+        }
+
+        const int       i  = static_cast<int>(x);
+        const NekDouble w  = x - i;
+        const NekDouble *r0 = &m_lut[i*m_lutNterms];
+        const NekDouble *r1 = r0 + m_lutNterms;
+        for (int k = 0; k < m_lutNterms; ++k)
+        {
+            terms[k] = r0[k] + w*(r1[k] - r0[k]);
+        }
+    }
+
+    /**
+     * Integrates the cell model over one PDE time-step of length @a dtPde
+     * using the point-wise kernel of @a ModelType. Each point is integrated
+     * over all of its substeps in turn, so that its state remains in local
+     * storage rather than sweeping the full solution arrays for every
+     * operation as in the vectorised scheme. The time-integration schemes
+     * are the same. The kernel is called non-virtually so that it can be
+     * inlined into the substep loop.
+     *
+     * If SubstepMaxDV is positive, the number of substeps at each point is
+     * chosen from the initial rate of change of the potential so that it
+     * changes by at most SubstepMaxDV per substep, limited to the range
+     * [1, Substeps]. Cells at rest therefore take a single step, while
+     * cells in the upstroke take the full number of substeps.
+     */
+    template <class ModelType>
+    void CellModel::FusedTimeIntegrate(
+                  ModelType *model,
+            const NekDouble  dtPde)
+    {
+        const int nconc  = m_concentrations.size();
+        const int ngates = m_gates.size();
+        const int *conc  = nconc  ? &m_concentrations[0] : 0;
+        const int *gates = ngates ? &m_gates[0]          : 0;
+
+        Array<OneD, NekDouble> wsp(2*m_nvar + std::max(ngates, 1));
+        NekDouble *y   = wsp.get();
+        NekDouble *dy  = y  + m_nvar;
+        NekDouble *tau = dy + m_nvar;
+
+        for (int i = 0; i < m_nq; ++i)
+        {
+            for (int k = 0; k < m_nvar; ++k)
+            {
+                y[k] = m_cellSol[k][i];
+            }
+
+            model->ModelType::v_UpdatePoint(y, dy, tau);
+
+            int nsub = m_substeps;
+            if (m_substepMaxDV > 0.0)
+            {
+                nsub = static_cast<int>(
+                    std::ceil(std::fabs(dy[0])*dtPde/m_substepMaxDV));
+                nsub = std::max(1, std::min(nsub, m_substeps));
+            }
+            const NekDouble dt = dtPde/nsub;
+
+            for (int n = 0; n < nsub; ++n)
+            {
+                if (n > 0)
+                {
+                    model->ModelType::v_UpdatePoint(y, dy, tau);
+                }
+
+                // Voltage, except on the final step where dV/dt is output
+                if (n < nsub - 1)
+                {
+                    y[0] += dt*dy[0];
+                }
+                // Ion concentrations
+                for (int j = 0; j < nconc; ++j)
+                {
+                    y[conc[j]] += dt*dy[conc[j]];
+                }
+                // Gating variables: Rush-Larsen scheme
+                for (int j = 0; j < ngates; ++j)
+                {
+                    const int g = gates[j];
+                    y[g] = dy[g] + (y[g] - dy[g])*std::exp(-dt/tau[j]);
+                }
+            }
+
+            for (int k = 0; k < m_nvar; ++k)
+            {
+                m_cellSol[k][i] = y[k];
+                m_wsp[k][i]     = dy[k];
+            }
+        }
+    }
+
 }
 
 #endif /* CELLMODEL_H_ */
@@ -149,6 +149,8 @@ namespace Nektar
         m_concentrations.push_back(18);
         m_concentrations.push_back(19);
         m_concentrations.push_back(20);
+
+        m_lutBreakpoints.push_back(-40.0);
     }
     
     
@@ -195,7 +197,6 @@ namespace Nektar
         //  21  Ca_up  Calcium up
         int n = m_nq;
         int i = 0;
-        NekDouble alpha, beta;
         Vmath::Zero(n, outarray[0], 1);
 
         Array<OneD, NekDouble> &tmp = outarray[11];
@@ -426,110 +427,25 @@ namespace Nektar
         Vmath::Sadd(n, 1.0, outarray[19], 1, outarray[19], 1);
         Vmath::Vdiv(n, tmp, 1, outarray[19], 1, outarray[19], 1);
 
-        // Process gating variables
+        // Process gating variables which depend only on the voltage
+        // m, h, j, o_a, o_i, u_a, u_i, x_r, x_s, d, f and w. The inf and
+        // tau values of each are stored consecutively in vt.
+        static const int gateVar[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15};
+        NekDouble vt[24];
+        for (i = 0; i < n; ++i)
+        {
+            EvaluateVoltageTerms(inarray[0][i], vt);
+            for (int g = 0; g < 12; ++g)
+            {
+                outarray[gateVar[g]][i]      = vt[2*g];
+                m_gates_tau[gateVar[g]-1][i] = vt[2*g+1];
+            }
+        }
+
         const NekDouble * v;
         const NekDouble * x;
         NekDouble * x_tau;
         NekDouble * x_new;
-        // m
-        for (i = 0, v = &inarray[0][0], x = &inarray[1][0], x_new = &outarray[1][0], x_tau = &m_gates_tau[0][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = (*v == (-47.13)) ? 3.2 : (0.32*(*v+47.13))/(1.0-exp((-0.1)*(*v + 47.13)));
-            beta  = 0.08*exp(-(*v)/11.0);
-            *x_tau = 1.0/(alpha + beta);
-            *x_new = alpha*(*x_tau);
-        }
-        // h
-        for (i = 0, v = &inarray[0][0], x = &inarray[2][0], x_new = &outarray[2][0], x_tau = &m_gates_tau[1][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = (*v >= -40.0) ? 0.0 : 0.135*exp(-((*v)+80.0)/6.8);
-            beta  = (*v >= -40.0) ? 1.0/(0.13*(1.0+exp(-(*v + 10.66)/11.1)))
-                    : 3.56*exp(0.079*(*v))+310000.0*exp(0.35*(*v));
-            *x_tau = 1.0/(alpha + beta);
-            *x_new = alpha*(*x_tau);
-        }
-        // j
-        for (i = 0, v = &inarray[0][0], x = &inarray[3][0], x_new = &outarray[3][0], x_tau = &m_gates_tau[2][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = (*v >= -40.0) ? 0.0
-                    : (-127140.0*exp(0.2444*(*v))-3.474e-05*exp(-0.04391*(*v)))*(((*v)+37.78)/(1.0+exp(0.311*((*v)+79.23))));
-            beta  = (*v >= -40.0) ? (0.3*exp(-2.535e-07*(*v))/(1.0+exp(-0.1*(*v+32.0))))
-                    : 0.1212*exp(-0.01052*(*v))/(1.0+exp(-0.1378*(*v+40.14)));
-            *x_tau = 1.0/(alpha + beta);
-            *x_new = alpha*(*x_tau);
-        }
-        // oa
-        for (i = 0, v = &inarray[0][0], x = &inarray[4][0], x_new = &outarray[4][0], x_tau = &m_gates_tau[3][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = 0.65/(exp(-(*v+10.0)/8.5) + exp(-(*v-30.0)/59.0));
-            beta  = 0.65/(2.5 + exp((*v+82.0)/17.0));
-            *x_tau = 1.0/K_Q10/(alpha + beta);
-            *x_new = (1.0/(1.0+exp(-(*v+20.47)/17.54)));
-        }
-        // oi
-        for (i = 0, v = &inarray[0][0], x = &inarray[5][0], x_new = &outarray[5][0], x_tau = &m_gates_tau[4][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = 1.0/(18.53 + exp((*v+113.7)/10.95));
-            beta  = 1.0/(35.56 + exp(-(*v+1.26)/7.44));
-            *x_tau = 1.0/K_Q10/(alpha + beta);
-            *x_new = (1.0/(1.0+exp((*v+43.1)/5.3)));
-        }
-        // ua
-        for (i = 0, v = &inarray[0][0], x = &inarray[6][0], x_new = &outarray[6][0], x_tau = &m_gates_tau[5][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = 0.65/(exp(-(*v+10.0)/8.5)+exp(-(*v-30.0)/59.0));
-            beta  = 0.65/(2.5+exp((*v+82.0)/17.0));
-            *x_tau = 1.0/K_Q10/(alpha + beta);
-            *x_new = 1.0/(1.0+exp(-(*v+30.3)/9.6));
-        }
-        // ui
-        for (i = 0, v = &inarray[0][0], x = &inarray[7][0], x_new = &outarray[7][0], x_tau = &m_gates_tau[6][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = 1.0/(21.0 + exp(-(*v-185.0)/28.0));
-            beta  = exp((*v-158.0)/16.0);
-            *x_tau = 1.0/K_Q10/(alpha + beta);
-            *x_new = 1.0/(1.0+exp((*v-99.45)/27.48));
-        }
-        // xr
-        for (i = 0, v = &inarray[0][0], x = &inarray[8][0], x_new = &outarray[8][0], x_tau = &m_gates_tau[7][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = 0.0003*(*v+14.1)/(1-exp(-(*v+14.1)/5.0));
-            beta  = 7.3898e-5*(*v-3.3328)/(exp((*v-3.3328)/5.1237)-1.0);
-            *x_tau = 1.0/(alpha + beta);
-            *x_new = 1.0/(1+exp(-(*v+14.1)/6.5));
-        }
-        // xs
-        for (i = 0, v = &inarray[0][0], x = &inarray[9][0], x_new = &outarray[9][0], x_tau = &m_gates_tau[8][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            alpha = 4e-5*(*v-19.9)/(1.0-exp(-(*v-19.9)/17.0));
-            beta  = 3.5e-5*(*v-19.9)/(exp((*v-19.9)/9.0)-1.0);
-            *x_tau = 0.5/(alpha + beta);
-            *x_new = 1.0/sqrt(1.0+exp(-(*v-19.9)/12.7));
-        }
-        // d
-        for (i = 0, v = &inarray[0][0], x = &inarray[10][0], x_new = &outarray[10][0], x_tau = &m_gates_tau[9][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            *x_tau  = (1-exp(-(*v+10.0)/6.24))/(0.035*(*v+10.0)*(1+exp(-(*v+10.0)/6.24)));
-            *x_new = 1.0/(1.0 + exp(-(*v+10)/8.0));
-        }
-        // f
-        for (i = 0, v = &inarray[0][0], x = &inarray[11][0], x_new = &outarray[11][0], x_tau = &m_gates_tau[10][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            //alpha = 1.0/(1.0 + exp((*v+28.0)/6.9));
-            *x_tau  = 9.0/(0.0197*exp(-0.0337*0.0337*(*v+10.0)*(*v+10.0))+0.02);
-            *x_new = exp((-(*v + 28.0)) / 6.9) / (1.0 + exp((-(*v + 28.0)) / 6.9));
-        }
         // f_Ca
         for (i = 0, v = &inarray[0][0], x = &inarray[12][0], x_new = &outarray[12][0], x_tau = &m_gates_tau[11][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
@@ -538,7 +454,7 @@ namespace Nektar
             *x_new = 1.0/(1.0+inarray[17][i]/0.00035);
         }
 
-        Array<OneD, NekDouble> &tmp_Fn = outarray[15];
+        Array<OneD, NekDouble> &tmp_Fn = outarray[14];
         Vmath::Svtsvtp(n, 0.5*5e-13/F, tmp_I_Ca_L, 1, -0.2*5e-13/F, tmp_I_Na_Ca, 1, tmp_Fn, 1);
         Vmath::Svtvm(n, 1e-12*JSR_V_rel, tmp_I_rel, 1, tmp_Fn, 1, tmp_Fn, 1);
 
@@ -556,14 +472,76 @@ namespace Nektar
             *x_tau  = 1.91 + 2.09/(1.0+exp(-(*v - 3.4175e-13)/13.67e-16));
             *x_new = 1.0 - 1.0/(1.0 + exp(-(*v - 6.835e-14)/13.67e-16));
         }
-        // w
-        for (i = 0, v = &inarray[0][0], x = &inarray[15][0], x_new = &outarray[15][0], x_tau = &m_gates_tau[14][0];
-                i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
-        {
-            *x_tau  = 6.0*(1.0-exp(-(*v-7.9)/5.0))/(1.0+0.3*exp(-(*v-7.9)/5.0))/(*v-7.9);
-            *x_new = 1.0 - 1.0/(1.0 + exp(-(*v - 40.0)/17.0));
-        }
+    }
 
+
+    /**
+     * Computes the steady-state value and time constant of each gating
+     * variable which depends only on the membrane potential.
+     */
+    void CourtemancheRamirezNattel98::v_EvaluateVoltageTerms(
+            const NekDouble  v,
+                  NekDouble *terms)
+    {
+        NekDouble alpha, beta;
+
+        // m
+        alpha = (v == (-47.13)) ? 3.2 : (0.32*(v+47.13))/(1.0-exp((-0.1)*(v + 47.13)));
+        beta  = 0.08*exp(-(v)/11.0);
+        terms[1]  = 1.0/(alpha + beta);
+        terms[0]  = alpha*terms[1];
+        // h
+        alpha = (v >= -40.0) ? 0.0 : 0.135*exp(-((v)+80.0)/6.8);
+        beta  = (v >= -40.0) ? 1.0/(0.13*(1.0+exp(-(v + 10.66)/11.1)))
+                : 3.56*exp(0.079*(v))+310000.0*exp(0.35*(v));
+        terms[3]  = 1.0/(alpha + beta);
+        terms[2]  = alpha*terms[3];
+        // j
+        alpha = (v >= -40.0) ? 0.0
+                : (-127140.0*exp(0.2444*(v))-3.474e-05*exp(-0.04391*(v)))*(((v)+37.78)/(1.0+exp(0.311*((v)+79.23))));
+        beta  = (v >= -40.0) ? (0.3*exp(-2.535e-07*(v))/(1.0+exp(-0.1*(v+32.0))))
+                : 0.1212*exp(-0.01052*(v))/(1.0+exp(-0.1378*(v+40.14)));
+        terms[5]  = 1.0/(alpha + beta);
+        terms[4]  = alpha*terms[5];
+        // oa
+        alpha = 0.65/(exp(-(v+10.0)/8.5) + exp(-(v-30.0)/59.0));
+        beta  = 0.65/(2.5 + exp((v+82.0)/17.0));
+        terms[7]  = 1.0/K_Q10/(alpha + beta);
+        terms[6]  = (1.0/(1.0+exp(-(v+20.47)/17.54)));
+        // oi
+        alpha = 1.0/(18.53 + exp((v+113.7)/10.95));
+        beta  = 1.0/(35.56 + exp(-(v+1.26)/7.44));
+        terms[9]  = 1.0/K_Q10/(alpha + beta);
+        terms[8]  = (1.0/(1.0+exp((v+43.1)/5.3)));
+        // ua
+        alpha = 0.65/(exp(-(v+10.0)/8.5)+exp(-(v-30.0)/59.0));
+        beta  = 0.65/(2.5+exp((v+82.0)/17.0));
+        terms[11] = 1.0/K_Q10/(alpha + beta);
+        terms[10] = 1.0/(1.0+exp(-(v+30.3)/9.6));
+        // ui
+        alpha = 1.0/(21.0 + exp(-(v-185.0)/28.0));
+        beta  = exp((v-158.0)/16.0);
+        terms[13] = 1.0/K_Q10/(alpha + beta);
+        terms[12] = 1.0/(1.0+exp((v-99.45)/27.48));
+        // xr
+        alpha = 0.0003*(v+14.1)/(1-exp(-(v+14.1)/5.0));
+        beta  = 7.3898e-5*(v-3.3328)/(exp((v-3.3328)/5.1237)-1.0);
+        terms[15] = 1.0/(alpha + beta);
+        terms[14] = 1.0/(1+exp(-(v+14.1)/6.5));
+        // xs
+        alpha = 4e-5*(v-19.9)/(1.0-exp(-(v-19.9)/17.0));
+        beta  = 3.5e-5*(v-19.9)/(exp((v-19.9)/9.0)-1.0);
+        terms[17] = 0.5/(alpha + beta);
+        terms[16] = 1.0/sqrt(1.0+exp(-(v-19.9)/12.7));
+        // d
+        terms[19] = (1-exp(-(v+10.0)/6.24))/(0.035*(v+10.0)*(1+exp(-(v+10.0)/6.24)));
+        terms[18] = 1.0/(1.0 + exp(-(v+10)/8.0));
+        // f
+        terms[21] = 9.0/(0.0197*exp(-0.0337*0.0337*(v+10.0)*(v+10.0))+0.02);
+        terms[20] = exp((-(v + 28.0)) / 6.9) / (1.0 + exp((-(v + 28.0)) / 6.9));
+        // w
+        terms[23] = 6.0*(1.0-exp(-(v-7.9)/5.0))/(1.0+0.3*exp(-(v-7.9)/5.0))/(v-7.9);
+        terms[22] = 1.0 - 1.0/(1.0 + exp(-(v - 40.0)/17.0));
     }
 
 
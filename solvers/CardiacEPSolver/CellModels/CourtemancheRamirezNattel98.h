@@ -78,6 +78,16 @@ namespace Nektar
 
         virtual std::string v_GetCellVarName(unsigned int idx);
 
+        virtual int v_GetNumVoltageTerms()
+        {
+            return 24;
+        }
+
+        /// Computes the terms depending only on the membrane potential.
+        virtual void v_EvaluateVoltageTerms(
+                const NekDouble  v,
+                      NekDouble *terms);
+
     private:
         NekDouble C_m;
         NekDouble g_Na;
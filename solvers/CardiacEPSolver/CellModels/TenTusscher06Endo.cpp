@@ -75,326 +75,303 @@ namespace Nektar
         m_concentrations.push_back(16);
         m_concentrations.push_back(17);
         m_concentrations.push_back(18);
+
+        m_lutBreakpoints.push_back(-40.0);
     }
     
     
     /**
      *
      */
-    void TenTusscher06Endo::v_Update(
-                     const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
-                           Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                     const NekDouble time)
+    void TenTusscher06Endo::v_UpdatePoint(
+            const NekDouble *y,
+                  NekDouble *dy,
+                  NekDouble *tau)
     {
-        for (unsigned int i = 0; i < m_nq; ++i)
-        {
-            // Inputs:
-            // Time units: millisecond
-            NekDouble var_chaste_interface__membrane__V = inarray[0][i];
-            // Units: millivolt; Initial value: -86.709
-            NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1 = inarray[1][i];
-            // Units: dimensionless; Initial value: 0.00448
-            NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2 = inarray[2][i];
-            // Units: dimensionless; Initial value: 0.476
-            NekDouble var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs = inarray[3][i];
-            // Units: dimensionless; Initial value: 0.0087
-            NekDouble var_chaste_interface__fast_sodium_current_m_gate__m = inarray[4][i];
-            // Units: dimensionless; Initial value: 0.00155
-            NekDouble var_chaste_interface__fast_sodium_current_h_gate__h = inarray[5][i];
-            // Units: dimensionless; Initial value: 0.7573
-            NekDouble var_chaste_interface__fast_sodium_current_j_gate__j = inarray[6][i];
-            // Units: dimensionless; Initial value: 0.7225
-            NekDouble var_chaste_interface__L_type_Ca_current_d_gate__d = inarray[7][i];
-            // Units: dimensionless; Initial value: 3.164e-5
-            NekDouble var_chaste_interface__L_type_Ca_current_f_gate__f = inarray[8][i];
-            // Units: dimensionless; Initial value: 0.8009
-            NekDouble var_chaste_interface__L_type_Ca_current_f2_gate__f2 = inarray[9][i];
-            // Units: dimensionless; Initial value: 0.9778
-            NekDouble var_chaste_interface__L_type_Ca_current_fCass_gate__fCass = inarray[10][i];
-            // Units: dimensionless; Initial value: 0.9953
-            NekDouble var_chaste_interface__transient_outward_current_s_gate__s = inarray[11][i];
-            // Units: dimensionless; Initial value: 0.3212
-            NekDouble var_chaste_interface__transient_outward_current_r_gate__r = inarray[12][i];
-            // Units: dimensionless; Initial value: 2.235e-8
-            NekDouble var_chaste_interface__calcium_dynamics__Ca_i = inarray[13][i];
-            // Units: millimolar; Initial value: 0.00013
-            NekDouble var_chaste_interface__calcium_dynamics__Ca_SR = inarray[14][i];
-            // Units: millimolar; Initial value: 3.715
-            NekDouble var_chaste_interface__calcium_dynamics__Ca_ss = inarray[15][i];
-            // Units: millimolar; Initial value: 0.00036
-            NekDouble var_chaste_interface__calcium_dynamics__R_prime = inarray[16][i];
-            // Units: dimensionless; Initial value: 0.9068
-            NekDouble var_chaste_interface__sodium_dynamics__Na_i = inarray[17][i];
-            // Units: millimolar; Initial value: 10.355
-            NekDouble var_chaste_interface__potassium_dynamics__K_i = inarray[18][i];
-            // Units: millimolar; Initial value: 138.4
+        // Inputs:
+        // Time units: millisecond
+        NekDouble var_chaste_interface__membrane__V = y[0];
+        // Units: millivolt; Initial value: -86.709
+        NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1 = y[1];
+        // Units: dimensionless; Initial value: 0.00448
+        NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2 = y[2];
+        // Units: dimensionless; Initial value: 0.476
+        NekDouble var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs = y[3];
+        // Units: dimensionless; Initial value: 0.0087
+        NekDouble var_chaste_interface__fast_sodium_current_m_gate__m = y[4];
+        // Units: dimensionless; Initial value: 0.00155
+        NekDouble var_chaste_interface__fast_sodium_current_h_gate__h = y[5];
+        // Units: dimensionless; Initial value: 0.7573
+        NekDouble var_chaste_interface__fast_sodium_current_j_gate__j = y[6];
+        // Units: dimensionless; Initial value: 0.7225
+        NekDouble var_chaste_interface__L_type_Ca_current_d_gate__d = y[7];
+        // Units: dimensionless; Initial value: 3.164e-5
+        NekDouble var_chaste_interface__L_type_Ca_current_f_gate__f = y[8];
+        // Units: dimensionless; Initial value: 0.8009
+        NekDouble var_chaste_interface__L_type_Ca_current_f2_gate__f2 = y[9];
+        // Units: dimensionless; Initial value: 0.9778
+        NekDouble var_chaste_interface__L_type_Ca_current_fCass_gate__fCass = y[10];
+        // Units: dimensionless; Initial value: 0.9953
+        NekDouble var_chaste_interface__transient_outward_current_s_gate__s = y[11];
+        // Units: dimensionless; Initial value: 0.3212
+        NekDouble var_chaste_interface__transient_outward_current_r_gate__r = y[12];
+        // Units: dimensionless; Initial value: 2.235e-8
+        NekDouble var_chaste_interface__calcium_dynamics__Ca_i = y[13];
+        // Units: millimolar; Initial value: 0.00013
+        NekDouble var_chaste_interface__calcium_dynamics__Ca_SR = y[14];
+        // Units: millimolar; Initial value: 3.715
+        NekDouble var_chaste_interface__calcium_dynamics__Ca_ss = y[15];
+        // Units: millimolar; Initial value: 0.00036
+        NekDouble var_chaste_interface__calcium_dynamics__R_prime = y[16];
+        // Units: dimensionless; Initial value: 0.9068
+        NekDouble var_chaste_interface__sodium_dynamics__Na_i = y[17];
+        // Units: millimolar; Initial value: 10.355
+        NekDouble var_chaste_interface__potassium_dynamics__K_i = y[18];
+        // Units: millimolar; Initial value: 138.4
+
+        
+        // Mathematics
+        NekDouble vt[22];
+        EvaluateVoltageTerms(var_chaste_interface__membrane__V, vt);
 
-            
-            // Mathematics
-            NekDouble d_dt_chaste_interface__membrane__V;
-            const NekDouble var_membrane__R = 8314.472; // joule_per_mole_kelvin
-            const NekDouble var_membrane__T = 310.0; // kelvin
-            const NekDouble var_membrane__F = 96485.3415; // coulomb_per_millimole
-            const NekDouble var_membrane__Cm = 0.185; // microF
-            const NekDouble var_membrane__V_c = 0.016404; // micrometre3
-            const NekDouble var_inward_rectifier_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_reversal_potentials__K_i = var_chaste_interface__potassium_dynamics__K_i; // millimolar
-            const NekDouble var_reversal_potentials__R = var_membrane__R; // joule_per_mole_kelvin
-            const NekDouble var_reversal_potentials__T = var_membrane__T; // kelvin
-            const NekDouble var_reversal_potentials__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_potassium_dynamics__K_o = 5.4; // millimolar
-            const NekDouble var_reversal_potentials__K_o = var_potassium_dynamics__K_o; // millimolar
-            const NekDouble var_reversal_potentials__E_K = ((var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log(var_reversal_potentials__K_o / var_reversal_potentials__K_i); // millivolt
-            const NekDouble var_inward_rectifier_potassium_current__E_K = var_reversal_potentials__E_K; // millivolt
-            const NekDouble var_inward_rectifier_potassium_current__beta_K1 = ((3.0 * exp(0.0002 * ((var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K) + 100.0))) + exp(0.1 * ((var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K) - 10.0))) / (1.0 + exp((-0.5) * (var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K))); // dimensionless
-            const NekDouble var_inward_rectifier_potassium_current__alpha_K1 = 0.1 / (1.0 + exp(0.06 * ((var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K) - 200.0))); // dimensionless
-            const NekDouble var_inward_rectifier_potassium_current__xK1_inf = var_inward_rectifier_potassium_current__alpha_K1 / (var_inward_rectifier_potassium_current__alpha_K1 + var_inward_rectifier_potassium_current__beta_K1); // dimensionless
-            const NekDouble var_inward_rectifier_potassium_current__K_o = var_potassium_dynamics__K_o; // millimolar
-            const NekDouble var_inward_rectifier_potassium_current__g_K1 = 5.405; // nanoS_per_picoF
-            const NekDouble var_inward_rectifier_potassium_current__i_K1 = var_inward_rectifier_potassium_current__g_K1 * var_inward_rectifier_potassium_current__xK1_inf * sqrt(var_inward_rectifier_potassium_current__K_o / 5.4) * (var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K); // picoA_per_picoF
-            const NekDouble var_transient_outward_current__s = var_chaste_interface__transient_outward_current_s_gate__s; // dimensionless
-            const NekDouble var_transient_outward_current__r = var_chaste_interface__transient_outward_current_r_gate__r; // dimensionless
-            const NekDouble var_transient_outward_current__g_to = 0.073; // nanoS_per_picoF
-            const NekDouble var_transient_outward_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_transient_outward_current__E_K = var_reversal_potentials__E_K; // millivolt
-            const NekDouble var_transient_outward_current__i_to = var_transient_outward_current__g_to * var_transient_outward_current__r * var_transient_outward_current__s * (var_transient_outward_current__V - var_transient_outward_current__E_K); // picoA_per_picoF
-            const NekDouble var_rapid_time_dependent_potassium_current__Xr1 = var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1; // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current__Xr2 = var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2; // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_rapid_time_dependent_potassium_current__K_o = var_potassium_dynamics__K_o; // millimolar
-            const NekDouble var_rapid_time_dependent_potassium_current__E_K = var_reversal_potentials__E_K; // millivolt
-            const NekDouble var_rapid_time_dependent_potassium_current__g_Kr = 0.153; // nanoS_per_picoF
-            const NekDouble var_rapid_time_dependent_potassium_current__i_Kr = var_rapid_time_dependent_potassium_current__g_Kr * sqrt(var_rapid_time_dependent_potassium_current__K_o / 5.4) * var_rapid_time_dependent_potassium_current__Xr1 * var_rapid_time_dependent_potassium_current__Xr2 * (var_rapid_time_dependent_potassium_current__V - var_rapid_time_dependent_potassium_current__E_K); // picoA_per_picoF
-            const NekDouble var_slow_time_dependent_potassium_current__g_Ks = 0.392; // nanoS_per_picoF
-            const NekDouble var_sodium_dynamics__Na_o = 140.0; // millimolar
-            const NekDouble var_reversal_potentials__Na_o = var_sodium_dynamics__Na_o; // millimolar
-            const NekDouble var_reversal_potentials__Na_i = var_chaste_interface__sodium_dynamics__Na_i; // millimolar
-            const NekDouble var_reversal_potentials__P_kna = 0.03; // dimensionless
-            const NekDouble var_reversal_potentials__E_Ks = ((var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log((var_reversal_potentials__K_o + (var_reversal_potentials__P_kna * var_reversal_potentials__Na_o)) / (var_reversal_potentials__K_i + (var_reversal_potentials__P_kna * var_reversal_potentials__Na_i))); // millivolt
-            const NekDouble var_slow_time_dependent_potassium_current__E_Ks = var_reversal_potentials__E_Ks; // millivolt
-            const NekDouble var_slow_time_dependent_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_slow_time_dependent_potassium_current__Xs = var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs; // dimensionless
-            const NekDouble var_slow_time_dependent_potassium_current__i_Ks = var_slow_time_dependent_potassium_current__g_Ks * pow(var_slow_time_dependent_potassium_current__Xs, 2.0) * (var_slow_time_dependent_potassium_current__V - var_slow_time_dependent_potassium_current__E_Ks); // picoA_per_picoF
-            const NekDouble var_L_type_Ca_current__Ca_ss = var_chaste_interface__calcium_dynamics__Ca_ss; // millimolar
-            const NekDouble var_L_type_Ca_current__g_CaL = 3.98e-05; // litre_per_farad_second
-            const NekDouble var_L_type_Ca_current__f = var_chaste_interface__L_type_Ca_current_f_gate__f; // dimensionless
-            const NekDouble var_L_type_Ca_current__d = var_chaste_interface__L_type_Ca_current_d_gate__d; // dimensionless
-            const NekDouble var_L_type_Ca_current__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_L_type_Ca_current__f2 = var_chaste_interface__L_type_Ca_current_f2_gate__f2; // dimensionless
-            const NekDouble var_L_type_Ca_current__fCass = var_chaste_interface__L_type_Ca_current_fCass_gate__fCass; // dimensionless
-            const NekDouble var_L_type_Ca_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_L_type_Ca_current__T = var_membrane__T; // kelvin
-            const NekDouble var_calcium_dynamics__Ca_o = 2.0; // millimolar
-            const NekDouble var_L_type_Ca_current__Ca_o = var_calcium_dynamics__Ca_o; // millimolar
-            const NekDouble var_L_type_Ca_current__R = var_membrane__R; // joule_per_mole_kelvin
-            const NekDouble var_L_type_Ca_current__i_CaL = (((var_L_type_Ca_current__g_CaL * var_L_type_Ca_current__d * var_L_type_Ca_current__f * var_L_type_Ca_current__f2 * var_L_type_Ca_current__fCass * 4.0 * (var_L_type_Ca_current__V - 15.0) * pow(var_L_type_Ca_current__F, 2.0)) / (var_L_type_Ca_current__R * var_L_type_Ca_current__T)) * ((0.25 * var_L_type_Ca_current__Ca_ss * exp((2.0 * (var_L_type_Ca_current__V - 15.0) * var_L_type_Ca_current__F) / (var_L_type_Ca_current__R * var_L_type_Ca_current__T))) - var_L_type_Ca_current__Ca_o)) / (exp((2.0 * (var_L_type_Ca_current__V - 15.0) * var_L_type_Ca_current__F) / (var_L_type_Ca_current__R * var_L_type_Ca_current__T)) - 1.0); // picoA_per_picoF
-            const NekDouble var_sodium_potassium_pump_current__Na_i = var_chaste_interface__sodium_dynamics__Na_i; // millimolar
-            const NekDouble var_sodium_potassium_pump_current__R = var_membrane__R; // joule_per_mole_kelvin
-            const NekDouble var_sodium_potassium_pump_current__T = var_membrane__T; // kelvin
-            const NekDouble var_sodium_potassium_pump_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_sodium_potassium_pump_current__K_mk = 1.0; // millimolar
-            const NekDouble var_sodium_potassium_pump_current__P_NaK = 2.724; // picoA_per_picoF
-            const NekDouble var_sodium_potassium_pump_current__K_mNa = 40.0; // millimolar
-            const NekDouble var_sodium_potassium_pump_current__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_sodium_potassium_pump_current__K_o = var_potassium_dynamics__K_o; // millimolar
-            const NekDouble var_sodium_potassium_pump_current__i_NaK = ((((var_sodium_potassium_pump_current__P_NaK * var_sodium_potassium_pump_current__K_o) / (var_sodium_potassium_pump_current__K_o + var_sodium_potassium_pump_current__K_mk)) * var_sodium_potassium_pump_current__Na_i) / (var_sodium_potassium_pump_current__Na_i + var_sodium_potassium_pump_current__K_mNa)) / (1.0 + (0.1245 * exp(((-0.1) * var_sodium_potassium_pump_current__V * var_sodium_potassium_pump_current__F) / (var_sodium_potassium_pump_current__R * var_sodium_potassium_pump_current__T))) + (0.0353 * exp(((-var_sodium_potassium_pump_current__V) * var_sodium_potassium_pump_current__F) / (var_sodium_potassium_pump_current__R * var_sodium_potassium_pump_current__T)))); // picoA_per_picoF
-            const NekDouble var_fast_sodium_current__j = var_chaste_interface__fast_sodium_current_j_gate__j; // dimensionless
-            const NekDouble var_fast_sodium_current__h = var_chaste_interface__fast_sodium_current_h_gate__h; // dimensionless
-            const NekDouble var_fast_sodium_current__g_Na = 14.838; // nanoS_per_picoF
-            const NekDouble var_fast_sodium_current__m = var_chaste_interface__fast_sodium_current_m_gate__m; // dimensionless
-            const NekDouble var_fast_sodium_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_reversal_potentials__E_Na = ((var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log(var_reversal_potentials__Na_o / var_reversal_potentials__Na_i); // millivolt
-            const NekDouble var_fast_sodium_current__E_Na = var_reversal_potentials__E_Na; // millivolt
-            const NekDouble var_fast_sodium_current__i_Na = var_fast_sodium_current__g_Na * pow(var_fast_sodium_current__m, 3.0) * var_fast_sodium_current__h * var_fast_sodium_current__j * (var_fast_sodium_current__V - var_fast_sodium_current__E_Na); // picoA_per_picoF
-            const NekDouble var_sodium_background_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_sodium_background_current__E_Na = var_reversal_potentials__E_Na; // millivolt
-            const NekDouble var_sodium_background_current__g_bna = 0.00029; // nanoS_per_picoF
-            const NekDouble var_sodium_background_current__i_b_Na = var_sodium_background_current__g_bna * (var_sodium_background_current__V - var_sodium_background_current__E_Na); // picoA_per_picoF
-            const NekDouble var_sodium_calcium_exchanger_current__alpha = 2.5; // dimensionless
-            const NekDouble var_sodium_calcium_exchanger_current__gamma = 0.35; // dimensionless
-            const NekDouble var_sodium_calcium_exchanger_current__K_sat = 0.1; // dimensionless
-            const NekDouble var_sodium_calcium_exchanger_current__Km_Ca = 1.38; // millimolar
-            const NekDouble var_sodium_calcium_exchanger_current__K_NaCa = 1000.0; // picoA_per_picoF
-            const NekDouble var_sodium_calcium_exchanger_current__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_sodium_calcium_exchanger_current__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
-            const NekDouble var_sodium_calcium_exchanger_current__Ca_o = var_calcium_dynamics__Ca_o; // millimolar
-            const NekDouble var_sodium_calcium_exchanger_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_sodium_calcium_exchanger_current__R = var_membrane__R; // joule_per_mole_kelvin
-            const NekDouble var_sodium_calcium_exchanger_current__Km_Nai = 87.5; // millimolar
-            const NekDouble var_sodium_calcium_exchanger_current__Na_o = var_sodium_dynamics__Na_o; // millimolar
-            const NekDouble var_sodium_calcium_exchanger_current__Na_i = var_chaste_interface__sodium_dynamics__Na_i; // millimolar
-            const NekDouble var_sodium_calcium_exchanger_current__T = var_membrane__T; // kelvin
-            const NekDouble var_sodium_calcium_exchanger_current__i_NaCa = (var_sodium_calcium_exchanger_current__K_NaCa * ((exp((var_sodium_calcium_exchanger_current__gamma * var_sodium_calcium_exchanger_current__V * var_sodium_calcium_exchanger_current__F) / (var_sodium_calcium_exchanger_current__R * var_sodium_calcium_exchanger_current__T)) * pow(var_sodium_calcium_exchanger_current__Na_i, 3.0) * var_sodium_calcium_exchanger_current__Ca_o) - (exp(((var_sodium_calcium_exchanger_current__gamma - 1.0) * var_sodium_calcium_exchanger_current__V * var_sodium_calcium_exchanger_current__F) / (var_sodium_calcium_exchanger_current__R * var_sodium_calcium_exchanger_current__T)) * pow(var_sodium_calcium_exchanger_current__Na_o, 3.0) * var_sodium_calcium_exchanger_current__Ca_i * var_sodium_calcium_exchanger_current__alpha))) / ((pow(var_sodium_calcium_exchanger_current__Km_Nai, 3.0) + pow(var_sodium_calcium_exchanger_current__Na_o, 3.0)) * (var_sodium_calcium_exchanger_current__Km_Ca + var_sodium_calcium_exchanger_current__Ca_o) * (1.0 + (var_sodium_calcium_exchanger_current__K_sat * exp(((var_sodium_calcium_exchanger_current__gamma - 1.0) * var_sodium_calcium_exchanger_current__V * var_sodium_calcium_exchanger_current__F) / (var_sodium_calcium_exchanger_current__R * var_sodium_calcium_exchanger_current__T))))); // picoA_per_picoF
-            const NekDouble var_reversal_potentials__Ca_o = var_calcium_dynamics__Ca_o; // millimolar
-            const NekDouble var_reversal_potentials__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
-            const NekDouble var_reversal_potentials__E_Ca = ((0.5 * var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log(var_reversal_potentials__Ca_o / var_reversal_potentials__Ca_i); // millivolt
-            const NekDouble var_calcium_background_current__E_Ca = var_reversal_potentials__E_Ca; // millivolt
-            const NekDouble var_calcium_background_current__g_bca = 0.000592; // nanoS_per_picoF
-            const NekDouble var_calcium_background_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_calcium_background_current__i_b_Ca = var_calcium_background_current__g_bca * (var_calcium_background_current__V - var_calcium_background_current__E_Ca); // picoA_per_picoF
-            const NekDouble var_potassium_pump_current__g_pK = 0.0146; // nanoS_per_picoF
-            const NekDouble var_potassium_pump_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_potassium_pump_current__E_K = var_reversal_potentials__E_K; // millivolt
-            const NekDouble var_potassium_pump_current__i_p_K = (var_potassium_pump_current__g_pK * (var_potassium_pump_current__V - var_potassium_pump_current__E_K)) / (1.0 + exp((25.0 - var_potassium_pump_current__V) / 5.98)); // picoA_per_picoF
-            const NekDouble var_calcium_pump_current__K_pCa = 0.0005; // millimolar
-            const NekDouble var_calcium_pump_current__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
-            const NekDouble var_calcium_pump_current__g_pCa = 0.1238; // picoA_per_picoF
-            const NekDouble var_calcium_pump_current__i_p_Ca = (var_calcium_pump_current__g_pCa * var_calcium_pump_current__Ca_i) / (var_calcium_pump_current__Ca_i + var_calcium_pump_current__K_pCa); // picoA_per_picoF
-            const NekDouble var_chaste_interface__membrane__i_Stim = 0.0;
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__V = var_rapid_time_dependent_potassium_current__V; // millivolt
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__alpha_xr1 = 450.0 / (1.0 + exp(((-45.0) - var_rapid_time_dependent_potassium_current_Xr1_gate__V) / 10.0)); // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__beta_xr1 = 6.0 / (1.0 + exp((var_rapid_time_dependent_potassium_current_Xr1_gate__V + 30.0) / 11.5)); // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1 = 1.0 * var_rapid_time_dependent_potassium_current_Xr1_gate__alpha_xr1 * var_rapid_time_dependent_potassium_current_Xr1_gate__beta_xr1; // millisecond
+        NekDouble d_dt_chaste_interface__membrane__V;
+        const NekDouble var_membrane__R = 8314.472; // joule_per_mole_kelvin
+        const NekDouble var_membrane__T = 310.0; // kelvin
+        const NekDouble var_membrane__F = 96485.3415; // coulomb_per_millimole
+        const NekDouble var_membrane__Cm = 0.185; // microF
+        const NekDouble var_membrane__V_c = 0.016404; // micrometre3
+        const NekDouble var_inward_rectifier_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_reversal_potentials__K_i = var_chaste_interface__potassium_dynamics__K_i; // millimolar
+        const NekDouble var_reversal_potentials__R = var_membrane__R; // joule_per_mole_kelvin
+        const NekDouble var_reversal_potentials__T = var_membrane__T; // kelvin
+        const NekDouble var_reversal_potentials__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_potassium_dynamics__K_o = 5.4; // millimolar
+        const NekDouble var_reversal_potentials__K_o = var_potassium_dynamics__K_o; // millimolar
+        const NekDouble var_reversal_potentials__E_K = ((var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log(var_reversal_potentials__K_o / var_reversal_potentials__K_i); // millivolt
+        const NekDouble var_inward_rectifier_potassium_current__E_K = var_reversal_potentials__E_K; // millivolt
+        const NekDouble var_inward_rectifier_potassium_current__beta_K1 = ((3.0 * exp(0.0002 * ((var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K) + 100.0))) + exp(0.1 * ((var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K) - 10.0))) / (1.0 + exp((-0.5) * (var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K))); // dimensionless
+        const NekDouble var_inward_rectifier_potassium_current__alpha_K1 = 0.1 / (1.0 + exp(0.06 * ((var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K) - 200.0))); // dimensionless
+        const NekDouble var_inward_rectifier_potassium_current__xK1_inf = var_inward_rectifier_potassium_current__alpha_K1 / (var_inward_rectifier_potassium_current__alpha_K1 + var_inward_rectifier_potassium_current__beta_K1); // dimensionless
+        const NekDouble var_inward_rectifier_potassium_current__K_o = var_potassium_dynamics__K_o; // millimolar
+        const NekDouble var_inward_rectifier_potassium_current__g_K1 = 5.405; // nanoS_per_picoF
+        const NekDouble var_inward_rectifier_potassium_current__i_K1 = var_inward_rectifier_potassium_current__g_K1 * var_inward_rectifier_potassium_current__xK1_inf * sqrt(var_inward_rectifier_potassium_current__K_o / 5.4) * (var_inward_rectifier_potassium_current__V - var_inward_rectifier_potassium_current__E_K); // picoA_per_picoF
+        const NekDouble var_transient_outward_current__s = var_chaste_interface__transient_outward_current_s_gate__s; // dimensionless
+        const NekDouble var_transient_outward_current__r = var_chaste_interface__transient_outward_current_r_gate__r; // dimensionless
+        const NekDouble var_transient_outward_current__g_to = 0.073; // nanoS_per_picoF
+        const NekDouble var_transient_outward_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_transient_outward_current__E_K = var_reversal_potentials__E_K; // millivolt
+        const NekDouble var_transient_outward_current__i_to = var_transient_outward_current__g_to * var_transient_outward_current__r * var_transient_outward_current__s * (var_transient_outward_current__V - var_transient_outward_current__E_K); // picoA_per_picoF
+        const NekDouble var_rapid_time_dependent_potassium_current__Xr1 = var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1; // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current__Xr2 = var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2; // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_rapid_time_dependent_potassium_current__K_o = var_potassium_dynamics__K_o; // millimolar
+        const NekDouble var_rapid_time_dependent_potassium_current__E_K = var_reversal_potentials__E_K; // millivolt
+        const NekDouble var_rapid_time_dependent_potassium_current__g_Kr = 0.153; // nanoS_per_picoF
+        const NekDouble var_rapid_time_dependent_potassium_current__i_Kr = var_rapid_time_dependent_potassium_current__g_Kr * sqrt(var_rapid_time_dependent_potassium_current__K_o / 5.4) * var_rapid_time_dependent_potassium_current__Xr1 * var_rapid_time_dependent_potassium_current__Xr2 * (var_rapid_time_dependent_potassium_current__V - var_rapid_time_dependent_potassium_current__E_K); // picoA_per_picoF
+        const NekDouble var_slow_time_dependent_potassium_current__g_Ks = 0.392; // nanoS_per_picoF
+        const NekDouble var_sodium_dynamics__Na_o = 140.0; // millimolar
+        const NekDouble var_reversal_potentials__Na_o = var_sodium_dynamics__Na_o; // millimolar
+        const NekDouble var_reversal_potentials__Na_i = var_chaste_interface__sodium_dynamics__Na_i; // millimolar
+        const NekDouble var_reversal_potentials__P_kna = 0.03; // dimensionless
+        const NekDouble var_reversal_potentials__E_Ks = ((var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log((var_reversal_potentials__K_o + (var_reversal_potentials__P_kna * var_reversal_potentials__Na_o)) / (var_reversal_potentials__K_i + (var_reversal_potentials__P_kna * var_reversal_potentials__Na_i))); // millivolt
+        const NekDouble var_slow_time_dependent_potassium_current__E_Ks = var_reversal_potentials__E_Ks; // millivolt
+        const NekDouble var_slow_time_dependent_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_slow_time_dependent_potassium_current__Xs = var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs; // dimensionless
+        const NekDouble var_slow_time_dependent_potassium_current__i_Ks = var_slow_time_dependent_potassium_current__g_Ks * pow(var_slow_time_dependent_potassium_current__Xs, 2.0) * (var_slow_time_dependent_potassium_current__V - var_slow_time_dependent_potassium_current__E_Ks); // picoA_per_picoF
+        const NekDouble var_L_type_Ca_current__Ca_ss = var_chaste_interface__calcium_dynamics__Ca_ss; // millimolar
+        const NekDouble var_L_type_Ca_current__g_CaL = 3.98e-05; // litre_per_farad_second
+        const NekDouble var_L_type_Ca_current__f = var_chaste_interface__L_type_Ca_current_f_gate__f; // dimensionless
+        const NekDouble var_L_type_Ca_current__d = var_chaste_interface__L_type_Ca_current_d_gate__d; // dimensionless
+        const NekDouble var_L_type_Ca_current__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_L_type_Ca_current__f2 = var_chaste_interface__L_type_Ca_current_f2_gate__f2; // dimensionless
+        const NekDouble var_L_type_Ca_current__fCass = var_chaste_interface__L_type_Ca_current_fCass_gate__fCass; // dimensionless
+        const NekDouble var_L_type_Ca_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_L_type_Ca_current__T = var_membrane__T; // kelvin
+        const NekDouble var_calcium_dynamics__Ca_o = 2.0; // millimolar
+        const NekDouble var_L_type_Ca_current__Ca_o = var_calcium_dynamics__Ca_o; // millimolar
+        const NekDouble var_L_type_Ca_current__R = var_membrane__R; // joule_per_mole_kelvin
+        const NekDouble var_L_type_Ca_current__i_CaL = (((var_L_type_Ca_current__g_CaL * var_L_type_Ca_current__d * var_L_type_Ca_current__f * var_L_type_Ca_current__f2 * var_L_type_Ca_current__fCass * 4.0 * (var_L_type_Ca_current__V - 15.0) * pow(var_L_type_Ca_current__F, 2.0)) / (var_L_type_Ca_current__R * var_L_type_Ca_current__T)) * ((0.25 * var_L_type_Ca_current__Ca_ss * exp((2.0 * (var_L_type_Ca_current__V - 15.0) * var_L_type_Ca_current__F) / (var_L_type_Ca_current__R * var_L_type_Ca_current__T))) - var_L_type_Ca_current__Ca_o)) / (exp((2.0 * (var_L_type_Ca_current__V - 15.0) * var_L_type_Ca_current__F) / (var_L_type_Ca_current__R * var_L_type_Ca_current__T)) - 1.0); // picoA_per_picoF
+        const NekDouble var_sodium_potassium_pump_current__Na_i = var_chaste_interface__sodium_dynamics__Na_i; // millimolar
+        const NekDouble var_sodium_potassium_pump_current__R = var_membrane__R; // joule_per_mole_kelvin
+        const NekDouble var_sodium_potassium_pump_current__T = var_membrane__T; // kelvin
+        const NekDouble var_sodium_potassium_pump_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_sodium_potassium_pump_current__K_mk = 1.0; // millimolar
+        const NekDouble var_sodium_potassium_pump_current__P_NaK = 2.724; // picoA_per_picoF
+        const NekDouble var_sodium_potassium_pump_current__K_mNa = 40.0; // millimolar
+        const NekDouble var_sodium_potassium_pump_current__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_sodium_potassium_pump_current__K_o = var_potassium_dynamics__K_o; // millimolar
+        const NekDouble var_sodium_potassium_pump_current__i_NaK = ((((var_sodium_potassium_pump_current__P_NaK * var_sodium_potassium_pump_current__K_o) / (var_sodium_potassium_pump_current__K_o + var_sodium_potassium_pump_current__K_mk)) * var_sodium_potassium_pump_current__Na_i) / (var_sodium_potassium_pump_current__Na_i + var_sodium_potassium_pump_current__K_mNa)) / (1.0 + (0.1245 * exp(((-0.1) * var_sodium_potassium_pump_current__V * var_sodium_potassium_pump_current__F) / (var_sodium_potassium_pump_current__R * var_sodium_potassium_pump_current__T))) + (0.0353 * exp(((-var_sodium_potassium_pump_current__V) * var_sodium_potassium_pump_current__F) / (var_sodium_potassium_pump_current__R * var_sodium_potassium_pump_current__T)))); // picoA_per_picoF
+        const NekDouble var_fast_sodium_current__j = var_chaste_interface__fast_sodium_current_j_gate__j; // dimensionless
+        const NekDouble var_fast_sodium_current__h = var_chaste_interface__fast_sodium_current_h_gate__h; // dimensionless
+        const NekDouble var_fast_sodium_current__g_Na = 14.838; // nanoS_per_picoF
+        const NekDouble var_fast_sodium_current__m = var_chaste_interface__fast_sodium_current_m_gate__m; // dimensionless
+        const NekDouble var_fast_sodium_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_reversal_potentials__E_Na = ((var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log(var_reversal_potentials__Na_o / var_reversal_potentials__Na_i); // millivolt
+        const NekDouble var_fast_sodium_current__E_Na = var_reversal_potentials__E_Na; // millivolt
+        const NekDouble var_fast_sodium_current__i_Na = var_fast_sodium_current__g_Na * pow(var_fast_sodium_current__m, 3.0) * var_fast_sodium_current__h * var_fast_sodium_current__j * (var_fast_sodium_current__V - var_fast_sodium_current__E_Na); // picoA_per_picoF
+        const NekDouble var_sodium_background_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_sodium_background_current__E_Na = var_reversal_potentials__E_Na; // millivolt
+        const NekDouble var_sodium_background_current__g_bna = 0.00029; // nanoS_per_picoF
+        const NekDouble var_sodium_background_current__i_b_Na = var_sodium_background_current__g_bna * (var_sodium_background_current__V - var_sodium_background_current__E_Na); // picoA_per_picoF
+        const NekDouble var_sodium_calcium_exchanger_current__alpha = 2.5; // dimensionless
+        const NekDouble var_sodium_calcium_exchanger_current__gamma = 0.35; // dimensionless
+        const NekDouble var_sodium_calcium_exchanger_current__K_sat = 0.1; // dimensionless
+        const NekDouble var_sodium_calcium_exchanger_current__Km_Ca = 1.38; // millimolar
+        const NekDouble var_sodium_calcium_exchanger_current__K_NaCa = 1000.0; // picoA_per_picoF
+        const NekDouble var_sodium_calcium_exchanger_current__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_sodium_calcium_exchanger_current__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
+        const NekDouble var_sodium_calcium_exchanger_current__Ca_o = var_calcium_dynamics__Ca_o; // millimolar
+        const NekDouble var_sodium_calcium_exchanger_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_sodium_calcium_exchanger_current__R = var_membrane__R; // joule_per_mole_kelvin
+        const NekDouble var_sodium_calcium_exchanger_current__Km_Nai = 87.5; // millimolar
+        const NekDouble var_sodium_calcium_exchanger_current__Na_o = var_sodium_dynamics__Na_o; // millimolar
+        const NekDouble var_sodium_calcium_exchanger_current__Na_i = var_chaste_interface__sodium_dynamics__Na_i; // millimolar
+        const NekDouble var_sodium_calcium_exchanger_current__T = var_membrane__T; // kelvin
+        const NekDouble var_sodium_calcium_exchanger_current__i_NaCa = (var_sodium_calcium_exchanger_current__K_NaCa * ((exp((var_sodium_calcium_exchanger_current__gamma * var_sodium_calcium_exchanger_current__V * var_sodium_calcium_exchanger_current__F) / (var_sodium_calcium_exchanger_current__R * var_sodium_calcium_exchanger_current__T)) * pow(var_sodium_calcium_exchanger_current__Na_i, 3.0) * var_sodium_calcium_exchanger_current__Ca_o) - (exp(((var_sodium_calcium_exchanger_current__gamma - 1.0) * var_sodium_calcium_exchanger_current__V * var_sodium_calcium_exchanger_current__F) / (var_sodium_calcium_exchanger_current__R * var_sodium_calcium_exchanger_current__T)) * pow(var_sodium_calcium_exchanger_current__Na_o, 3.0) * var_sodium_calcium_exchanger_current__Ca_i * var_sodium_calcium_exchanger_current__alpha))) / ((pow(var_sodium_calcium_exchanger_current__Km_Nai, 3.0) + pow(var_sodium_calcium_exchanger_current__Na_o, 3.0)) * (var_sodium_calcium_exchanger_current__Km_Ca + var_sodium_calcium_exchanger_current__Ca_o) * (1.0 + (var_sodium_calcium_exchanger_current__K_sat * exp(((var_sodium_calcium_exchanger_current__gamma - 1.0) * var_sodium_calcium_exchanger_current__V * var_sodium_calcium_exchanger_current__F) / (var_sodium_calcium_exchanger_current__R * var_sodium_calcium_exchanger_current__T))))); // picoA_per_picoF
+        const NekDouble var_reversal_potentials__Ca_o = var_calcium_dynamics__Ca_o; // millimolar
+        const NekDouble var_reversal_potentials__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
+        const NekDouble var_reversal_potentials__E_Ca = ((0.5 * var_reversal_potentials__R * var_reversal_potentials__T) / var_reversal_potentials__F) * log(var_reversal_potentials__Ca_o / var_reversal_potentials__Ca_i); // millivolt
+        const NekDouble var_calcium_background_current__E_Ca = var_reversal_potentials__E_Ca; // millivolt
+        const NekDouble var_calcium_background_current__g_bca = 0.000592; // nanoS_per_picoF
+        const NekDouble var_calcium_background_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_calcium_background_current__i_b_Ca = var_calcium_background_current__g_bca * (var_calcium_background_current__V - var_calcium_background_current__E_Ca); // picoA_per_picoF
+        const NekDouble var_potassium_pump_current__g_pK = 0.0146; // nanoS_per_picoF
+        const NekDouble var_potassium_pump_current__V = var_chaste_interface__membrane__V; // millivolt
+        const NekDouble var_potassium_pump_current__E_K = var_reversal_potentials__E_K; // millivolt
+        const NekDouble var_potassium_pump_current__i_p_K = (var_potassium_pump_current__g_pK * (var_potassium_pump_current__V - var_potassium_pump_current__E_K)) / (1.0 + exp((25.0 - var_potassium_pump_current__V) / 5.98)); // picoA_per_picoF
+        const NekDouble var_calcium_pump_current__K_pCa = 0.0005; // millimolar
+        const NekDouble var_calcium_pump_current__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
+        const NekDouble var_calcium_pump_current__g_pCa = 0.1238; // picoA_per_picoF
+        const NekDouble var_calcium_pump_current__i_p_Ca = (var_calcium_pump_current__g_pCa * var_calcium_pump_current__Ca_i) / (var_calcium_pump_current__Ca_i + var_calcium_pump_current__K_pCa); // picoA_per_picoF
+        const NekDouble var_chaste_interface__membrane__i_Stim = 0.0;
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1 = vt[0]; // millisecond
 //            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__Xr1 = var_rapid_time_dependent_potassium_current__Xr1; // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf = 1.0 / (1.0 + exp(((-26.0) - var_rapid_time_dependent_potassium_current_Xr1_gate__V) / 7.0)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf = vt[1]; // dimensionless
 //            const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__d_Xr1_d_environment__time = (var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf - var_rapid_time_dependent_potassium_current_Xr1_gate__Xr1) / var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1; // per_millisecond
 //            const NekDouble var_rapid_time_dependent_potassium_current__rapid_time_dependent_potassium_current_Xr1_gate__d_Xr1_d_environment__time = var_rapid_time_dependent_potassium_current_Xr1_gate__d_Xr1_d_environment__time; // per_millisecond
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__V = var_rapid_time_dependent_potassium_current__V; // millivolt
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__alpha_xr2 = 3.0 / (1.0 + exp(((-60.0) - var_rapid_time_dependent_potassium_current_Xr2_gate__V) / 20.0)); // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__beta_xr2 = 1.12 / (1.0 + exp((var_rapid_time_dependent_potassium_current_Xr2_gate__V - 60.0) / 20.0)); // dimensionless
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2 = 1.0 * var_rapid_time_dependent_potassium_current_Xr2_gate__alpha_xr2 * var_rapid_time_dependent_potassium_current_Xr2_gate__beta_xr2; // millisecond
-            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf = 1.0 / (1.0 + exp((var_rapid_time_dependent_potassium_current_Xr2_gate__V + 88.0) / 24.0)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2 = vt[2]; // millisecond
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf = vt[3]; // dimensionless
 //            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__Xr2 = var_rapid_time_dependent_potassium_current__Xr2; // dimensionless
 //            const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__d_Xr2_d_environment__time = (var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf - var_rapid_time_dependent_potassium_current_Xr2_gate__Xr2) / var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2; // per_millisecond
 //            const NekDouble var_rapid_time_dependent_potassium_current__rapid_time_dependent_potassium_current_Xr2_gate__d_Xr2_d_environment__time = var_rapid_time_dependent_potassium_current_Xr2_gate__d_Xr2_d_environment__time; // per_millisecond
-            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__V = var_slow_time_dependent_potassium_current__V; // millivolt
-            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__beta_xs = 1.0 / (1.0 + exp((var_slow_time_dependent_potassium_current_Xs_gate__V - 35.0) / 15.0)); // dimensionless
-            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__alpha_xs = 1400.0 / sqrt(1.0 + exp((5.0 - var_slow_time_dependent_potassium_current_Xs_gate__V) / 6.0)); // dimensionless
-            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__tau_xs = (1.0 * var_slow_time_dependent_potassium_current_Xs_gate__alpha_xs * var_slow_time_dependent_potassium_current_Xs_gate__beta_xs) + 80.0; // millisecond
-            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__xs_inf = 1.0 / (1.0 + exp(((-5.0) - var_slow_time_dependent_potassium_current_Xs_gate__V) / 14.0)); // dimensionless
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__tau_xs = vt[4]; // millisecond
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__xs_inf = vt[5]; // dimensionless
 //            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__Xs = var_slow_time_dependent_potassium_current__Xs; // dimensionless
 //            const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__d_Xs_d_environment__time = (var_slow_time_dependent_potassium_current_Xs_gate__xs_inf - var_slow_time_dependent_potassium_current_Xs_gate__Xs) / var_slow_time_dependent_potassium_current_Xs_gate__tau_xs; // per_millisecond
 //            const NekDouble var_slow_time_dependent_potassium_current__slow_time_dependent_potassium_current_Xs_gate__d_Xs_d_environment__time = var_slow_time_dependent_potassium_current_Xs_gate__d_Xs_d_environment__time; // per_millisecond
-            const NekDouble var_fast_sodium_current_m_gate__V = var_fast_sodium_current__V; // millivolt
-            const NekDouble var_fast_sodium_current_m_gate__alpha_m = 1.0 / (1.0 + exp(((-60.0) - var_fast_sodium_current_m_gate__V) / 5.0)); // dimensionless
-            const NekDouble var_fast_sodium_current_m_gate__beta_m = (0.1 / (1.0 + exp((var_fast_sodium_current_m_gate__V + 35.0) / 5.0))) + (0.1 / (1.0 + exp((var_fast_sodium_current_m_gate__V - 50.0) / 200.0))); // dimensionless
-            const NekDouble var_fast_sodium_current_m_gate__tau_m = 1.0 * var_fast_sodium_current_m_gate__alpha_m * var_fast_sodium_current_m_gate__beta_m; // millisecond
-            const NekDouble var_fast_sodium_current_m_gate__m_inf = 1.0 / pow(1.0 + exp(((-56.86) - var_fast_sodium_current_m_gate__V) / 9.03), 2.0); // dimensionless
+        const NekDouble var_fast_sodium_current_m_gate__tau_m = vt[6]; // millisecond
+        const NekDouble var_fast_sodium_current_m_gate__m_inf = vt[7]; // dimensionless
 //            const NekDouble var_fast_sodium_current_m_gate__m = var_fast_sodium_current__m; // dimensionless
 //            const NekDouble var_fast_sodium_current_m_gate__d_m_d_environment__time = (var_fast_sodium_current_m_gate__m_inf - var_fast_sodium_current_m_gate__m) / var_fast_sodium_current_m_gate__tau_m; // per_millisecond
 //            const NekDouble var_fast_sodium_current__fast_sodium_current_m_gate__d_m_d_environment__time = var_fast_sodium_current_m_gate__d_m_d_environment__time; // per_millisecond
-            const NekDouble var_fast_sodium_current_h_gate__V = var_fast_sodium_current__V; // millivolt
-            const NekDouble var_fast_sodium_current_h_gate__h_inf = 1.0 / pow(1.0 + exp((var_fast_sodium_current_h_gate__V + 71.55) / 7.43), 2.0); // dimensionless
-            const NekDouble var_fast_sodium_current_h_gate__beta_h = (var_fast_sodium_current_h_gate__V < (-40.0)) ? ((2.7 * exp(0.079 * var_fast_sodium_current_h_gate__V)) + (310000.0 * exp(0.3485 * var_fast_sodium_current_h_gate__V))) : (0.77 / (0.13 * (1.0 + exp((var_fast_sodium_current_h_gate__V + 10.66) / (-11.1))))); // per_millisecond
-            const NekDouble var_fast_sodium_current_h_gate__alpha_h = (var_fast_sodium_current_h_gate__V < (-40.0)) ? (0.057 * exp((-(var_fast_sodium_current_h_gate__V + 80.0)) / 6.8)) : 0.0; // per_millisecond
-            const NekDouble var_fast_sodium_current_h_gate__tau_h = 1.0 / (var_fast_sodium_current_h_gate__alpha_h + var_fast_sodium_current_h_gate__beta_h); // millisecond
+        const NekDouble var_fast_sodium_current_h_gate__h_inf = vt[8]; // dimensionless
+        const NekDouble var_fast_sodium_current_h_gate__tau_h = vt[9]; // millisecond
 //            const NekDouble var_fast_sodium_current_h_gate__h = var_fast_sodium_current__h; // dimensionless
 //            const NekDouble var_fast_sodium_current_h_gate__d_h_d_environment__time = (var_fast_sodium_current_h_gate__h_inf - var_fast_sodium_current_h_gate__h) / var_fast_sodium_current_h_gate__tau_h; // per_millisecond
 //            const NekDouble var_fast_sodium_current__fast_sodium_current_h_gate__d_h_d_environment__time = var_fast_sodium_current_h_gate__d_h_d_environment__time; // per_millisecond
-            const NekDouble var_fast_sodium_current_j_gate__V = var_fast_sodium_current__V; // millivolt
-            const NekDouble var_fast_sodium_current_j_gate__j_inf = 1.0 / pow(1.0 + exp((var_fast_sodium_current_j_gate__V + 71.55) / 7.43), 2.0); // dimensionless
-            const NekDouble var_fast_sodium_current_j_gate__alpha_j = (var_fast_sodium_current_j_gate__V < (-40.0)) ? ((((((-25428.0) * exp(0.2444 * var_fast_sodium_current_j_gate__V)) - (6.948e-06 * exp((-0.04391) * var_fast_sodium_current_j_gate__V))) * (var_fast_sodium_current_j_gate__V + 37.78)) / 1.0) / (1.0 + exp(0.311 * (var_fast_sodium_current_j_gate__V + 79.23)))) : 0.0; // per_millisecond
-            const NekDouble var_fast_sodium_current_j_gate__beta_j = (var_fast_sodium_current_j_gate__V < (-40.0)) ? ((0.02424 * exp((-0.01052) * var_fast_sodium_current_j_gate__V)) / (1.0 + exp((-0.1378) * (var_fast_sodium_current_j_gate__V + 40.14)))) : ((0.6 * exp(0.057 * var_fast_sodium_current_j_gate__V)) / (1.0 + exp((-0.1) * (var_fast_sodium_current_j_gate__V + 32.0)))); // per_millisecond
-            const NekDouble var_fast_sodium_current_j_gate__tau_j = 1.0 / (var_fast_sodium_current_j_gate__alpha_j + var_fast_sodium_current_j_gate__beta_j); // millisecond
+        const NekDouble var_fast_sodium_current_j_gate__j_inf = vt[10]; // dimensionless
+        const NekDouble var_fast_sodium_current_j_gate__tau_j = vt[11]; // millisecond
 //            const NekDouble var_fast_sodium_current_j_gate__j = var_fast_sodium_current__j; // dimensionless
 //            const NekDouble var_fast_sodium_current_j_gate__d_j_d_environment__time = (var_fast_sodium_current_j_gate__j_inf - var_fast_sodium_current_j_gate__j) / var_fast_sodium_current_j_gate__tau_j; // per_millisecond
 //            const NekDouble var_fast_sodium_current__fast_sodium_current_j_gate__d_j_d_environment__time = var_fast_sodium_current_j_gate__d_j_d_environment__time; // per_millisecond
-            const NekDouble var_L_type_Ca_current_d_gate__V = var_L_type_Ca_current__V; // millivolt
-            const NekDouble var_L_type_Ca_current_d_gate__alpha_d = (1.4 / (1.0 + exp(((-35.0) - var_L_type_Ca_current_d_gate__V) / 13.0))) + 0.25; // dimensionless
-            const NekDouble var_L_type_Ca_current_d_gate__gamma_d = 1.0 / (1.0 + exp((50.0 - var_L_type_Ca_current_d_gate__V) / 20.0)); // millisecond
-            const NekDouble var_L_type_Ca_current_d_gate__beta_d = 1.4 / (1.0 + exp((var_L_type_Ca_current_d_gate__V + 5.0) / 5.0)); // dimensionless
-            const NekDouble var_L_type_Ca_current_d_gate__tau_d = (1.0 * var_L_type_Ca_current_d_gate__alpha_d * var_L_type_Ca_current_d_gate__beta_d) + var_L_type_Ca_current_d_gate__gamma_d; // millisecond
-            const NekDouble var_L_type_Ca_current_d_gate__d_inf = 1.0 / (1.0 + exp(((-8.0) - var_L_type_Ca_current_d_gate__V) / 7.5)); // dimensionless
+        const NekDouble var_L_type_Ca_current_d_gate__tau_d = vt[12]; // millisecond
+        const NekDouble var_L_type_Ca_current_d_gate__d_inf = vt[13]; // dimensionless
 //            const NekDouble var_L_type_Ca_current_d_gate__d = var_L_type_Ca_current__d; // dimensionless
 //            const NekDouble var_L_type_Ca_current_d_gate__d_d_d_environment__time = (var_L_type_Ca_current_d_gate__d_inf - var_L_type_Ca_current_d_gate__d) / var_L_type_Ca_current_d_gate__tau_d; // per_millisecond
 //            const NekDouble var_L_type_Ca_current__L_type_Ca_current_d_gate__d_d_d_environment__time = var_L_type_Ca_current_d_gate__d_d_d_environment__time; // per_millisecond
-            const NekDouble var_L_type_Ca_current_f_gate__V = var_L_type_Ca_current__V; // millivolt
-            const NekDouble var_L_type_Ca_current_f_gate__tau_f = (1102.5 * exp((-pow(var_L_type_Ca_current_f_gate__V + 27.0, 2.0)) / 225.0)) + (200.0 / (1.0 + exp((13.0 - var_L_type_Ca_current_f_gate__V) / 10.0))) + (180.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 30.0) / 10.0))) + 20.0; // millisecond
-            const NekDouble var_L_type_Ca_current_f_gate__f_inf = 1.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 20.0) / 7.0)); // dimensionless
+        const NekDouble var_L_type_Ca_current_f_gate__tau_f = vt[14]; // millisecond
+        const NekDouble var_L_type_Ca_current_f_gate__f_inf = vt[15]; // dimensionless
 //            const NekDouble var_L_type_Ca_current_f_gate__f = var_L_type_Ca_current__f; // dimensionless
 //            const NekDouble var_L_type_Ca_current_f_gate__d_f_d_environment__time = (var_L_type_Ca_current_f_gate__f_inf - var_L_type_Ca_current_f_gate__f) / var_L_type_Ca_current_f_gate__tau_f; // per_millisecond
 //            const NekDouble var_L_type_Ca_current__L_type_Ca_current_f_gate__d_f_d_environment__time = var_L_type_Ca_current_f_gate__d_f_d_environment__time; // per_millisecond
 //            const NekDouble var_L_type_Ca_current_f2_gate__f2 = var_L_type_Ca_current__f2; // dimensionless
-            const NekDouble var_L_type_Ca_current_f2_gate__V = var_L_type_Ca_current__V; // millivolt
-            const NekDouble var_L_type_Ca_current_f2_gate__f2_inf = (0.67 / (1.0 + exp((var_L_type_Ca_current_f2_gate__V + 35.0) / 7.0))) + 0.33; // dimensionless
-            const NekDouble var_L_type_Ca_current_f2_gate__tau_f2 = (562.0 * exp((-pow(var_L_type_Ca_current_f2_gate__V + 27.0, 2.0)) / 240.0)) + (31.0 / (1.0 + exp((25.0 - var_L_type_Ca_current_f2_gate__V) / 10.0))) + (80.0 / (1.0 + exp((var_L_type_Ca_current_f2_gate__V + 30.0) / 10.0))); // millisecond
+        const NekDouble var_L_type_Ca_current_f2_gate__f2_inf = vt[16]; // dimensionless
+        const NekDouble var_L_type_Ca_current_f2_gate__tau_f2 = vt[17]; // millisecond
 //            const NekDouble var_L_type_Ca_current_f2_gate__d_f2_d_environment__time = (var_L_type_Ca_current_f2_gate__f2_inf - var_L_type_Ca_current_f2_gate__f2) / var_L_type_Ca_current_f2_gate__tau_f2; // per_millisecond
 //            const NekDouble var_L_type_Ca_current__L_type_Ca_current_f2_gate__d_f2_d_environment__time = var_L_type_Ca_current_f2_gate__d_f2_d_environment__time; // per_millisecond
-            const NekDouble var_L_type_Ca_current_fCass_gate__Ca_ss = var_L_type_Ca_current__Ca_ss; // millimolar
-            const NekDouble var_L_type_Ca_current_fCass_gate__tau_fCass = (80.0 / (1.0 + pow(var_L_type_Ca_current_fCass_gate__Ca_ss / 0.05, 2.0))) + 2.0; // millisecond
-            const NekDouble var_L_type_Ca_current_fCass_gate__fCass_inf = (0.6 / (1.0 + pow(var_L_type_Ca_current_fCass_gate__Ca_ss / 0.05, 2.0))) + 0.4; // dimensionless
+        const NekDouble var_L_type_Ca_current_fCass_gate__Ca_ss = var_L_type_Ca_current__Ca_ss; // millimolar
+        const NekDouble var_L_type_Ca_current_fCass_gate__tau_fCass = (80.0 / (1.0 + pow(var_L_type_Ca_current_fCass_gate__Ca_ss / 0.05, 2.0))) + 2.0; // millisecond
+        const NekDouble var_L_type_Ca_current_fCass_gate__fCass_inf = (0.6 / (1.0 + pow(var_L_type_Ca_current_fCass_gate__Ca_ss / 0.05, 2.0))) + 0.4; // dimensionless
 //            const NekDouble var_L_type_Ca_current_fCass_gate__fCass = var_L_type_Ca_current__fCass; // dimensionless
 //            const NekDouble var_L_type_Ca_current_fCass_gate__d_fCass_d_environment__time = (var_L_type_Ca_current_fCass_gate__fCass_inf - var_L_type_Ca_current_fCass_gate__fCass) / var_L_type_Ca_current_fCass_gate__tau_fCass; // per_millisecond
 //            const NekDouble var_L_type_Ca_current__L_type_Ca_current_fCass_gate__d_fCass_d_environment__time = var_L_type_Ca_current_fCass_gate__d_fCass_d_environment__time; // per_millisecond
-            const NekDouble var_transient_outward_current_s_gate__V = var_transient_outward_current__V; // millivolt
-            const NekDouble var_transient_outward_current_s_gate__s_inf = 1.0 / (1.0 + exp((var_transient_outward_current_s_gate__V + 28.0) / 5.0)); // dimensionless
-            const NekDouble var_transient_outward_current_s_gate__tau_s = (1000.0 * exp((-pow(var_transient_outward_current_s_gate__V + 67.0, 2.0)) / 1000.0)) + 8.0; // millisecond
+        const NekDouble var_transient_outward_current_s_gate__s_inf = vt[18]; // dimensionless
+        const NekDouble var_transient_outward_current_s_gate__tau_s = vt[19]; // millisecond
 //            const NekDouble var_transient_outward_current_s_gate__s = var_transient_outward_current__s; // dimensionless
 //            const NekDouble var_transient_outward_current_s_gate__d_s_d_environment__time = (var_transient_outward_current_s_gate__s_inf - var_transient_outward_current_s_gate__s) / var_transient_outward_current_s_gate__tau_s; // per_millisecond
 //            const NekDouble var_transient_outward_current__transient_outward_current_s_gate__d_s_d_environment__time = var_transient_outward_current_s_gate__d_s_d_environment__time; // per_millisecond
-            const NekDouble var_transient_outward_current_r_gate__V = var_transient_outward_current__V; // millivolt
-            const NekDouble var_transient_outward_current_r_gate__r_inf = 1.0 / (1.0 + exp((20.0 - var_transient_outward_current_r_gate__V) / 6.0)); // dimensionless
-            const NekDouble var_transient_outward_current_r_gate__tau_r = (9.5 * exp((-pow(var_transient_outward_current_r_gate__V + 40.0, 2.0)) / 1800.0)) + 0.8; // millisecond
-            const NekDouble var_transient_outward_current_r_gate__r = var_transient_outward_current__r; // dimensionless
-            const NekDouble var_transient_outward_current_r_gate__d_r_d_environment__time = (var_transient_outward_current_r_gate__r_inf - var_transient_outward_current_r_gate__r) / var_transient_outward_current_r_gate__tau_r; // per_millisecond
+        const NekDouble var_transient_outward_current_r_gate__r_inf = vt[20]; // dimensionless
+        const NekDouble var_transient_outward_current_r_gate__tau_r = vt[21]; // millisecond
+        const NekDouble var_transient_outward_current_r_gate__r = var_transient_outward_current__r; // dimensionless
+        const NekDouble var_transient_outward_current_r_gate__d_r_d_environment__time = (var_transient_outward_current_r_gate__r_inf - var_transient_outward_current_r_gate__r) / var_transient_outward_current_r_gate__tau_r; // per_millisecond
 //            const NekDouble var_transient_outward_current__transient_outward_current_r_gate__d_r_d_environment__time = var_transient_outward_current_r_gate__d_r_d_environment__time; // per_millisecond
-            const NekDouble var_calcium_dynamics__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
-            const NekDouble var_calcium_dynamics__Ca_SR = var_chaste_interface__calcium_dynamics__Ca_SR; // millimolar
-            const NekDouble var_calcium_dynamics__Ca_ss = var_chaste_interface__calcium_dynamics__Ca_ss; // millimolar
-            const NekDouble var_calcium_dynamics__V_rel = 0.102; // per_millisecond
-            const NekDouble var_calcium_dynamics__R_prime = var_chaste_interface__calcium_dynamics__R_prime; // dimensionless
-            const NekDouble var_calcium_dynamics__k1_prime = 0.15; // per_millimolar2_per_millisecond
-            const NekDouble var_calcium_dynamics__max_sr = 2.5; // dimensionless
-            const NekDouble var_calcium_dynamics__EC = 1.5; // millimolar
-            const NekDouble var_calcium_dynamics__min_sr = 1.0; // dimensionless
-            const NekDouble var_calcium_dynamics__kcasr = var_calcium_dynamics__max_sr - ((var_calcium_dynamics__max_sr - var_calcium_dynamics__min_sr) / (1.0 + pow(var_calcium_dynamics__EC / var_calcium_dynamics__Ca_SR, 2.0))); // dimensionless
-            const NekDouble var_calcium_dynamics__k1 = var_calcium_dynamics__k1_prime / var_calcium_dynamics__kcasr; // per_millimolar2_per_millisecond
-            const NekDouble var_calcium_dynamics__k3 = 0.06; // per_millisecond
-            const NekDouble var_calcium_dynamics__O = (var_calcium_dynamics__k1 * pow(var_calcium_dynamics__Ca_ss, 2.0) * var_calcium_dynamics__R_prime) / (var_calcium_dynamics__k3 + (var_calcium_dynamics__k1 * pow(var_calcium_dynamics__Ca_ss, 2.0))); // dimensionless
-            const NekDouble var_calcium_dynamics__i_rel = var_calcium_dynamics__V_rel * var_calcium_dynamics__O * (var_calcium_dynamics__Ca_SR - var_calcium_dynamics__Ca_ss); // millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__Vmax_up = 0.006375; // millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__K_up = 0.00025; // millimolar
-            const NekDouble var_calcium_dynamics__i_up = var_calcium_dynamics__Vmax_up / (1.0 + (pow(var_calcium_dynamics__K_up, 2.0) / pow(var_calcium_dynamics__Ca_i, 2.0))); // millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__V_leak = 0.00036; // per_millisecond
-            const NekDouble var_calcium_dynamics__i_leak = var_calcium_dynamics__V_leak * (var_calcium_dynamics__Ca_SR - var_calcium_dynamics__Ca_i); // millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__V_xfer = 0.0038; // per_millisecond
-            const NekDouble var_calcium_dynamics__i_xfer = var_calcium_dynamics__V_xfer * (var_calcium_dynamics__Ca_ss - var_calcium_dynamics__Ca_i); // millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__k2_prime = 0.045; // per_millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__k2 = var_calcium_dynamics__k2_prime * var_calcium_dynamics__kcasr; // per_millimolar_per_millisecond
-            const NekDouble var_calcium_dynamics__k4 = 0.005; // per_millisecond
-            const NekDouble var_calcium_dynamics__Buf_c = 0.2; // millimolar
-            const NekDouble var_calcium_dynamics__K_buf_c = 0.001; // millimolar
-            const NekDouble var_calcium_dynamics__Ca_i_bufc = 1.0 / (1.0 + ((var_calcium_dynamics__Buf_c * var_calcium_dynamics__K_buf_c) / pow(var_calcium_dynamics__Ca_i + var_calcium_dynamics__K_buf_c, 2.0))); // dimensionless
-            const NekDouble var_calcium_dynamics__K_buf_sr = 0.3; // millimolar
-            const NekDouble var_calcium_dynamics__Buf_sr = 10.0; // millimolar
-            const NekDouble var_calcium_dynamics__Ca_sr_bufsr = 1.0 / (1.0 + ((var_calcium_dynamics__Buf_sr * var_calcium_dynamics__K_buf_sr) / pow(var_calcium_dynamics__Ca_SR + var_calcium_dynamics__K_buf_sr, 2.0))); // dimensionless
-            const NekDouble var_calcium_dynamics__Buf_ss = 0.4; // millimolar
-            const NekDouble var_calcium_dynamics__K_buf_ss = 0.00025; // millimolar
-            const NekDouble var_calcium_dynamics__Ca_ss_bufss = 1.0 / (1.0 + ((var_calcium_dynamics__Buf_ss * var_calcium_dynamics__K_buf_ss) / pow(var_calcium_dynamics__Ca_ss + var_calcium_dynamics__K_buf_ss, 2.0))); // dimensionless
-            const NekDouble var_calcium_dynamics__V_sr = 0.001094; // micrometre3
-            const NekDouble var_calcium_dynamics__V_ss = 5.468e-05; // micrometre3
-            const NekDouble var_calcium_dynamics__V_c = var_membrane__V_c; // micrometre3
-            const NekDouble var_calcium_dynamics__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_calcium_dynamics__Cm = var_membrane__Cm; // microF
-            const NekDouble var_calcium_dynamics__i_CaL = var_L_type_Ca_current__i_CaL; // picoA_per_picoF
-            const NekDouble var_calcium_dynamics__i_NaCa = var_sodium_calcium_exchanger_current__i_NaCa; // picoA_per_picoF
-            const NekDouble var_calcium_dynamics__i_p_Ca = var_calcium_pump_current__i_p_Ca; // picoA_per_picoF
-            const NekDouble var_calcium_dynamics__i_b_Ca = var_calcium_background_current__i_b_Ca; // picoA_per_picoF
-            const NekDouble var_calcium_dynamics__d_Ca_i_d_environment__time = var_calcium_dynamics__Ca_i_bufc * (((((var_calcium_dynamics__i_leak - var_calcium_dynamics__i_up) * var_calcium_dynamics__V_sr) / var_calcium_dynamics__V_c) + var_calcium_dynamics__i_xfer) - ((1.0 * ((var_calcium_dynamics__i_b_Ca + var_calcium_dynamics__i_p_Ca) - (2.0 * var_calcium_dynamics__i_NaCa)) * var_calcium_dynamics__Cm) / (2.0 * 1.0 * var_calcium_dynamics__V_c * var_calcium_dynamics__F))); // 'millimole per litre per millisecond'
-            const NekDouble var_calcium_dynamics__d_Ca_SR_d_environment__time = var_calcium_dynamics__Ca_sr_bufsr * (var_calcium_dynamics__i_up - (var_calcium_dynamics__i_rel + var_calcium_dynamics__i_leak)); // 'millimole per litre per millisecond'
-            const NekDouble var_calcium_dynamics__d_Ca_ss_d_environment__time = var_calcium_dynamics__Ca_ss_bufss * (((((-1.0) * var_calcium_dynamics__i_CaL * var_calcium_dynamics__Cm) / (2.0 * 1.0 * var_calcium_dynamics__V_ss * var_calcium_dynamics__F)) + ((var_calcium_dynamics__i_rel * var_calcium_dynamics__V_sr) / var_calcium_dynamics__V_ss)) - ((var_calcium_dynamics__i_xfer * var_calcium_dynamics__V_c) / var_calcium_dynamics__V_ss)); // 'millimole per litre per millisecond'
-            const NekDouble var_calcium_dynamics__d_R_prime_d_environment__time = ((-var_calcium_dynamics__k2) * var_calcium_dynamics__Ca_ss * var_calcium_dynamics__R_prime) + (var_calcium_dynamics__k4 * (1.0 - var_calcium_dynamics__R_prime)); // per_millisecond
-            const NekDouble var_sodium_dynamics__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_sodium_dynamics__Cm = var_membrane__Cm; // microF
-            const NekDouble var_sodium_dynamics__V_c = var_membrane__V_c; // micrometre3
-            const NekDouble var_sodium_dynamics__i_Na = var_fast_sodium_current__i_Na; // picoA_per_picoF
-            const NekDouble var_sodium_dynamics__i_NaCa = var_sodium_calcium_exchanger_current__i_NaCa; // picoA_per_picoF
-            const NekDouble var_sodium_dynamics__i_NaK = var_sodium_potassium_pump_current__i_NaK; // picoA_per_picoF
-            const NekDouble var_sodium_dynamics__i_b_Na = var_sodium_background_current__i_b_Na; // picoA_per_picoF
-            const NekDouble var_sodium_dynamics__d_Na_i_d_environment__time = (((-1.0) * (var_sodium_dynamics__i_Na + var_sodium_dynamics__i_b_Na + (3.0 * var_sodium_dynamics__i_NaK) + (3.0 * var_sodium_dynamics__i_NaCa))) / (1.0 * var_sodium_dynamics__V_c * var_sodium_dynamics__F)) * var_sodium_dynamics__Cm; // 'millimole per litre per millisecond'
-            const NekDouble var_potassium_dynamics__F = var_membrane__F; // coulomb_per_millimole
-            const NekDouble var_potassium_dynamics__Cm = var_membrane__Cm; // microF
-            const NekDouble var_potassium_dynamics__V_c = var_membrane__V_c; // micrometre3
-            const NekDouble var_potassium_dynamics__i_K1 = var_inward_rectifier_potassium_current__i_K1; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__i_to = var_transient_outward_current__i_to; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__i_NaK = var_sodium_potassium_pump_current__i_NaK; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__i_Kr = var_rapid_time_dependent_potassium_current__i_Kr; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__i_Ks = var_slow_time_dependent_potassium_current__i_Ks; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__i_p_K = var_potassium_pump_current__i_p_K; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__chaste_interface__chaste_membrane_capacitance = 1.0; // uF_per_cm2
-            const NekDouble var_potassium_dynamics__i_Stim_converter = var_chaste_interface__membrane__i_Stim; // uA_per_cm2
-            const NekDouble var_potassium_dynamics__i_Stim = var_potassium_dynamics__i_Stim_converter / var_potassium_dynamics__chaste_interface__chaste_membrane_capacitance; // picoA_per_picoF
-            const NekDouble var_potassium_dynamics__d_K_i_d_environment__time = (((-1.0) * ((var_potassium_dynamics__i_K1 + var_potassium_dynamics__i_to + var_potassium_dynamics__i_Kr + var_potassium_dynamics__i_Ks + var_potassium_dynamics__i_p_K + var_potassium_dynamics__i_Stim) - (2.0 * var_potassium_dynamics__i_NaK))) / (1.0 * var_potassium_dynamics__V_c * var_potassium_dynamics__F)) * var_potassium_dynamics__Cm; // 'millimole per litre per millisecond'
+        const NekDouble var_calcium_dynamics__Ca_i = var_chaste_interface__calcium_dynamics__Ca_i; // millimolar
+        const NekDouble var_calcium_dynamics__Ca_SR = var_chaste_interface__calcium_dynamics__Ca_SR; // millimolar
+        const NekDouble var_calcium_dynamics__Ca_ss = var_chaste_interface__calcium_dynamics__Ca_ss; // millimolar
+        const NekDouble var_calcium_dynamics__V_rel = 0.102; // per_millisecond
+        const NekDouble var_calcium_dynamics__R_prime = var_chaste_interface__calcium_dynamics__R_prime; // dimensionless
+        const NekDouble var_calcium_dynamics__k1_prime = 0.15; // per_millimolar2_per_millisecond
+        const NekDouble var_calcium_dynamics__max_sr = 2.5; // dimensionless
+        const NekDouble var_calcium_dynamics__EC = 1.5; // millimolar
+        const NekDouble var_calcium_dynamics__min_sr = 1.0; // dimensionless
+        const NekDouble var_calcium_dynamics__kcasr = var_calcium_dynamics__max_sr - ((var_calcium_dynamics__max_sr - var_calcium_dynamics__min_sr) / (1.0 + pow(var_calcium_dynamics__EC / var_calcium_dynamics__Ca_SR, 2.0))); // dimensionless
+        const NekDouble var_calcium_dynamics__k1 = var_calcium_dynamics__k1_prime / var_calcium_dynamics__kcasr; // per_millimolar2_per_millisecond
+        const NekDouble var_calcium_dynamics__k3 = 0.06; // per_millisecond
+        const NekDouble var_calcium_dynamics__O = (var_calcium_dynamics__k1 * pow(var_calcium_dynamics__Ca_ss, 2.0) * var_calcium_dynamics__R_prime) / (var_calcium_dynamics__k3 + (var_calcium_dynamics__k1 * pow(var_calcium_dynamics__Ca_ss, 2.0))); // dimensionless
+        const NekDouble var_calcium_dynamics__i_rel = var_calcium_dynamics__V_rel * var_calcium_dynamics__O * (var_calcium_dynamics__Ca_SR - var_calcium_dynamics__Ca_ss); // millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__Vmax_up = 0.006375; // millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__K_up = 0.00025; // millimolar
+        const NekDouble var_calcium_dynamics__i_up = var_calcium_dynamics__Vmax_up / (1.0 + (pow(var_calcium_dynamics__K_up, 2.0) / pow(var_calcium_dynamics__Ca_i, 2.0))); // millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__V_leak = 0.00036; // per_millisecond
+        const NekDouble var_calcium_dynamics__i_leak = var_calcium_dynamics__V_leak * (var_calcium_dynamics__Ca_SR - var_calcium_dynamics__Ca_i); // millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__V_xfer = 0.0038; // per_millisecond
+        const NekDouble var_calcium_dynamics__i_xfer = var_calcium_dynamics__V_xfer * (var_calcium_dynamics__Ca_ss - var_calcium_dynamics__Ca_i); // millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__k2_prime = 0.045; // per_millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__k2 = var_calcium_dynamics__k2_prime * var_calcium_dynamics__kcasr; // per_millimolar_per_millisecond
+        const NekDouble var_calcium_dynamics__k4 = 0.005; // per_millisecond
+        const NekDouble var_calcium_dynamics__Buf_c = 0.2; // millimolar
+        const NekDouble var_calcium_dynamics__K_buf_c = 0.001; // millimolar
+        const NekDouble var_calcium_dynamics__Ca_i_bufc = 1.0 / (1.0 + ((var_calcium_dynamics__Buf_c * var_calcium_dynamics__K_buf_c) / pow(var_calcium_dynamics__Ca_i + var_calcium_dynamics__K_buf_c, 2.0))); // dimensionless
+        const NekDouble var_calcium_dynamics__K_buf_sr = 0.3; // millimolar
+        const NekDouble var_calcium_dynamics__Buf_sr = 10.0; // millimolar
+        const NekDouble var_calcium_dynamics__Ca_sr_bufsr = 1.0 / (1.0 + ((var_calcium_dynamics__Buf_sr * var_calcium_dynamics__K_buf_sr) / pow(var_calcium_dynamics__Ca_SR + var_calcium_dynamics__K_buf_sr, 2.0))); // dimensionless
+        const NekDouble var_calcium_dynamics__Buf_ss = 0.4; // millimolar
+        const NekDouble var_calcium_dynamics__K_buf_ss = 0.00025; // millimolar
+        const NekDouble var_calcium_dynamics__Ca_ss_bufss = 1.0 / (1.0 + ((var_calcium_dynamics__Buf_ss * var_calcium_dynamics__K_buf_ss) / pow(var_calcium_dynamics__Ca_ss + var_calcium_dynamics__K_buf_ss, 2.0))); // dimensionless
+        const NekDouble var_calcium_dynamics__V_sr = 0.001094; // micrometre3
+        const NekDouble var_calcium_dynamics__V_ss = 5.468e-05; // micrometre3
+        const NekDouble var_calcium_dynamics__V_c = var_membrane__V_c; // micrometre3
+        const NekDouble var_calcium_dynamics__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_calcium_dynamics__Cm = var_membrane__Cm; // microF
+        const NekDouble var_calcium_dynamics__i_CaL = var_L_type_Ca_current__i_CaL; // picoA_per_picoF
+        const NekDouble var_calcium_dynamics__i_NaCa = var_sodium_calcium_exchanger_current__i_NaCa; // picoA_per_picoF
+        const NekDouble var_calcium_dynamics__i_p_Ca = var_calcium_pump_current__i_p_Ca; // picoA_per_picoF
+        const NekDouble var_calcium_dynamics__i_b_Ca = var_calcium_background_current__i_b_Ca; // picoA_per_picoF
+        const NekDouble var_calcium_dynamics__d_Ca_i_d_environment__time = var_calcium_dynamics__Ca_i_bufc * (((((var_calcium_dynamics__i_leak - var_calcium_dynamics__i_up) * var_calcium_dynamics__V_sr) / var_calcium_dynamics__V_c) + var_calcium_dynamics__i_xfer) - ((1.0 * ((var_calcium_dynamics__i_b_Ca + var_calcium_dynamics__i_p_Ca) - (2.0 * var_calcium_dynamics__i_NaCa)) * var_calcium_dynamics__Cm) / (2.0 * 1.0 * var_calcium_dynamics__V_c * var_calcium_dynamics__F))); // 'millimole per litre per millisecond'
+        const NekDouble var_calcium_dynamics__d_Ca_SR_d_environment__time = var_calcium_dynamics__Ca_sr_bufsr * (var_calcium_dynamics__i_up - (var_calcium_dynamics__i_rel + var_calcium_dynamics__i_leak)); // 'millimole per litre per millisecond'
+        const NekDouble var_calcium_dynamics__d_Ca_ss_d_environment__time = var_calcium_dynamics__Ca_ss_bufss * (((((-1.0) * var_calcium_dynamics__i_CaL * var_calcium_dynamics__Cm) / (2.0 * 1.0 * var_calcium_dynamics__V_ss * var_calcium_dynamics__F)) + ((var_calcium_dynamics__i_rel * var_calcium_dynamics__V_sr) / var_calcium_dynamics__V_ss)) - ((var_calcium_dynamics__i_xfer * var_calcium_dynamics__V_c) / var_calcium_dynamics__V_ss)); // 'millimole per litre per millisecond'
+        const NekDouble var_calcium_dynamics__d_R_prime_d_environment__time = ((-var_calcium_dynamics__k2) * var_calcium_dynamics__Ca_ss * var_calcium_dynamics__R_prime) + (var_calcium_dynamics__k4 * (1.0 - var_calcium_dynamics__R_prime)); // per_millisecond
+        const NekDouble var_sodium_dynamics__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_sodium_dynamics__Cm = var_membrane__Cm; // microF
+        const NekDouble var_sodium_dynamics__V_c = var_membrane__V_c; // micrometre3
+        const NekDouble var_sodium_dynamics__i_Na = var_fast_sodium_current__i_Na; // picoA_per_picoF
+        const NekDouble var_sodium_dynamics__i_NaCa = var_sodium_calcium_exchanger_current__i_NaCa; // picoA_per_picoF
+        const NekDouble var_sodium_dynamics__i_NaK = var_sodium_potassium_pump_current__i_NaK; // picoA_per_picoF
+        const NekDouble var_sodium_dynamics__i_b_Na = var_sodium_background_current__i_b_Na; // picoA_per_picoF
+        const NekDouble var_sodium_dynamics__d_Na_i_d_environment__time = (((-1.0) * (var_sodium_dynamics__i_Na + var_sodium_dynamics__i_b_Na + (3.0 * var_sodium_dynamics__i_NaK) + (3.0 * var_sodium_dynamics__i_NaCa))) / (1.0 * var_sodium_dynamics__V_c * var_sodium_dynamics__F)) * var_sodium_dynamics__Cm; // 'millimole per litre per millisecond'
+        const NekDouble var_potassium_dynamics__F = var_membrane__F; // coulomb_per_millimole
+        const NekDouble var_potassium_dynamics__Cm = var_membrane__Cm; // microF
+        const NekDouble var_potassium_dynamics__V_c = var_membrane__V_c; // micrometre3
+        const NekDouble var_potassium_dynamics__i_K1 = var_inward_rectifier_potassium_current__i_K1; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__i_to = var_transient_outward_current__i_to; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__i_NaK = var_sodium_potassium_pump_current__i_NaK; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__i_Kr = var_rapid_time_dependent_potassium_current__i_Kr; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__i_Ks = var_slow_time_dependent_potassium_current__i_Ks; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__i_p_K = var_potassium_pump_current__i_p_K; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__chaste_interface__chaste_membrane_capacitance = 1.0; // uF_per_cm2
+        const NekDouble var_potassium_dynamics__i_Stim_converter = var_chaste_interface__membrane__i_Stim; // uA_per_cm2
+        const NekDouble var_potassium_dynamics__i_Stim = var_potassium_dynamics__i_Stim_converter / var_potassium_dynamics__chaste_interface__chaste_membrane_capacitance; // picoA_per_picoF
+        const NekDouble var_potassium_dynamics__d_K_i_d_environment__time = (((-1.0) * ((var_potassium_dynamics__i_K1 + var_potassium_dynamics__i_to + var_potassium_dynamics__i_Kr + var_potassium_dynamics__i_Ks + var_potassium_dynamics__i_p_K + var_potassium_dynamics__i_Stim) - (2.0 * var_potassium_dynamics__i_NaK))) / (1.0 * var_potassium_dynamics__V_c * var_potassium_dynamics__F)) * var_potassium_dynamics__Cm; // 'millimole per litre per millisecond'
 //            const NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__d_Xr1_d_environment__time = var_rapid_time_dependent_potassium_current__rapid_time_dependent_potassium_current_Xr1_gate__d_Xr1_d_environment__time; // per_millisecond
 //            const NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__d_Xr2_d_environment__time = var_rapid_time_dependent_potassium_current__rapid_time_dependent_potassium_current_Xr2_gate__d_Xr2_d_environment__time; // per_millisecond
 //            const NekDouble var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__d_Xs_d_environment__time = var_slow_time_dependent_potassium_current__slow_time_dependent_potassium_current_Xs_gate__d_Xs_d_environment__time; // per_millisecond
@@ -407,12 +384,12 @@ namespace Nektar
 //            const NekDouble var_chaste_interface__L_type_Ca_current_fCass_gate__d_fCass_d_environment__time = var_L_type_Ca_current__L_type_Ca_current_fCass_gate__d_fCass_d_environment__time; // per_millisecond
 //            const NekDouble var_chaste_interface__transient_outward_current_s_gate__d_s_d_environment__time = var_transient_outward_current__transient_outward_current_s_gate__d_s_d_environment__time; // per_millisecond
 //            const NekDouble var_chaste_interface__transient_outward_current_r_gate__d_r_d_environment__time = var_transient_outward_current__transient_outward_current_r_gate__d_r_d_environment__time; // per_millisecond
-            const NekDouble var_chaste_interface__calcium_dynamics__d_Ca_i_d_environment__time = var_calcium_dynamics__d_Ca_i_d_environment__time; // millimolar_per_millisecond
-            const NekDouble var_chaste_interface__calcium_dynamics__d_Ca_SR_d_environment__time = var_calcium_dynamics__d_Ca_SR_d_environment__time; // millimolar_per_millisecond
-            const NekDouble var_chaste_interface__calcium_dynamics__d_Ca_ss_d_environment__time = var_calcium_dynamics__d_Ca_ss_d_environment__time; // millimolar_per_millisecond
-            const NekDouble var_chaste_interface__calcium_dynamics__d_R_prime_d_environment__time = var_calcium_dynamics__d_R_prime_d_environment__time; // per_millisecond
-            const NekDouble var_chaste_interface__sodium_dynamics__d_Na_i_d_environment__time = var_sodium_dynamics__d_Na_i_d_environment__time; // millimolar_per_millisecond
-            const NekDouble var_chaste_interface__potassium_dynamics__d_K_i_d_environment__time = var_potassium_dynamics__d_K_i_d_environment__time; // millimolar_per_millisecond
+        const NekDouble var_chaste_interface__calcium_dynamics__d_Ca_i_d_environment__time = var_calcium_dynamics__d_Ca_i_d_environment__time; // millimolar_per_millisecond
+        const NekDouble var_chaste_interface__calcium_dynamics__d_Ca_SR_d_environment__time = var_calcium_dynamics__d_Ca_SR_d_environment__time; // millimolar_per_millisecond
+        const NekDouble var_chaste_interface__calcium_dynamics__d_Ca_ss_d_environment__time = var_calcium_dynamics__d_Ca_ss_d_environment__time; // millimolar_per_millisecond
+        const NekDouble var_chaste_interface__calcium_dynamics__d_R_prime_d_environment__time = var_calcium_dynamics__d_R_prime_d_environment__time; // per_millisecond
+        const NekDouble var_chaste_interface__sodium_dynamics__d_Na_i_d_environment__time = var_sodium_dynamics__d_Na_i_d_environment__time; // millimolar_per_millisecond
+        const NekDouble var_chaste_interface__potassium_dynamics__d_K_i_d_environment__time = var_potassium_dynamics__d_K_i_d_environment__time; // millimolar_per_millisecond
 //            const NekDouble d_dt_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1 = var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__d_Xr1_d_environment__time; // per_millisecond
 //            const NekDouble d_dt_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2 = var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__d_Xr2_d_environment__time; // per_millisecond
 //            const NekDouble d_dt_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs = var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__d_Xs_d_environment__time; // per_millisecond
@@ -425,75 +402,165 @@ namespace Nektar
 //            const NekDouble d_dt_chaste_interface__L_type_Ca_current_fCass_gate__fCass = var_chaste_interface__L_type_Ca_current_fCass_gate__d_fCass_d_environment__time; // per_millisecond
 //            const NekDouble d_dt_chaste_interface__transient_outward_current_s_gate__s = var_chaste_interface__transient_outward_current_s_gate__d_s_d_environment__time; // per_millisecond
 //            const NekDouble d_dt_chaste_interface__transient_outward_current_r_gate__r = var_chaste_interface__transient_outward_current_r_gate__d_r_d_environment__time; // per_millisecond
-            const NekDouble d_dt_chaste_interface__calcium_dynamics__Ca_i = var_chaste_interface__calcium_dynamics__d_Ca_i_d_environment__time; // 'millimole per litre per millisecond'
-            const NekDouble d_dt_chaste_interface__calcium_dynamics__Ca_SR = var_chaste_interface__calcium_dynamics__d_Ca_SR_d_environment__time; // 'millimole per litre per millisecond'
-            const NekDouble d_dt_chaste_interface__calcium_dynamics__Ca_ss = var_chaste_interface__calcium_dynamics__d_Ca_ss_d_environment__time; // 'millimole per litre per millisecond'
-            const NekDouble d_dt_chaste_interface__calcium_dynamics__R_prime = var_chaste_interface__calcium_dynamics__d_R_prime_d_environment__time; // per_millisecond
-            const NekDouble d_dt_chaste_interface__sodium_dynamics__Na_i = var_chaste_interface__sodium_dynamics__d_Na_i_d_environment__time; // 'millimole per litre per millisecond'
-            const NekDouble d_dt_chaste_interface__potassium_dynamics__K_i = var_chaste_interface__potassium_dynamics__d_K_i_d_environment__time; // 'millimole per litre per millisecond'
-            
-            const NekDouble var_membrane__i_K1 = var_inward_rectifier_potassium_current__i_K1; // picoA_per_picoF
-            const NekDouble var_membrane__i_to = var_transient_outward_current__i_to; // picoA_per_picoF
-            const NekDouble var_membrane__i_Kr = var_rapid_time_dependent_potassium_current__i_Kr; // picoA_per_picoF
-            const NekDouble var_membrane__i_Ks = var_slow_time_dependent_potassium_current__i_Ks; // picoA_per_picoF
-            const NekDouble var_membrane__i_CaL = var_L_type_Ca_current__i_CaL; // picoA_per_picoF
-            const NekDouble var_membrane__i_NaK = var_sodium_potassium_pump_current__i_NaK; // picoA_per_picoF
-            const NekDouble var_membrane__i_Na = var_fast_sodium_current__i_Na; // picoA_per_picoF
-            const NekDouble var_membrane__i_b_Na = var_sodium_background_current__i_b_Na; // picoA_per_picoF
-            const NekDouble var_membrane__i_NaCa = var_sodium_calcium_exchanger_current__i_NaCa; // picoA_per_picoF
-            const NekDouble var_membrane__i_b_Ca = var_calcium_background_current__i_b_Ca; // picoA_per_picoF
-            const NekDouble var_membrane__i_p_K = var_potassium_pump_current__i_p_K; // picoA_per_picoF
-            const NekDouble var_membrane__i_p_Ca = var_calcium_pump_current__i_p_Ca; // picoA_per_picoF
-            const NekDouble var_membrane__i_Stim_converter = var_chaste_interface__membrane__i_Stim; // uA_per_cm2
-            const NekDouble var_membrane__chaste_interface__chaste_membrane_capacitance = 1.0; // uF_per_cm2
-            const NekDouble var_membrane__i_Stim = var_membrane__i_Stim_converter / var_membrane__chaste_interface__chaste_membrane_capacitance; // picoA_per_picoF
-            const NekDouble var_membrane__d_V_d_environment__time = ((-1.0) / 1.0) * (var_membrane__i_K1 + var_membrane__i_to + var_membrane__i_Kr + var_membrane__i_Ks + var_membrane__i_CaL + var_membrane__i_NaK + var_membrane__i_Na + var_membrane__i_b_Na + var_membrane__i_NaCa + var_membrane__i_b_Ca + var_membrane__i_p_K + var_membrane__i_p_Ca + var_membrane__i_Stim); // 'millivolt per millisecond'
-            const NekDouble var_chaste_interface__membrane__d_V_d_environment__time = var_membrane__d_V_d_environment__time; // ___units_1
-            d_dt_chaste_interface__membrane__V = var_chaste_interface__membrane__d_V_d_environment__time; // 'millivolt per millisecond'
-            outarray[0][i] = d_dt_chaste_interface__membrane__V;
-            outarray[1][i] = var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf;
-            m_gates_tau[0][i] = var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1;
-            outarray[2][i] = var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf;
-            m_gates_tau[1][i] = var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2;
-            outarray[3][i] = var_slow_time_dependent_potassium_current_Xs_gate__xs_inf;
-            m_gates_tau[2][i] = var_slow_time_dependent_potassium_current_Xs_gate__tau_xs;
-            outarray[4][i] = var_fast_sodium_current_m_gate__m_inf;
-            m_gates_tau[3][i] = var_fast_sodium_current_m_gate__tau_m;
-            outarray[5][i] = var_fast_sodium_current_h_gate__h_inf;
-            m_gates_tau[4][i] = var_fast_sodium_current_h_gate__tau_h;
-            outarray[6][i] = var_fast_sodium_current_j_gate__j_inf;
-            m_gates_tau[5][i] = var_fast_sodium_current_j_gate__tau_j;
-            outarray[7][i] = var_L_type_Ca_current_d_gate__d_inf;
-            m_gates_tau[6][i] = var_L_type_Ca_current_d_gate__tau_d;
-            outarray[8][i] = var_L_type_Ca_current_f_gate__f_inf;
-            m_gates_tau[7][i] = var_L_type_Ca_current_f_gate__tau_f;
-            outarray[9][i] = var_L_type_Ca_current_f2_gate__f2_inf;
-            m_gates_tau[8][i] = var_L_type_Ca_current_f2_gate__tau_f2;
-            outarray[10][i] = var_L_type_Ca_current_fCass_gate__fCass_inf;
-            m_gates_tau[9][i] = var_L_type_Ca_current_fCass_gate__tau_fCass;
-            outarray[11][i] = var_transient_outward_current_s_gate__s_inf;
-            m_gates_tau[10][i] = var_transient_outward_current_s_gate__tau_s;
-            outarray[12][i] = var_transient_outward_current_r_gate__r_inf;
-            m_gates_tau[11][i] = var_transient_outward_current_r_gate__tau_r;
-//            outarray[1][i] = d_dt_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1;
-//            outarray[2][i] = d_dt_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2;
-//            outarray[3][i] = d_dt_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs;
-//            outarray[4][i] = d_dt_chaste_interface__fast_sodium_current_m_gate__m;
-//            outarray[5][i] = d_dt_chaste_interface__fast_sodium_current_h_gate__h;
-//            outarray[6][i] = d_dt_chaste_interface__fast_sodium_current_j_gate__j;
-//            outarray[7][i] = d_dt_chaste_interface__L_type_Ca_current_d_gate__d;
-//            outarray[8][i] = d_dt_chaste_interface__L_type_Ca_current_f_gate__f;
-//            outarray[9][i] = d_dt_chaste_interface__L_type_Ca_current_f2_gate__f2;
-//            outarray[10][i] = d_dt_chaste_interface__L_type_Ca_current_fCass_gate__fCass;
-//            outarray[11][i] = d_dt_chaste_interface__transient_outward_current_s_gate__s;
-//            outarray[12][i] = d_dt_chaste_interface__transient_outward_current_r_gate__r;
-            outarray[13][i] = d_dt_chaste_interface__calcium_dynamics__Ca_i;
-            outarray[14][i] = d_dt_chaste_interface__calcium_dynamics__Ca_SR;
-            outarray[15][i] = d_dt_chaste_interface__calcium_dynamics__Ca_ss;
-            outarray[16][i] = d_dt_chaste_interface__calcium_dynamics__R_prime;
-            outarray[17][i] = d_dt_chaste_interface__sodium_dynamics__Na_i;
-            outarray[18][i] = d_dt_chaste_interface__potassium_dynamics__K_i;
-        }
+        const NekDouble d_dt_chaste_interface__calcium_dynamics__Ca_i = var_chaste_interface__calcium_dynamics__d_Ca_i_d_environment__time; // 'millimole per litre per millisecond'
+        const NekDouble d_dt_chaste_interface__calcium_dynamics__Ca_SR = var_chaste_interface__calcium_dynamics__d_Ca_SR_d_environment__time; // 'millimole per litre per millisecond'
+        const NekDouble d_dt_chaste_interface__calcium_dynamics__Ca_ss = var_chaste_interface__calcium_dynamics__d_Ca_ss_d_environment__time; // 'millimole per litre per millisecond'
+        const NekDouble d_dt_chaste_interface__calcium_dynamics__R_prime = var_chaste_interface__calcium_dynamics__d_R_prime_d_environment__time; // per_millisecond
+        const NekDouble d_dt_chaste_interface__sodium_dynamics__Na_i = var_chaste_interface__sodium_dynamics__d_Na_i_d_environment__time; // 'millimole per litre per millisecond'
+        const NekDouble d_dt_chaste_interface__potassium_dynamics__K_i = var_chaste_interface__potassium_dynamics__d_K_i_d_environment__time; // 'millimole per litre per millisecond'
+        
+        const NekDouble var_membrane__i_K1 = var_inward_rectifier_potassium_current__i_K1; // picoA_per_picoF
+        const NekDouble var_membrane__i_to = var_transient_outward_current__i_to; // picoA_per_picoF
+        const NekDouble var_membrane__i_Kr = var_rapid_time_dependent_potassium_current__i_Kr; // picoA_per_picoF
+        const NekDouble var_membrane__i_Ks = var_slow_time_dependent_potassium_current__i_Ks; // picoA_per_picoF
+        const NekDouble var_membrane__i_CaL = var_L_type_Ca_current__i_CaL; // picoA_per_picoF
+        const NekDouble var_membrane__i_NaK = var_sodium_potassium_pump_current__i_NaK; // picoA_per_picoF
+        const NekDouble var_membrane__i_Na = var_fast_sodium_current__i_Na; // picoA_per_picoF
+        const NekDouble var_membrane__i_b_Na = var_sodium_background_current__i_b_Na; // picoA_per_picoF
+        const NekDouble var_membrane__i_NaCa = var_sodium_calcium_exchanger_current__i_NaCa; // picoA_per_picoF
+        const NekDouble var_membrane__i_b_Ca = var_calcium_background_current__i_b_Ca; // picoA_per_picoF
+        const NekDouble var_membrane__i_p_K = var_potassium_pump_current__i_p_K; // picoA_per_picoF
+        const NekDouble var_membrane__i_p_Ca = var_calcium_pump_current__i_p_Ca; // picoA_per_picoF
+        const NekDouble var_membrane__i_Stim_converter = var_chaste_interface__membrane__i_Stim; // uA_per_cm2
+        const NekDouble var_membrane__chaste_interface__chaste_membrane_capacitance = 1.0; // uF_per_cm2
+        const NekDouble var_membrane__i_Stim = var_membrane__i_Stim_converter / var_membrane__chaste_interface__chaste_membrane_capacitance; // picoA_per_picoF
+        const NekDouble var_membrane__d_V_d_environment__time = ((-1.0) / 1.0) * (var_membrane__i_K1 + var_membrane__i_to + var_membrane__i_Kr + var_membrane__i_Ks + var_membrane__i_CaL + var_membrane__i_NaK + var_membrane__i_Na + var_membrane__i_b_Na + var_membrane__i_NaCa + var_membrane__i_b_Ca + var_membrane__i_p_K + var_membrane__i_p_Ca + var_membrane__i_Stim); // 'millivolt per millisecond'
+        const NekDouble var_chaste_interface__membrane__d_V_d_environment__time = var_membrane__d_V_d_environment__time; // ___units_1
+        d_dt_chaste_interface__membrane__V = var_chaste_interface__membrane__d_V_d_environment__time; // 'millivolt per millisecond'
+        dy[0] = d_dt_chaste_interface__membrane__V;
+        dy[1] = var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf;
+        tau[0] = var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1;
+        dy[2] = var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf;
+        tau[1] = var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2;
+        dy[3] = var_slow_time_dependent_potassium_current_Xs_gate__xs_inf;
+        tau[2] = var_slow_time_dependent_potassium_current_Xs_gate__tau_xs;
+        dy[4] = var_fast_sodium_current_m_gate__m_inf;
+        tau[3] = var_fast_sodium_current_m_gate__tau_m;
+        dy[5] = var_fast_sodium_current_h_gate__h_inf;
+        tau[4] = var_fast_sodium_current_h_gate__tau_h;
+        dy[6] = var_fast_sodium_current_j_gate__j_inf;
+        tau[5] = var_fast_sodium_current_j_gate__tau_j;
+        dy[7] = var_L_type_Ca_current_d_gate__d_inf;
+        tau[6] = var_L_type_Ca_current_d_gate__tau_d;
+        dy[8] = var_L_type_Ca_current_f_gate__f_inf;
+        tau[7] = var_L_type_Ca_current_f_gate__tau_f;
+        dy[9] = var_L_type_Ca_current_f2_gate__f2_inf;
+        tau[8] = var_L_type_Ca_current_f2_gate__tau_f2;
+        dy[10] = var_L_type_Ca_current_fCass_gate__fCass_inf;
+        tau[9] = var_L_type_Ca_current_fCass_gate__tau_fCass;
+        dy[11] = var_transient_outward_current_s_gate__s_inf;
+        tau[10] = var_transient_outward_current_s_gate__tau_s;
+        dy[12] = var_transient_outward_current_r_gate__r_inf;
+        tau[11] = var_transient_outward_current_r_gate__tau_r;
+//            dy[1] = d_dt_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1;
+//            dy[2] = d_dt_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2;
+//            dy[3] = d_dt_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs;
+//            dy[4] = d_dt_chaste_interface__fast_sodium_current_m_gate__m;
+//            dy[5] = d_dt_chaste_interface__fast_sodium_current_h_gate__h;
+//            dy[6] = d_dt_chaste_interface__fast_sodium_current_j_gate__j;
+//            dy[7] = d_dt_chaste_interface__L_type_Ca_current_d_gate__d;
+//            dy[8] = d_dt_chaste_interface__L_type_Ca_current_f_gate__f;
+//            dy[9] = d_dt_chaste_interface__L_type_Ca_current_f2_gate__f2;
+//            dy[10] = d_dt_chaste_interface__L_type_Ca_current_fCass_gate__fCass;
+//            dy[11] = d_dt_chaste_interface__transient_outward_current_s_gate__s;
+//            dy[12] = d_dt_chaste_interface__transient_outward_current_r_gate__r;
+        dy[13] = d_dt_chaste_interface__calcium_dynamics__Ca_i;
+        dy[14] = d_dt_chaste_interface__calcium_dynamics__Ca_SR;
+        dy[15] = d_dt_chaste_interface__calcium_dynamics__Ca_ss;
+        dy[16] = d_dt_chaste_interface__calcium_dynamics__R_prime;
+        dy[17] = d_dt_chaste_interface__sodium_dynamics__Na_i;
+        dy[18] = d_dt_chaste_interface__potassium_dynamics__K_i;
+    }
+
+    /**
+     * Integrates all points with the inlined point-wise kernel.
+     */
+    void TenTusscher06Endo::v_FusedTimeIntegrate(const NekDouble dtPde)
+    {
+        FusedTimeIntegrate(this, dtPde);
+    }
+
+
+    /**
+     * Computes the steady-state values and time constants of the gates
+     * which depend only on the membrane potential, i.e. all gates except
+     * fCass.
+     */
+    void TenTusscher06Endo::v_EvaluateVoltageTerms(
+            const NekDouble  V,
+                  NekDouble *terms)
+    {
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__V = V; // millivolt
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__V = V; // millivolt
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__V = V; // millivolt
+        const NekDouble var_fast_sodium_current_m_gate__V = V; // millivolt
+        const NekDouble var_fast_sodium_current_h_gate__V = V; // millivolt
+        const NekDouble var_fast_sodium_current_j_gate__V = V; // millivolt
+        const NekDouble var_L_type_Ca_current_d_gate__V = V; // millivolt
+        const NekDouble var_L_type_Ca_current_f_gate__V = V; // millivolt
+        const NekDouble var_L_type_Ca_current_f2_gate__V = V; // millivolt
+        const NekDouble var_transient_outward_current_s_gate__V = V; // millivolt
+        const NekDouble var_transient_outward_current_r_gate__V = V; // millivolt
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__alpha_xr1 = 450.0 / (1.0 + exp(((-45.0) - var_rapid_time_dependent_potassium_current_Xr1_gate__V) / 10.0)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__beta_xr1 = 6.0 / (1.0 + exp((var_rapid_time_dependent_potassium_current_Xr1_gate__V + 30.0) / 11.5)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1 = 1.0 * var_rapid_time_dependent_potassium_current_Xr1_gate__alpha_xr1 * var_rapid_time_dependent_potassium_current_Xr1_gate__beta_xr1; // millisecond
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf = 1.0 / (1.0 + exp(((-26.0) - var_rapid_time_dependent_potassium_current_Xr1_gate__V) / 7.0)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__alpha_xr2 = 3.0 / (1.0 + exp(((-60.0) - var_rapid_time_dependent_potassium_current_Xr2_gate__V) / 20.0)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__beta_xr2 = 1.12 / (1.0 + exp((var_rapid_time_dependent_potassium_current_Xr2_gate__V - 60.0) / 20.0)); // dimensionless
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2 = 1.0 * var_rapid_time_dependent_potassium_current_Xr2_gate__alpha_xr2 * var_rapid_time_dependent_potassium_current_Xr2_gate__beta_xr2; // millisecond
+        const NekDouble var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf = 1.0 / (1.0 + exp((var_rapid_time_dependent_potassium_current_Xr2_gate__V + 88.0) / 24.0)); // dimensionless
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__beta_xs = 1.0 / (1.0 + exp((var_slow_time_dependent_potassium_current_Xs_gate__V - 35.0) / 15.0)); // dimensionless
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__alpha_xs = 1400.0 / sqrt(1.0 + exp((5.0 - var_slow_time_dependent_potassium_current_Xs_gate__V) / 6.0)); // dimensionless
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__tau_xs = (1.0 * var_slow_time_dependent_potassium_current_Xs_gate__alpha_xs * var_slow_time_dependent_potassium_current_Xs_gate__beta_xs) + 80.0; // millisecond
+        const NekDouble var_slow_time_dependent_potassium_current_Xs_gate__xs_inf = 1.0 / (1.0 + exp(((-5.0) - var_slow_time_dependent_potassium_current_Xs_gate__V) / 14.0)); // dimensionless
+        const NekDouble var_fast_sodium_current_m_gate__alpha_m = 1.0 / (1.0 + exp(((-60.0) - var_fast_sodium_current_m_gate__V) / 5.0)); // dimensionless
+        const NekDouble var_fast_sodium_current_m_gate__beta_m = (0.1 / (1.0 + exp((var_fast_sodium_current_m_gate__V + 35.0) / 5.0))) + (0.1 / (1.0 + exp((var_fast_sodium_current_m_gate__V - 50.0) / 200.0))); // dimensionless
+        const NekDouble var_fast_sodium_current_m_gate__tau_m = 1.0 * var_fast_sodium_current_m_gate__alpha_m * var_fast_sodium_current_m_gate__beta_m; // millisecond
+        const NekDouble var_fast_sodium_current_m_gate__m_inf = 1.0 / pow(1.0 + exp(((-56.86) - var_fast_sodium_current_m_gate__V) / 9.03), 2.0); // dimensionless
+        const NekDouble var_fast_sodium_current_h_gate__h_inf = 1.0 / pow(1.0 + exp((var_fast_sodium_current_h_gate__V + 71.55) / 7.43), 2.0); // dimensionless
+        const NekDouble var_fast_sodium_current_h_gate__beta_h = (var_fast_sodium_current_h_gate__V < (-40.0)) ? ((2.7 * exp(0.079 * var_fast_sodium_current_h_gate__V)) + (310000.0 * exp(0.3485 * var_fast_sodium_current_h_gate__V))) : (0.77 / (0.13 * (1.0 + exp((var_fast_sodium_current_h_gate__V + 10.66) / (-11.1))))); // per_millisecond
+        const NekDouble var_fast_sodium_current_h_gate__alpha_h = (var_fast_sodium_current_h_gate__V < (-40.0)) ? (0.057 * exp((-(var_fast_sodium_current_h_gate__V + 80.0)) / 6.8)) : 0.0; // per_millisecond
+        const NekDouble var_fast_sodium_current_h_gate__tau_h = 1.0 / (var_fast_sodium_current_h_gate__alpha_h + var_fast_sodium_current_h_gate__beta_h); // millisecond
+        const NekDouble var_fast_sodium_current_j_gate__j_inf = 1.0 / pow(1.0 + exp((var_fast_sodium_current_j_gate__V + 71.55) / 7.43), 2.0); // dimensionless
+        const NekDouble var_fast_sodium_current_j_gate__alpha_j = (var_fast_sodium_current_j_gate__V < (-40.0)) ? ((((((-25428.0) * exp(0.2444 * var_fast_sodium_current_j_gate__V)) - (6.948e-06 * exp((-0.04391) * var_fast_sodium_current_j_gate__V))) * (var_fast_sodium_current_j_gate__V + 37.78)) / 1.0) / (1.0 + exp(0.311 * (var_fast_sodium_current_j_gate__V + 79.23)))) : 0.0; // per_millisecond
+        const NekDouble var_fast_sodium_current_j_gate__beta_j = (var_fast_sodium_current_j_gate__V < (-40.0)) ? ((0.02424 * exp((-0.01052) * var_fast_sodium_current_j_gate__V)) / (1.0 + exp((-0.1378) * (var_fast_sodium_current_j_gate__V + 40.14)))) : ((0.6 * exp(0.057 * var_fast_sodium_current_j_gate__V)) / (1.0 + exp((-0.1) * (var_fast_sodium_current_j_gate__V + 32.0)))); // per_millisecond
+        const NekDouble var_fast_sodium_current_j_gate__tau_j = 1.0 / (var_fast_sodium_current_j_gate__alpha_j + var_fast_sodium_current_j_gate__beta_j); // millisecond
+        const NekDouble var_L_type_Ca_current_d_gate__alpha_d = (1.4 / (1.0 + exp(((-35.0) - var_L_type_Ca_current_d_gate__V) / 13.0))) + 0.25; // dimensionless
+        const NekDouble var_L_type_Ca_current_d_gate__gamma_d = 1.0 / (1.0 + exp((50.0 - var_L_type_Ca_current_d_gate__V) / 20.0)); // millisecond
+        const NekDouble var_L_type_Ca_current_d_gate__beta_d = 1.4 / (1.0 + exp((var_L_type_Ca_current_d_gate__V + 5.0) / 5.0)); // dimensionless
+        const NekDouble var_L_type_Ca_current_d_gate__tau_d = (1.0 * var_L_type_Ca_current_d_gate__alpha_d * var_L_type_Ca_current_d_gate__beta_d) + var_L_type_Ca_current_d_gate__gamma_d; // millisecond
+        const NekDouble var_L_type_Ca_current_d_gate__d_inf = 1.0 / (1.0 + exp(((-8.0) - var_L_type_Ca_current_d_gate__V) / 7.5)); // dimensionless
+        const NekDouble var_L_type_Ca_current_f_gate__tau_f = (1102.5 * exp((-pow(var_L_type_Ca_current_f_gate__V + 27.0, 2.0)) / 225.0)) + (200.0 / (1.0 + exp((13.0 - var_L_type_Ca_current_f_gate__V) / 10.0))) + (180.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 30.0) / 10.0))) + 20.0; // millisecond
+        const NekDouble var_L_type_Ca_current_f_gate__f_inf = 1.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 20.0) / 7.0)); // dimensionless
+        const NekDouble var_L_type_Ca_current_f2_gate__f2_inf = (0.67 / (1.0 + exp((var_L_type_Ca_current_f2_gate__V + 35.0) / 7.0))) + 0.33; // dimensionless
+        const NekDouble var_L_type_Ca_current_f2_gate__tau_f2 = (562.0 * exp((-pow(var_L_type_Ca_current_f2_gate__V + 27.0, 2.0)) / 240.0)) + (31.0 / (1.0 + exp((25.0 - var_L_type_Ca_current_f2_gate__V) / 10.0))) + (80.0 / (1.0 + exp((var_L_type_Ca_current_f2_gate__V + 30.0) / 10.0))); // millisecond
+        const NekDouble var_transient_outward_current_s_gate__s_inf = 1.0 / (1.0 + exp((var_transient_outward_current_s_gate__V + 28.0) / 5.0)); // dimensionless
+        const NekDouble var_transient_outward_current_s_gate__tau_s = (1000.0 * exp((-pow(var_transient_outward_current_s_gate__V + 67.0, 2.0)) / 1000.0)) + 8.0; // millisecond
+        const NekDouble var_transient_outward_current_r_gate__r_inf = 1.0 / (1.0 + exp((20.0 - var_transient_outward_current_r_gate__V) / 6.0)); // dimensionless
+        const NekDouble var_transient_outward_current_r_gate__tau_r = (9.5 * exp((-pow(var_transient_outward_current_r_gate__V + 40.0, 2.0)) / 1800.0)) + 0.8; // millisecond
+
+        terms[0] = var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1;
+        terms[1] = var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf;
+        terms[2] = var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2;
+        terms[3] = var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf;
+        terms[4] = var_slow_time_dependent_potassium_current_Xs_gate__tau_xs;
+        terms[5] = var_slow_time_dependent_potassium_current_Xs_gate__xs_inf;
+        terms[6] = var_fast_sodium_current_m_gate__tau_m;
+        terms[7] = var_fast_sodium_current_m_gate__m_inf;
+        terms[8] = var_fast_sodium_current_h_gate__h_inf;
+        terms[9] = var_fast_sodium_current_h_gate__tau_h;
+        terms[10] = var_fast_sodium_current_j_gate__j_inf;
+        terms[11] = var_fast_sodium_current_j_gate__tau_j;
+        terms[12] = var_L_type_Ca_current_d_gate__tau_d;
+        terms[13] = var_L_type_Ca_current_d_gate__d_inf;
+        terms[14] = var_L_type_Ca_current_f_gate__tau_f;
+        terms[15] = var_L_type_Ca_current_f_gate__f_inf;
+        terms[16] = var_L_type_Ca_current_f2_gate__f2_inf;
+        terms[17] = var_L_type_Ca_current_f2_gate__tau_f2;
+        terms[18] = var_transient_outward_current_s_gate__s_inf;
+        terms[19] = var_transient_outward_current_s_gate__tau_s;
+        terms[20] = var_transient_outward_current_r_gate__r_inf;
+        terms[21] = var_transient_outward_current_r_gate__tau_r;
     }
 
 
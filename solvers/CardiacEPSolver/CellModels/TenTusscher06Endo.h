@@ -64,16 +64,36 @@ namespace Nektar
         virtual ~TenTusscher06Endo() {}
 
     protected:
-        /// Computes the reaction terms $f(u,v)$ and $g(u,v)$.
-        virtual void v_Update(
-               const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
-                     Array<OneD,        Array<OneD, NekDouble> >&outarray,
-               const NekDouble time);
+        friend class CellModel;
+
+        virtual bool v_HasPointUpdate()
+        {
+            return true;
+        }
+
+        /// Computes the derivatives and gate time constants at one point.
+        virtual void v_UpdatePoint(
+                const NekDouble *y,
+                      NekDouble *dy,
+                      NekDouble *tau);
+
+        /// Integrates all points over one PDE time-step.
+        virtual void v_FusedTimeIntegrate(const NekDouble dtPde);
 
         /// Prints a summary of the model parameters.
         virtual void v_GenerateSummary(SummaryList& s);
 
         virtual void v_SetInitialConditions();
+
+        virtual int v_GetNumVoltageTerms()
+        {
+            return 22;
+        }
+
+        /// Computes the terms depending only on the membrane potential.
+        virtual void v_EvaluateVoltageTerms(
+                const NekDouble  V,
+                      NekDouble *terms);
     };
 }
 
@@ -0,0 +1,50 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Luo-Rudy 1991 cell model with adaptive substeps</description>
+    <executable>PrePacing</executable>
+    <parameters>LuoRudy91.xml</parameters>
+    <files>
+        <file description="Session File">LuoRudy91.xml</file>
+    </files>
+    <metrics>
+        <metric type="Regex" id="1">
+            <regex>
+                ^#\s([\w]*)\s*([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)
+            </regex>
+            <matches>
+                <match>
+                    <field>Var0</field>
+                    <field tolerance="1e-04">-82.2379</field>
+                </match>
+                <match>
+                    <field>Var1</field>
+                    <field tolerance="1e-05">0.00244342</field>
+                </match>
+                <match>
+                    <field>Var2</field>
+                    <field tolerance="1e-05">0.971963</field>
+                </match>
+                <match>
+                    <field>Var3</field>
+                    <field tolerance="1e-05">0.946681</field>
+                </match>
+                <match>
+                    <field>Var4</field>
+                    <field tolerance="1e-05">0.00369617</field>
+                </match>
+                <match>
+                    <field>Var5</field>
+                    <field tolerance="1e-05">0.789012</field>
+                </match>
+                <match>
+                    <field>Var6</field>
+                    <field tolerance="1e-05">0.715884</field>
+                </match>
+                <match>
+                    <field>Var7</field>
+                    <field tolerance="1e-05">0.000227373</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -216,4 +216,12 @@ namespace Nektar
         
         return out;
     }
+
+    void AUSM2Solver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
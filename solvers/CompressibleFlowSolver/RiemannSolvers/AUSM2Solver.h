@@ -52,8 +52,15 @@ namespace Nektar
         static std::string solverName;
         
     protected:
+        friend class CompressibleSolver;
+
         AUSM2Solver();
         
+        virtual void v_BatchSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
+
         virtual void v_PointSolve(
             double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
             double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
@@ -47,7 +47,8 @@ namespace Nektar
 
     AverageSolver::AverageSolver() : CompressibleSolver()
     {
-        m_pointSolve = false;
+        m_pointSolve       = false;
+        m_requiresRotation = true;
     }
 
     /**
@@ -40,7 +40,10 @@ namespace Nektar
     CompressibleSolver::CompressibleSolver() : RiemannSolver(),
                                                m_pointSolve(true)
     {
-        m_requiresRotation = true;
+        // Point solvers rotate to and from the trace normal frame themselves
+        // in BatchPointSolve; array solvers request the rotation from
+        // RiemannSolver::Solve.
+        m_requiresRotation = false;
     }
 
     void CompressibleSolver::v_Solve(
@@ -50,39 +53,7 @@ namespace Nektar
     {
         if (m_pointSolve)
         {
-            int expDim = Fwd.num_elements()-2;
-            NekDouble rhouf, rhovf;
-
-            if (expDim == 1)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], 0.0,   0.0,   Fwd [2][i],
-                        Bwd [0][i], Bwd [1][i], 0.0,   0.0,   Bwd [2][i],
-                        flux[0][i], flux[1][i], rhouf, rhovf, flux[2][i]);
-                }
-            }
-            else if (expDim == 2)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], Fwd [2][i], 0.0,   Fwd [3][i],
-                        Bwd [0][i], Bwd [1][i], Bwd [2][i], 0.0,   Bwd [3][i],
-                        flux[0][i], flux[1][i], flux[2][i], rhovf, flux[3][i]);
-                }
-            }
-            else if (expDim == 3)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], Fwd [2][i], Fwd [3][i], Fwd [4][i],
-                        Bwd [0][i], Bwd [1][i], Bwd [2][i], Bwd [3][i], Bwd [4][i],
-                        flux[0][i], flux[1][i], flux[2][i], flux[3][i], flux[4][i]);
-                }
-            }
+            v_BatchSolve(Fwd, Bwd, flux);
         }
         else
         {
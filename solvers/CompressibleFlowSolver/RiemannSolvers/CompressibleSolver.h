@@ -62,6 +62,16 @@ namespace Nektar
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
 
+        /// Solve at all trace points; point solvers instantiate
+        /// BatchPointSolve here so that v_PointSolve is inlined.
+        virtual void v_BatchSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux)
+        {
+            ASSERTL0(false, "This function should be defined by subclasses.");
+        }
+
         virtual void v_PointSolve(
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER,
@@ -69,7 +79,119 @@ namespace Nektar
         {
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
+
+        template <class SolverType>
+        void BatchPointSolve(
+                  SolverType                                 *solver,
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
     };
+
+    /**
+     * @brief Solve the Riemann problem at every trace point using the point
+     * solver of @a SolverType.
+     *
+     * The momentum of each point is rotated into the frame of the trace
+     * normal, solved and rotated back within the same loop, so the states
+     * are read and the fluxes written in a single pass over contiguous
+     * arrays. The point solver is called non-virtually so that it can be
+     * inlined into the loop; this should therefore be instantiated in the
+     * translation unit which defines SolverType::v_PointSolve.
+     */
+    template <class SolverType>
+    void CompressibleSolver::BatchPointSolve(
+              SolverType                                 *solver,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const Array<OneD, const Array<OneD, NekDouble> > &normals =
+            m_vectors["N"]();
+
+        const int expDim = Fwd.num_elements()-2;
+        const int nPts   = Fwd[0].num_elements();
+        NekDouble uL, vL, wL, uR, vR, wR, uf, vf, wf;
+        int i;
+
+        // Raw pointers to the contiguous trace arrays of each field.
+        const NekDouble *fw[5], *bw[5];
+        NekDouble       *fl[5];
+        for (i = 0; i < expDim+2; ++i)
+        {
+            fw[i] = Fwd [i].get();
+            bw[i] = Bwd [i].get();
+            fl[i] = flux[i].get();
+        }
+
+        if (expDim == 1)
+        {
+            const NekDouble *nx = normals[0].get();
+
+            for (i = 0; i < nPts; ++i)
+            {
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], nx[i]*fw[1][i], 0.0, 0.0, fw[2][i],
+                    bw[0][i], nx[i]*bw[1][i], 0.0, 0.0, bw[2][i],
+                    fl[0][i], uf,             vf,  wf,  fl[2][i]);
+
+                fl[1][i] = nx[i]*uf;
+            }
+        }
+        else if (expDim == 2)
+        {
+            const NekDouble *nx = normals[0].get();
+            const NekDouble *ny = normals[1].get();
+
+            for (i = 0; i < nPts; ++i)
+            {
+                uL =  nx[i]*fw[1][i] + ny[i]*fw[2][i];
+                vL = -ny[i]*fw[1][i] + nx[i]*fw[2][i];
+                uR =  nx[i]*bw[1][i] + ny[i]*bw[2][i];
+                vR = -ny[i]*bw[1][i] + nx[i]*bw[2][i];
+
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], uL, vL, 0.0, fw[3][i],
+                    bw[0][i], uR, vR, 0.0, bw[3][i],
+                    fl[0][i], uf, vf, wf,  fl[3][i]);
+
+                fl[1][i] = nx[i]*uf - ny[i]*vf;
+                fl[2][i] = ny[i]*uf + nx[i]*vf;
+            }
+        }
+        else if (expDim == 3)
+        {
+            if (m_rotMat.num_elements() == 0)
+            {
+                GenerateRotationMatrices(normals);
+            }
+
+            const NekDouble *R[9];
+            for (i = 0; i < 9; ++i)
+            {
+                R[i] = m_rotMat[i].get();
+            }
+
+            for (i = 0; i < nPts; ++i)
+            {
+                uL = R[0][i]*fw[1][i] + R[1][i]*fw[2][i] + R[2][i]*fw[3][i];
+                vL = R[3][i]*fw[1][i] + R[4][i]*fw[2][i] + R[5][i]*fw[3][i];
+                wL = R[6][i]*fw[1][i] + R[7][i]*fw[2][i] + R[8][i]*fw[3][i];
+                uR = R[0][i]*bw[1][i] + R[1][i]*bw[2][i] + R[2][i]*bw[3][i];
+                vR = R[3][i]*bw[1][i] + R[4][i]*bw[2][i] + R[5][i]*bw[3][i];
+                wR = R[6][i]*bw[1][i] + R[7][i]*bw[2][i] + R[8][i]*bw[3][i];
+
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], uL, vL, wL, fw[4][i],
+                    bw[0][i], uR, vR, wR, bw[4][i],
+                    fl[0][i], uf, vf, wf, fl[4][i]);
+
+                fl[1][i] = R[0][i]*uf + R[3][i]*vf + R[6][i]*wf;
+                fl[2][i] = R[1][i]*uf + R[4][i]*vf + R[7][i]*wf;
+                fl[3][i] = R[2][i]*uf + R[5][i]*vf + R[8][i]*wf;
+            }
+        }
+    }
 }
 
 #endif
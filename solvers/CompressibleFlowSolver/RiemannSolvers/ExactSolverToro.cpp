@@ -389,4 +389,12 @@ namespace Nektar
         Ef    = outU*(outP/(gamma-1.0) + 0.5*outRho*
                       (outU*outU + outV*outV + outW*outW) + outP);
     }
+
+    void ExactSolverToro::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
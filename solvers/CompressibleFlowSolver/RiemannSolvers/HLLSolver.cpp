@@ -143,4 +143,12 @@ namespace Nektar
                      tmp2 * (ER - EL)) * tmp1;
         }
     }
+
+    void HLLSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
@@ -138,4 +138,12 @@ namespace Nektar
         Ef    = 0.5 * ((uL * (EL + pL) + uR * (ER + pR)) - 
                         sign * S * (ER - EL));
     }
+
+    void LaxFriedrichsSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
@@ -0,0 +1,55 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Consistency of the 3D Riemann solvers with equal states</description>
+    <executable>TimingRiemannSolvers</executable>
+    <parameters>3 1000 1</parameters>
+    <metrics>
+        <metric type="Regex" id="1">
+            <regex>
+                ^\s*(\w+) consistency error:\s*([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)
+            </regex>
+            <matches>
+                <match>
+                    <field>Average</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>LaxFriedrichs</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>Roe</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>HLL</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>HLLC</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>AUSM0</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>AUSM1</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>AUSM2</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>AUSM3</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+                <match>
+                    <field>ExactToro</field>
+                    <field tolerance="1e-12">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
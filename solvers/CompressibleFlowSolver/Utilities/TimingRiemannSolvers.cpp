@@ -0,0 +1,304 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File TimingRiemannSolvers.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Measures the throughput, in trace points per second, of each
+// of the compressible Riemann solvers on random states, and checks that each
+// solver is consistent with the exact Euler flux when both states agree.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <SolverUtils/RiemannSolvers/RiemannSolver.h>
+
+using namespace std;
+using namespace Nektar;
+using namespace Nektar::SolverUtils;
+
+/**
+ * @brief Provides the parameters, normals and velocity locations usually
+ * supplied by CompressibleFlowSystem to the Riemann solvers.
+ */
+class RiemannSetup
+{
+public:
+    RiemannSetup(const int nDim, const int nPts)
+        : m_gamma  (1.4),
+          m_velLoc (nDim),
+          m_normals(nDim)
+    {
+        int i;
+
+        for (i = 0; i < nDim; ++i)
+        {
+            m_velLoc[i] = i+1;
+        }
+
+        for (i = 0; i < nDim; ++i)
+        {
+            m_normals[i] = Array<OneD, NekDouble>(nPts, 0.0);
+        }
+
+        // Random unit normals.
+        for (i = 0; i < nPts; ++i)
+        {
+            NekDouble mag = 0.0;
+            for (int j = 0; j < nDim; ++j)
+            {
+                m_normals[j][i] = 2.0*rand()/RAND_MAX - 1.0 + 1e-3;
+                mag += m_normals[j][i]*m_normals[j][i];
+            }
+            mag = sqrt(mag);
+            for (int j = 0; j < nDim; ++j)
+            {
+                m_normals[j][i] /= mag;
+            }
+        }
+    }
+
+    NekDouble GetGamma()
+    {
+        return m_gamma;
+    }
+
+    const Array<OneD, NekDouble> &GetVelLoc()
+    {
+        return m_velLoc;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetNormals()
+    {
+        return m_normals;
+    }
+
+private:
+    NekDouble                                m_gamma;
+    Array<OneD, NekDouble>                   m_velLoc;
+    Array<OneD, Array<OneD, NekDouble> >     m_normals;
+};
+
+/**
+ * @brief Fill @a u with random conservative states of positive density and
+ * pressure.
+ */
+void RandomState(
+    const int                                   nDim,
+    const NekDouble                             gamma,
+          Array<OneD, Array<OneD, NekDouble> > &u)
+{
+    const int nPts = u[0].num_elements();
+
+    for (int i = 0; i < nPts; ++i)
+    {
+        NekDouble rho = 0.5 + 1.0*rand()/RAND_MAX;
+        NekDouble p   = 0.5 + 1.0*rand()/RAND_MAX;
+        NekDouble ke  = 0.0;
+
+        u[0][i] = rho;
+        for (int j = 0; j < nDim; ++j)
+        {
+            NekDouble vel = 0.5*(2.0*rand()/RAND_MAX - 1.0);
+            u[j+1][i]  = rho*vel;
+            ke        += 0.5*rho*vel*vel;
+        }
+        u[nDim+1][i] = p/(gamma-1.0) + ke;
+    }
+}
+
+/**
+ * @brief Compute the largest difference between @a flux and the exact
+ * normal Euler flux of the state @a u.
+ */
+NekDouble ConsistencyError(
+    const int                                         nDim,
+    const NekDouble                                   gamma,
+    const Array<OneD, const Array<OneD, NekDouble> > &normals,
+    const Array<OneD, const Array<OneD, NekDouble> > &u,
+    const Array<OneD, const Array<OneD, NekDouble> > &flux)
+{
+    const int nPts  = u[0].num_elements();
+    NekDouble error = 0.0;
+
+    for (int i = 0; i < nPts; ++i)
+    {
+        NekDouble rho = u[0][i];
+        NekDouble vn  = 0.0;
+        NekDouble ke  = 0.0;
+
+        for (int j = 0; j < nDim; ++j)
+        {
+            vn += u[j+1][i]*normals[j][i]/rho;
+            ke += 0.5*u[j+1][i]*u[j+1][i]/rho;
+        }
+
+        NekDouble p = (gamma-1.0)*(u[nDim+1][i] - ke);
+
+        error = max(error, fabs(flux[0][i] - rho*vn));
+        for (int j = 0; j < nDim; ++j)
+        {
+            error = max(error, fabs(flux[j+1][i] -
+                                    u[j+1][i]*vn - p*normals[j][i]));
+        }
+        error = max(error, fabs(flux[nDim+1][i] - (u[nDim+1][i] + p)*vn));
+    }
+
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 4)
+    {
+        fprintf(stderr, "Usage: TimingRiemannSolvers [dim] [npoints] "
+                        "[nrepeats]\n");
+        exit(1);
+    }
+
+    const int nDim  = argc > 1 ? atoi(argv[1]) : 3;
+    const int nPts  = argc > 2 ? atoi(argv[2]) : 100000;
+    const int nReps = argc > 3 ? atoi(argv[3]) : 20;
+
+    if (nDim < 1 || nDim > 3 || nPts < 1 || nReps < 1)
+    {
+        fprintf(stderr, "Dimension must be 1, 2 or 3; number of points and "
+                        "repeats must be positive.\n");
+        exit(1);
+    }
+
+    srand(1);
+
+    RiemannSetup setup(nDim, nPts);
+
+    const int nVar = nDim + 2;
+    Array<OneD, Array<OneD, NekDouble> > Fwd (nVar);
+    Array<OneD, Array<OneD, NekDouble> > Bwd (nVar);
+    Array<OneD, Array<OneD, NekDouble> > flux(nVar);
+
+    for (int i = 0; i < nVar; ++i)
+    {
+        Fwd [i] = Array<OneD, NekDouble>(nPts);
+        Bwd [i] = Array<OneD, NekDouble>(nPts);
+        flux[i] = Array<OneD, NekDouble>(nPts);
+    }
+
+    RandomState(nDim, setup.GetGamma(), Fwd);
+    RandomState(nDim, setup.GetGamma(), Bwd);
+
+    vector<string> names;
+    names.push_back("Average");
+    names.push_back("LaxFriedrichs");
+    names.push_back("Roe");
+    names.push_back("HLL");
+    names.push_back("HLLC");
+    names.push_back("AUSM0");
+    names.push_back("AUSM1");
+    names.push_back("AUSM2");
+    names.push_back("AUSM3");
+    names.push_back("ExactToro");
+
+    Timer timer;
+
+    cout << "Riemann solver throughput: dimension " << nDim << ", "
+         << nPts << " points, " << nReps << " repeats" << endl;
+
+    for (int n = 0; n < names.size(); ++n)
+    {
+        if (!GetRiemannSolverFactory().ModuleExists(names[n]))
+        {
+            continue;
+        }
+
+        RiemannSolverSharedPtr solver =
+            GetRiemannSolverFactory().CreateInstance(names[n]);
+
+        solver->SetParam    (
+            "gamma",  &RiemannSetup::GetGamma,   &setup);
+        solver->SetAuxiliary(
+            "velLoc", &RiemannSetup::GetVelLoc,  &setup);
+        solver->SetVector   (
+            "N",      &RiemannSetup::GetNormals, &setup);
+
+        // Warm up and generate any rotation matrices outside the timing.
+        solver->Solve(Fwd, Bwd, flux);
+
+        timer.Start();
+        for (int r = 0; r < nReps; ++r)
+        {
+            solver->Solve(Fwd, Bwd, flux);
+        }
+        timer.Stop();
+
+        NekDouble elapsed = timer.TimePerTest(nReps);
+
+        cout << "  " << names[n] << ": "
+             << nPts/elapsed << " points/s" << endl;
+    }
+
+    // With equal left and right states every solver must return the exact
+    // flux, which exercises the rotation to and from the trace normal.
+    cout << "Riemann solver consistency with equal states:" << endl;
+
+    for (int n = 0; n < names.size(); ++n)
+    {
+        if (!GetRiemannSolverFactory().ModuleExists(names[n]))
+        {
+            continue;
+        }
+
+        RiemannSolverSharedPtr solver =
+            GetRiemannSolverFactory().CreateInstance(names[n]);
+
+        solver->SetParam    (
+            "gamma",  &RiemannSetup::GetGamma,   &setup);
+        solver->SetAuxiliary(
+            "velLoc", &RiemannSetup::GetVelLoc,  &setup);
+        solver->SetVector   (
+            "N",      &RiemannSetup::GetNormals, &setup);
+
+        solver->Solve(Fwd, Fwd, flux);
+
+        NekDouble error = ConsistencyError(
+            nDim, setup.GetGamma(), setup.GetNormals(), Fwd, flux);
+
+        cout << "  " << names[n] << " consistency error: "
+             << error << endl;
+    }
+
+    return 0;
+}
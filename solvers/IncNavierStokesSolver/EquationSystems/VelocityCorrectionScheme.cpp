@@ -341,11 +341,20 @@ namespace Nektar
             factors[StdRegions::eFactorSVVDiffCoeff]   = m_sVVDiffCoeff/m_kinvis;
         }
 
-        // Solve Helmholtz system and put in Physical space
+        // Solve Helmholtz systems of all velocity components together
+        // and put in Physical space
+        Array<OneD, MultiRegions::ExpListSharedPtr> vel(m_nConvectiveFields);
+        Array<OneD, Array<OneD, NekDouble> > velCoeffs(m_nConvectiveFields);
+        for(i = 0; i < m_nConvectiveFields; ++i)
+        {
+            vel[i]       = m_fields[i];
+            velCoeffs[i] = m_fields[i]->UpdateCoeffs();
+        }
+
+        m_fields[0]->MultiHelmSolve(vel, F, velCoeffs, NullFlagList, factors);
+
         for(i = 0; i < m_nConvectiveFields; ++i)
         {
-            m_fields[i]->HelmSolve(F[i], m_fields[i]->UpdateCoeffs(),
-                                   NullFlagList, factors);
             m_fields[i]->BwdTrans(m_fields[i]->GetCoeffs(),outarray[i]);
         }
     }
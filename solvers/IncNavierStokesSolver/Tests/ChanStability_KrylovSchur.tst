@@ -0,0 +1,34 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Linear stability (Krylov-Schur): Channel</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>-I Driver=KrylovSchur ChanStability.xml</parameters>
+    <files>
+        <file description="Session File">ChanStability.xml</file>
+        <file description="Session File">ChanStability.bse</file>
+        <file description="Session File">ChanStability.rst</file>
+    </files>
+    <metrics>
+        <metric type="Regex" id="1">
+            <regex>
+                ^\s*([0-9])\s+([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)\s+([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)\s+([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)\s+([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)\s*$
+            </regex>
+            <matches>
+                <match>
+                    <field>0</field>
+                    <field tolerance="1e-05">1.00031</field>
+                    <field tolerance="1e-05">0.0349848</field>
+                    <field tolerance="1e-04">0.00223497</field>
+                    <field tolerance="1e-04">0.249892</field>
+                </match>
+                <match>
+                    <field>1</field>
+                    <field tolerance="1e-05">1.00031</field>
+                    <field tolerance="1e-05">-0.0349848</field>
+                    <field tolerance="1e-04">0.00223497</field>
+                    <field tolerance="1e-04">-0.249892</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
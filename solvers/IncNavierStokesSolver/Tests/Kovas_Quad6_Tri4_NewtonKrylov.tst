@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Steady Kovasznay flow by Newton-Krylov on the velocity correction time stepper, mixed elements P=7</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>Kovas_Quad6_Tri4_NewtonKrylov.xml</parameters>
+    <files>
+        <file description="Session File">Kovas_Quad6_Tri4_NewtonKrylov.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-3">0.000529867</value>
+            <value variable="v" tolerance="1e-3">0.000172531</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-3">0.00074911</value>
+            <value variable="v" tolerance="1e-3">0.000353995</value>
+        </metric>
+    </metrics>
+</test>
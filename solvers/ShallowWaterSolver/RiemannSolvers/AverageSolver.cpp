@@ -83,4 +83,12 @@ namespace Nektar
 		     (uR * uR * hR + 0.5 * g * hR * hR));
 	hvf = 0.5 * (hL * uL * vL + hR * uR * vR);
     }
+
+    void AverageSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
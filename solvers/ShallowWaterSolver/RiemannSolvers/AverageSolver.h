@@ -54,8 +54,15 @@ namespace Nektar
         static std::string solverName;
         
     protected:
+        friend class NonlinearSWESolver;
+
         AverageSolver();
         
+        virtual void v_BatchSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
+
         virtual void v_PointSolve(
             double  hL, double  huL, double  hvL,
             double  hR, double  huR, double  hvR,
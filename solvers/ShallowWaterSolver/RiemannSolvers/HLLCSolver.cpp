@@ -141,4 +141,12 @@ namespace Nektar
 	    ASSERTL0(false,"Error in HLLC solver -- non physical combination of SR, SL and Sstar");
 	  }
     }
+
+    void HLLCSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
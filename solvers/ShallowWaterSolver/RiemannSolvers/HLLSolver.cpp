@@ -127,4 +127,12 @@ namespace Nektar
 		  SL * SR * (hR * vR - hL * vL)) / (SR - SL);
 	  }
     }
+
+    void HLLSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
@@ -76,4 +76,12 @@ namespace Nektar
 	uf    = 0.5 * (g * etaL + g * etaR);
 	vf    = 0.0;
     }
+
+    void LinearAverageSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
@@ -53,8 +53,15 @@ namespace Nektar
         static std::string solverName;
         
     protected:
+        friend class LinearSWESolver;
+
         LinearAverageSolver();
         
+        virtual void v_BatchSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
+
         virtual void v_PointSolve(
 				  double  etaL, double  uL, double  vL, double dL,
 				  double  etaR, double  uR, double  vR, double dR,
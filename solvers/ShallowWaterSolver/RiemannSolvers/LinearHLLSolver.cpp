@@ -104,4 +104,12 @@ namespace Nektar
 	    vf  = (SL * SR * (vR - vL)) / (SR - SL);
 	  }
     }
+
+    void LinearHLLSolver::v_BatchSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        BatchPointSolve(this, Fwd, Bwd, flux);
+    }
 }
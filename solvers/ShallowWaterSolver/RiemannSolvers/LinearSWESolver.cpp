@@ -40,8 +40,10 @@ namespace Nektar
     LinearSWESolver::LinearSWESolver() : RiemannSolver(),
                                                m_pointSolve(true)
     {
-        m_requiresRotation = true;
-
+        // Point solvers rotate to and from the trace normal frame themselves
+        // in BatchPointSolve; array solvers should request the rotation from
+        // RiemannSolver::Solve.
+        m_requiresRotation = false;
     }
 
     void  LinearSWESolver::v_Solve(
@@ -49,42 +51,9 @@ namespace Nektar
         const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
               Array<OneD,       Array<OneD, NekDouble> > &flux)
     {
-
-	// extract the forward and backward trace of the depth
-  	const Array<OneD, NekDouble> &dFwd = m_scalars["depthFwd"]();
- 	const Array<OneD, NekDouble> &dBwd = m_scalars["depthBwd"]();
-
-
         if (m_pointSolve)
         {
-	  	  
-            int expDim = Fwd.num_elements()-1;
-            NekDouble vf;
-
-            if (expDim == 1)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-                    v_PointSolve(
-			Fwd [0][i], Fwd [1][i], 0.0, dFwd[i], 
-		  	Bwd [0][i], Bwd [1][i], 0.0, dBwd[i],
-                        flux[0][i], flux[1][i], vf);
-                }
-            }
-            else if (expDim == 2)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-		  v_PointSolve(
-			Fwd [0][i], Fwd [1][i], Fwd [2][i], dFwd[i],
-			Bwd [0][i], Bwd [1][i], Bwd [2][i], dBwd[i],
-                        flux[0][i], flux[1][i], flux[2][i]);
-                }
-            }
-            else if (expDim == 3)
-            {
-	      ASSERTL0(false, "No 3D Shallow water supported.");
-	    }
+            v_BatchSolve(Fwd, Bwd, flux);
         }
         else
         {
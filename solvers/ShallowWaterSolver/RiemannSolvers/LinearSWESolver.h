@@ -62,6 +62,16 @@ namespace Nektar
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
 
+        /// Solve at all trace points; point solvers instantiate
+        /// BatchPointSolve here so that v_PointSolve is inlined.
+        virtual void v_BatchSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux)
+        {
+            ASSERTL0(false, "This function should be defined by subclasses.");
+        }
+
         virtual void v_PointSolve(
 	    NekDouble  etaL, NekDouble  uL, NekDouble  vL, NekDouble dL,
             NekDouble  etaR, NekDouble  uR, NekDouble  vR, NekDouble dR,
@@ -69,7 +79,87 @@ namespace Nektar
         {
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
+
+        template <class SolverType>
+        void BatchPointSolve(
+                  SolverType                                 *solver,
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
     };
+
+    /**
+     * @brief Solve the Riemann problem at every trace point using the point
+     * solver of @a SolverType, rotating the velocity to and from the trace
+     * normal frame within the same loop. The point solver is called
+     * non-virtually so that it can be inlined.
+     */
+    template <class SolverType>
+    void LinearSWESolver::BatchPointSolve(
+              SolverType                                 *solver,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const Array<OneD, const Array<OneD, NekDouble> > &normals =
+            m_vectors["N"]();
+
+        // extract the forward and backward trace of the depth
+        const NekDouble *dFwd = m_scalars["depthFwd"]().get();
+        const NekDouble *dBwd = m_scalars["depthBwd"]().get();
+
+        const int expDim = Fwd.num_elements()-1;
+        const int nPts   = Fwd[0].num_elements();
+        NekDouble uL, vL, uR, vR, uf, vf;
+        int i;
+
+        ASSERTL0(expDim == 1 || expDim == 2,
+                 "Only 1D and 2D shallow water supported.");
+
+        const NekDouble *fw[3], *bw[3];
+        NekDouble       *fl[3];
+        for (i = 0; i < expDim+1; ++i)
+        {
+            fw[i] = Fwd [i].get();
+            bw[i] = Bwd [i].get();
+            fl[i] = flux[i].get();
+        }
+
+        const NekDouble *nx = normals[0].get();
+
+        if (expDim == 1)
+        {
+            for (i = 0; i < nPts; ++i)
+            {
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], nx[i]*fw[1][i], 0.0, dFwd[i],
+                    bw[0][i], nx[i]*bw[1][i], 0.0, dBwd[i],
+                    fl[0][i], uf,             vf);
+
+                fl[1][i] = nx[i]*uf;
+            }
+        }
+        else
+        {
+            const NekDouble *ny = normals[1].get();
+
+            for (i = 0; i < nPts; ++i)
+            {
+                uL =  nx[i]*fw[1][i] + ny[i]*fw[2][i];
+                vL = -ny[i]*fw[1][i] + nx[i]*fw[2][i];
+                uR =  nx[i]*bw[1][i] + ny[i]*bw[2][i];
+                vR = -ny[i]*bw[1][i] + nx[i]*bw[2][i];
+
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], uL, vL, dFwd[i],
+                    bw[0][i], uR, vR, dBwd[i],
+                    fl[0][i], uf, vf);
+
+                fl[1][i] = nx[i]*uf - ny[i]*vf;
+                fl[2][i] = ny[i]*uf + nx[i]*vf;
+            }
+        }
+    }
 }
 
 #endif
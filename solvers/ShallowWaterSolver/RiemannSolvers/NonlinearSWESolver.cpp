@@ -40,7 +40,10 @@ namespace Nektar
     NonlinearSWESolver::NonlinearSWESolver() : RiemannSolver(),
                                                m_pointSolve(true)
     {
-        m_requiresRotation = true;
+        // Point solvers rotate to and from the trace normal frame themselves
+        // in BatchPointSolve; array solvers should request the rotation from
+        // RiemannSolver::Solve.
+        m_requiresRotation = false;
     }
 
     void  NonlinearSWESolver::v_Solve(
@@ -50,33 +53,7 @@ namespace Nektar
     {
         if (m_pointSolve)
         {
-            int expDim = Fwd.num_elements()-1;
-            NekDouble hvf;
-
-            if (expDim == 1)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], 0.0,
-                        Bwd [0][i], Bwd [1][i], 0.0,
-                        flux[0][i], flux[1][i], hvf);
-                }
-            }
-            else if (expDim == 2)
-            {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
-                {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], Fwd [2][i],
-                        Bwd [0][i], Bwd [1][i], Bwd [2][i],
-                        flux[0][i], flux[1][i], flux[2][i]);
-                }
-            }
-            else if (expDim == 3)
-            {
-	      ASSERTL0(false, "No 3D Shallow water supported.");
-	    }
+            v_BatchSolve(Fwd, Bwd, flux);
         }
         else
         {
@@ -62,6 +62,16 @@ namespace Nektar
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
 
+        /// Solve at all trace points; point solvers instantiate
+        /// BatchPointSolve here so that v_PointSolve is inlined.
+        virtual void v_BatchSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux)
+        {
+            ASSERTL0(false, "This function should be defined by subclasses.");
+        }
+
         virtual void v_PointSolve(
             NekDouble  hL, NekDouble  huL, NekDouble  hvL,
             NekDouble  hR, NekDouble  huR, NekDouble  hvR,
@@ -69,7 +79,83 @@ namespace Nektar
         {
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
+
+        template <class SolverType>
+        void BatchPointSolve(
+                  SolverType                                 *solver,
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
     };
+
+    /**
+     * @brief Solve the Riemann problem at every trace point using the point
+     * solver of @a SolverType, rotating the momentum to and from the trace
+     * normal frame within the same loop. The point solver is called
+     * non-virtually so that it can be inlined.
+     */
+    template <class SolverType>
+    void NonlinearSWESolver::BatchPointSolve(
+              SolverType                                 *solver,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const Array<OneD, const Array<OneD, NekDouble> > &normals =
+            m_vectors["N"]();
+
+        const int expDim = Fwd.num_elements()-1;
+        const int nPts   = Fwd[0].num_elements();
+        NekDouble huL, hvL, huR, hvR, huf, hvf;
+        int i;
+
+        ASSERTL0(expDim == 1 || expDim == 2,
+                 "Only 1D and 2D shallow water supported.");
+
+        const NekDouble *fw[3], *bw[3];
+        NekDouble       *fl[3];
+        for (i = 0; i < expDim+1; ++i)
+        {
+            fw[i] = Fwd [i].get();
+            bw[i] = Bwd [i].get();
+            fl[i] = flux[i].get();
+        }
+
+        const NekDouble *nx = normals[0].get();
+
+        if (expDim == 1)
+        {
+            for (i = 0; i < nPts; ++i)
+            {
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], nx[i]*fw[1][i], 0.0,
+                    bw[0][i], nx[i]*bw[1][i], 0.0,
+                    fl[0][i], huf,            hvf);
+
+                fl[1][i] = nx[i]*huf;
+            }
+        }
+        else
+        {
+            const NekDouble *ny = normals[1].get();
+
+            for (i = 0; i < nPts; ++i)
+            {
+                huL =  nx[i]*fw[1][i] + ny[i]*fw[2][i];
+                hvL = -ny[i]*fw[1][i] + nx[i]*fw[2][i];
+                huR =  nx[i]*bw[1][i] + ny[i]*bw[2][i];
+                hvR = -ny[i]*bw[1][i] + nx[i]*bw[2][i];
+
+                solver->SolverType::v_PointSolve(
+                    fw[0][i], huL, hvL,
+                    bw[0][i], huR, hvR,
+                    fl[0][i], huf, hvf);
+
+                fl[1][i] = nx[i]*huf - ny[i]*hvf;
+                fl[2][i] = ny[i]*huf + nx[i]*hvf;
+            }
+        }
+    }
 }
 
 #endif
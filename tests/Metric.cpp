@@ -65,6 +65,11 @@ namespace Nektar
         }
         m_id = atoi(metric->Attribute("id"));
         m_type = boost::to_upper_copy(string(metric->Attribute("type")));
+
+        if (metric->Attribute("file"))
+        {
+            m_file = metric->Attribute("file");
+        }
     }
 
     /**
@@ -58,12 +58,21 @@ namespace Nektar
         bool Test     (std::istream& pStdout, std::istream& pStderr);
         /// Perform the test, given the standard output and error streams
         void Generate (std::istream& pStdout, std::istream& pStderr);
+
+        /// Name of a file written by the test which is tested in place of
+        /// the standard output, or an empty string.
+        const std::string& GetFile() const
+        {
+            return m_file;
+        }
         
     protected:
         /// Stores the ID of this metric.
         int m_id;
         /// Stores the type of this metric (uppercase).
         std::string m_type;
+        /// Stores the file tested in place of the standard output.
+        std::string m_file;
         /// 
         bool m_generate;
         TiXmlElement *m_metric;
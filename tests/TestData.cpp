@@ -71,9 +71,10 @@ namespace Nektar
         return m_description;
     }
 
-    const std::string TestData::GetExecutable() const
+    const std::string TestData::GetExecutable(unsigned int pId) const
     {
-        std::string execname = m_executable;
+        ASSERTL0(pId < m_executables.size(), "Command index out of range.");
+        std::string execname = m_executables[pId];
     #if defined(RELWITHDEBINFO)
         execname += "-rg";
     #elif !defined(NDEBUG)
@@ -82,9 +83,15 @@ namespace Nektar
         return execname;
     }
 
-    const std::string& TestData::GetParameters() const
+    const std::string& TestData::GetParameters(unsigned int pId) const
     {
-        return m_parameters;
+        ASSERTL0(pId < m_parameters.size(), "Command index out of range.");
+        return m_parameters[pId];
+    }
+
+    unsigned int TestData::GetNumCommands() const
+    {
+        return m_executables.size();
     }
 
     const unsigned int& TestData::GetNProcesses() const
@@ -145,15 +152,27 @@ namespace Nektar
         ASSERTL0(tmp, "Cannot find 'description' for test.");
         m_description = string(tmp->GetText());
 
-        // Find executable tag.
+        // Find executable tags. A test may run several commands in turn,
+        // e.g. a solver followed by a post-processing utility.
         tmp = testElement->FirstChildElement("executable");
         ASSERTL0(tmp, "Cannot find 'executable' for test.");
-        m_executable = string(tmp->GetText());
+        while (tmp)
+        {
+            m_executables.push_back(string(tmp->GetText()));
+            tmp = tmp->NextSiblingElement("executable");
+        }
 
-        // Find parameters tag.
+        // Find parameters tags, one for each executable.
         tmp = testElement->FirstChildElement("parameters");
         ASSERTL0(tmp, "Cannot find 'parameters' for test.");
-        m_parameters = string(tmp->GetText());
+        while (tmp)
+        {
+            m_parameters.push_back(tmp->GetText() ?
+                                   string(tmp->GetText()) : string());
+            tmp = tmp->NextSiblingElement("parameters");
+        }
+        ASSERTL0(m_parameters.size() == m_executables.size(),
+                 "Each 'executable' for test needs its 'parameters'.");
 
         // Find parallel processes tah.
         tmp = testElement->FirstChildElement("processes");
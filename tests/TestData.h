@@ -60,8 +60,9 @@ namespace Nektar
         TestData(const TestData& pSrc);
 
         const std::string& GetDescription() const;
-        const std::string  GetExecutable() const;
-        const std::string& GetParameters() const;
+        const std::string  GetExecutable(unsigned int pId = 0) const;
+        const std::string& GetParameters(unsigned int pId = 0) const;
+        unsigned int GetNumCommands() const;
         const unsigned int& GetNProcesses() const;
 
         std::string GetMetricType(unsigned int pId) const;
@@ -77,8 +78,8 @@ namespace Nektar
     private:
         std::string                     m_filename;
         std::string                     m_description;
-        std::string                     m_executable;
-        std::string                     m_parameters;
+        std::vector<std::string>        m_executables;
+        std::vector<std::string>        m_parameters;
         unsigned int                    m_processes;
         TiXmlDocument*                  m_doc;
         std::vector<TiXmlElement*>      m_metrics;
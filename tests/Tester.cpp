@@ -203,35 +203,48 @@ int main(int argc, char *argv[])
             fs::copy_file(source, dest);
         }
 
-        // Construct test command to run. If in debug mode, append "-g"
-        // Output from stdout and stderr are directed to the files output.out
-        // and output.err, respectively.
-        if (file.GetNProcesses() > 1)
+        // Run each command of the test in turn. Output from stdout and
+        // stderr of the last command, against which the metrics are
+        // tested, is directed to the files output.out and output.err,
+        // respectively. That of an earlier command i goes to
+        // output_i.out and output_i.err.
+        for (unsigned int i = 0; i < file.GetNumCommands(); ++i)
         {
-            command += "mpirun -np "
-                    + boost::lexical_cast<string>(file.GetNProcesses())
-                    + " ";
-        }
+            // Construct test command to run. If in debug mode, append "-g"
+            command = "";
+            if (file.GetNProcesses() > 1)
+            {
+                command += "mpirun -np "
+                        + boost::lexical_cast<string>(file.GetNProcesses())
+                        + " ";
+            }
 
-        // If executable doesn't exist in path then hope that it is in the
-        // user's PATH environment variable.
-        fs::path execPath = startDir / fs::path(file.GetExecutable());
-        if (!fs::exists(execPath))
-        {
-            execPath = fs::path(file.GetExecutable());
-        }
+            // If executable doesn't exist in path then hope that it is in
+            // the user's PATH environment variable.
+            fs::path execPath = startDir / fs::path(file.GetExecutable(i));
+            if (!fs::exists(execPath))
+            {
+                execPath = fs::path(file.GetExecutable(i));
+            }
 
-        command += PortablePath(execPath);
-        command += " ";
-        command += file.GetParameters();
-        command += " 1>output.out 2>output.err";
+            string outName = "output";
+            if (i + 1 < file.GetNumCommands())
+            {
+                outName += "_" + boost::lexical_cast<string>(i);
+            }
 
-        // Run executable to perform test.
-        if (system(command.c_str()))
-        {
-            cerr << "Error occurred running test:" << endl;
-            cerr << "Command: " << command << endl;
-            throw 1;
+            command += PortablePath(execPath);
+            command += " ";
+            command += file.GetParameters(i);
+            command += " 1>" + outName + ".out 2>" + outName + ".err";
+
+            // Run executable to perform test.
+            if (system(command.c_str()))
+            {
+                cerr << "Error occurred running test:" << endl;
+                cerr << "Command: " << command << endl;
+                throw 1;
+            }
         }
 
         // Check output files exist
@@ -259,6 +272,25 @@ int main(int argc, char *argv[])
             vStderr.clear();
             vStdout.seekg(0, ios::beg);
             vStderr.seekg(0, ios::beg);
+
+            // A metric with a file attribute tests that file, written by
+            // the test, in place of the standard output.
+            if (!metrics[i]->GetFile().empty())
+            {
+                ifstream vFile(metrics[i]->GetFile().c_str());
+                if (!vFile.good())
+                {
+                    cerr << "Test output file " << metrics[i]->GetFile()
+                         << " is missing or unreadable." << endl;
+                    status = 1;
+                }
+                else if (!metrics[i]->Test(vFile, vStderr))
+                {
+                    status = 1;
+                }
+                continue;
+            }
+
             if (!metrics[i]->Test(vStdout, vStderr))
             {
                 status = 1;
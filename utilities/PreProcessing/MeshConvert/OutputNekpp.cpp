@@ -43,6 +43,7 @@ using namespace std;
 namespace io = boost::iostreams;
 
 #include <tinyxml/tinyxml.h>
+#include <LibUtilities/BasicUtils/CompressData.h>
 
 #include "MeshElements.h"
 #include "OutputNekpp.h"
@@ -60,6 +61,9 @@ namespace Nektar
         {
             m_config["z"] = ConfigOption(true, "0",
                 "Compress output file and append a .gz extension.");
+            m_config["compressed"] = ConfigOption(true, "0",
+                "Write vertex, edge, face, element and curve data in "
+                "compressed binary form.");
         }
 
         OutputNekpp::~OutputNekpp()
@@ -122,6 +126,29 @@ namespace Nektar
             }
         }
 
+        /**
+         * Adds the child @a pTag to @a pSection holding @a pData compressed
+         * and encoded in base64. Nothing is written for empty data.
+         */
+        template<typename T>
+        static void WriteCompressedData(
+            TiXmlElement            *pSection,
+            const std::string       &pTag,
+            const std::vector<T>    &pData)
+        {
+            if (pData.empty())
+            {
+                return;
+            }
+
+            std::string encoded;
+            LibUtilities::CompressData::ZlibEncodeToBase64Str(pData, encoded);
+
+            TiXmlElement *x = new TiXmlElement(pTag);
+            x->LinkEndChild(new TiXmlText(encoded));
+            pSection->LinkEndChild(x);
+        }
+
         void OutputNekpp::WriteXmlNodes(TiXmlElement * pRoot)
         {
             TiXmlElement* verTag = new TiXmlElement( "VERTEX" );
@@ -131,6 +158,27 @@ namespace Nektar
                     m_mesh->m_vertexSet.begin(),
                     m_mesh->m_vertexSet.end());
 
+            if (m_config["compressed"].as<bool>())
+            {
+                vector<int>       ids;
+                vector<NekDouble> coords;
+
+                for (it = tmp.begin(); it != tmp.end(); ++it)
+                {
+                    ids.push_back((*it)->m_id);
+                    coords.push_back((*it)->m_x);
+                    coords.push_back((*it)->m_y);
+                    coords.push_back((*it)->m_z);
+                }
+
+                verTag->SetAttribute("COMPRESSED",
+                    LibUtilities::CompressData::GetCompressString());
+                WriteCompressedData(verTag, "ID", ids);
+                WriteCompressedData(verTag, "X",  coords);
+                pRoot->LinkEndChild(verTag);
+                return;
+            }
+
             for (it = tmp.begin(); it != tmp.end(); ++it)
             {
                 NodeSharedPtr n = *it;
@@ -153,6 +201,23 @@ namespace Nektar
                 std::set<EdgeSharedPtr>::iterator it;
                 std::set<EdgeSharedPtr> tmp(m_mesh->m_edgeSet.begin(),
                                             m_mesh->m_edgeSet.end());
+
+                if (m_config["compressed"].as<bool>())
+                {
+                    vector<int> data;
+                    for (it = tmp.begin(); it != tmp.end(); ++it)
+                    {
+                        data.push_back((*it)->m_id);
+                        data.push_back((*it)->m_n1->m_id);
+                        data.push_back((*it)->m_n2->m_id);
+                    }
+
+                    verTag->SetAttribute("COMPRESSED",
+                        LibUtilities::CompressData::GetCompressString());
+                    WriteCompressedData(verTag, "E", data);
+                    pRoot->LinkEndChild(verTag);
+                    return;
+                }
                 for (it = tmp.begin(); it != tmp.end(); ++it)
                 {
                     EdgeSharedPtr ed = *it;
@@ -178,6 +243,33 @@ namespace Nektar
                         m_mesh->m_faceSet.begin(),
                         m_mesh->m_faceSet.end());
 
+                if (m_config["compressed"].as<bool>())
+                {
+                    map<string, vector<int> > data;
+                    for (it = tmp.begin(); it != tmp.end(); ++it)
+                    {
+                        FaceSharedPtr fa = *it;
+                        ASSERTL0(fa->m_vertexList.size() == 3 ||
+                                 fa->m_vertexList.size() == 4,
+                                 "Unknown face type.");
+
+                        vector<int> &d = data[
+                            fa->m_vertexList.size() == 3 ? "T" : "Q"];
+                        d.push_back(fa->m_id);
+                        for (int j = 0; j < fa->m_edgeList.size(); ++j)
+                        {
+                            d.push_back(fa->m_edgeList[j]->m_id);
+                        }
+                    }
+
+                    verTag->SetAttribute("COMPRESSED",
+                        LibUtilities::CompressData::GetCompressString());
+                    WriteCompressedData(verTag, "T", data["T"]);
+                    WriteCompressedData(verTag, "Q", data["Q"]);
+                    pRoot->LinkEndChild(verTag);
+                    return;
+                }
+
                 for (it = tmp.begin(); it != tmp.end(); ++it)
                 {
                     stringstream s;
@@ -212,6 +304,52 @@ namespace Nektar
             TiXmlElement* verTag = new TiXmlElement( "ELEMENT" );
             vector<ElementSharedPtr> &elmt = m_mesh->m_element[m_mesh->m_expDim];
 
+            // Compressed elements are stored as the element ID followed by
+            // its vertices (1D), edges (2D) or faces (3D), one tag per
+            // element type.
+            if (m_config["compressed"].as<bool>())
+            {
+                map<string, vector<int> > data;
+                for (int i = 0; i < elmt.size(); ++i)
+                {
+                    vector<int> &d = data[elmt[i]->GetTag()];
+                    d.push_back(elmt[i]->GetId());
+
+                    switch (m_mesh->m_expDim)
+                    {
+                        case 1:
+                            for (int j = 0; j < elmt[i]->GetVertexCount(); ++j)
+                            {
+                                d.push_back(elmt[i]->GetVertex(j)->m_id);
+                            }
+                            break;
+                        case 2:
+                            for (int j = 0; j < elmt[i]->GetEdgeCount(); ++j)
+                            {
+                                d.push_back(elmt[i]->GetEdge(j)->m_id);
+                            }
+                            break;
+                        case 3:
+                            for (int j = 0; j < elmt[i]->GetFaceCount(); ++j)
+                            {
+                                d.push_back(elmt[i]->GetFace(j)->m_id);
+                            }
+                            break;
+                    }
+                }
+
+                verTag->SetAttribute("COMPRESSED",
+                    LibUtilities::CompressData::GetCompressString());
+
+                map<string, vector<int> >::iterator it;
+                for (it = data.begin(); it != data.end(); ++it)
+                {
+                    WriteCompressedData(verTag, it->first, it->second);
+                }
+                pRoot->LinkEndChild(verTag);
+                return;
+            }
+
             for(int i = 0; i < elmt.size(); ++i)
             {
                 TiXmlElement *elm_tag = new TiXmlElement(elmt[i]->GetTag());
@@ -222,6 +360,39 @@ namespace Nektar
             pRoot->LinkEndChild(verTag);
         }
 
+        /**
+         * Appends the record (ID, entity ID, NUMPOINTS, points type, number
+         * of coordinate triples) of a curve to @a pInfo and its coordinates
+         * to @a pPoints. The coordinates are read back from the text form
+         * of the curve, so both forms store the same values.
+         */
+        static void AddCompressedCurve(
+            const int                pId,
+            const int                pEntityId,
+            const int                pNumPoints,
+            const int                pType,
+            const std::string       &pCurveStr,
+            std::vector<int>        &pInfo,
+            std::vector<NekDouble>  &pPoints)
+        {
+            std::istringstream s(pCurveStr);
+            NekDouble          x;
+            int                n = pPoints.size();
+
+            while (s >> x)
+            {
+                pPoints.push_back(x);
+            }
+            ASSERTL0((pPoints.size() - n) % 3 == 0,
+                     "Curve coordinates are not a whole number of points.");
+
+            pInfo.push_back(pId);
+            pInfo.push_back(pEntityId);
+            pInfo.push_back(pNumPoints);
+            pInfo.push_back(pType);
+            pInfo.push_back((pPoints.size() - n) / 3);
+        }
+
         void OutputNekpp::WriteXmlCurves(TiXmlElement * pRoot)
         {
             int edgecnt = 0;
@@ -240,9 +411,21 @@ namespace Nektar
 
             TiXmlElement * curved = new TiXmlElement ("CURVED" );
 
+            bool compressed = m_config["compressed"].as<bool>();
+            vector<int>       edgeInfo,   faceInfo;
+            vector<NekDouble> edgePoints, facePoints;
+
             for (it = m_mesh->m_edgeSet.begin(); it != m_mesh->m_edgeSet.end(); ++it)
             {
-                if ((*it)->m_edgeNodes.size() > 0)
+                if ((*it)->m_edgeNodes.size() > 0 && compressed)
+                {
+                    AddCompressedCurve(edgecnt++, (*it)->m_id,
+                                       (*it)->GetNodeCount(),
+                                       (*it)->m_curveType,
+                                       (*it)->GetXmlCurveString(),
+                                       edgeInfo, edgePoints);
+                }
+                else if ((*it)->m_edgeNodes.size() > 0)
                 {
                     TiXmlElement * e = new TiXmlElement( "E" );
                     e->SetAttribute("ID",        edgecnt++);
@@ -266,7 +449,15 @@ namespace Nektar
                      it != m_mesh->m_element[m_mesh->m_expDim].end(); ++it)
                 {
                     // Only generate face curve if there are volume nodes
-                    if ((*it)->GetVolumeNodes().size() > 0)
+                    if ((*it)->GetVolumeNodes().size() > 0 && compressed)
+                    {
+                        AddCompressedCurve(facecnt++, (*it)->GetId(),
+                                           (*it)->GetNodeCount(),
+                                           (*it)->GetCurveType(),
+                                           (*it)->GetXmlCurveString(),
+                                           faceInfo, facePoints);
+                    }
+                    else if ((*it)->GetVolumeNodes().size() > 0)
                     {
                         TiXmlElement * e = new TiXmlElement( "F" );
                         e->SetAttribute("ID",        facecnt++);
@@ -286,7 +477,15 @@ namespace Nektar
                 FaceSet::iterator it2;
                 for (it2 = m_mesh->m_faceSet.begin(); it2 != m_mesh->m_faceSet.end(); ++it2)
                 {
-                    if ((*it2)->m_faceNodes.size() > 0)
+                    if ((*it2)->m_faceNodes.size() > 0 && compressed)
+                    {
+                        AddCompressedCurve(facecnt++, (*it2)->m_id,
+                                           (*it2)->GetNodeCount(),
+                                           (*it2)->m_curveType,
+                                           (*it2)->GetXmlCurveString(),
+                                           faceInfo, facePoints);
+                    }
+                    else if ((*it2)->m_faceNodes.size() > 0)
                     {
                         TiXmlElement * f = new TiXmlElement( "F" );
                         f->SetAttribute("ID",       facecnt++);
@@ -301,6 +500,16 @@ namespace Nektar
                 }
             }
 
+            if (compressed)
+            {
+                curved->SetAttribute("COMPRESSED",
+                    LibUtilities::CompressData::GetCompressString());
+                WriteCompressedData(curved, "E",       edgeInfo);
+                WriteCompressedData(curved, "EPOINTS", edgePoints);
+                WriteCompressedData(curved, "F",       faceInfo);
+                WriteCompressedData(curved, "FPOINTS", facePoints);
+            }
+
             pRoot->LinkEndChild( curved );
         }
 